@@ -0,0 +1,716 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Buttons woken by EXTI edge. The line of a button is masked
+ *              from its first edge until the button is idle again, debounce
+ *              and hold timing run on scan timer in the meantime. With no
+ *              button active, nothing runs except idle poll of buttons
+ *              sharing an EXTI line
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include "stm32f401re.h"
+#include "stm32f401re_rcc.h"
+#include "stm32f401re_gpio.h"
+#include "stm32f401re_exti.h"
+#include "stm32f401re_syscfg.h"
+#include "misc.h"
+#include "utilities.h"
+#include "timer.h"
+#include "buttonexti.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define BUTTON_ALL                          ((1u << BUTTON_MAX) - 1)
+#define BUTTON_HOLD_STEPS                   4u
+
+/* Pin of a button. EXTI_LineN has same value as GPIO_Pin_N */
+typedef struct {
+    GPIO_TypeDef *pGpio;
+    uint16_t wPin;
+    uint32_t dwClock;
+    uint8_t byPortSource;
+    uint8_t byPinSource;
+    IRQn_Type irq;
+} button_pin_t;
+
+typedef struct {
+    uint32_t dwTick;         /* Last debounced change */
+    uint32_t dwEdge;         /* First edge of change being debounced */
+    uint8_t byMode;          /* key_type_t */
+    uint8_t bPressed;        /* Debounced state */
+    uint8_t bEdge;           /* dwEdge is set */
+    uint8_t byCount;         /* Samples differing from bPressed */
+    uint8_t byPress;         /* Short presses waiting for next one */
+    uint8_t byHold;          /* Hold events sent */
+} button_state_t;
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+/* Same pins as BUTTON_xxx_PIN. Kit 2 and kit 4 both use line 4, kit 4 is
+ * polled when idle */
+static const button_pin_t g_pPin[BUTTON_MAX] = {
+    { GPIOC, GPIO_Pin_13, RCC_AHB1Periph_GPIOC, EXTI_PortSourceGPIOC, EXTI_PinSource13, EXTI15_10_IRQn },
+    { GPIOB, GPIO_Pin_5,  RCC_AHB1Periph_GPIOB, EXTI_PortSourceGPIOB, EXTI_PinSource5,  EXTI9_5_IRQn },
+    { GPIOB, GPIO_Pin_3,  RCC_AHB1Periph_GPIOB, EXTI_PortSourceGPIOB, EXTI_PinSource3,  EXTI3_IRQn },
+    { GPIOA, GPIO_Pin_4,  RCC_AHB1Periph_GPIOA, EXTI_PortSourceGPIOA, EXTI_PinSource4,  EXTI4_IRQn },
+    { GPIOB, GPIO_Pin_0,  RCC_AHB1Periph_GPIOB, EXTI_PortSourceGPIOB, EXTI_PinSource0,  EXTI0_IRQn },
+    { GPIOB, GPIO_Pin_4,  RCC_AHB1Periph_GPIOB, EXTI_PortSourceGPIOB, EXTI_PinSource4,  EXTI4_IRQn },
+};
+
+static const uint16_t g_pwHold[BUTTON_HOLD_STEPS] = {
+    KEY_TIME_HOLD1S, KEY_TIME_HOLD3S, KEY_TIME_HOLD5S, KEY_TIME_HOLD10S
+};
+
+static button_state_t g_pState[BUTTON_MAX];
+static button_event_callback g_pCallback[BUTTON_EVENT_MAXIMUM];
+
+static uint8_t g_byExti;                    /* Buttons owning their EXTI line */
+static uint8_t g_byActive;                  /* Buttons scanned */
+static volatile uint8_t g_byWake;           /* Written by interrupt */
+static volatile uint32_t g_pdwWakeTick[BUTTON_MAX];
+
+static uint8_t g_byScanTimer = NO_TIMER;
+static uint8_t g_byPollTimer = NO_TIMER;
+
+static button_stat_t g_stat;                /* dwWake is g_dwWake */
+static volatile uint32_t g_dwWake;          /* Written by interrupt */
+static uint32_t g_dwStatStart;
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static void ButtonExti_GpioConfig(void);
+static void ButtonExti_ExtiConfig(void);
+static uint8_t ButtonExti_IsPressed(uint8_t byId);
+static void ButtonExti_PollPins(uint32_t dwTick);
+static void ButtonExti_StartScan(void);
+static void ButtonExti_StartPoll(void);
+static void ButtonExti_Scan(void *pData);
+static void ButtonExti_Poll(void *pData);
+static uint8_t ButtonExti_ScanButton(uint8_t byId, uint32_t dwTick);
+static void ButtonExti_Release(uint8_t byId, uint32_t dwTick);
+static void ButtonExti_Sleep(uint8_t byId);
+static void ButtonExti_Notify(button_event_t event, uint8_t byId, uint16_t wTime);
+static void ButtonExti_IrqHandler(void);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func   ButtonExti_Init
+ * @brief  Initialize pins and EXTI lines of buttons, all in logic mode. A
+ *         pin whose line is taken by another button is polled when idle
+ * @param  None
+ * @retval None
+ */
+void
+ButtonExti_Init(void)
+{
+    uint8_t i;
+
+    memsetl((uint8_t *)g_pState, 0, sizeof(g_pState));
+    memsetl((uint8_t *)g_pCallback, 0, sizeof(g_pCallback));
+
+    for (i = 0; i < BUTTON_MAX; i++) {
+        g_pState[i].byMode = BUTTON_TYPE_LOGIC;
+    }
+
+    g_byActive = 0;
+    g_byWake = 0;
+
+    ButtonExti_GpioConfig();
+    ButtonExti_ExtiConfig();
+    ButtonExti_ResetStatistic();
+
+    /* A button held at start is debounced as a press */
+    ButtonExti_PollPins(GetMilSecTick());
+    for (i = 0; i < BUTTON_MAX; i++) {
+        if ((g_byExti & (1u << i)) && ButtonExti_IsPressed(i)) {
+            EXTI->IMR &= ~(uint32_t)g_pPin[i].wPin;
+            g_byActive |= (uint8_t)(1u << i);
+        }
+    }
+
+    if (g_byActive != 0) {
+        ButtonExti_StartScan();
+    } else {
+        ButtonExti_StartPoll();
+    }
+}
+
+/**
+ * @func   ButtonExti_RegisterEventCallback
+ * @brief  Register callback of an event
+ * @param  buttonEvent: event
+ * @param  procButtonEvent: callback, NULL to remove
+ * @retval None
+ */
+void
+ButtonExti_RegisterEventCallback(
+    button_event_t buttonEvent,
+    button_event_callback procButtonEvent
+) {
+    if (buttonEvent < BUTTON_EVENT_MAXIMUM) {
+        g_pCallback[buttonEvent] = procButtonEvent;
+    }
+}
+
+/**
+ * @func   ButtonExti_SetMode
+ * @brief  Set mode of a button
+ * @param  id: id of button
+ * @param  mode: BUTTON_TYPE_LOGIC and/or BUTTON_TYPE_EDGE
+ * @retval None
+ */
+void
+ButtonExti_SetMode(
+    uint8_t id,
+    uint8_t mode
+) {
+    if (id < BUTTON_MAX) {
+        g_pState[id].byMode = mode;
+    }
+}
+
+/**
+ * @func   ButtonExti_GetMode
+ * @brief  Get mode of a button
+ * @param  id: id of button
+ * @retval Mode
+ */
+uint8_t
+ButtonExti_GetMode(
+    uint8_t id
+) {
+    return (id < BUTTON_MAX) ? g_pState[id].byMode : 0;
+}
+
+/**
+ * @func   ButtonExti_GetLogicInputPin
+ * @brief  Get logic on input pin
+ * @param  id: id of button
+ * @retval Logic of pin, 0 when pressed
+ */
+uint8_t
+ButtonExti_GetLogicInputPin(
+    uint8_t id
+) {
+    if (id >= BUTTON_MAX) {
+        return 1;
+    }
+
+    return GPIO_ReadInputDataBit(g_pPin[id].pGpio, g_pPin[id].wPin);
+}
+
+/**
+ * @func   ButtonExti_IsIdle
+ * @brief  Check no button is pressed or waiting for next press
+ * @param  None
+ * @retval 1 if idle; 0 otherwise
+ */
+uint8_t
+ButtonExti_IsIdle(void)
+{
+    return (g_byActive == 0) && (g_byWake == 0);
+}
+
+/**
+ * @func   ButtonExti_GetStatistic
+ * @brief  Get wake ups and latency
+ * @param  pStat: statistic
+ * @retval None
+ */
+void
+ButtonExti_GetStatistic(
+    button_stat_p pStat
+) {
+    uint32_t dwElapsed;
+    uint32_t dwPrimask;
+
+    dwPrimask = __get_PRIMASK();
+    __disable_irq();
+    *pStat = g_stat;
+    pStat->dwWake = g_dwWake;
+    dwElapsed = GetMilSecTick() - g_dwStatStart;
+    __set_PRIMASK(dwPrimask);
+
+    pStat->wWakeRate = 0;
+    if (dwElapsed != 0) {
+        pStat->wWakeRate = (uint16_t)(((uint64_t)(pStat->dwScan + pStat->dwPoll) * 100000) / dwElapsed);
+    }
+}
+
+/**
+ * @func   ButtonExti_ResetStatistic
+ * @brief  Clear statistic
+ * @param  None
+ * @retval None
+ */
+void
+ButtonExti_ResetStatistic(void)
+{
+    uint32_t dwPrimask;
+
+    dwPrimask = __get_PRIMASK();
+    __disable_irq();
+    memsetl((uint8_t *)&g_stat, 0, sizeof(g_stat));
+    g_dwWake = 0;
+    g_dwStatStart = GetMilSecTick();
+    __set_PRIMASK(dwPrimask);
+}
+
+/**
+ * @func   processButtonExti
+ * @brief  Start scan of buttons woken by EXTI, called in main loop
+ * @param  None
+ * @retval None
+ */
+void
+processButtonExti(void)
+{
+    uint32_t dwPrimask;
+    uint8_t byWake;
+    uint8_t i;
+
+    if (g_byWake == 0) {
+        return;
+    }
+
+    dwPrimask = __get_PRIMASK();
+    __disable_irq();
+    byWake = g_byWake;
+    g_byWake = 0;
+    __set_PRIMASK(dwPrimask);
+
+    for (i = 0; i < BUTTON_MAX; i++) {
+        if ((byWake & (1u << i)) && !g_pState[i].bEdge) {
+            g_pState[i].dwEdge = g_pdwWakeTick[i];
+            g_pState[i].bEdge = 1;
+        }
+    }
+
+    g_byActive |= byWake;
+    ButtonExti_StartScan();
+}
+
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+/**
+ * @func   ButtonExti_GpioConfig
+ * @brief  Buttons are inputs with pull up, low when pressed
+ * @param  None
+ * @retval None
+ */
+static void
+ButtonExti_GpioConfig(void)
+{
+    GPIO_InitTypeDef GPIO_InitStructure;
+    uint8_t i;
+
+    GPIO_InitStructure.GPIO_Mode = GPIO_Mode_IN;
+    GPIO_InitStructure.GPIO_PuPd = GPIO_PuPd_UP;
+    GPIO_InitStructure.GPIO_Speed = GPIO_Speed_50MHz;
+
+    for (i = 0; i < BUTTON_MAX; i++) {
+        RCC_AHB1PeriphClockCmd(g_pPin[i].dwClock, ENABLE);
+        GPIO_InitStructure.GPIO_Pin = g_pPin[i].wPin;
+        GPIO_Init(g_pPin[i].pGpio, &GPIO_InitStructure);
+    }
+}
+
+/**
+ * @func   ButtonExti_ExtiConfig
+ * @brief  Map a line to first button on it, interrupt on both edges
+ * @param  None
+ * @retval None
+ */
+static void
+ButtonExti_ExtiConfig(void)
+{
+    EXTI_InitTypeDef EXTI_InitStructure;
+    NVIC_InitTypeDef NVIC_InitStructure;
+    uint16_t wLines = 0;
+    uint8_t i;
+
+    RCC_APB2PeriphClockCmd(RCC_APB2Periph_SYSCFG, ENABLE);
+
+    EXTI_InitStructure.EXTI_Mode = EXTI_Mode_Interrupt;
+    EXTI_InitStructure.EXTI_Trigger = EXTI_Trigger_Rising_Falling;
+    EXTI_InitStructure.EXTI_LineCmd = ENABLE;
+
+    NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 3;
+    NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0;
+    NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+
+    g_byExti = 0;
+
+    for (i = 0; i < BUTTON_MAX; i++) {
+        if (wLines & g_pPin[i].wPin) {
+            continue;
+        }
+        wLines |= g_pPin[i].wPin;
+        g_byExti |= (uint8_t)(1u << i);
+
+        SYSCFG_EXTILineConfig(g_pPin[i].byPortSource, g_pPin[i].byPinSource);
+
+        EXTI_InitStructure.EXTI_Line = g_pPin[i].wPin;
+        EXTI_Init(&EXTI_InitStructure);
+        EXTI_ClearITPendingBit(g_pPin[i].wPin);
+
+        NVIC_InitStructure.NVIC_IRQChannel = g_pPin[i].irq;
+        NVIC_Init(&NVIC_InitStructure);
+    }
+}
+
+/**
+ * @func   ButtonExti_IsPressed
+ * @brief  Sample pin of a button
+ * @param  byId: id of button
+ * @retval 1 if pin is low; 0 otherwise
+ */
+static uint8_t
+ButtonExti_IsPressed(
+    uint8_t byId
+) {
+    return GPIO_ReadInputDataBit(g_pPin[byId].pGpio, g_pPin[byId].wPin) == Bit_RESET;
+}
+
+/**
+ * @func   ButtonExti_PollPins
+ * @brief  Activate idle buttons without EXTI line whose pin is low
+ * @param  dwTick: current tick
+ * @retval None
+ */
+static void
+ButtonExti_PollPins(
+    uint32_t dwTick
+) {
+    uint8_t byPolled = (uint8_t)(BUTTON_ALL & ~g_byExti & ~g_byActive);
+    uint8_t i;
+
+    for (i = 0; byPolled != 0; i++, byPolled >>= 1) {
+        if ((byPolled & 0x01) && ButtonExti_IsPressed(i)) {
+            g_pState[i].dwEdge = dwTick;
+            g_pState[i].bEdge = 1;
+            g_byActive |= (uint8_t)(1u << i);
+        }
+    }
+}
+
+/**
+ * @func   ButtonExti_StartScan
+ * @brief  Scan active buttons every KEY_TIME_SCAN, idle poll stops
+ * @param  None
+ * @retval None
+ */
+static void
+ButtonExti_StartScan(void)
+{
+    if (g_byPollTimer != NO_TIMER) {
+        TimerStop(g_byPollTimer);
+        g_byPollTimer = NO_TIMER;
+    }
+
+    if (g_byScanTimer == NO_TIMER) {
+        g_byScanTimer = TimerStart("btnscan", KEY_TIME_SCAN, TIMER_REPEAT_ONE_TIME,
+                                   ButtonExti_Scan, NULL);
+    }
+}
+
+/**
+ * @func   ButtonExti_StartPoll
+ * @brief  Poll buttons without EXTI line every BUTTON_EXTI_POLL_IDLE, if any
+ * @param  None
+ * @retval None
+ */
+static void
+ButtonExti_StartPoll(void)
+{
+    if (((BUTTON_ALL & ~g_byExti) != 0) && (g_byPollTimer == NO_TIMER)) {
+        g_byPollTimer = TimerStart("btnpoll", BUTTON_EXTI_POLL_IDLE, TIMER_REPEAT_ONE_TIME,
+                                   ButtonExti_Poll, NULL);
+    }
+}
+
+/**
+ * @func   ButtonExti_Scan
+ * @brief  Debounce and time active buttons. Timer is one time and started
+ *         again while a button is active, so it is never stopped by itself
+ * @param  pData: not used
+ * @retval None
+ */
+static void
+ButtonExti_Scan(
+    void *pData
+) {
+    uint32_t dwTick = GetMilSecTick();
+    uint8_t i;
+
+    (void)pData;
+
+    g_byScanTimer = NO_TIMER;
+    g_stat.dwScan++;
+
+    ButtonExti_PollPins(dwTick);
+
+    for (i = 0; i < BUTTON_MAX; i++) {
+        if ((g_byActive & (1u << i)) && !ButtonExti_ScanButton(i, dwTick)) {
+            ButtonExti_Sleep(i);
+        }
+    }
+
+    if (g_byActive != 0) {
+        ButtonExti_StartScan();
+    } else {
+        ButtonExti_StartPoll();
+    }
+}
+
+/**
+ * @func   ButtonExti_Poll
+ * @brief  Idle poll of buttons without EXTI line
+ * @param  pData: not used
+ * @retval None
+ */
+static void
+ButtonExti_Poll(
+    void *pData
+) {
+    (void)pData;
+
+    g_byPollTimer = NO_TIMER;
+    g_stat.dwPoll++;
+
+    ButtonExti_PollPins(GetMilSecTick());
+
+    if (g_byActive != 0) {
+        ButtonExti_StartScan();
+    } else {
+        ButtonExti_StartPoll();
+    }
+}
+
+/**
+ * @func   ButtonExti_ScanButton
+ * @brief  Debounce a button: state changes after KEY_COUNT_IS_PRESS equal
+ *         samples. Send hold events and presses whose window ended
+ * @param  byId: id of button
+ * @param  dwTick: current tick
+ * @retval 1 if button stays active; 0 if idle
+ */
+static uint8_t
+ButtonExti_ScanButton(
+    uint8_t byId,
+    uint32_t dwTick
+) {
+    button_state_t *pState = &g_pState[byId];
+    uint8_t bPressed = ButtonExti_IsPressed(byId);
+    uint32_t dwLatency;
+
+    if (bPressed != pState->bPressed) {
+        if ((pState->byCount == 0) && !pState->bEdge) {
+            pState->dwEdge = dwTick;
+            pState->bEdge = 1;
+        }
+
+        if (++pState->byCount >= KEY_COUNT_IS_PRESS) {
+            dwLatency = dwTick - pState->dwEdge;
+            if (dwLatency > g_stat.wLatencyMax) {
+                g_stat.wLatencyMax = (uint16_t)dwLatency;
+            }
+
+            pState->byCount = 0;
+            pState->bEdge = 0;
+            pState->bPressed = bPressed;
+
+            if (bPressed) {
+                pState->byHold = 0;
+                if (pState->byMode & BUTTON_TYPE_EDGE) {
+                    ButtonExti_Notify(BUTTON_EVENT_EDGE, byId, BUTTON_EDGE_FALLING);
+                }
+            } else {
+                ButtonExti_Release(byId, dwTick);
+            }
+
+            pState->dwTick = dwTick;
+        }
+    } else {
+        pState->byCount = 0;
+    }
+
+    if (pState->byMode & BUTTON_TYPE_LOGIC) {
+        if (pState->bPressed) {
+            if ((pState->byHold < BUTTON_HOLD_STEPS) &&
+                ((dwTick - pState->dwTick) >= g_pwHold[pState->byHold])) {
+                ButtonExti_Notify(BUTTON_EVENT_HOLD, byId, g_pwHold[pState->byHold]);
+                pState->byHold++;
+            }
+        } else if ((pState->byPress != 0) &&
+                   ((dwTick - pState->dwTick) >= KEY_TIMEOUT_BW2PRESS)) {
+            ButtonExti_Notify(BUTTON_EVENT_PRESS, byId, pState->byPress);
+            pState->byPress = 0;
+        }
+    }
+
+    return pState->bPressed || (pState->byCount != 0) || (pState->byPress != 0);
+}
+
+/**
+ * @func   ButtonExti_Release
+ * @brief  Button released: count a short press or send release of a hold
+ * @param  byId: id of button
+ * @param  dwTick: current tick
+ * @retval None
+ */
+static void
+ButtonExti_Release(
+    uint8_t byId,
+    uint32_t dwTick
+) {
+    button_state_t *pState = &g_pState[byId];
+    uint32_t dwHeld = dwTick - pState->dwTick;
+
+    if (pState->byMode & BUTTON_TYPE_EDGE) {
+        ButtonExti_Notify(BUTTON_EVENT_EDGE, byId, BUTTON_EDGE_RISING);
+    }
+
+    if (!(pState->byMode & BUTTON_TYPE_LOGIC)) {
+        return;
+    }
+
+    if (dwHeld >= KEY_TIME_IS_HOLD) {
+        pState->byPress = 0;
+        ButtonExti_Notify(BUTTON_EVENT_RELEASE, byId, (dwHeld > 0xFFFF) ? 0xFFFF : (uint16_t)dwHeld);
+    } else if (pState->byPress < 0xFF) {
+        pState->byPress++;
+    }
+}
+
+/**
+ * @func   ButtonExti_Sleep
+ * @brief  Stop scanning an idle button and unmask its EXTI line
+ * @param  byId: id of button
+ * @retval None
+ */
+static void
+ButtonExti_Sleep(
+    uint8_t byId
+) {
+    uint32_t dwLine = g_pPin[byId].wPin;
+
+    g_byActive &= (uint8_t)~(1u << byId);
+    g_pState[byId].bEdge = 0;
+
+    if (!(g_byExti & (1u << byId))) {
+        return;
+    }
+
+    EXTI_ClearITPendingBit(dwLine);
+    EXTI->IMR |= dwLine;
+
+    /* An edge between last sample and unmask is lost, check pin again */
+    if (ButtonExti_IsPressed(byId)) {
+        EXTI->IMR &= ~dwLine;
+        g_byActive |= (uint8_t)(1u << byId);
+    }
+}
+
+/**
+ * @func   ButtonExti_Notify
+ * @brief  Call callback of an event
+ * @param  event: event
+ * @param  byId: id of button
+ * @param  wTime: parameter of event
+ * @retval None
+ */
+static void
+ButtonExti_Notify(
+    button_event_t event,
+    uint8_t byId,
+    uint16_t wTime
+) {
+    if (g_pCallback[event] != NULL) {
+        g_stat.dwEvent++;
+        g_pCallback[event](byId, wTime);
+    }
+}
+
+/**
+ * @func   ButtonExti_IrqHandler
+ * @brief  Mask lines with an edge and wake their buttons
+ * @param  None
+ * @retval None
+ */
+static void
+ButtonExti_IrqHandler(void)
+{
+    uint32_t dwLine;
+    uint8_t i;
+
+    for (i = 0; i < BUTTON_MAX; i++) {
+        dwLine = g_pPin[i].wPin;
+        if ((g_byExti & (1u << i)) && (EXTI_GetITStatus(dwLine) != RESET)) {
+            EXTI_ClearITPendingBit(dwLine);
+            EXTI->IMR &= ~dwLine;
+            g_pdwWakeTick[i] = GetMilSecTick();
+            g_byWake |= (uint8_t)(1u << i);
+            g_dwWake++;
+        }
+    }
+}
+
+/**
+ * @func   EXTI0_IRQHandler, EXTI3_IRQHandler, EXTI4_IRQHandler,
+ *         EXTI9_5_IRQHandler, EXTI15_10_IRQHandler
+ * @brief  Lines of buttons
+ * @param  None
+ * @retval None
+ */
+void
+EXTI0_IRQHandler(void)
+{
+    ButtonExti_IrqHandler();
+}
+
+void
+EXTI3_IRQHandler(void)
+{
+    ButtonExti_IrqHandler();
+}
+
+void
+EXTI4_IRQHandler(void)
+{
+    ButtonExti_IrqHandler();
+}
+
+void
+EXTI9_5_IRQHandler(void)
+{
+    ButtonExti_IrqHandler();
+}
+
+void
+EXTI15_10_IRQHandler(void)
+{
+    ButtonExti_IrqHandler();
+}
+
+/* END FILE */
@@ -0,0 +1,160 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Buttons woken by EXTI edge, debounce and hold timing run on
+ *              scan timer only while a button is active. Same events and
+ *              callbacks as button.h, used instead of Button_Init
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+#ifndef _BUTTONEXTI_H_
+#define _BUTTONEXTI_H_
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <stdint.h>
+#include "button.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+/*! @brief Poll period (ms) of a button sharing its EXTI line with another
+ *         one, while no button is active */
+#define BUTTON_EXTI_POLL_IDLE               50u
+
+/*!
+ * Events, param time of callback:
+ *   BUTTON_EVENT_EDGE     BUTTON_EDGE_FALLING pressed, BUTTON_EDGE_RISING
+ *                         released, buttons in BUTTON_TYPE_EDGE mode
+ *   BUTTON_EVENT_PRESS    number of presses, KEY_TIMEOUT_BW2PRESS after
+ *                         last short press
+ *   BUTTON_EVENT_HOLD     time held (ms) at KEY_TIME_HOLD1S/3S/5S/10S
+ *   BUTTON_EVENT_RELEASE  time held (ms), released after KEY_TIME_IS_HOLD
+ */
+
+/*! @brief Statistic since ButtonExti_ResetStatistic */
+typedef struct {
+    uint32_t dwWake;         /*< Edge interrupts */
+    uint32_t dwScan;         /*< Runs of scan timer */
+    uint32_t dwPoll;         /*< Idle polls of buttons without EXTI line */
+    uint32_t dwEvent;        /*< Callbacks called */
+    uint16_t wWakeRate;      /*< Scans and polls per 100 s */
+    uint16_t wLatencyMax;    /*< Longest first edge to debounced state (ms) */
+} button_stat_t, *button_stat_p;
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func   ButtonExti_Init
+ * @brief  Initialize pins and EXTI lines of buttons, all in logic mode. A
+ *         pin whose line is taken by another button is polled when idle
+ * @param  None
+ * @retval None
+ */
+void
+ButtonExti_Init(void);
+
+/**
+ * @func   ButtonExti_RegisterEventCallback
+ * @brief  Register callback of an event
+ * @param  buttonEvent: event
+ * @param  procButtonEvent: callback, NULL to remove
+ * @retval None
+ */
+void
+ButtonExti_RegisterEventCallback(
+    button_event_t buttonEvent,
+    button_event_callback procButtonEvent
+);
+
+/**
+ * @func   ButtonExti_SetMode
+ * @brief  Set mode of a button
+ * @param  id: id of button
+ * @param  mode: BUTTON_TYPE_LOGIC and/or BUTTON_TYPE_EDGE
+ * @retval None
+ */
+void
+ButtonExti_SetMode(
+    uint8_t id,
+    uint8_t mode
+);
+
+/**
+ * @func   ButtonExti_GetMode
+ * @brief  Get mode of a button
+ * @param  id: id of button
+ * @retval Mode
+ */
+uint8_t
+ButtonExti_GetMode(
+    uint8_t id
+);
+
+/**
+ * @func   ButtonExti_GetLogicInputPin
+ * @brief  Get logic on input pin
+ * @param  id: id of button
+ * @retval Logic of pin, 0 when pressed
+ */
+uint8_t
+ButtonExti_GetLogicInputPin(
+    uint8_t id
+);
+
+/**
+ * @func   ButtonExti_IsIdle
+ * @brief  Check no button is pressed or waiting for next press
+ * @param  None
+ * @retval 1 if idle; 0 otherwise
+ */
+uint8_t
+ButtonExti_IsIdle(void);
+
+/**
+ * @func   ButtonExti_GetStatistic
+ * @brief  Get wake ups and latency
+ * @param  pStat: statistic
+ * @retval None
+ */
+void
+ButtonExti_GetStatistic(
+    button_stat_p pStat
+);
+
+/**
+ * @func   ButtonExti_ResetStatistic
+ * @brief  Clear statistic
+ * @param  None
+ * @retval None
+ */
+void
+ButtonExti_ResetStatistic(void);
+
+/**
+ * @func   processButtonExti
+ * @brief  Start scan of buttons woken by EXTI, called in main loop
+ * @param  None
+ * @retval None
+ */
+void
+processButtonExti(void);
+
+#endif
+
+/* END FILE */
@@ -0,0 +1,542 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Gestures of buttons from a table. Gesture_Load sorts entries
+ *              per button (clicks by count, holds and releases by time) so
+ *              each tick only compares an active button with its next
+ *              threshold. Timer runs only while a button is active
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include "utilities.h"
+#include "timer.h"
+#include "buttonexti.h"
+#include "gesture.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define GESTURE_NONE                        0xFFu
+
+/* Entries of a button, indexes in table */
+typedef struct {
+    uint8_t pbyClick[GESTURE_CLICK_MAX + 1];    /* By number of clicks */
+    uint8_t pbyHold[GESTURE_HOLD_MAX];          /* By time */
+    uint8_t pbyRelease[GESTURE_HOLD_MAX];       /* By time */
+    uint8_t byEdge;
+    uint8_t byClickMax;
+    uint8_t byHolds;
+    uint8_t byReleases;
+} gesture_button_t;
+
+typedef struct {
+    uint32_t dwTick;         /* Last edge */
+    uint8_t bPressed;
+    uint8_t byClicks;        /* Clicks waiting for next one */
+    uint8_t byHold;          /* Holds sent in this press */
+    uint8_t bChord;          /* Taken by a chord until released */
+} gesture_state_t;
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+static const gesture_t *g_pTable;
+static gesture_callback g_callback;
+
+static gesture_button_t g_pButton[GESTURE_BUTTON_MAX];
+static gesture_state_t g_pState[GESTURE_BUTTON_MAX];
+static uint8_t g_pbyChord[GESTURE_CHORD_MAX];
+static uint8_t g_byChords;
+
+static uint8_t g_byPressed;                 /* Mask of buttons */
+static uint8_t g_byClicking;                /* Mask of buttons */
+static uint8_t g_byChordFired;              /* Mask of chords */
+
+static uint8_t g_byTimer = NO_TIMER;
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static uint8_t Gesture_Insert(const gesture_t *pTable, uint8_t *pbyList, uint8_t *pbyCount, uint8_t byEntry);
+static void Gesture_Emit(uint8_t byEntry, uint8_t byButton, uint16_t wParam);
+static void Gesture_Release(uint8_t byButton, uint32_t dwHeld);
+static void Gesture_Click(uint8_t byButton);
+static void Gesture_CheckChords(uint32_t dwTick);
+static void Gesture_StartTimer(void);
+static void Gesture_Tick(void *pData);
+static void Gesture_OnEdge(uint8_t id, uint16_t time);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func   Gesture_Init
+ * @brief  Take edges of all buttons from ButtonExti, after ButtonExti_Init.
+ *         No gesture until Gesture_Load
+ * @param  None
+ * @retval None
+ */
+void
+Gesture_Init(void)
+{
+    uint8_t i;
+
+    g_pTable = NULL;
+    g_callback = NULL;
+
+    for (i = 0; i < BUTTON_MAX; i++) {
+        ButtonExti_SetMode(i, BUTTON_TYPE_EDGE);
+    }
+
+    ButtonExti_RegisterEventCallback(BUTTON_EVENT_EDGE, Gesture_OnEdge);
+}
+
+/**
+ * @func   Gesture_Load
+ * @brief  Compile a table, state of buttons is cleared
+ * @param  pTable: gestures, stays valid while loaded
+ * @param  byCount: number of gestures
+ * @param  callback: called for each gesture recognised
+ * @retval 1 if loaded; 0 if table exceeds GESTURE_xxx_MAX or a button has
+ *         two edge gestures or two click gestures of same count
+ */
+uint8_t
+Gesture_Load(
+    const gesture_t *pTable,
+    uint8_t byCount,
+    gesture_callback callback
+) {
+    gesture_button_t *pButton;
+    uint8_t i;
+    uint8_t j;
+
+    g_pTable = NULL;
+
+    memsetl((uint8_t *)g_pButton, 0, sizeof(g_pButton));
+    memsetl((uint8_t *)g_pState, 0, sizeof(g_pState));
+    g_byChords = 0;
+    g_byPressed = 0;
+    g_byClicking = 0;
+    g_byChordFired = 0;
+
+    for (j = 0; j < GESTURE_BUTTON_MAX; j++) {
+        memsetl(g_pButton[j].pbyClick, GESTURE_NONE, sizeof(g_pButton[j].pbyClick));
+        g_pButton[j].byEdge = GESTURE_NONE;
+    }
+
+    for (i = 0; (i < byCount) && (i != GESTURE_NONE); i++) {
+        if (pTable[i].byButtons == 0) {
+            return 0;
+        }
+
+        if (pTable[i].byType == GESTURE_CHORD) {
+            if (g_byChords >= GESTURE_CHORD_MAX) {
+                return 0;
+            }
+            g_pbyChord[g_byChords++] = i;
+            continue;
+        }
+
+        for (j = 0; j < GESTURE_BUTTON_MAX; j++) {
+            if (!(pTable[i].byButtons & (1u << j))) {
+                continue;
+            }
+            pButton = &g_pButton[j];
+
+            switch (pTable[i].byType) {
+            case GESTURE_EDGE:
+                if (pButton->byEdge != GESTURE_NONE) {
+                    return 0;
+                }
+                pButton->byEdge = i;
+                break;
+
+            case GESTURE_CLICK:
+                if ((pTable[i].byCount == 0) || (pTable[i].byCount > GESTURE_CLICK_MAX) ||
+                    (pButton->pbyClick[pTable[i].byCount] != GESTURE_NONE)) {
+                    return 0;
+                }
+                pButton->pbyClick[pTable[i].byCount] = i;
+                if (pTable[i].byCount > pButton->byClickMax) {
+                    pButton->byClickMax = pTable[i].byCount;
+                }
+                break;
+
+            case GESTURE_HOLD:
+                if (!Gesture_Insert(pTable, pButton->pbyHold, &pButton->byHolds, i)) {
+                    return 0;
+                }
+                break;
+
+            case GESTURE_RELEASE:
+                if (!Gesture_Insert(pTable, pButton->pbyRelease, &pButton->byReleases, i)) {
+                    return 0;
+                }
+                break;
+
+            default:
+                return 0;
+            }
+        }
+    }
+
+    g_callback = callback;
+    g_pTable = pTable;
+
+    return 1;
+}
+
+/**
+ * @func   Gesture_Input
+ * @brief  Debounced edge of a button, from ButtonExti or a recorded trace
+ * @param  byButton: id of button
+ * @param  bPressed: 1 pressed; 0 released
+ * @param  dwTick: time of edge (ms)
+ * @retval None
+ */
+void
+Gesture_Input(
+    uint8_t byButton,
+    uint8_t bPressed,
+    uint32_t dwTick
+) {
+    gesture_state_t *pState;
+    uint32_t dwHeld;
+    uint8_t i;
+
+    if ((g_pTable == NULL) || (byButton >= GESTURE_BUTTON_MAX)) {
+        return;
+    }
+
+    pState = &g_pState[byButton];
+    if (pState->bPressed == bPressed) {
+        return;
+    }
+
+    dwHeld = dwTick - pState->dwTick;
+    pState->bPressed = bPressed;
+    pState->dwTick = dwTick;
+
+    if (g_pButton[byButton].byEdge != GESTURE_NONE) {
+        Gesture_Emit(g_pButton[byButton].byEdge, byButton, bPressed);
+    }
+
+    if (bPressed) {
+        g_byPressed |= (uint8_t)(1u << byButton);
+        pState->byHold = 0;
+        Gesture_CheckChords(dwTick);
+    } else {
+        g_byPressed &= (uint8_t)~(1u << byButton);
+
+        for (i = 0; i < g_byChords; i++) {
+            if (g_pTable[g_pbyChord[i]].byButtons & (1u << byButton)) {
+                g_byChordFired &= (uint8_t)~(1u << i);
+            }
+        }
+
+        if (pState->bChord) {
+            pState->bChord = 0;
+        } else {
+            Gesture_Release(byButton, dwHeld);
+        }
+    }
+
+    Gesture_StartTimer();
+}
+
+/**
+ * @func   Gesture_Process
+ * @brief  Timing of holds, chords and click gaps. Called by gesture timer
+ *         or by a trace replay
+ * @param  dwTick: current time (ms)
+ * @retval 1 if a button is active; 0 if idle
+ */
+uint8_t
+Gesture_Process(
+    uint32_t dwTick
+) {
+    gesture_button_t *pButton;
+    gesture_state_t *pState;
+    uint8_t byActive;
+    uint8_t byEntry;
+    uint8_t i;
+
+    if (g_pTable == NULL) {
+        return 0;
+    }
+
+    /* Only buttons pressed or waiting for next click */
+    byActive = g_byPressed | g_byClicking;
+
+    for (i = 0; byActive >> i; i++) {
+        if (!(byActive & (1u << i))) {
+            continue;
+        }
+        pButton = &g_pButton[i];
+        pState = &g_pState[i];
+
+        if (pState->bPressed) {
+            if (!pState->bChord && (pState->byHold < pButton->byHolds)) {
+                byEntry = pButton->pbyHold[pState->byHold];
+                if ((dwTick - pState->dwTick) >= g_pTable[byEntry].wTime) {
+                    pState->byHold++;
+                    Gesture_Emit(byEntry, i, g_pTable[byEntry].wTime);
+                }
+            }
+        } else if ((dwTick - pState->dwTick) >= GESTURE_CLICK_GAP) {
+            Gesture_Click(i);
+        }
+    }
+
+    if (g_byChords != 0) {
+        Gesture_CheckChords(dwTick);
+    }
+
+    return (g_byPressed | g_byClicking) != 0;
+}
+
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+/**
+ * @func   Gesture_Insert
+ * @brief  Insert an entry in a list sorted by time
+ * @param  pTable: table being loaded
+ * @param  pbyList: list of entries
+ * @param  pbyCount: number of entries in list
+ * @param  byEntry: index in table
+ * @retval 1 if inserted; 0 if list is full
+ */
+static uint8_t
+Gesture_Insert(
+    const gesture_t *pTable,
+    uint8_t *pbyList,
+    uint8_t *pbyCount,
+    uint8_t byEntry
+) {
+    uint8_t i = *pbyCount;
+
+    if (i >= GESTURE_HOLD_MAX) {
+        return 0;
+    }
+
+    while ((i > 0) && (pTable[pbyList[i - 1]].wTime > pTable[byEntry].wTime)) {
+        pbyList[i] = pbyList[i - 1];
+        i--;
+    }
+
+    pbyList[i] = byEntry;
+    (*pbyCount)++;
+
+    return 1;
+}
+
+/**
+ * @func   Gesture_Emit
+ * @brief  Call callback with event of an entry
+ * @param  byEntry: index in table
+ * @param  byButton: id of button
+ * @param  wParam: param of gesture
+ * @retval None
+ */
+static void
+Gesture_Emit(
+    uint8_t byEntry,
+    uint8_t byButton,
+    uint16_t wParam
+) {
+    if (g_callback != NULL) {
+        g_callback(g_pTable[byEntry].byEvent, byButton, wParam);
+    }
+}
+
+/**
+ * @func   Gesture_Release
+ * @brief  Release of a button not in a chord: release after hold, else a
+ *         click counted
+ * @param  byButton: id of button
+ * @param  dwHeld: time held (ms)
+ * @retval None
+ */
+static void
+Gesture_Release(
+    uint8_t byButton,
+    uint32_t dwHeld
+) {
+    gesture_button_t *pButton = &g_pButton[byButton];
+    gesture_state_t *pState = &g_pState[byButton];
+    uint8_t byEntry = GESTURE_NONE;
+    uint8_t i;
+
+    for (i = 0; i < pButton->byReleases; i++) {
+        if (dwHeld >= g_pTable[pButton->pbyRelease[i]].wTime) {
+            byEntry = pButton->pbyRelease[i];
+        }
+    }
+
+    if ((byEntry != GESTURE_NONE) || (pState->byHold != 0)) {
+        pState->byClicks = 0;
+        g_byClicking &= (uint8_t)~(1u << byButton);
+        if (byEntry != GESTURE_NONE) {
+            Gesture_Emit(byEntry, byButton, (dwHeld > 0xFFFF) ? 0xFFFF : (uint16_t)dwHeld);
+        }
+        return;
+    }
+
+    if (pButton->byClickMax == 0) {
+        return;
+    }
+
+    if (pState->byClicks < GESTURE_CLICK_MAX) {
+        pState->byClicks++;
+    }
+    g_byClicking |= (uint8_t)(1u << byButton);
+
+    /* No gesture of more clicks, no need to wait for gap */
+    if (pState->byClicks >= pButton->byClickMax) {
+        Gesture_Click(byButton);
+    }
+}
+
+/**
+ * @func   Gesture_Click
+ * @brief  Clicks of a button ended, send gesture of that count if any
+ * @param  byButton: id of button
+ * @retval None
+ */
+static void
+Gesture_Click(
+    uint8_t byButton
+) {
+    gesture_state_t *pState = &g_pState[byButton];
+    uint8_t byEntry = g_pButton[byButton].pbyClick[pState->byClicks];
+    uint8_t byClicks = pState->byClicks;
+
+    pState->byClicks = 0;
+    g_byClicking &= (uint8_t)~(1u << byButton);
+
+    if (byEntry != GESTURE_NONE) {
+        Gesture_Emit(byEntry, byButton, byClicks);
+    }
+}
+
+/**
+ * @func   Gesture_CheckChords
+ * @brief  Send chords whose buttons are all held long enough, buttons are
+ *         taken by chord until released
+ * @param  dwTick: current time (ms)
+ * @retval None
+ */
+static void
+Gesture_CheckChords(
+    uint32_t dwTick
+) {
+    const gesture_t *pChord;
+    uint32_t dwHeld;
+    uint8_t byFirst;
+    uint8_t i;
+    uint8_t j;
+
+    for (i = 0; i < g_byChords; i++) {
+        pChord = &g_pTable[g_pbyChord[i]];
+
+        if ((g_byChordFired & (1u << i)) ||
+            ((g_byPressed & pChord->byButtons) != pChord->byButtons)) {
+            continue;
+        }
+
+        /* Held together since last button pressed */
+        dwHeld = 0xFFFFFFFF;
+        byFirst = GESTURE_NONE;
+        for (j = 0; j < GESTURE_BUTTON_MAX; j++) {
+            if (pChord->byButtons & (1u << j)) {
+                if ((dwTick - g_pState[j].dwTick) < dwHeld) {
+                    dwHeld = dwTick - g_pState[j].dwTick;
+                }
+                if (byFirst == GESTURE_NONE) {
+                    byFirst = j;
+                }
+            }
+        }
+
+        if (dwHeld < pChord->wTime) {
+            continue;
+        }
+
+        g_byChordFired |= (uint8_t)(1u << i);
+        for (j = 0; j < GESTURE_BUTTON_MAX; j++) {
+            if (pChord->byButtons & (1u << j)) {
+                g_pState[j].bChord = 1;
+                g_pState[j].byClicks = 0;
+            }
+        }
+        g_byClicking &= (uint8_t)~pChord->byButtons;
+
+        Gesture_Emit(g_pbyChord[i], byFirst, pChord->wTime);
+    }
+}
+
+/**
+ * @func   Gesture_StartTimer
+ * @brief  Start gesture timing if not running
+ * @param  None
+ * @retval None
+ */
+static void
+Gesture_StartTimer(void)
+{
+    if (g_byTimer == NO_TIMER) {
+        g_byTimer = TimerStart("gesture", GESTURE_TICK, TIMER_REPEAT_ONE_TIME,
+                               Gesture_Tick, NULL);
+    }
+}
+
+/**
+ * @func   Gesture_Tick
+ * @brief  Timer of gestures, one time and started again while a button is
+ *         active
+ * @param  pData: not used
+ * @retval None
+ */
+static void
+Gesture_Tick(
+    void *pData
+) {
+    (void)pData;
+
+    g_byTimer = NO_TIMER;
+
+    if (Gesture_Process(GetMilSecTick())) {
+        Gesture_StartTimer();
+    }
+}
+
+/**
+ * @func   Gesture_OnEdge
+ * @brief  Edge event of ButtonExti
+ * @param  id: id of button
+ * @param  time: BUTTON_EDGE_FALLING pressed, BUTTON_EDGE_RISING released
+ * @retval None
+ */
+static void
+Gesture_OnEdge(
+    uint8_t id,
+    uint16_t time
+) {
+    Gesture_Input(id, time == BUTTON_EDGE_FALLING, GetMilSecTick());
+}
+
+/* END FILE */
@@ -0,0 +1,158 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Gestures of buttons from a table: clicks, holds, release
+ *              after hold and chords. Table is compiled per button when
+ *              loaded, input is debounced edges of ButtonExti
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+#ifndef _GESTURE_H_
+#define _GESTURE_H_
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <stdint.h>
+#include "button.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define GESTURE_BUTTON_MAX                  8u      /* Buttons in a mask */
+#define GESTURE_CLICK_MAX                   5u      /* Clicks of a gesture */
+#define GESTURE_HOLD_MAX                    4u      /* Holds, releases per button */
+#define GESTURE_CHORD_MAX                   4u
+
+/*! @brief Max time (ms) between release and next press of a multi click */
+#define GESTURE_CLICK_GAP                   KEY_TIMEOUT_BW2PRESS
+
+/*! @brief Period (ms) of gesture timing while a button is active */
+#define GESTURE_TICK                        10u
+
+/*!
+ * Kinds of gesture, param of callback:
+ *   GESTURE_EDGE     1 pressed, 0 released
+ *   GESTURE_CLICK    byCount clicks, each shorter than holds of button,
+ *                    sent GESTURE_CLICK_GAP after last one or at once if
+ *                    no gesture of more clicks
+ *   GESTURE_HOLD     held wTime (ms), while pressed
+ *   GESTURE_RELEASE  time held (ms), released after longest wTime reached
+ *   GESTURE_CHORD    wTime (ms), all buttons of mask held together wTime.
+ *                    Other gestures of these buttons are dropped until
+ *                    they are released
+ * Click, hold and release match any button of mask, chord all of them.
+ */
+typedef enum {
+    GESTURE_EDGE,
+    GESTURE_CLICK,
+    GESTURE_HOLD,
+    GESTURE_RELEASE,
+    GESTURE_CHORD
+} gesture_type_t;
+
+typedef struct {
+    uint8_t byType;          /*< gesture_type_t */
+    uint8_t byButtons;       /*< Mask of button ids */
+    uint8_t byCount;         /*< Clicks, GESTURE_CLICK */
+    uint16_t wTime;          /*< ms, GESTURE_HOLD, GESTURE_RELEASE, GESTURE_CHORD */
+    uint8_t byEvent;         /*< Event sent to application */
+} gesture_t, *gesture_p;
+
+/*! @brief Entries of a table */
+#define GESTURE_CLICK_OF(buttons, count, event)   { GESTURE_CLICK, (buttons), (count), 0, (event) }
+#define GESTURE_HOLD_OF(buttons, time, event)     { GESTURE_HOLD, (buttons), 0, (time), (event) }
+#define GESTURE_RELEASE_OF(buttons, time, event)  { GESTURE_RELEASE, (buttons), 0, (time), (event) }
+#define GESTURE_CHORD_OF(buttons, time, event)    { GESTURE_CHORD, (buttons), 0, (time), (event) }
+#define GESTURE_EDGE_OF(buttons, event)           { GESTURE_EDGE, (buttons), 0, 0, (event) }
+
+/*! @brief Mask of all buttons of kit */
+#define GESTURE_ALL_BUTTONS                 ((uint8_t)((1u << BUTTON_MAX) - 1))
+
+/*!
+ * Events of eventbutton.h, one entry for all buttons:
+ *   GESTURE_CLICK_OF(GESTURE_ALL_BUTTONS, 1, APP_EVENT_PRESS),
+ *   GESTURE_CLICK_OF(GESTURE_ALL_BUTTONS, 2, APP_EVENT_PRESS),
+ *   GESTURE_CLICK_OF(GESTURE_ALL_BUTTONS, 5, APP_EVENT_PRESS),
+ *   GESTURE_HOLD_OF(GESTURE_ALL_BUTTONS, KEY_TIME_HOLD1S, APP_EVENT_HOLD),
+ *   ...
+ *   GESTURE_RELEASE_OF(GESTURE_ALL_BUTTONS, KEY_TIME_HOLD10S, APP_EVENT_RELEASE),
+ * Callback gets id of button and count or time as param.
+ */
+
+/*! @brief Gesture recognised: event of entry, button (lowest id of a
+ *         chord) and param of gesture */
+typedef void (*gesture_callback)(uint8_t byEvent, uint8_t byButton, uint16_t wParam);
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func   Gesture_Init
+ * @brief  Take edges of all buttons from ButtonExti, after ButtonExti_Init.
+ *         No gesture until Gesture_Load
+ * @param  None
+ * @retval None
+ */
+void
+Gesture_Init(void);
+
+/**
+ * @func   Gesture_Load
+ * @brief  Compile a table, state of buttons is cleared
+ * @param  pTable: gestures, stays valid while loaded
+ * @param  byCount: number of gestures
+ * @param  callback: called for each gesture recognised
+ * @retval 1 if loaded; 0 if table exceeds GESTURE_xxx_MAX or a button has
+ *         two edge gestures or two click gestures of same count
+ */
+uint8_t
+Gesture_Load(
+    const gesture_t *pTable,
+    uint8_t byCount,
+    gesture_callback callback
+);
+
+/**
+ * @func   Gesture_Input
+ * @brief  Debounced edge of a button, from ButtonExti or a recorded trace
+ * @param  byButton: id of button
+ * @param  bPressed: 1 pressed; 0 released
+ * @param  dwTick: time of edge (ms)
+ * @retval None
+ */
+void
+Gesture_Input(
+    uint8_t byButton,
+    uint8_t bPressed,
+    uint32_t dwTick
+);
+
+/**
+ * @func   Gesture_Process
+ * @brief  Timing of holds, chords and click gaps. Called by gesture timer
+ *         or by a trace replay
+ * @param  dwTick: current time (ms)
+ * @retval 1 if a button is active; 0 if idle
+ */
+uint8_t
+Gesture_Process(
+    uint32_t dwTick
+);
+
+#endif
+
+/* END FILE */
@@ -0,0 +1,535 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Melody player, notes are changed by timer interrupt so
+ *              timing does not depend on load of main loop.
+ *
+ *              TIM4 counts length of current note, its update interrupt
+ *              loads next note into preloaded PSC / ARR / CCR4 of TIM3
+ *              (buzzer PWM), so a note starts at a PWM period boundary.
+ *              Note boundaries are fixed by hardware, latency of interrupt
+ *              is not added up over the melody
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include "stm32f401re_rcc.h"
+#include "stm32f401re_tim.h"
+#include "misc.h"
+#include "utilities.h"
+#include "buzzer.h"
+#include "buzzerplayer.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+/* PWM of buzzer (PC9, TIM3_CH4) set up by BuzzerControl_Init. TIM3_CH3
+ * drives blue of kit led 1, its duty follows period of the note */
+#define BUZZER_PWM_TIM                      TIM3
+
+/* Note timer, ticks of 0.1 ms */
+#define BUZZER_NOTE_TIM                     TIM4
+#define BUZZER_NOTE_TIM_CLK                 RCC_APB1Periph_TIM4
+#define BUZZER_NOTE_TIM_HZ                  10000u
+#define BUZZER_NOTE_IRQn                    TIM4_IRQn
+#define BUZZER_NOTE_IRQHandler              TIM4_IRQHandler
+#define BUZZER_NOTE_TICK_MAX                0xFFFFu
+
+#define BUZZER_VOLUME_MAX                   50u
+
+/* Clock of TIM3 / TIM4 on APB1, SystemCoreClock of the kit. Note table,
+ * note timer and tones of tone_t are all computed from it, define it for a
+ * board clocked otherwise */
+#ifndef BUZZER_TIM_HZ
+#define BUZZER_TIM_HZ                       84000000u
+#endif
+
+/* Timer values of a note at frequency f10 (0.1 Hz), computed by compiler */
+#define BUZZER_CYCLES(f10)                  ((uint32_t)((BUZZER_TIM_HZ * 10ull) / (f10)))
+#define BUZZER_PSC(f10)                     (BUZZER_CYCLES(f10) / 0x10000u)
+#define BUZZER_ARR(f10)                     (BUZZER_CYCLES(f10) / (BUZZER_PSC(f10) + 1) - 1)
+#define BUZZER_NOTE(f10)                    { BUZZER_PSC(f10), BUZZER_ARR(f10) }
+
+/* Whole note of 4 beats, in ticks of note timer at 1 beat per minute */
+#define BUZZER_WHOLE_TICKS                  (4u * 60u * BUZZER_NOTE_TIM_HZ)
+
+typedef struct {
+    uint16_t wPrescaler;                    /*< PSC */
+    uint16_t wPeriod;                       /*< ARR */
+} buzzer_note_t;
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+/* Equal temperament, A4 = 440 Hz */
+static const buzzer_note_t g_pNote[BUZZER_NOTE_COUNT] = {
+    /* C1 - B1 */
+    BUZZER_NOTE(327), BUZZER_NOTE(346), BUZZER_NOTE(367), BUZZER_NOTE(389),
+    BUZZER_NOTE(412), BUZZER_NOTE(437), BUZZER_NOTE(462), BUZZER_NOTE(490),
+    BUZZER_NOTE(519), BUZZER_NOTE(550), BUZZER_NOTE(583), BUZZER_NOTE(617),
+    /* C2 - B2 */
+    BUZZER_NOTE(654), BUZZER_NOTE(693), BUZZER_NOTE(734), BUZZER_NOTE(778),
+    BUZZER_NOTE(824), BUZZER_NOTE(873), BUZZER_NOTE(925), BUZZER_NOTE(980),
+    BUZZER_NOTE(1038), BUZZER_NOTE(1100), BUZZER_NOTE(1165), BUZZER_NOTE(1235),
+    /* C3 - B3 */
+    BUZZER_NOTE(1308), BUZZER_NOTE(1386), BUZZER_NOTE(1468), BUZZER_NOTE(1556),
+    BUZZER_NOTE(1648), BUZZER_NOTE(1746), BUZZER_NOTE(1850), BUZZER_NOTE(1960),
+    BUZZER_NOTE(2077), BUZZER_NOTE(2200), BUZZER_NOTE(2331), BUZZER_NOTE(2469),
+    /* C4 - B4 */
+    BUZZER_NOTE(2616), BUZZER_NOTE(2772), BUZZER_NOTE(2937), BUZZER_NOTE(3111),
+    BUZZER_NOTE(3296), BUZZER_NOTE(3492), BUZZER_NOTE(3700), BUZZER_NOTE(3920),
+    BUZZER_NOTE(4153), BUZZER_NOTE(4400), BUZZER_NOTE(4662), BUZZER_NOTE(4939),
+    /* C5 - B5 */
+    BUZZER_NOTE(5233), BUZZER_NOTE(5544), BUZZER_NOTE(5873), BUZZER_NOTE(6223),
+    BUZZER_NOTE(6593), BUZZER_NOTE(6985), BUZZER_NOTE(7400), BUZZER_NOTE(7840),
+    BUZZER_NOTE(8306), BUZZER_NOTE(8800), BUZZER_NOTE(9323), BUZZER_NOTE(9878),
+    /* C6 - B6 */
+    BUZZER_NOTE(10465), BUZZER_NOTE(11087), BUZZER_NOTE(11747), BUZZER_NOTE(12445),
+    BUZZER_NOTE(13185), BUZZER_NOTE(13969), BUZZER_NOTE(14800), BUZZER_NOTE(15680),
+    BUZZER_NOTE(16612), BUZZER_NOTE(17600), BUZZER_NOTE(18647), BUZZER_NOTE(19755),
+    /* C7 - B7 */
+    BUZZER_NOTE(20930), BUZZER_NOTE(22175), BUZZER_NOTE(23493), BUZZER_NOTE(24890),
+    BUZZER_NOTE(26370), BUZZER_NOTE(27938), BUZZER_NOTE(29600), BUZZER_NOTE(31360),
+    BUZZER_NOTE(33224), BUZZER_NOTE(35200), BUZZER_NOTE(37293), BUZZER_NOTE(39511),
+    /* C8 - B8 */
+    BUZZER_NOTE(41860), BUZZER_NOTE(44349), BUZZER_NOTE(46986), BUZZER_NOTE(49780),
+    BUZZER_NOTE(52740), BUZZER_NOTE(55877), BUZZER_NOTE(59199), BUZZER_NOTE(62719),
+    BUZZER_NOTE(66449), BUZZER_NOTE(70400), BUZZER_NOTE(74586), BUZZER_NOTE(79021)
+};
+
+static volatile uint8_t g_bPlaying;
+static tone_p g_pListTone;                  /* Melody of tone_t, or */
+static const uint8_t *g_pbyMelody;          /* compact melody */
+static const uint8_t *g_pbyNext;
+static uint16_t g_wIndex;
+static uint16_t g_wCount;
+static uint8_t g_byRepeat;
+static uint16_t g_wTempo = BUZZER_TEMPO_NORMAL;
+static uint8_t g_byVolume = BUZZER_VOLUME_DEFAULT;
+
+/* Duty of PWM in 1/256 of period */
+static uint16_t g_wDuty = BUZZER_VOLUME_DEFAULT * 256u / 100u;
+
+/* Ticks of note timer for each duration code of compact melody */
+static uint16_t g_pwTicks[BUZZER_MELODY_DURATION_MASK + 1];
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static void BuzzerPlayer_Start(uint16_t wTempo, uint8_t byRepeat);
+static uint8_t BuzzerPlayer_LoadNote(void);
+static uint8_t BuzzerPlayer_LoadTone(void);
+static uint8_t BuzzerPlayer_LoadCompact(void);
+static uint8_t BuzzerPlayer_CheckCompact(const uint8_t *pbyMelody, uint16_t wCount);
+static void BuzzerPlayer_SetTone(uint16_t wFreq);
+static void BuzzerPlayer_SetTicks(uint32_t dwTicks);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func   BuzzerPlayer_Init
+ * @brief  Initialize note timer, after BuzzerControl_Init. Not to be used
+ *         together with BuzzerControl_SetMelody
+ * @param  None
+ * @retval None
+ */
+void
+BuzzerPlayer_Init(void)
+{
+    TIM_TimeBaseInitTypeDef TIM_TimeBaseStructure;
+    NVIC_InitTypeDef NVIC_InitStructure;
+
+    /* New note is taken at end of a PWM period */
+    TIM_ARRPreloadConfig(BUZZER_PWM_TIM, ENABLE);
+    TIM_OC4PreloadConfig(BUZZER_PWM_TIM, TIM_OCPreload_Enable);
+
+    RCC_APB1PeriphClockCmd(BUZZER_NOTE_TIM_CLK, ENABLE);
+
+    TIM_TimeBaseStructure.TIM_Prescaler = (uint16_t)(BUZZER_TIM_HZ / BUZZER_NOTE_TIM_HZ - 1);
+    TIM_TimeBaseStructure.TIM_Period = BUZZER_NOTE_TICK_MAX;
+    TIM_TimeBaseStructure.TIM_ClockDivision = 0;
+    TIM_TimeBaseStructure.TIM_CounterMode = TIM_CounterMode_Up;
+    TIM_TimeBaseStructure.TIM_RepetitionCounter = 0;
+    TIM_TimeBaseInit(BUZZER_NOTE_TIM, &TIM_TimeBaseStructure);
+
+    /* ARR is written right after update event, not preloaded */
+    TIM_ARRPreloadConfig(BUZZER_NOTE_TIM, DISABLE);
+    TIM_ClearITPendingBit(BUZZER_NOTE_TIM, TIM_IT_Update);
+    TIM_ITConfig(BUZZER_NOTE_TIM, TIM_IT_Update, ENABLE);
+
+    NVIC_InitStructure.NVIC_IRQChannel = BUZZER_NOTE_IRQn;
+    NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 2;
+    NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0;
+    NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+    NVIC_Init(&NVIC_InitStructure);
+}
+
+/**
+ * @func   BuzzerPlayer_Play
+ * @brief  Play a melody, a playing one is stopped. Notes of freq 0 are
+ *         rests, list ends with { 0, 0 }
+ * @param  pListTone: melody, stays valid while playing
+ * @param  wTempo: percent of written tempo, BUZZER_TEMPO_NORMAL as written
+ * @param  byRepeat: number of plays, BUZZER_PLAY_FOREVER to loop
+ * @retval None
+ */
+void
+BuzzerPlayer_Play(
+    tone_p pListTone,
+    uint16_t wTempo,
+    uint8_t byRepeat
+) {
+    BuzzerPlayer_Stop();
+
+    if ((pListTone == NULL) || (wTempo == 0) || (byRepeat == 0)) {
+        return;
+    }
+
+    g_pListTone = pListTone;
+    BuzzerPlayer_Start(wTempo, byRepeat);
+}
+
+/**
+ * @func   BuzzerPlayer_PlayCompact
+ * @brief  Play a compact melody, a playing one is stopped. Notes are set
+ *         from precomputed timer values, no division per note. A melody
+ *         with a note out of C1 - B8 is not played
+ * @param  pbyMelody: melody, stays valid while playing
+ * @param  wTempo: percent of written tempo, BUZZER_TEMPO_NORMAL as written
+ * @param  byRepeat: number of plays, BUZZER_PLAY_FOREVER to loop
+ * @retval None
+ */
+void
+BuzzerPlayer_PlayCompact(
+    const uint8_t *pbyMelody,
+    uint16_t wTempo,
+    uint8_t byRepeat
+) {
+    uint32_t dwWhole;
+    uint32_t dwTicks;
+    uint16_t wCount;
+    uint16_t wBpm;
+    uint8_t i;
+
+    BuzzerPlayer_Stop();
+
+    if ((pbyMelody == NULL) || (wTempo == 0) || (byRepeat == 0)) {
+        return;
+    }
+
+    wCount = (uint16_t)(pbyMelody[0] | (pbyMelody[1] << 8));
+    wBpm = (uint16_t)(pbyMelody[2] | (pbyMelody[3] << 8));
+    if ((wBpm == 0) || !BuzzerPlayer_CheckCompact(pbyMelody, wCount)) {
+        return;
+    }
+
+    /* Divisions of the melody are done once here */
+    dwWhole = (uint32_t)((uint64_t)BUZZER_WHOLE_TICKS * BUZZER_TEMPO_NORMAL /
+                         ((uint32_t)wBpm * wTempo));
+    for (i = 0; i <= BUZZER_MELODY_DURATION_MASK; i++) {
+        dwTicks = dwWhole >> (i & 0x07);
+        if (i & BUZZER_MELODY_DOTTED) {
+            dwTicks += dwTicks >> 1;
+        }
+        g_pwTicks[i] = (dwTicks > BUZZER_NOTE_TICK_MAX) ? BUZZER_NOTE_TICK_MAX : (uint16_t)dwTicks;
+    }
+
+    g_pbyMelody = pbyMelody;
+    g_wCount = wCount;
+    BuzzerPlayer_Start(wTempo, byRepeat);
+}
+
+/**
+ * @func   BuzzerPlayer_Stop
+ * @brief  Stop melody, buzzer is silent
+ * @param  None
+ * @retval None
+ */
+void
+BuzzerPlayer_Stop(void)
+{
+    TIM_Cmd(BUZZER_NOTE_TIM, DISABLE);
+    TIM_ClearITPendingBit(BUZZER_NOTE_TIM, TIM_IT_Update);
+    g_bPlaying = 0;
+    g_pListTone = NULL;
+    g_pbyMelody = NULL;
+
+    TIM_SetCompare4(BUZZER_PWM_TIM, 0);
+}
+
+/**
+ * @func   BuzzerPlayer_IsPlaying
+ * @brief  Check a melody is playing
+ * @param  None
+ * @retval 1 if playing; 0 otherwise
+ */
+uint8_t
+BuzzerPlayer_IsPlaying(void)
+{
+    return g_bPlaying;
+}
+
+/**
+ * @func   BuzzerPlayer_SetVolume
+ * @brief  Set volume from next note
+ * @param  byVolume: duty cycle of PWM, 0 - 50 %
+ * @retval None
+ */
+void
+BuzzerPlayer_SetVolume(
+    uint8_t byVolume
+) {
+    g_byVolume = (byVolume > BUZZER_VOLUME_MAX) ? BUZZER_VOLUME_MAX : byVolume;
+    g_wDuty = (uint16_t)(g_byVolume * 256u / 100u);
+}
+
+/**
+ * @func   BUZZER_NOTE_IRQHandler
+ * @brief  Current note is over, load next one
+ * @param  None
+ * @retval None
+ */
+void
+BUZZER_NOTE_IRQHandler(void)
+{
+    if (TIM_GetITStatus(BUZZER_NOTE_TIM, TIM_IT_Update) == RESET) {
+        return;
+    }
+    TIM_ClearITPendingBit(BUZZER_NOTE_TIM, TIM_IT_Update);
+
+    if (!g_bPlaying || !BuzzerPlayer_LoadNote()) {
+        BuzzerPlayer_Stop();
+    }
+}
+
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+/**
+ * @func   BuzzerPlayer_Start
+ * @brief  Load first note and start note timer
+ * @param  wTempo: percent of written tempo
+ * @param  byRepeat: number of plays
+ * @retval None
+ */
+static void
+BuzzerPlayer_Start(
+    uint16_t wTempo,
+    uint8_t byRepeat
+) {
+    g_wIndex = 0;
+    g_pbyNext = NULL;
+    g_wTempo = wTempo;
+    g_byRepeat = byRepeat;
+
+    if (!BuzzerPlayer_LoadNote()) {
+        BuzzerPlayer_Stop();
+        return;
+    }
+
+    /* First note now, others at end of a PWM period */
+    TIM_GenerateEvent(BUZZER_PWM_TIM, TIM_EventSource_Update);
+
+    g_bPlaying = 1;
+    TIM_SetCounter(BUZZER_NOTE_TIM, 0);
+    TIM_Cmd(BUZZER_NOTE_TIM, ENABLE);
+}
+
+/**
+ * @func   BuzzerPlayer_LoadNote
+ * @brief  Set tone of next note and its length on note timer
+ * @param  None
+ * @retval 0 if melody is over
+ */
+static uint8_t
+BuzzerPlayer_LoadNote(void)
+{
+    if (g_pbyMelody != NULL) {
+        return BuzzerPlayer_LoadCompact();
+    }
+
+    return BuzzerPlayer_LoadTone();
+}
+
+/**
+ * @func   BuzzerPlayer_LoadTone
+ * @brief  Next note of tone_t list. At end of list the melody starts again
+ *         while repeats are left
+ * @param  None
+ * @retval 0 if melody is over
+ */
+static uint8_t
+BuzzerPlayer_LoadTone(void)
+{
+    tone_p pTone = &g_pListTone[g_wIndex];
+
+    if ((pTone->freq == 0) && (pTone->duration == 0)) {
+        if (g_wIndex == 0) {
+            return 0;
+        }
+
+        if ((g_byRepeat != BUZZER_PLAY_FOREVER) && (--g_byRepeat == 0)) {
+            return 0;
+        }
+
+        g_wIndex = 0;
+        pTone = &g_pListTone[0];
+    }
+
+    g_wIndex++;
+
+    BuzzerPlayer_SetTone(pTone->freq);
+    BuzzerPlayer_SetTicks((uint32_t)pTone->duration * (BUZZER_NOTE_TIM_HZ / 1000u) *
+                          BUZZER_TEMPO_NORMAL / g_wTempo);
+
+    return 1;
+}
+
+/**
+ * @func   BuzzerPlayer_LoadCompact
+ * @brief  Next note of compact melody, from tables only
+ * @param  None
+ * @retval 0 if melody is over
+ */
+static uint8_t
+BuzzerPlayer_LoadCompact(void)
+{
+    const buzzer_note_t *pNote;
+    uint8_t byNote;
+    uint8_t byDuration;
+
+    if ((g_pbyNext == NULL) || (g_wIndex >= g_wCount)) {
+        if (g_wCount == 0) {
+            return 0;
+        }
+
+        if ((g_pbyNext != NULL) && (g_byRepeat != BUZZER_PLAY_FOREVER) && (--g_byRepeat == 0)) {
+            return 0;
+        }
+
+        g_wIndex = 0;
+        g_pbyNext = g_pbyMelody + BUZZER_MELODY_HEADER_SIZE;
+    }
+
+    g_wIndex++;
+
+    byNote = *g_pbyNext++;
+    byDuration = (uint8_t)(byNote >> 6);
+    if (byDuration == BUZZER_MELODY_DURATION_NEXT) {
+        byDuration = *g_pbyNext++;
+    } else {
+        byDuration = g_pbyMelody[5 + byDuration];
+    }
+
+    byNote &= BUZZER_MELODY_NOTE_MASK;
+    if (byNote == 0) {
+        TIM_SetCompare4(BUZZER_PWM_TIM, 0);
+    } else {
+        pNote = &g_pNote[g_pbyMelody[4] + byNote - 1];
+        BUZZER_PWM_TIM->PSC = pNote->wPrescaler;
+        TIM_SetAutoreload(BUZZER_PWM_TIM, pNote->wPeriod);
+        TIM_SetCompare4(BUZZER_PWM_TIM, ((uint32_t)(pNote->wPeriod + 1) * g_wDuty) >> 8);
+    }
+
+    BuzzerPlayer_SetTicks(g_pwTicks[byDuration & BUZZER_MELODY_DURATION_MASK]);
+
+    return 1;
+}
+
+/**
+ * @func   BuzzerPlayer_CheckCompact
+ * @brief  Check all notes of a compact melody are in the note table, so
+ *         notes are loaded without a check in the interrupt
+ * @param  pbyMelody: melody
+ * @param  wCount: number of notes
+ * @retval 1 if melody can be played; 0 otherwise
+ */
+static uint8_t
+BuzzerPlayer_CheckCompact(
+    const uint8_t *pbyMelody,
+    uint16_t wCount
+) {
+    const uint8_t *pbyNext = pbyMelody + BUZZER_MELODY_HEADER_SIZE;
+    uint8_t byNote;
+    uint16_t i;
+
+    if (pbyMelody[4] >= BUZZER_NOTE_COUNT) {
+        return 0;
+    }
+
+    for (i = 0; i < wCount; i++) {
+        byNote = *pbyNext++;
+        if ((byNote >> 6) == BUZZER_MELODY_DURATION_NEXT) {
+            pbyNext++;
+        }
+
+        byNote &= BUZZER_MELODY_NOTE_MASK;
+        if ((byNote != 0) && ((uint32_t)pbyMelody[4] + byNote - 1 >= BUZZER_NOTE_COUNT)) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/**
+ * @func   BuzzerPlayer_SetTone
+ * @brief  Preload PWM of buzzer for a frequency, taken at next update
+ * @param  wFreq: frequency (Hz), 0 for a rest
+ * @retval None
+ */
+static void
+BuzzerPlayer_SetTone(
+    uint16_t wFreq
+) {
+    uint32_t dwCycles;
+    uint32_t dwPrescaler;
+    uint32_t dwPeriod;
+
+    if (wFreq == 0) {
+        TIM_SetCompare4(BUZZER_PWM_TIM, 0);
+        return;
+    }
+
+    dwCycles = BUZZER_TIM_HZ / wFreq;
+    dwPrescaler = dwCycles / 0x10000u + 1;
+    dwPeriod = dwCycles / dwPrescaler;
+
+    BUZZER_PWM_TIM->PSC = (uint16_t)(dwPrescaler - 1);
+    TIM_SetAutoreload(BUZZER_PWM_TIM, dwPeriod - 1);
+    TIM_SetCompare4(BUZZER_PWM_TIM, (dwPeriod * g_wDuty) >> 8);
+}
+
+/**
+ * @func   BuzzerPlayer_SetTicks
+ * @brief  Length of current note on note timer
+ * @param  dwTicks: ticks of 0.1 ms
+ * @retval None
+ */
+static void
+BuzzerPlayer_SetTicks(
+    uint32_t dwTicks
+) {
+    if (dwTicks == 0) {
+        dwTicks = 1;
+    } else if (dwTicks > BUZZER_NOTE_TICK_MAX) {
+        dwTicks = BUZZER_NOTE_TICK_MAX;
+    }
+
+    TIM_SetAutoreload(BUZZER_NOTE_TIM, dwTicks - 1);
+}
+
+/* END FILE */
@@ -0,0 +1,139 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Melody player, notes are changed by timer interrupt so
+ *              timing does not depend on load of main loop
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+#ifndef _BUZZERPLAYER_H_
+#define _BUZZERPLAYER_H_
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <stdint.h>
+#include "buzzer.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+/*! @brief Tempo of a melody as written (percent) */
+#define BUZZER_TEMPO_NORMAL                 100u
+
+/*! @brief Repeat a melody until BuzzerPlayer_Stop */
+#define BUZZER_PLAY_FOREVER                 0xFFu
+
+/*! @brief Default volume, duty cycle of PWM (percent) */
+#define BUZZER_VOLUME_DEFAULT               50u
+
+/*!
+ * Compact melody, made from RTTTL by tools/buzzer_rtttl:
+ *   0, 1   number of notes, little endian
+ *   2, 3   beats per minute (quarter notes), little endian
+ *   4      lowest note, semitones above C1
+ *   5 - 7  durations of 1-byte notes
+ *   8 -    notes, bits 7-6: duration at byte 5 + n, 3 if it is in next byte
+ *                 bits 5-0: 0 rest, else semitones above lowest note + 1
+ * Duration: bits 2-0 note is 1 / 2^n of whole note, bit 3 dotted
+ */
+#define BUZZER_MELODY_HEADER_SIZE           8u
+#define BUZZER_MELODY_DURATION_NEXT         3u
+#define BUZZER_MELODY_DOTTED                0x08u
+#define BUZZER_MELODY_DURATION_MASK         0x0Fu
+#define BUZZER_MELODY_NOTE_MASK             0x3Fu
+
+/*! @brief Notes of compact melody, C1 - B8 */
+#define BUZZER_NOTE_COUNT                   96u
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func   BuzzerPlayer_Init
+ * @brief  Initialize note timer, after BuzzerControl_Init. Not to be used
+ *         together with BuzzerControl_SetMelody
+ * @param  None
+ * @retval None
+ */
+void
+BuzzerPlayer_Init(void);
+
+/**
+ * @func   BuzzerPlayer_Play
+ * @brief  Play a melody, a playing one is stopped. Notes of freq 0 are
+ *         rests, list ends with { 0, 0 }
+ * @param  pListTone: melody, stays valid while playing
+ * @param  wTempo: percent of written tempo, BUZZER_TEMPO_NORMAL as written
+ * @param  byRepeat: number of plays, BUZZER_PLAY_FOREVER to loop
+ * @retval None
+ */
+void
+BuzzerPlayer_Play(
+    tone_p pListTone,
+    uint16_t wTempo,
+    uint8_t byRepeat
+);
+
+/**
+ * @func   BuzzerPlayer_PlayCompact
+ * @brief  Play a compact melody, a playing one is stopped. Notes are set
+ *         from precomputed timer values, no division per note. A melody
+ *         with a note out of C1 - B8 is not played
+ * @param  pbyMelody: melody, stays valid while playing
+ * @param  wTempo: percent of written tempo, BUZZER_TEMPO_NORMAL as written
+ * @param  byRepeat: number of plays, BUZZER_PLAY_FOREVER to loop
+ * @retval None
+ */
+void
+BuzzerPlayer_PlayCompact(
+    const uint8_t *pbyMelody,
+    uint16_t wTempo,
+    uint8_t byRepeat
+);
+
+/**
+ * @func   BuzzerPlayer_Stop
+ * @brief  Stop melody, buzzer is silent
+ * @param  None
+ * @retval None
+ */
+void
+BuzzerPlayer_Stop(void);
+
+/**
+ * @func   BuzzerPlayer_IsPlaying
+ * @brief  Check a melody is playing
+ * @param  None
+ * @retval 1 if playing; 0 otherwise
+ */
+uint8_t
+BuzzerPlayer_IsPlaying(void);
+
+/**
+ * @func   BuzzerPlayer_SetVolume
+ * @brief  Set volume from next note
+ * @param  byVolume: duty cycle of PWM, 0 - 50 %
+ * @retval None
+ */
+void
+BuzzerPlayer_SetVolume(
+    uint8_t byVolume
+);
+
+#endif
+
+/* END FILE */
@@ -0,0 +1,303 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Display task, redraws invalidated screen parts once per frame.
+ *              Callbacks only invalidate clients, the frame timer renders
+ *              them, so a burst of events gives one redraw
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include "stm32f401re.h"
+#include "utilities.h"
+#include "timer.h"
+#include "displaytask.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+typedef struct {
+    display_render_fnptr pRender;
+    void *pData;
+} display_client_t, *display_client_p;
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+static display_client_t g_pClient[DISPLAY_CLIENT_MAX];
+static uint8_t g_byClientCount;
+
+/* Bit n set: client n is rendered in next frame, clients left over by a
+ * frame cut by budget stay set */
+static volatile uint8_t g_byInvalid;
+
+static uint8_t g_byTimerId = NO_TIMER;
+static uint16_t g_wBudget = DISPLAY_BUDGET_DEFAULT;
+
+static display_stat_t g_stat;
+static uint32_t g_dwFrameTime;
+static uint32_t g_dwStatStart;
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static void DisplayTask_Frame(void *pData);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func   DisplayTask_Init
+ * @brief  Start frame timer at default frame rate and budget, no client
+ * @param  None
+ * @retval None
+ */
+void
+DisplayTask_Init(void)
+{
+    memsetl((uint8_t *)g_pClient, 0, sizeof(g_pClient));
+    g_byClientCount = 0;
+    g_byInvalid = 0;
+    g_wBudget = DISPLAY_BUDGET_DEFAULT;
+
+    DisplayTask_SetFrameRate(DISPLAY_FPS_DEFAULT);
+    DisplayTask_ResetStatistic();
+}
+
+/**
+ * @func   DisplayTask_SetFrameRate
+ * @brief  Change frame rate
+ * @param  byFps: frames per second, 0 to stop rendering
+ * @retval None
+ */
+void
+DisplayTask_SetFrameRate(
+    uint8_t byFps
+) {
+    if (g_byTimerId != NO_TIMER) {
+        TimerStop(g_byTimerId);
+        g_byTimerId = NO_TIMER;
+    }
+
+    if (byFps != 0) {
+        g_byTimerId = TimerStart("display", 1000u / byFps, TIMER_REPEAT_FOREVER,
+                                 DisplayTask_Frame, NULL);
+    }
+}
+
+/**
+ * @func   DisplayTask_SetBudget
+ * @brief  Change time of render in a frame. At least one client is rendered
+ *         in every frame
+ * @param  wBudget: time in ms
+ * @retval None
+ */
+void
+DisplayTask_SetBudget(
+    uint16_t wBudget
+) {
+    g_wBudget = wBudget;
+}
+
+/**
+ * @func   DisplayTask_Register
+ * @brief  Add a client, clients are rendered in order of registration
+ *         (background first). Client is invalid until first frame
+ * @param  pRender: render of client
+ * @param  pData: data of render
+ * @retval Id of client, DISPLAY_NO_CLIENT if there is no room
+ */
+uint8_t
+DisplayTask_Register(
+    display_render_fnptr pRender,
+    void *pData
+) {
+    uint8_t byId;
+
+    if ((pRender == NULL) || (g_byClientCount >= DISPLAY_CLIENT_MAX)) {
+        return DISPLAY_NO_CLIENT;
+    }
+
+    byId = g_byClientCount++;
+    g_pClient[byId].pRender = pRender;
+    g_pClient[byId].pData = pData;
+    DisplayTask_Invalidate(byId);
+
+    return byId;
+}
+
+/**
+ * @func   DisplayTask_Invalidate
+ * @brief  Mark a client to be rendered in next frame, no drawing here. May
+ *         be called from button, serial and sensor callbacks or interrupts
+ * @param  byId: id of client
+ * @retval None
+ */
+void
+DisplayTask_Invalidate(
+    uint8_t byId
+) {
+    uint32_t dwPrimask;
+    uint8_t byMask;
+
+    if (byId >= g_byClientCount) {
+        return;
+    }
+
+    byMask = (uint8_t)(1u << byId);
+
+    /* May be called with interrupts masked, mask is restored as it was */
+    dwPrimask = __get_PRIMASK();
+    __disable_irq();
+    g_stat.dwInvalidate++;
+    if (g_byInvalid & byMask) {
+        g_stat.dwCoalesced++;
+    }
+    g_byInvalid |= byMask;
+    __set_PRIMASK(dwPrimask);
+}
+
+/**
+ * @func   DisplayTask_InvalidateAll
+ * @brief  Mark all clients to be rendered in next frame
+ * @param  None
+ * @retval None
+ */
+void
+DisplayTask_InvalidateAll(void)
+{
+    uint8_t i;
+
+    for (i = 0; i < g_byClientCount; i++) {
+        DisplayTask_Invalidate(i);
+    }
+}
+
+/**
+ * @func   DisplayTask_GetStatistic
+ * @brief  Get frame rate and frame time
+ * @param  pStat: statistic
+ * @retval None
+ */
+void
+DisplayTask_GetStatistic(
+    display_stat_p pStat
+) {
+    uint32_t dwElapsed = GetMilSecTick() - g_dwStatStart;
+    uint32_t dwPrimask;
+
+    /* Counters of DisplayTask_Invalidate from interrupts, copied at once */
+    dwPrimask = __get_PRIMASK();
+    __disable_irq();
+    *pStat = g_stat;
+    __set_PRIMASK(dwPrimask);
+
+    pStat->wFps = 0;
+    if (dwElapsed != 0) {
+        pStat->wFps = (uint16_t)(((uint64_t)pStat->dwFrame * 100000) / dwElapsed);
+    }
+
+    pStat->wFrameTimeAvg = 0;
+    if (pStat->dwFrame != 0) {
+        pStat->wFrameTimeAvg = (uint16_t)(g_dwFrameTime / pStat->dwFrame);
+    }
+}
+
+/**
+ * @func   DisplayTask_ResetStatistic
+ * @brief  Clear statistic
+ * @param  None
+ * @retval None
+ */
+void
+DisplayTask_ResetStatistic(void)
+{
+    uint32_t dwPrimask;
+
+    dwPrimask = __get_PRIMASK();
+    __disable_irq();
+    memsetl((uint8_t *)&g_stat, 0, sizeof(g_stat));
+    __set_PRIMASK(dwPrimask);
+    g_dwFrameTime = 0;
+    g_dwStatStart = GetMilSecTick();
+}
+
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+/**
+ * @func   DisplayTask_Frame
+ * @brief  Timer callback, render clients invalidated since last frame in
+ *         order of id (background first). When budget is over, the others
+ *         stay invalid and are rendered in next frame, main loop runs in
+ *         between
+ * @param  pData: not used
+ * @retval None
+ */
+static void
+DisplayTask_Frame(
+    void *pData
+) {
+    uint32_t dwPrimask;
+    uint32_t dwStart;
+    uint32_t dwTime;
+    uint8_t byInvalid;
+    uint8_t byId;
+    uint8_t bRendered = 0;
+
+    (void)pData;
+
+    dwPrimask = __get_PRIMASK();
+    __disable_irq();
+    byInvalid = g_byInvalid;
+    g_byInvalid = 0;
+    __set_PRIMASK(dwPrimask);
+
+    if (byInvalid == 0) {
+        g_stat.dwIdle++;
+        return;
+    }
+
+    dwStart = GetMilSecTick();
+
+    for (byId = 0; byId < g_byClientCount; byId++) {
+        if (!(byInvalid & (1u << byId))) {
+            continue;
+        }
+
+        if (bRendered && ((GetMilSecTick() - dwStart) >= g_wBudget)) {
+            /* Clients not rendered yet, with the ones invalidated meanwhile */
+            dwPrimask = __get_PRIMASK();
+            __disable_irq();
+            g_byInvalid |= byInvalid;
+            __set_PRIMASK(dwPrimask);
+            g_stat.dwOverBudget++;
+            break;
+        }
+
+        byInvalid &= (uint8_t)~(1u << byId);
+        g_pClient[byId].pRender(g_pClient[byId].pData);
+        bRendered = 1;
+    }
+
+    dwTime = GetMilSecTick() - dwStart;
+    g_dwFrameTime += dwTime;
+    if (dwTime > g_stat.wFrameTimeMax) {
+        g_stat.wFrameTimeMax = (uint16_t)dwTime;
+    }
+    g_stat.dwFrame++;
+}
+
+/* END FILE */
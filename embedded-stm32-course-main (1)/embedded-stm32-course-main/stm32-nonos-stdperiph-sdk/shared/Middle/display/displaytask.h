@@ -0,0 +1,152 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Display task, redraws invalidated screen parts once per frame
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+#ifndef _DISPLAYTASK_H_
+#define _DISPLAYTASK_H_
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <stdint.h>
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define DISPLAY_CLIENT_MAX                   8u
+#define DISPLAY_NO_CLIENT                    0xFFu
+
+/*! @brief Default frame rate (frames per second) */
+#define DISPLAY_FPS_DEFAULT                  20u
+
+/*! @brief Default time (ms) of render in a frame, clients left over are
+ *         rendered in next frame so main loop keeps serving serial */
+#define DISPLAY_BUDGET_DEFAULT               20u
+
+/*! @brief Render of a client, draws its part of screen */
+typedef void (*display_render_fnptr)(void *pData);
+
+/*!
+ * Statistic of display task, since DisplayTask_ResetStatistic.
+ * Frame rate in 0.01 fps, frame time is time of render in a frame.
+ */
+typedef struct {
+    uint32_t dwFrame;        /*< Frames rendered */
+    uint32_t dwIdle;         /*< Frames with nothing invalidated */
+    uint32_t dwOverBudget;   /*< Frames cut by budget */
+    uint32_t dwInvalidate;   /*< Calls of DisplayTask_Invalidate */
+    uint32_t dwCoalesced;    /*< Invalidations of a client already invalid */
+    uint16_t wFps;           /*< Frames rendered per 100 s */
+    uint16_t wFrameTimeAvg;  /*< Average frame time (ms) */
+    uint16_t wFrameTimeMax;  /*< Longest frame time (ms) */
+} display_stat_t, *display_stat_p;
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func   DisplayTask_Init
+ * @brief  Start frame timer at default frame rate and budget, no client
+ * @param  None
+ * @retval None
+ */
+void
+DisplayTask_Init(void);
+
+/**
+ * @func   DisplayTask_SetFrameRate
+ * @brief  Change frame rate
+ * @param  byFps: frames per second, 0 to stop rendering
+ * @retval None
+ */
+void
+DisplayTask_SetFrameRate(
+    uint8_t byFps
+);
+
+/**
+ * @func   DisplayTask_SetBudget
+ * @brief  Change time of render in a frame. At least one client is rendered
+ *         in every frame
+ * @param  wBudget: time in ms
+ * @retval None
+ */
+void
+DisplayTask_SetBudget(
+    uint16_t wBudget
+);
+
+/**
+ * @func   DisplayTask_Register
+ * @brief  Add a client, clients are rendered in order of registration
+ *         (background first). Client is invalid until first frame
+ * @param  pRender: render of client
+ * @param  pData: data of render
+ * @retval Id of client, DISPLAY_NO_CLIENT if there is no room
+ */
+uint8_t
+DisplayTask_Register(
+    display_render_fnptr pRender,
+    void *pData
+);
+
+/**
+ * @func   DisplayTask_Invalidate
+ * @brief  Mark a client to be rendered in next frame, no drawing here. May
+ *         be called from button, serial and sensor callbacks or interrupts
+ * @param  byId: id of client
+ * @retval None
+ */
+void
+DisplayTask_Invalidate(
+    uint8_t byId
+);
+
+/**
+ * @func   DisplayTask_InvalidateAll
+ * @brief  Mark all clients to be rendered in next frame
+ * @param  None
+ * @retval None
+ */
+void
+DisplayTask_InvalidateAll(void);
+
+/**
+ * @func   DisplayTask_GetStatistic
+ * @brief  Get frame rate and frame time
+ * @param  pStat: statistic
+ * @retval None
+ */
+void
+DisplayTask_GetStatistic(
+    display_stat_p pStat
+);
+
+/**
+ * @func   DisplayTask_ResetStatistic
+ * @brief  Clear statistic
+ * @param  None
+ * @retval None
+ */
+void
+DisplayTask_ResetStatistic(void);
+
+#endif
+
+/* END FILE */
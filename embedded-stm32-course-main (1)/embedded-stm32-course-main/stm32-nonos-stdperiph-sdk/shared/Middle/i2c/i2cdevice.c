@@ -0,0 +1,414 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Register map access of I2C devices on top of I2C engine
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include "utilities.h"
+#include "i2cengine.h"
+#include "i2cdevice.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+/* Request of blocking helpers */
+static i2c_device_req_t g_reqBlocking;
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static uint8_t I2CDevice_Prepare(i2c_device_p pDevice, i2c_device_req_p pReq, uint16_t wReg);
+static uint8_t I2CDevice_Run(i2c_device_req_p pReq);
+static uint8_t I2CDevice_Result(uint8_t byXferStatus);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func   I2CDevice_Init
+ * @brief  Describe a slave, default timeout and retries
+ * @param  pDevice: device
+ * @param  byAddress: 7-bit slave address
+ * @param  byRegSize: I2C_DEVICE_REG_8BIT or I2C_DEVICE_REG_16BIT
+ * @retval None
+ */
+void
+I2CDevice_Init(
+    i2c_device_p pDevice,
+    uint8_t byAddress,
+    uint8_t byRegSize
+) {
+    pDevice->byAddress = byAddress;
+    pDevice->byRegSize = (byRegSize == I2C_DEVICE_REG_16BIT) ?
+                         I2C_DEVICE_REG_16BIT : I2C_DEVICE_REG_8BIT;
+    pDevice->byTimeout = 0;
+    pDevice->byRetry = I2C_DEVICE_RETRY_DEFAULT;
+}
+
+/**
+ * @func   I2CDevice_PrepareRead
+ * @brief  Build a burst read of registers, not submitted
+ * @param  pDevice: device
+ * @param  pReq: request
+ * @param  wReg: first register
+ * @param  pbyData: buffer for data read
+ * @param  byLength: number of bytes
+ * @retval I2C_DEVICE_OK or I2C_DEVICE_ERR_PARAM
+ */
+uint8_t
+I2CDevice_PrepareRead(
+    i2c_device_p pDevice,
+    i2c_device_req_p pReq,
+    uint16_t wReg,
+    uint8_t *pbyData,
+    uint8_t byLength
+) {
+    if ((pbyData == NULL) || (byLength == 0)) {
+        return I2C_DEVICE_ERR_PARAM;
+    }
+
+    pReq->xfer.byTxLength = I2CDevice_Prepare(pDevice, pReq, wReg);
+    pReq->xfer.pRxData = pbyData;
+    pReq->xfer.byRxLength = byLength;
+
+    return I2C_DEVICE_OK;
+}
+
+/**
+ * @func   I2CDevice_PrepareWrite
+ * @brief  Build a burst write of registers, data is copied into request
+ * @param  pDevice: device
+ * @param  pReq: request
+ * @param  wReg: first register
+ * @param  pbyData: data to write
+ * @param  byLength: number of bytes, up to I2C_DEVICE_BURST_MAX
+ * @retval I2C_DEVICE_OK or I2C_DEVICE_ERR_PARAM
+ */
+uint8_t
+I2CDevice_PrepareWrite(
+    i2c_device_p pDevice,
+    i2c_device_req_p pReq,
+    uint16_t wReg,
+    uint8_t *pbyData,
+    uint8_t byLength
+) {
+    uint8_t byRegSize;
+
+    if ((pbyData == NULL) || (byLength == 0) || (byLength > I2C_DEVICE_BURST_MAX)) {
+        return I2C_DEVICE_ERR_PARAM;
+    }
+
+    byRegSize = I2CDevice_Prepare(pDevice, pReq, wReg);
+    memcpyl(&pReq->pbyTxBuffer[byRegSize], pbyData, byLength);
+    pReq->xfer.byTxLength = byRegSize + byLength;
+    pReq->xfer.pRxData = NULL;
+    pReq->xfer.byRxLength = 0;
+
+    return I2C_DEVICE_OK;
+}
+
+/**
+ * @func   I2CDevice_SubmitBatch
+ * @brief  Submit prepared requests, possibly of different devices, to run
+ *         back-to-back. Callback of each request is called from processI2CEngine
+ * @param  ppReq: requests
+ * @param  byCount: number of requests, up to I2C_ENGINE_QUEUE_SIZE
+ * @retval I2C_DEVICE_OK, I2C_DEVICE_ERR_FULL or I2C_DEVICE_ERR_PARAM
+ */
+uint8_t
+I2CDevice_SubmitBatch(
+    i2c_device_req_p *ppReq,
+    uint8_t byCount
+) {
+    i2c_xfer_p pXfer[I2C_ENGINE_QUEUE_SIZE];
+    uint8_t i;
+
+    if ((byCount == 0) || (byCount > I2C_ENGINE_QUEUE_SIZE)) {
+        return I2C_DEVICE_ERR_PARAM;
+    }
+
+    for (i = 0; i < byCount; i++) {
+        pXfer[i] = &ppReq[i]->xfer;
+    }
+
+    switch (I2CEngine_SubmitBatch(pXfer, byCount)) {
+    case I2C_ENGINE_OK:
+        return I2C_DEVICE_OK;
+
+    case I2C_ENGINE_ERR_FULL:
+        return I2C_DEVICE_ERR_FULL;
+
+    default:
+        return I2C_DEVICE_ERR_PARAM;
+    }
+}
+
+/**
+ * @func   I2CDevice_ReadRegAsync
+ * @brief  Burst read of registers, result is reported by callback
+ * @param  pDevice: device
+ * @param  pReq: request
+ * @param  wReg: first register
+ * @param  pbyData: buffer for data read
+ * @param  byLength: number of bytes
+ * @param  callback: called when finished
+ * @param  pCallbackData: parameter of callback
+ * @retval I2C_DEVICE_OK or error code
+ */
+uint8_t
+I2CDevice_ReadRegAsync(
+    i2c_device_p pDevice,
+    i2c_device_req_p pReq,
+    uint16_t wReg,
+    uint8_t *pbyData,
+    uint8_t byLength,
+    i2c_xfer_callback callback,
+    void *pCallbackData
+) {
+    uint8_t byStatus = I2CDevice_PrepareRead(pDevice, pReq, wReg, pbyData, byLength);
+
+    if (byStatus != I2C_DEVICE_OK) {
+        return byStatus;
+    }
+
+    pReq->xfer.callback = callback;
+    pReq->xfer.pCallbackData = pCallbackData;
+
+    return I2CDevice_SubmitBatch(&pReq, 1);
+}
+
+/**
+ * @func   I2CDevice_WriteRegAsync
+ * @brief  Burst write of registers, result is reported by callback
+ * @param  pDevice: device
+ * @param  pReq: request
+ * @param  wReg: first register
+ * @param  pbyData: data to write
+ * @param  byLength: number of bytes, up to I2C_DEVICE_BURST_MAX
+ * @param  callback: called when finished
+ * @param  pCallbackData: parameter of callback
+ * @retval I2C_DEVICE_OK or error code
+ */
+uint8_t
+I2CDevice_WriteRegAsync(
+    i2c_device_p pDevice,
+    i2c_device_req_p pReq,
+    uint16_t wReg,
+    uint8_t *pbyData,
+    uint8_t byLength,
+    i2c_xfer_callback callback,
+    void *pCallbackData
+) {
+    uint8_t byStatus = I2CDevice_PrepareWrite(pDevice, pReq, wReg, pbyData, byLength);
+
+    if (byStatus != I2C_DEVICE_OK) {
+        return byStatus;
+    }
+
+    pReq->xfer.callback = callback;
+    pReq->xfer.pCallbackData = pCallbackData;
+
+    return I2CDevice_SubmitBatch(&pReq, 1);
+}
+
+/**
+ * @func   I2CDevice_ReadReg
+ * @brief  Burst read of registers, wait until finished. Bounded by timeout
+ *         and retries of transfers queued before
+ * @param  pDevice: device
+ * @param  wReg: first register
+ * @param  pbyData: buffer for data read
+ * @param  byLength: number of bytes
+ * @retval I2C_DEVICE_OK or error code
+ */
+uint8_t
+I2CDevice_ReadReg(
+    i2c_device_p pDevice,
+    uint16_t wReg,
+    uint8_t *pbyData,
+    uint8_t byLength
+) {
+    uint8_t byStatus = I2CDevice_PrepareRead(pDevice, &g_reqBlocking, wReg, pbyData, byLength);
+
+    if (byStatus != I2C_DEVICE_OK) {
+        return byStatus;
+    }
+
+    return I2CDevice_Run(&g_reqBlocking);
+}
+
+/**
+ * @func   I2CDevice_WriteReg
+ * @brief  Burst write of registers, wait until finished
+ * @param  pDevice: device
+ * @param  wReg: first register
+ * @param  pbyData: data to write
+ * @param  byLength: number of bytes, up to I2C_DEVICE_BURST_MAX
+ * @retval I2C_DEVICE_OK or error code
+ */
+uint8_t
+I2CDevice_WriteReg(
+    i2c_device_p pDevice,
+    uint16_t wReg,
+    uint8_t *pbyData,
+    uint8_t byLength
+) {
+    uint8_t byStatus = I2CDevice_PrepareWrite(pDevice, &g_reqBlocking, wReg, pbyData, byLength);
+
+    if (byStatus != I2C_DEVICE_OK) {
+        return byStatus;
+    }
+
+    return I2CDevice_Run(&g_reqBlocking);
+}
+
+/**
+ * @func   I2CDevice_UpdateReg
+ * @brief  Read-modify-write bits of a register
+ * @param  pDevice: device
+ * @param  wReg: register
+ * @param  byMask: bits to change
+ * @param  byValue: new value of bits
+ * @retval I2C_DEVICE_OK or error code
+ */
+uint8_t
+I2CDevice_UpdateReg(
+    i2c_device_p pDevice,
+    uint16_t wReg,
+    uint8_t byMask,
+    uint8_t byValue
+) {
+    uint8_t byReg;
+    uint8_t byStatus = I2CDevice_ReadReg(pDevice, wReg, &byReg, 1);
+
+    if (byStatus != I2C_DEVICE_OK) {
+        return byStatus;
+    }
+
+    byReg = (byReg & ~byMask) | (byValue & byMask);
+
+    return I2CDevice_WriteReg(pDevice, wReg, &byReg, 1);
+}
+
+/**
+ * @func   I2CDevice_Probe
+ * @brief  Check a slave ACKs its address
+ * @param  pDevice: device
+ * @retval I2C_DEVICE_OK or error code
+ */
+uint8_t
+I2CDevice_Probe(
+    i2c_device_p pDevice
+) {
+    I2CDevice_Prepare(pDevice, &g_reqBlocking, 0);
+    g_reqBlocking.xfer.byTxLength = 0;
+    g_reqBlocking.xfer.pRxData = NULL;
+    g_reqBlocking.xfer.byRxLength = 0;
+    g_reqBlocking.xfer.byRetry = 0;
+
+    return I2CDevice_Run(&g_reqBlocking);
+}
+
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+/**
+ * @func   I2CDevice_Prepare
+ * @brief  Common part of a request: slave, register address, timeout
+ * @param  pDevice: device
+ * @param  pReq: request
+ * @param  wReg: register
+ * @retval Size of register address
+ */
+static uint8_t
+I2CDevice_Prepare(
+    i2c_device_p pDevice,
+    i2c_device_req_p pReq,
+    uint16_t wReg
+) {
+    uint8_t byRegSize = 0;
+
+    if (pDevice->byRegSize == I2C_DEVICE_REG_16BIT) {
+        pReq->pbyTxBuffer[byRegSize++] = (uint8_t)(wReg >> 8);
+    }
+    pReq->pbyTxBuffer[byRegSize++] = (uint8_t)wReg;
+
+    pReq->xfer.byAddress = pDevice->byAddress;
+    pReq->xfer.pTxData = pReq->pbyTxBuffer;
+    pReq->xfer.byTimeout = pDevice->byTimeout;
+    pReq->xfer.byRetry = pDevice->byRetry;
+    pReq->xfer.callback = NULL;
+    pReq->xfer.pCallbackData = NULL;
+
+    return byRegSize;
+}
+
+/**
+ * @func   I2CDevice_Run
+ * @brief  Submit a request and wait it finished. Engine timeout ends every
+ *         transfer, so the wait is bounded
+ * @param  pReq: request
+ * @retval I2C_DEVICE_OK or error code
+ */
+static uint8_t
+I2CDevice_Run(
+    i2c_device_req_p pReq
+) {
+    uint8_t byStatus = I2CDevice_SubmitBatch(&pReq, 1);
+
+    if (byStatus != I2C_DEVICE_OK) {
+        return byStatus;
+    }
+
+    while ((pReq->xfer.byStatus == I2C_XFER_PENDING) ||
+           (pReq->xfer.byStatus == I2C_XFER_ACTIVE)) {
+        I2CEngine_CheckTimeout();
+    }
+
+    return I2CDevice_Result(pReq->xfer.byStatus);
+}
+
+/**
+ * @func   I2CDevice_Result
+ * @brief  Map status of transfer to return code
+ * @param  byXferStatus: i2c_xfer_status_t
+ * @retval I2C_DEVICE_OK or error code
+ */
+static uint8_t
+I2CDevice_Result(
+    uint8_t byXferStatus
+) {
+    switch (byXferStatus) {
+    case I2C_XFER_DONE:
+        return I2C_DEVICE_OK;
+
+    case I2C_XFER_ERR_NACK:
+        return I2C_DEVICE_ERR_NACK;
+
+    case I2C_XFER_ERR_TIMEOUT:
+        return I2C_DEVICE_ERR_TIMEOUT;
+
+    default:
+        return I2C_DEVICE_ERR_BUS;
+    }
+}
+
+/* END FILE */
@@ -0,0 +1,257 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Register map access of I2C devices on top of I2C engine
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+#ifndef _I2C_DEVICE_H_
+#define _I2C_DEVICE_H_
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <stdint.h>
+#include "i2cengine.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+/*! @brief Max bytes of a burst write */
+#define I2C_DEVICE_BURST_MAX                16u
+
+/*! @brief Size of register address */
+#define I2C_DEVICE_REG_8BIT                 1u
+#define I2C_DEVICE_REG_16BIT                2u
+
+/*! @brief Default retries of a device transfer */
+#define I2C_DEVICE_RETRY_DEFAULT            2u
+
+/*! @brief Return code */
+#define I2C_DEVICE_OK                       0x00u
+#define I2C_DEVICE_ERR_PARAM                0x01u
+#define I2C_DEVICE_ERR_FULL                 0x02u
+#define I2C_DEVICE_ERR_NACK                 0x03u
+#define I2C_DEVICE_ERR_BUS                  0x04u
+#define I2C_DEVICE_ERR_TIMEOUT              0x05u
+
+/*! @brief A slave on the bus */
+typedef struct {
+
+    uint8_t byAddress;               /*< 7-bit slave address */
+
+    uint8_t byRegSize;               /*< I2C_DEVICE_REG_8BIT or _16BIT */
+
+    uint8_t byTimeout;               /*< ms per transfer, 0: engine default */
+
+    uint8_t byRetry;                 /*< Retries per transfer */
+
+} i2c_device_t, *i2c_device_p;
+
+/*!
+ * Register request. Holds the transfer and the register address (+ data of
+ * a write), must stay valid until its callback has been called.
+ */
+typedef struct {
+
+    i2c_xfer_t xfer;
+
+    uint8_t pbyTxBuffer[I2C_DEVICE_REG_16BIT + I2C_DEVICE_BURST_MAX];
+
+} i2c_device_req_t, *i2c_device_req_p;
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func   I2CDevice_Init
+ * @brief  Describe a slave, default timeout and retries
+ * @param  pDevice: device
+ * @param  byAddress: 7-bit slave address
+ * @param  byRegSize: I2C_DEVICE_REG_8BIT or I2C_DEVICE_REG_16BIT
+ * @retval None
+ */
+void
+I2CDevice_Init(
+    i2c_device_p pDevice,
+    uint8_t byAddress,
+    uint8_t byRegSize
+);
+
+/**
+ * @func   I2CDevice_PrepareRead
+ * @brief  Build a burst read of registers, not submitted
+ * @param  pDevice: device
+ * @param  pReq: request
+ * @param  wReg: first register
+ * @param  pbyData: buffer for data read
+ * @param  byLength: number of bytes
+ * @retval I2C_DEVICE_OK or I2C_DEVICE_ERR_PARAM
+ */
+uint8_t
+I2CDevice_PrepareRead(
+    i2c_device_p pDevice,
+    i2c_device_req_p pReq,
+    uint16_t wReg,
+    uint8_t *pbyData,
+    uint8_t byLength
+);
+
+/**
+ * @func   I2CDevice_PrepareWrite
+ * @brief  Build a burst write of registers, data is copied into request
+ * @param  pDevice: device
+ * @param  pReq: request
+ * @param  wReg: first register
+ * @param  pbyData: data to write
+ * @param  byLength: number of bytes, up to I2C_DEVICE_BURST_MAX
+ * @retval I2C_DEVICE_OK or I2C_DEVICE_ERR_PARAM
+ */
+uint8_t
+I2CDevice_PrepareWrite(
+    i2c_device_p pDevice,
+    i2c_device_req_p pReq,
+    uint16_t wReg,
+    uint8_t *pbyData,
+    uint8_t byLength
+);
+
+/**
+ * @func   I2CDevice_SubmitBatch
+ * @brief  Submit prepared requests, possibly of different devices, to run
+ *         back-to-back. Callback of each request is called from processI2CEngine
+ * @param  ppReq: requests
+ * @param  byCount: number of requests, up to I2C_ENGINE_QUEUE_SIZE
+ * @retval I2C_DEVICE_OK, I2C_DEVICE_ERR_FULL or I2C_DEVICE_ERR_PARAM
+ */
+uint8_t
+I2CDevice_SubmitBatch(
+    i2c_device_req_p *ppReq,
+    uint8_t byCount
+);
+
+/**
+ * @func   I2CDevice_ReadRegAsync
+ * @brief  Burst read of registers, result is reported by callback
+ * @param  pDevice: device
+ * @param  pReq: request
+ * @param  wReg: first register
+ * @param  pbyData: buffer for data read
+ * @param  byLength: number of bytes
+ * @param  callback: called when finished
+ * @param  pCallbackData: parameter of callback
+ * @retval I2C_DEVICE_OK or error code
+ */
+uint8_t
+I2CDevice_ReadRegAsync(
+    i2c_device_p pDevice,
+    i2c_device_req_p pReq,
+    uint16_t wReg,
+    uint8_t *pbyData,
+    uint8_t byLength,
+    i2c_xfer_callback callback,
+    void *pCallbackData
+);
+
+/**
+ * @func   I2CDevice_WriteRegAsync
+ * @brief  Burst write of registers, result is reported by callback
+ * @param  pDevice: device
+ * @param  pReq: request
+ * @param  wReg: first register
+ * @param  pbyData: data to write
+ * @param  byLength: number of bytes, up to I2C_DEVICE_BURST_MAX
+ * @param  callback: called when finished
+ * @param  pCallbackData: parameter of callback
+ * @retval I2C_DEVICE_OK or error code
+ */
+uint8_t
+I2CDevice_WriteRegAsync(
+    i2c_device_p pDevice,
+    i2c_device_req_p pReq,
+    uint16_t wReg,
+    uint8_t *pbyData,
+    uint8_t byLength,
+    i2c_xfer_callback callback,
+    void *pCallbackData
+);
+
+/**
+ * @func   I2CDevice_ReadReg
+ * @brief  Burst read of registers, wait until finished. Bounded by timeout
+ *         and retries of transfers queued before
+ * @param  pDevice: device
+ * @param  wReg: first register
+ * @param  pbyData: buffer for data read
+ * @param  byLength: number of bytes
+ * @retval I2C_DEVICE_OK or error code
+ */
+uint8_t
+I2CDevice_ReadReg(
+    i2c_device_p pDevice,
+    uint16_t wReg,
+    uint8_t *pbyData,
+    uint8_t byLength
+);
+
+/**
+ * @func   I2CDevice_WriteReg
+ * @brief  Burst write of registers, wait until finished
+ * @param  pDevice: device
+ * @param  wReg: first register
+ * @param  pbyData: data to write
+ * @param  byLength: number of bytes, up to I2C_DEVICE_BURST_MAX
+ * @retval I2C_DEVICE_OK or error code
+ */
+uint8_t
+I2CDevice_WriteReg(
+    i2c_device_p pDevice,
+    uint16_t wReg,
+    uint8_t *pbyData,
+    uint8_t byLength
+);
+
+/**
+ * @func   I2CDevice_UpdateReg
+ * @brief  Read-modify-write bits of a register
+ * @param  pDevice: device
+ * @param  wReg: register
+ * @param  byMask: bits to change
+ * @param  byValue: new value of bits
+ * @retval I2C_DEVICE_OK or error code
+ */
+uint8_t
+I2CDevice_UpdateReg(
+    i2c_device_p pDevice,
+    uint16_t wReg,
+    uint8_t byMask,
+    uint8_t byValue
+);
+
+/**
+ * @func   I2CDevice_Probe
+ * @brief  Check a slave ACKs its address
+ * @param  pDevice: device
+ * @retval I2C_DEVICE_OK or error code
+ */
+uint8_t
+I2CDevice_Probe(
+    i2c_device_p pDevice
+);
+
+#endif
+
+/* END FILE */
@@ -0,0 +1,883 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Non-blocking I2C transaction engine (interrupt + DMA)
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include "stm32f401re_rcc.h"
+#include "stm32f401re_gpio.h"
+#include "stm32f401re_i2c.h"
+#include "stm32f401re_dma.h"
+#include "misc.h"
+#include "utilities.h"
+#include "timer.h"
+#include "serial.h"
+#include "i2cengine.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define I2C_QUEUE_MASK                      (I2C_ENGINE_QUEUE_SIZE - 1)
+
+/* Bus wiring: I2C1 on PB8 (SCL) / PB9 (SDA). I2C2/I2C3 pins are used by
+ * LCD and buzzer on the kit */
+#define I2C_ENGINE_I2Cx                     I2C1
+#define I2C_ENGINE_CLK                      RCC_APB1Periph_I2C1
+#define I2C_ENGINE_AF                       GPIO_AF_I2C1
+#define I2C_ENGINE_GPIO                     GPIOB
+#define I2C_ENGINE_GPIO_CLK                 RCC_AHB1Periph_GPIOB
+#define I2C_ENGINE_PIN_SCL                  GPIO_Pin_8
+#define I2C_ENGINE_PIN_SDA                  GPIO_Pin_9
+#define I2C_ENGINE_SOURCE_SCL               GPIO_PinSource8
+#define I2C_ENGINE_SOURCE_SDA               GPIO_PinSource9
+
+/* I2C1_RX is mapped on DMA1 stream 0 channel 1 */
+#define I2C_DMA_CLK                         RCC_AHB1Periph_DMA1
+#define I2C_DMA_STREAM                      DMA1_Stream0
+#define I2C_DMA_CHANNEL                     DMA_Channel_1
+#define I2C_DMA_IT_TC                       DMA_IT_TCIF0
+#define I2C_DMA_FLAGS                       (DMA_FLAG_TCIF0 | DMA_FLAG_HTIF0 | \
+                                             DMA_FLAG_TEIF0 | DMA_FLAG_DMEIF0 | \
+                                             DMA_FLAG_FEIF0)
+#define I2C_DMA_IRQn                        DMA1_Stream0_IRQn
+#define I2C_DMA_IRQHandler                  DMA1_Stream0_IRQHandler
+
+#define I2C_EV_IRQn                         I2C1_EV_IRQn
+#define I2C_ER_IRQn                         I2C1_ER_IRQn
+#define I2C_EV_IRQHandler                   I2C1_EV_IRQHandler
+#define I2C_ER_IRQHandler                   I2C1_ER_IRQHandler
+
+/* Max loop waiting STOP bit cleared before next START */
+#define I2C_STOP_WAIT_LOOP                  1000u
+
+/* Reads longer than one byte are done by DMA */
+#define I2C_DMA_MIN_LENGTH                  2u
+
+/* Bus recovery: half period of SCL (~5 us) and max clocks to free SDA */
+#define I2C_RECOVERY_DELAY_LOOP             100u
+#define I2C_RECOVERY_CLOCKS                 9u
+
+#define I2C_DIAG_COUNTERS                   8u
+
+typedef enum {
+    I2C_PHASE_WRITE,
+    I2C_PHASE_READ
+} i2c_phase_t;
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+static i2c_xfer_p g_pXferQueue[I2C_ENGINE_QUEUE_SIZE];
+
+/* Indexes run free, are masked when accessing queue:
+ * byCallbackIdx <= byActiveIdx <= byHeadIdx */
+static volatile uint8_t g_byHeadIdx;        /* Written by main loop */
+static volatile uint8_t g_byActiveIdx;      /* Written by interrupt */
+static uint8_t g_byCallbackIdx;             /* Written by main loop */
+
+static i2c_xfer_p volatile g_pActiveXfer;
+static i2c_phase_t g_phase;
+static uint8_t g_byTxIndex;
+
+/* Timeout, retry and backoff of active transfer */
+static uint32_t g_dwStartTick;              /* Start of current attempt */
+static uint32_t g_dwFirstTick;              /* Start of first attempt */
+static uint32_t g_dwBackoffTick;            /* Next attempt starts at */
+static uint8_t g_byAttempt;
+static volatile uint8_t g_bBackoff;
+static volatile uint8_t g_bRecover;         /* Bus must be recovered before START */
+static volatile uint8_t g_bWaitRecover;     /* Active transfer waits recovery in main loop */
+
+static i2c_stat_t g_stat;
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static void I2CEngine_GpioConfig(void);
+static void I2CEngine_PeriphConfig(void);
+static void I2CEngine_DmaConfig(void);
+static void I2CEngine_NvicConfig(void);
+static void I2CEngine_StartNext(void);
+static void I2CEngine_StartActive(void);
+static void I2CEngine_Complete(uint8_t byStatus);
+static void I2CEngine_CountError(uint8_t byStatus);
+static void I2CEngine_Retire(void);
+static void I2CEngine_Recover(void);
+static void I2CEngine_Delay(void);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func   I2CEngine_Init
+ * @brief  Initialize I2C peripheral, DMA and interrupts of engine
+ * @param  None
+ * @retval None
+ */
+void
+I2CEngine_Init(void)
+{
+    g_byHeadIdx = 0;
+    g_byActiveIdx = 0;
+    g_byCallbackIdx = 0;
+    g_pActiveXfer = NULL;
+    g_bBackoff = 0;
+    g_bRecover = 0;
+    g_bWaitRecover = 0;
+
+    I2CEngine_GpioConfig();
+    I2CEngine_PeriphConfig();
+    I2CEngine_DmaConfig();
+    I2CEngine_NvicConfig();
+}
+
+/**
+ * @func   I2CEngine_Submit
+ * @brief  Put a transfer into queue, start it if the bus is idle
+ * @param  pXfer: transfer descriptor
+ * @retval I2C_ENGINE_OK or I2C_ENGINE_ERR_FULL
+ */
+uint8_t
+I2CEngine_Submit(
+    i2c_xfer_p pXfer
+) {
+    return I2CEngine_SubmitBatch(&pXfer, 1);
+}
+
+/**
+ * @func   I2CEngine_SubmitBatch
+ * @brief  Put transfers into queue at once: all or none are queued and they
+ *         run back-to-back, chained from interrupt without bus idle time
+ * @param  ppXfer: transfer descriptors
+ * @param  byCount: number of transfers
+ * @retval I2C_ENGINE_OK, I2C_ENGINE_ERR_FULL or I2C_ENGINE_ERR_PARAM
+ */
+uint8_t
+I2CEngine_SubmitBatch(
+    i2c_xfer_p *ppXfer,
+    uint8_t byCount
+) {
+    i2c_xfer_p pXfer;
+    uint32_t dwPrimask;
+    uint8_t i;
+
+    if ((byCount == 0) || (byCount > I2C_ENGINE_QUEUE_SIZE)) {
+        return I2C_ENGINE_ERR_PARAM;
+    }
+
+    for (i = 0; i < byCount; i++) {
+        pXfer = ppXfer[i];
+        if ((pXfer == NULL) ||
+            ((pXfer->byTxLength != 0) && (pXfer->pTxData == NULL)) ||
+            ((pXfer->byRxLength != 0) && (pXfer->pRxData == NULL))) {
+            return I2C_ENGINE_ERR_PARAM;
+        }
+    }
+
+    /* Blocking waits never run processI2CEngine: free their slots here */
+    I2CEngine_Retire();
+
+    if ((uint8_t)(g_byHeadIdx - g_byCallbackIdx) > (I2C_ENGINE_QUEUE_SIZE - byCount)) {
+        return I2C_ENGINE_ERR_FULL;
+    }
+
+    for (i = 0; i < byCount; i++) {
+        ppXfer[i]->byStatus = I2C_XFER_PENDING;
+        g_pXferQueue[(g_byHeadIdx + i) & I2C_QUEUE_MASK] = ppXfer[i];
+    }
+
+    dwPrimask = __get_PRIMASK();
+    __disable_irq();
+    g_byHeadIdx += byCount;
+    if (g_pActiveXfer == NULL) {
+        I2CEngine_StartNext();
+    }
+    __set_PRIMASK(dwPrimask);
+
+    return I2C_ENGINE_OK;
+}
+
+/**
+ * @func   I2CEngine_IsIdle
+ * @brief  Check engine has no active or pending transfer
+ * @param  None
+ * @retval 1 if idle; 0 otherwise
+ */
+uint8_t
+I2CEngine_IsIdle(void)
+{
+    return (g_pActiveXfer == NULL) && (g_byActiveIdx == g_byHeadIdx);
+}
+
+/**
+ * @func   I2CEngine_CheckTimeout
+ * @brief  Abort a transfer stuck over its timeout, restart a transfer
+ *         whose backoff elapsed and recover the bus for a transfer waiting
+ *         it. Called by processI2CEngine, may be called by a blocking wait,
+ *         never from an interrupt
+ * @param  None
+ * @retval None
+ */
+void
+I2CEngine_CheckTimeout(void)
+{
+    i2c_xfer_p pXfer;
+    uint32_t dwTimeout;
+    uint32_t dwPrimask;
+    uint8_t bRecover;
+
+    dwPrimask = __get_PRIMASK();
+    __disable_irq();
+
+    pXfer = g_pActiveXfer;
+    if ((pXfer != NULL) && !g_bWaitRecover) {
+        if (g_bBackoff) {
+            if ((int32_t)(GetMilSecTick() - g_dwBackoffTick) >= 0) {
+                I2CEngine_StartActive();
+            }
+        } else {
+            dwTimeout = (pXfer->byTimeout != 0) ? pXfer->byTimeout : I2C_ENGINE_TIMEOUT_DEFAULT;
+            if ((GetMilSecTick() - g_dwStartTick) > dwTimeout) {
+                /* Slave stretches SCL or holds SDA: free the bus before next START */
+                I2C_GenerateSTOP(I2C_ENGINE_I2Cx, ENABLE);
+                g_bRecover = 1;
+                I2CEngine_Complete(I2C_XFER_ERR_TIMEOUT);
+            }
+        }
+    }
+
+    bRecover = (g_pActiveXfer != NULL) && g_bWaitRecover;
+
+    __set_PRIMASK(dwPrimask);
+
+    if (bRecover) {
+        I2CEngine_Recover();
+    }
+}
+
+/**
+ * @func   I2CEngine_RecoverBus
+ * @brief  Free a slave holding SDA low: clock SCL up to 9 times, generate
+ *         STOP then reset peripheral. No transfer must be on the wire.
+ *         Busy-waits ~100 us: call from main loop only, never from an
+ *         interrupt or with interrupts masked
+ * @param  None
+ * @retval 1 if SDA is released; 0 otherwise
+ */
+uint8_t
+I2CEngine_RecoverBus(void)
+{
+    GPIO_InitTypeDef GPIO_InitStructure;
+    uint8_t byClock;
+    uint8_t byReleased;
+
+    I2C_Cmd(I2C_ENGINE_I2Cx, DISABLE);
+
+    GPIO_SetBits(I2C_ENGINE_GPIO, I2C_ENGINE_PIN_SCL | I2C_ENGINE_PIN_SDA);
+    GPIO_InitStructure.GPIO_Pin = I2C_ENGINE_PIN_SCL | I2C_ENGINE_PIN_SDA;
+    GPIO_InitStructure.GPIO_Mode = GPIO_Mode_OUT;
+    GPIO_InitStructure.GPIO_OType = GPIO_OType_OD;
+    GPIO_InitStructure.GPIO_PuPd = GPIO_PuPd_UP;
+    GPIO_InitStructure.GPIO_Speed = GPIO_Speed_50MHz;
+    GPIO_Init(I2C_ENGINE_GPIO, &GPIO_InitStructure);
+    I2CEngine_Delay();
+
+    /* Slave shifts out the rest of its byte, releases SDA on a high bit */
+    for (byClock = 0; byClock < I2C_RECOVERY_CLOCKS; byClock++) {
+        if (GPIO_ReadInputDataBit(I2C_ENGINE_GPIO, I2C_ENGINE_PIN_SDA) == Bit_SET) {
+            break;
+        }
+        GPIO_ResetBits(I2C_ENGINE_GPIO, I2C_ENGINE_PIN_SCL);
+        I2CEngine_Delay();
+        GPIO_SetBits(I2C_ENGINE_GPIO, I2C_ENGINE_PIN_SCL);
+        I2CEngine_Delay();
+    }
+
+    /* STOP: SDA rises while SCL is high */
+    GPIO_ResetBits(I2C_ENGINE_GPIO, I2C_ENGINE_PIN_SCL);
+    I2CEngine_Delay();
+    GPIO_ResetBits(I2C_ENGINE_GPIO, I2C_ENGINE_PIN_SDA);
+    I2CEngine_Delay();
+    GPIO_SetBits(I2C_ENGINE_GPIO, I2C_ENGINE_PIN_SCL);
+    I2CEngine_Delay();
+    GPIO_SetBits(I2C_ENGINE_GPIO, I2C_ENGINE_PIN_SDA);
+    I2CEngine_Delay();
+
+    byReleased = (GPIO_ReadInputDataBit(I2C_ENGINE_GPIO, I2C_ENGINE_PIN_SDA) == Bit_SET);
+
+    I2CEngine_GpioConfig();
+    I2C_SoftwareResetCmd(I2C_ENGINE_I2Cx, ENABLE);
+    I2C_SoftwareResetCmd(I2C_ENGINE_I2Cx, DISABLE);
+    I2CEngine_PeriphConfig();
+
+    g_bRecover = 0;
+    g_stat.dwRecovery++;
+
+    return byReleased;
+}
+
+/**
+ * @func   I2CEngine_GetStatistic
+ * @brief  Get error counters
+ * @param  pStat: counters
+ * @retval None
+ */
+void
+I2CEngine_GetStatistic(
+    i2c_stat_p pStat
+) {
+    uint32_t dwPrimask;
+
+    dwPrimask = __get_PRIMASK();
+    __disable_irq();
+    *pStat = g_stat;
+    __set_PRIMASK(dwPrimask);
+}
+
+/**
+ * @func   I2CEngine_ResetStatistic
+ * @brief  Clear error counters
+ * @param  None
+ * @retval None
+ */
+void
+I2CEngine_ResetStatistic(void)
+{
+    uint32_t dwPrimask;
+
+    dwPrimask = __get_PRIMASK();
+    __disable_irq();
+    memsetl((uint8_t *)&g_stat, 0, sizeof(g_stat));
+    __set_PRIMASK(dwPrimask);
+}
+
+/**
+ * @func   I2CEngine_SendPacketRespond
+ * @brief  Respond frame of error counters (CMD_ID_I2C_DIAG), each counter
+ *         is 2 bytes MSB first, saturated at 0xFFFF
+ * @param  None
+ * @retval None
+ */
+void
+I2CEngine_SendPacketRespond(void)
+{
+    i2c_stat_t stat;
+    uint32_t pdwCounter[I2C_DIAG_COUNTERS];
+    uint8_t pbyPayload[CMD_SIZE_OF_PAYLOAD_I2C_DIAG];
+    uint8_t i;
+
+    I2CEngine_GetStatistic(&stat);
+
+    pdwCounter[0] = stat.dwTransfer;
+    pdwCounter[1] = stat.dwNack;
+    pdwCounter[2] = stat.dwArlo;
+    pdwCounter[3] = stat.dwBusError;
+    pdwCounter[4] = stat.dwTimeout;
+    pdwCounter[5] = stat.dwRetry;
+    pdwCounter[6] = stat.dwRecovery;
+    pdwCounter[7] = stat.dwMaxLatency;
+
+    for (i = 0; i < I2C_DIAG_COUNTERS; i++) {
+        if (pdwCounter[i] > 0xFFFF) {
+            pdwCounter[i] = 0xFFFF;
+        }
+        pbyPayload[2 * i] = (uint8_t)(pdwCounter[i] >> 8);
+        pbyPayload[2 * i + 1] = (uint8_t)pdwCounter[i];
+    }
+
+    Serial_SendPacket(CMD_OPT_NOT_USE, CMD_ID_I2C_DIAG, CMD_TYPE_RES,
+                      pbyPayload, sizeof(pbyPayload));
+}
+
+/**
+ * @func   I2CEngine_SerialHandle
+ * @brief  Serve CMD_ID_I2C_DIAG frames, other frames are ignored. Given to
+ *         SerialHandleEventCallback or called by the handler given to it
+ * @param  pData: cmd_receive_p frame received. GET responds error
+ *         counters, SET clears them then responds
+ * @retval None
+ */
+void
+I2CEngine_SerialHandle(
+    void *pData
+) {
+    cmd_receive_p pCmd = (cmd_receive_p)pData;
+
+    if ((pCmd == NULL) || (pCmd->cmdCommon.cmdid != CMD_ID_I2C_DIAG)) {
+        return;
+    }
+
+    if (pCmd->cmdCommon.type == CMD_TYPE_SET) {
+        I2CEngine_ResetStatistic();
+    } else if (pCmd->cmdCommon.type != CMD_TYPE_GET) {
+        return;
+    }
+
+    I2CEngine_SendPacketRespond();
+}
+
+/**
+ * @func   processI2CEngine
+ * @brief  Check timeout, call callbacks of finished transfers, run in main loop
+ * @param  None
+ * @retval None
+ */
+void
+processI2CEngine(void)
+{
+    i2c_xfer_p pXfer;
+
+    I2CEngine_CheckTimeout();
+
+    while (g_byCallbackIdx != g_byActiveIdx) {
+        pXfer = g_pXferQueue[g_byCallbackIdx & I2C_QUEUE_MASK];
+        g_byCallbackIdx++;
+
+        if (pXfer->callback != NULL) {
+            pXfer->callback(pXfer->pCallbackData, pXfer->byStatus);
+        }
+    }
+}
+
+/**
+ * @func   I2C_EV_IRQHandler
+ * @brief  Event interrupt, drives START/address/data phases
+ * @param  None
+ * @retval None
+ */
+void
+I2C_EV_IRQHandler(void)
+{
+    i2c_xfer_p pXfer = g_pActiveXfer;
+    uint16_t wSR1 = I2C_ENGINE_I2Cx->SR1;
+
+    if (pXfer == NULL) {
+        I2C_ITConfig(I2C_ENGINE_I2Cx, I2C_IT_EVT | I2C_IT_BUF, DISABLE);
+        return;
+    }
+
+    if (wSR1 & I2C_SR1_SB) {
+        if (g_phase == I2C_PHASE_WRITE) {
+            I2C_Send7bitAddress(I2C_ENGINE_I2Cx, pXfer->byAddress << 1, I2C_Direction_Transmitter);
+        } else {
+            if (pXfer->byRxLength >= I2C_DMA_MIN_LENGTH) {
+                /* DMA reads the bytes, hardware NACKs the last one */
+                I2C_AcknowledgeConfig(I2C_ENGINE_I2Cx, ENABLE);
+                I2C_DMALastTransferCmd(I2C_ENGINE_I2Cx, ENABLE);
+                I2C_DMACmd(I2C_ENGINE_I2Cx, ENABLE);
+            }
+            I2C_Send7bitAddress(I2C_ENGINE_I2Cx, pXfer->byAddress << 1, I2C_Direction_Receiver);
+        }
+    } else if (wSR1 & I2C_SR1_ADDR) {
+        if (g_phase == I2C_PHASE_WRITE) {
+            (void)I2C_ENGINE_I2Cx->SR2;
+            if (pXfer->byTxLength == 0) {
+                /* Probe only */
+                I2C_GenerateSTOP(I2C_ENGINE_I2Cx, ENABLE);
+                I2CEngine_Complete(I2C_XFER_DONE);
+            } else {
+                I2C_ITConfig(I2C_ENGINE_I2Cx, I2C_IT_BUF, ENABLE);
+            }
+        } else if (pXfer->byRxLength < I2C_DMA_MIN_LENGTH) {
+            /* Single byte: NACK and STOP must be programmed before ADDR is cleared */
+            I2C_AcknowledgeConfig(I2C_ENGINE_I2Cx, DISABLE);
+            (void)I2C_ENGINE_I2Cx->SR2;
+            I2C_GenerateSTOP(I2C_ENGINE_I2Cx, ENABLE);
+            I2C_ITConfig(I2C_ENGINE_I2Cx, I2C_IT_BUF, ENABLE);
+        } else {
+            (void)I2C_ENGINE_I2Cx->SR2;
+        }
+    } else if (g_phase == I2C_PHASE_WRITE) {
+        if ((wSR1 & I2C_SR1_BTF) && (g_byTxIndex >= pXfer->byTxLength)) {
+            /* Last byte is on the wire */
+            if (pXfer->byRxLength != 0) {
+                g_phase = I2C_PHASE_READ;
+                I2C_GenerateSTART(I2C_ENGINE_I2Cx, ENABLE);
+            } else {
+                I2C_GenerateSTOP(I2C_ENGINE_I2Cx, ENABLE);
+                I2CEngine_Complete(I2C_XFER_DONE);
+            }
+        } else if ((wSR1 & I2C_SR1_TXE) && (g_byTxIndex < pXfer->byTxLength)) {
+            I2C_SendData(I2C_ENGINE_I2Cx, pXfer->pTxData[g_byTxIndex++]);
+            if (g_byTxIndex >= pXfer->byTxLength) {
+                /* Wait BTF, no more TXE */
+                I2C_ITConfig(I2C_ENGINE_I2Cx, I2C_IT_BUF, DISABLE);
+            }
+        }
+    } else if (wSR1 & I2C_SR1_RXNE) {
+        pXfer->pRxData[0] = I2C_ReceiveData(I2C_ENGINE_I2Cx);
+        I2CEngine_Complete(I2C_XFER_DONE);
+    }
+}
+
+/**
+ * @func   I2C_ER_IRQHandler
+ * @brief  Error interrupt: NACK, arbitration lost, bus error
+ * @param  None
+ * @retval None
+ */
+void
+I2C_ER_IRQHandler(void)
+{
+    uint16_t wSR1 = I2C_ENGINE_I2Cx->SR1;
+    uint8_t byStatus = I2C_XFER_ERR_BUS;
+
+    /* Clear all error flags */
+    I2C_ENGINE_I2Cx->SR1 = wSR1 & ~(I2C_SR1_AF | I2C_SR1_ARLO | I2C_SR1_BERR | I2C_SR1_OVR);
+
+    if (wSR1 & I2C_SR1_AF) {
+        byStatus = I2C_XFER_ERR_NACK;
+        I2C_GenerateSTOP(I2C_ENGINE_I2Cx, ENABLE);
+    } else if (wSR1 & I2C_SR1_ARLO) {
+        /* Interface already went back to slave mode */
+        byStatus = I2C_XFER_ERR_ARLO;
+    } else {
+        I2C_GenerateSTOP(I2C_ENGINE_I2Cx, ENABLE);
+        g_bRecover = 1;
+    }
+
+    if ((g_pActiveXfer != NULL) && !g_bBackoff) {
+        I2CEngine_Complete(byStatus);
+    }
+}
+
+/**
+ * @func   I2C_DMA_IRQHandler
+ * @brief  DMA reception complete
+ * @param  None
+ * @retval None
+ */
+void
+I2C_DMA_IRQHandler(void)
+{
+    if (DMA_GetITStatus(I2C_DMA_STREAM, I2C_DMA_IT_TC) != RESET) {
+        DMA_ClearITPendingBit(I2C_DMA_STREAM, I2C_DMA_IT_TC);
+        I2C_GenerateSTOP(I2C_ENGINE_I2Cx, ENABLE);
+        I2CEngine_Complete(I2C_XFER_DONE);
+    }
+}
+
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+/**
+ * @func   I2CEngine_GpioConfig
+ * @brief  Configure SCL/SDA in alternate function open drain
+ * @param  None
+ * @retval None
+ */
+static void
+I2CEngine_GpioConfig(void)
+{
+    GPIO_InitTypeDef GPIO_InitStructure;
+
+    RCC_AHB1PeriphClockCmd(I2C_ENGINE_GPIO_CLK, ENABLE);
+
+    GPIO_InitStructure.GPIO_Pin = I2C_ENGINE_PIN_SCL | I2C_ENGINE_PIN_SDA;
+    GPIO_InitStructure.GPIO_Mode = GPIO_Mode_AF;
+    GPIO_InitStructure.GPIO_OType = GPIO_OType_OD;
+    GPIO_InitStructure.GPIO_PuPd = GPIO_PuPd_UP;
+    GPIO_InitStructure.GPIO_Speed = GPIO_Speed_50MHz;
+    GPIO_Init(I2C_ENGINE_GPIO, &GPIO_InitStructure);
+
+    GPIO_PinAFConfig(I2C_ENGINE_GPIO, I2C_ENGINE_SOURCE_SCL, I2C_ENGINE_AF);
+    GPIO_PinAFConfig(I2C_ENGINE_GPIO, I2C_ENGINE_SOURCE_SDA, I2C_ENGINE_AF);
+}
+
+/**
+ * @func   I2CEngine_PeriphConfig
+ * @brief  Configure I2C peripheral in master mode
+ * @param  None
+ * @retval None
+ */
+static void
+I2CEngine_PeriphConfig(void)
+{
+    I2C_InitTypeDef I2C_InitStructure;
+
+    RCC_APB1PeriphClockCmd(I2C_ENGINE_CLK, ENABLE);
+    I2C_DeInit(I2C_ENGINE_I2Cx);
+
+    I2C_InitStructure.I2C_ClockSpeed = I2C_ENGINE_CLOCK_SPEED;
+    I2C_InitStructure.I2C_Mode = I2C_Mode_I2C;
+    I2C_InitStructure.I2C_DutyCycle = I2C_DutyCycle_2;
+    I2C_InitStructure.I2C_OwnAddress1 = 0x00;
+    I2C_InitStructure.I2C_Ack = I2C_Ack_Enable;
+    I2C_InitStructure.I2C_AcknowledgedAddress = I2C_AcknowledgedAddress_7bit;
+    I2C_Init(I2C_ENGINE_I2Cx, &I2C_InitStructure);
+
+    I2C_Cmd(I2C_ENGINE_I2Cx, ENABLE);
+}
+
+/**
+ * @func   I2CEngine_DmaConfig
+ * @brief  Configure DMA stream used for reception
+ * @param  None
+ * @retval None
+ */
+static void
+I2CEngine_DmaConfig(void)
+{
+    DMA_InitTypeDef DMA_InitStructure;
+
+    RCC_AHB1PeriphClockCmd(I2C_DMA_CLK, ENABLE);
+    DMA_DeInit(I2C_DMA_STREAM);
+
+    DMA_InitStructure.DMA_Channel = I2C_DMA_CHANNEL;
+    DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t)&I2C_ENGINE_I2Cx->DR;
+    DMA_InitStructure.DMA_Memory0BaseAddr = 0;
+    DMA_InitStructure.DMA_DIR = DMA_DIR_PeripheralToMemory;
+    DMA_InitStructure.DMA_BufferSize = 1;
+    DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+    DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
+    DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Byte;
+    DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_Byte;
+    DMA_InitStructure.DMA_Mode = DMA_Mode_Normal;
+    DMA_InitStructure.DMA_Priority = DMA_Priority_High;
+    DMA_InitStructure.DMA_FIFOMode = DMA_FIFOMode_Disable;
+    DMA_InitStructure.DMA_FIFOThreshold = DMA_FIFOThreshold_Full;
+    DMA_InitStructure.DMA_MemoryBurst = DMA_MemoryBurst_Single;
+    DMA_InitStructure.DMA_PeripheralBurst = DMA_PeripheralBurst_Single;
+    DMA_Init(I2C_DMA_STREAM, &DMA_InitStructure);
+
+    DMA_ITConfig(I2C_DMA_STREAM, DMA_IT_TC, ENABLE);
+}
+
+/**
+ * @func   I2CEngine_NvicConfig
+ * @brief  Enable event, error and DMA interrupts
+ * @param  None
+ * @retval None
+ */
+static void
+I2CEngine_NvicConfig(void)
+{
+    NVIC_InitTypeDef NVIC_InitStructure;
+
+    NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 1;
+    NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0;
+    NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+
+    NVIC_InitStructure.NVIC_IRQChannel = I2C_EV_IRQn;
+    NVIC_Init(&NVIC_InitStructure);
+
+    NVIC_InitStructure.NVIC_IRQChannel = I2C_ER_IRQn;
+    NVIC_Init(&NVIC_InitStructure);
+
+    NVIC_InitStructure.NVIC_IRQChannel = I2C_DMA_IRQn;
+    NVIC_Init(&NVIC_InitStructure);
+}
+
+/**
+ * @func   I2CEngine_StartNext
+ * @brief  Start next pending transfer, called with interrupts masked
+ * @param  None
+ * @retval None
+ */
+static void
+I2CEngine_StartNext(void)
+{
+    i2c_xfer_p pXfer;
+
+    if (g_byActiveIdx == g_byHeadIdx) {
+        g_pActiveXfer = NULL;
+        return;
+    }
+
+    pXfer = g_pXferQueue[g_byActiveIdx & I2C_QUEUE_MASK];
+    pXfer->byStatus = I2C_XFER_ACTIVE;
+    g_pActiveXfer = pXfer;
+    g_byAttempt = 0;
+    g_dwFirstTick = GetMilSecTick();
+
+    I2CEngine_StartActive();
+}
+
+/**
+ * @func   I2CEngine_StartActive
+ * @brief  Start (again) active transfer, called with interrupts masked
+ * @param  None
+ * @retval None
+ */
+static void
+I2CEngine_StartActive(void)
+{
+    i2c_xfer_p pXfer = g_pActiveXfer;
+    uint16_t wLoop = I2C_STOP_WAIT_LOOP;
+
+    g_bBackoff = 0;
+    g_byTxIndex = 0;
+    g_phase = ((pXfer->byTxLength != 0) || (pXfer->byRxLength == 0)) ?
+              I2C_PHASE_WRITE : I2C_PHASE_READ;
+
+    /* Previous STOP must be on the wire before a new START */
+    while ((I2C_ENGINE_I2Cx->CR1 & I2C_CR1_STOP) && (wLoop-- != 0));
+
+    if (g_bRecover || (I2C_GetFlagStatus(I2C_ENGINE_I2Cx, I2C_FLAG_BUSY) == SET)) {
+        /* Recovery busy-waits: left to I2CEngine_CheckTimeout in main loop */
+        g_bRecover = 1;
+        g_bWaitRecover = 1;
+        return;
+    }
+
+    if (pXfer->byRxLength >= I2C_DMA_MIN_LENGTH) {
+        DMA_Cmd(I2C_DMA_STREAM, DISABLE);
+        DMA_ClearFlag(I2C_DMA_STREAM, I2C_DMA_FLAGS);
+        I2C_DMA_STREAM->M0AR = (uint32_t)pXfer->pRxData;
+        DMA_SetCurrDataCounter(I2C_DMA_STREAM, pXfer->byRxLength);
+        DMA_Cmd(I2C_DMA_STREAM, ENABLE);
+    }
+
+    g_dwStartTick = GetMilSecTick();
+    I2C_AcknowledgeConfig(I2C_ENGINE_I2Cx, ENABLE);
+    I2C_ITConfig(I2C_ENGINE_I2Cx, I2C_IT_EVT | I2C_IT_ERR, ENABLE);
+    I2C_GenerateSTART(I2C_ENGINE_I2Cx, ENABLE);
+}
+
+/**
+ * @func   I2CEngine_Complete
+ * @brief  Finish active transfer and chain the next one
+ * @param  byStatus: status of active transfer
+ * @retval None
+ */
+static void
+I2CEngine_Complete(
+    uint8_t byStatus
+) {
+    i2c_xfer_p pXfer = g_pActiveXfer;
+    uint32_t dwLatency;
+
+    I2C_ITConfig(I2C_ENGINE_I2Cx, I2C_IT_EVT | I2C_IT_BUF | I2C_IT_ERR, DISABLE);
+    I2C_DMACmd(I2C_ENGINE_I2Cx, DISABLE);
+    I2C_DMALastTransferCmd(I2C_ENGINE_I2Cx, DISABLE);
+    DMA_Cmd(I2C_DMA_STREAM, DISABLE);
+
+    I2CEngine_CountError(byStatus);
+
+    if ((byStatus != I2C_XFER_DONE) && (g_byAttempt < pXfer->byRetry)) {
+        /* Keep the bus, start again from I2CEngine_CheckTimeout */
+        g_dwBackoffTick = GetMilSecTick() + (I2C_ENGINE_BACKOFF_BASE << g_byAttempt);
+        g_byAttempt++;
+        g_stat.dwRetry++;
+        g_bBackoff = 1;
+        return;
+    }
+
+    dwLatency = GetMilSecTick() - g_dwFirstTick;
+    if (dwLatency > g_stat.dwMaxLatency) {
+        g_stat.dwMaxLatency = dwLatency;
+    }
+    g_stat.dwTransfer++;
+
+    pXfer->byStatus = byStatus;
+    g_byActiveIdx++;
+
+    I2CEngine_StartNext();
+}
+
+/**
+ * @func   I2CEngine_CountError
+ * @brief  Update error counter of a failed attempt
+ * @param  byStatus: status of attempt
+ * @retval None
+ */
+static void
+I2CEngine_CountError(
+    uint8_t byStatus
+) {
+    switch (byStatus) {
+    case I2C_XFER_ERR_NACK:
+        g_stat.dwNack++;
+        break;
+
+    case I2C_XFER_ERR_ARLO:
+        g_stat.dwArlo++;
+        break;
+
+    case I2C_XFER_ERR_BUS:
+        g_stat.dwBusError++;
+        break;
+
+    case I2C_XFER_ERR_TIMEOUT:
+        g_stat.dwTimeout++;
+        break;
+
+    default:
+        break;
+    }
+}
+
+/**
+ * @func   I2CEngine_Retire
+ * @brief  Free slots of finished transfers without callback, in queue
+ *         order: stops at the first one whose callback is still due
+ * @param  None
+ * @retval None
+ */
+static void
+I2CEngine_Retire(void)
+{
+    while ((g_byCallbackIdx != g_byActiveIdx) &&
+           (g_pXferQueue[g_byCallbackIdx & I2C_QUEUE_MASK]->callback == NULL)) {
+        g_byCallbackIdx++;
+    }
+}
+
+/**
+ * @func   I2CEngine_Recover
+ * @brief  Recover the bus for active transfer, called from main loop with
+ *         interrupts enabled. Transfer starts again if the bus is free,
+ *         else the attempt fails as a bus error and is retried
+ * @param  None
+ * @retval None
+ */
+static void
+I2CEngine_Recover(void)
+{
+    uint8_t byReleased = I2CEngine_RecoverBus();
+    uint32_t dwPrimask;
+
+    dwPrimask = __get_PRIMASK();
+    __disable_irq();
+
+    g_bWaitRecover = 0;
+    if (g_pActiveXfer != NULL) {
+        if (byReleased && (I2C_GetFlagStatus(I2C_ENGINE_I2Cx, I2C_FLAG_BUSY) == RESET)) {
+            I2CEngine_StartActive();
+        } else {
+            I2CEngine_Complete(I2C_XFER_ERR_BUS);
+        }
+    }
+
+    __set_PRIMASK(dwPrimask);
+}
+
+/**
+ * @func   I2CEngine_Delay
+ * @brief  Half period of SCL during bus recovery
+ * @param  None
+ * @retval None
+ */
+static void
+I2CEngine_Delay(void)
+{
+    volatile uint16_t wLoop = I2C_RECOVERY_DELAY_LOOP;
+
+    while (wLoop-- != 0);
+}
+
+/* END FILE */
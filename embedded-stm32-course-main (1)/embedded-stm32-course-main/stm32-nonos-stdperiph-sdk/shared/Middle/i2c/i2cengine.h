@@ -0,0 +1,236 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Non-blocking I2C transaction engine (interrupt + DMA)
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+#ifndef _I2C_ENGINE_H_
+#define _I2C_ENGINE_H_
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <stdint.h>
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+/*! @brief Number of transfers can be queued, must be a power of 2 */
+#define I2C_ENGINE_QUEUE_SIZE               8u
+
+/*! @brief Bus clock */
+#define I2C_ENGINE_CLOCK_SPEED              100000
+
+/*! @brief Timeout of a transfer when its byTimeout is 0 (ms) */
+#define I2C_ENGINE_TIMEOUT_DEFAULT          5u
+
+/*! @brief First retry delay (ms), doubled on each retry */
+#define I2C_ENGINE_BACKOFF_BASE             1u
+
+/*! @brief Return code of I2CEngine_Submit */
+#define I2C_ENGINE_OK                       0x00u
+#define I2C_ENGINE_ERR_FULL                 0x01u
+#define I2C_ENGINE_ERR_PARAM                0x02u
+
+/*! @brief Status of a transfer */
+typedef enum {
+    I2C_XFER_IDLE = 0,
+    I2C_XFER_PENDING,
+    I2C_XFER_ACTIVE,
+    I2C_XFER_DONE,
+    I2C_XFER_ERR_NACK,
+    I2C_XFER_ERR_ARLO,
+    I2C_XFER_ERR_BUS,
+    I2C_XFER_ERR_TIMEOUT
+} i2c_xfer_status_t;
+
+typedef void (* i2c_xfer_callback)(void *pCallbackData, uint8_t byStatus);
+
+/*!
+ * Transfer descriptor. Write byTxLength bytes, then (repeated START) read
+ * byRxLength bytes. The descriptor and its buffers are owned by the caller
+ * and must stay valid until the callback has been called.
+ * A finished transfer keeps its queue slot until processI2CEngine has
+ * called its callback; without callback the slot is freed by the next
+ * submit, so blocking waits outside the main loop do not fill the queue.
+ * A failed transfer is started again up to byRetry times, the bus stays
+ * reserved during backoff. Worst case duration is
+ * (byRetry + 1) * byTimeout + backoff.
+ */
+typedef struct _i2c_xfer_ {
+
+    uint8_t byAddress;               /*< 7-bit slave address */
+
+    uint8_t byTxLength;              /*< Number of bytes to write */
+
+    uint8_t byRxLength;              /*< Number of bytes to read */
+
+    volatile uint8_t byStatus;       /*< i2c_xfer_status_t */
+
+    uint8_t byTimeout;               /*< ms, 0: I2C_ENGINE_TIMEOUT_DEFAULT */
+
+    uint8_t byRetry;                 /*< Retries on error */
+
+    uint8_t *pTxData;                /*< Data to write */
+
+    uint8_t *pRxData;                /*< Buffer for read data */
+
+    i2c_xfer_callback callback;      /*< Called from processI2CEngine */
+
+    void *pCallbackData;             /*< Parameter of callback */
+
+} i2c_xfer_t, *i2c_xfer_p;
+
+/*! @brief Error counters of engine */
+typedef struct {
+    uint32_t dwTransfer;             /*< Transfers finished */
+    uint32_t dwNack;                 /*< Slave NACKed */
+    uint32_t dwArlo;                 /*< Arbitration lost */
+    uint32_t dwBusError;             /*< Misplaced START/STOP */
+    uint32_t dwTimeout;              /*< No event within timeout */
+    uint32_t dwRetry;                /*< Transfers started again */
+    uint32_t dwRecovery;             /*< Bus recoveries */
+    uint32_t dwMaxLatency;           /*< Longest transfer incl. retries (ms) */
+} i2c_stat_t, *i2c_stat_p;
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func   I2CEngine_Init
+ * @brief  Initialize I2C peripheral, DMA and interrupts of engine
+ * @param  None
+ * @retval None
+ */
+void
+I2CEngine_Init(void);
+
+/**
+ * @func   I2CEngine_Submit
+ * @brief  Put a transfer into queue, start it if the bus is idle
+ * @param  pXfer: transfer descriptor
+ * @retval I2C_ENGINE_OK or I2C_ENGINE_ERR_FULL
+ */
+uint8_t
+I2CEngine_Submit(
+    i2c_xfer_p pXfer
+);
+
+/**
+ * @func   I2CEngine_SubmitBatch
+ * @brief  Put transfers into queue at once: all or none are queued and they
+ *         run back-to-back, chained from interrupt without bus idle time
+ * @param  ppXfer: transfer descriptors
+ * @param  byCount: number of transfers
+ * @retval I2C_ENGINE_OK, I2C_ENGINE_ERR_FULL or I2C_ENGINE_ERR_PARAM
+ */
+uint8_t
+I2CEngine_SubmitBatch(
+    i2c_xfer_p *ppXfer,
+    uint8_t byCount
+);
+
+/**
+ * @func   I2CEngine_IsIdle
+ * @brief  Check engine has no active or pending transfer
+ * @param  None
+ * @retval 1 if idle; 0 otherwise
+ */
+uint8_t
+I2CEngine_IsIdle(void);
+
+/**
+ * @func   I2CEngine_CheckTimeout
+ * @brief  Abort a transfer stuck over its timeout, restart a transfer
+ *         whose backoff elapsed and recover the bus for a transfer waiting
+ *         it. Called by processI2CEngine, may be called by a blocking wait,
+ *         never from an interrupt
+ * @param  None
+ * @retval None
+ */
+void
+I2CEngine_CheckTimeout(void);
+
+/**
+ * @func   I2CEngine_RecoverBus
+ * @brief  Free a slave holding SDA low: clock SCL up to 9 times, generate
+ *         STOP then reset peripheral. No transfer must be on the wire.
+ *         Busy-waits ~100 us: call from main loop only, never from an
+ *         interrupt or with interrupts masked
+ * @param  None
+ * @retval 1 if SDA is released; 0 otherwise
+ */
+uint8_t
+I2CEngine_RecoverBus(void);
+
+/**
+ * @func   I2CEngine_GetStatistic
+ * @brief  Get error counters
+ * @param  pStat: counters
+ * @retval None
+ */
+void
+I2CEngine_GetStatistic(
+    i2c_stat_p pStat
+);
+
+/**
+ * @func   I2CEngine_ResetStatistic
+ * @brief  Clear error counters
+ * @param  None
+ * @retval None
+ */
+void
+I2CEngine_ResetStatistic(void);
+
+/**
+ * @func   I2CEngine_SendPacketRespond
+ * @brief  Respond frame of error counters (CMD_ID_I2C_DIAG)
+ * @param  None
+ * @retval None
+ */
+void
+I2CEngine_SendPacketRespond(void);
+
+/**
+ * @func   I2CEngine_SerialHandle
+ * @brief  Serve CMD_ID_I2C_DIAG frames, other frames are ignored. Given to
+ *         SerialHandleEventCallback or called by the handler given to it
+ * @param  pData: cmd_receive_p frame received. GET responds error
+ *         counters, SET clears them then responds
+ * @retval None
+ */
+void
+I2CEngine_SerialHandle(
+    void *pData
+);
+
+/**
+ * @func   processI2CEngine
+ * @brief  Check timeout, call callbacks of finished transfers, run in main loop
+ * @param  None
+ * @retval None
+ */
+void
+processI2CEngine(void);
+
+#endif
+
+/* END FILE */
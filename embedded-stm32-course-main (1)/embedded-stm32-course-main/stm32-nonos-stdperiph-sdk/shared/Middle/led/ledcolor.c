@@ -0,0 +1,279 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Led colors in RGB888 / HSV, gamma corrected and calibrated
+ *              per channel, at full resolution of LED_TIMER_PERIOD.
+ *              Gamma table is generated by tools/led_gamma (ledgamma.c)
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include "stm32f401re_tim.h"
+#include "utilities.h"
+#include "led.h"
+#include "ledkit.h"
+#include "ledcolor.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define LED_GAMMA_ONE                       65535u
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+extern const uint16_t g_pwLedGamma[256];
+
+static uint8_t g_pbyCalib[LED_KIT_COUNT][NUM_OF_COLOR];
+static uint16_t g_pwDuty[LED_KIT_COUNT][NUM_OF_COLOR];
+static uint8_t g_bBatch;
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static uint16_t LedColor_ToDuty(uint8_t byKit, uint8_t byChannel, uint8_t byValue);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func   LedColor_Init
+ * @brief  Preload compare registers of led timers, after LedControl_Init.
+ *         Calibration is full on all channels
+ * @param  None
+ * @retval None
+ */
+void
+LedColor_Init(void)
+{
+    uint8_t i;
+    uint8_t j;
+
+    /* Compare values are taken at update event, a period is never cut */
+    TIM_OC1PreloadConfig(TIM1, TIM_OCPreload_Enable);
+    TIM_OC3PreloadConfig(TIM1, TIM_OCPreload_Enable);
+    TIM_OC4PreloadConfig(TIM1, TIM_OCPreload_Enable);
+    TIM_OC1PreloadConfig(TIM2, TIM_OCPreload_Enable);
+    TIM_OC2PreloadConfig(TIM2, TIM_OCPreload_Enable);
+    TIM_OC3PreloadConfig(TIM3, TIM_OCPreload_Enable);
+
+    for (i = 0; i < LED_KIT_COUNT; i++) {
+        for (j = 0; j < NUM_OF_COLOR; j++) {
+            g_pbyCalib[i][j] = LED_CALIB_FULL;
+            g_pwDuty[i][j] = (uint16_t)*g_pLedKitCcr[i][j];
+        }
+    }
+
+    g_bBatch = 0;
+}
+
+/**
+ * @func   LedColor_SetCalibration
+ * @brief  Scale channels of a led so that equal components give white
+ * @param  led_id: LED_KIT_ID0, LED_KIT_ID1 or LED_ALL_ID
+ * @param  byRed, byGreen, byBlue: scale, 0 - LED_CALIB_FULL
+ * @retval None
+ */
+void
+LedColor_SetCalibration(
+    uint8_t led_id,
+    uint8_t byRed,
+    uint8_t byGreen,
+    uint8_t byBlue
+) {
+    uint8_t byKits = LedKit_GetMask(led_id);
+    uint8_t i;
+
+    for (i = 0; i < LED_KIT_COUNT; i++) {
+        if (byKits & (1u << i)) {
+            g_pbyCalib[i][LED_KIT_RED] = byRed;
+            g_pbyCalib[i][LED_KIT_GREEN] = byGreen;
+            g_pbyCalib[i][LED_KIT_BLUE] = byBlue;
+        }
+    }
+}
+
+/**
+ * @func   LedColor_SetRgb
+ * @brief  Set color of a led, applied now or by LedColor_Commit in a batch
+ * @param  led_id: LED_KIT_ID0, LED_KIT_ID1 or LED_ALL_ID
+ * @param  dwRgb: color 0xRRGGBB, perceived brightness is linear in components
+ * @retval None
+ */
+void
+LedColor_SetRgb(
+    uint8_t led_id,
+    uint32_t dwRgb
+) {
+    uint8_t byKits = LedKit_GetMask(led_id);
+    uint8_t i;
+    uint8_t j;
+
+    for (i = 0; i < LED_KIT_COUNT; i++) {
+        if (byKits & (1u << i)) {
+            for (j = 0; j < NUM_OF_COLOR; j++) {
+                g_pwDuty[i][j] = LedColor_ToDuty(i, j, (uint8_t)(dwRgb >> (16 - 8 * j)));
+            }
+        }
+    }
+
+    if (!g_bBatch) {
+        LedColor_Commit();
+    }
+}
+
+/**
+ * @func   LedColor_SetHsv
+ * @brief  Set color of a led by hue, saturation and value
+ * @param  led_id: LED_KIT_ID0, LED_KIT_ID1 or LED_ALL_ID
+ * @param  wHue: hue in degree, 0 - 359
+ * @param  bySat: saturation, 0 - 255
+ * @param  byVal: value, 0 - 255
+ * @retval None
+ */
+void
+LedColor_SetHsv(
+    uint8_t led_id,
+    uint16_t wHue,
+    uint8_t bySat,
+    uint8_t byVal
+) {
+    LedColor_SetRgb(led_id, LedColor_HsvToRgb(wHue, bySat, byVal));
+}
+
+/**
+ * @func   LedColor_HsvToRgb
+ * @brief  Convert hue, saturation and value to RGB888
+ * @param  wHue: hue in degree, 0 - 359
+ * @param  bySat: saturation, 0 - 255
+ * @param  byVal: value, 0 - 255
+ * @retval Color 0xRRGGBB
+ */
+uint32_t
+LedColor_HsvToRgb(
+    uint16_t wHue,
+    uint8_t bySat,
+    uint8_t byVal
+) {
+    uint32_t dwRest;
+    uint8_t byP;
+    uint8_t byQ;
+    uint8_t byT;
+
+    if (bySat == 0) {
+        return LED_RGB(byVal, byVal, byVal);
+    }
+
+    wHue %= 360;
+    dwRest = (uint32_t)(wHue % 60) * 255 / 60;
+
+    byP = (uint8_t)((uint32_t)byVal * (255 - bySat) / 255);
+    byQ = (uint8_t)((uint32_t)byVal * (255 - bySat * dwRest / 255) / 255);
+    byT = (uint8_t)((uint32_t)byVal * (255 - bySat * (255 - dwRest) / 255) / 255);
+
+    switch (wHue / 60) {
+    case 0:
+        return LED_RGB(byVal, byT, byP);
+
+    case 1:
+        return LED_RGB(byQ, byVal, byP);
+
+    case 2:
+        return LED_RGB(byP, byVal, byT);
+
+    case 3:
+        return LED_RGB(byP, byQ, byVal);
+
+    case 4:
+        return LED_RGB(byT, byP, byVal);
+
+    default:
+        return LED_RGB(byVal, byP, byQ);
+    }
+}
+
+/**
+ * @func   LedColor_Begin
+ * @brief  Start a batch, colors are kept until LedColor_Commit
+ * @param  None
+ * @retval None
+ */
+void
+LedColor_Begin(void)
+{
+    g_bBatch = 1;
+}
+
+/**
+ * @func   LedColor_Commit
+ * @brief  Write compare registers of all six channels, they change together
+ *         at next PWM period
+ * @param  None
+ * @retval None
+ */
+void
+LedColor_Commit(void)
+{
+    uint8_t i;
+    uint8_t j;
+
+    g_bBatch = 0;
+
+    /* No update event while registers are written, so preloaded values of
+     * a half written color never reach the outputs */
+    TIM_UpdateDisableConfig(TIM1, ENABLE);
+    TIM_UpdateDisableConfig(TIM2, ENABLE);
+    TIM_UpdateDisableConfig(TIM3, ENABLE);
+
+    for (i = 0; i < LED_KIT_COUNT; i++) {
+        for (j = 0; j < NUM_OF_COLOR; j++) {
+            *g_pLedKitCcr[i][j] = g_pwDuty[i][j];
+        }
+    }
+
+    TIM_UpdateDisableConfig(TIM1, DISABLE);
+    TIM_UpdateDisableConfig(TIM2, DISABLE);
+    TIM_UpdateDisableConfig(TIM3, DISABLE);
+}
+
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+/**
+ * @func   LedColor_ToDuty
+ * @brief  Compare value of a component: gamma, calibration, then scaled to
+ *         period of timer. A component above 0 is never off
+ * @param  byKit: 0 or 1
+ * @param  byChannel: LED_KIT_RED / GREEN / BLUE
+ * @param  byValue: component, 0 - 255
+ * @retval Compare value
+ */
+static uint16_t
+LedColor_ToDuty(
+    uint8_t byKit,
+    uint8_t byChannel,
+    uint8_t byValue
+) {
+    uint32_t dwLight = (uint32_t)g_pwLedGamma[byValue] * g_pbyCalib[byKit][byChannel] / LED_CALIB_FULL;
+    uint32_t dwDuty = (dwLight * (g_pLedKitTimer[byKit][byChannel]->ARR + 1) + LED_GAMMA_ONE / 2) / LED_GAMMA_ONE;
+
+    if ((dwDuty == 0) && (byValue != 0) && (g_pbyCalib[byKit][byChannel] != 0)) {
+        dwDuty = 1;
+    }
+
+    return (uint16_t)dwDuty;
+}
+
+/* END FILE */
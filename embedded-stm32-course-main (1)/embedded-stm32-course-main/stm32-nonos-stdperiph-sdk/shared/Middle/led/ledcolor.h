@@ -0,0 +1,138 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Led colors in RGB888 / HSV, gamma corrected and calibrated
+ *              per channel, at full resolution of LED_TIMER_PERIOD
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+#ifndef _LEDCOLOR_H_
+#define _LEDCOLOR_H_
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <stdint.h>
+#include "led.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+/*! @brief Color 0xRRGGBB from 8-bit components */
+#define LED_RGB(r, g, b)                    (((uint32_t)(r) << 16) | ((uint32_t)(g) << 8) | (uint32_t)(b))
+
+#define LED_RGB_BLACK                       LED_RGB(0, 0, 0)
+#define LED_RGB_WHITE                       LED_RGB(255, 255, 255)
+#define LED_RGB_YELLOW                      LED_RGB(255, 255, 0)
+
+/*! @brief Calibration of a channel, LED_CALIB_FULL keeps full duty */
+#define LED_CALIB_FULL                      255u
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func   LedColor_Init
+ * @brief  Preload compare registers of led timers, after LedControl_Init.
+ *         Calibration is full on all channels
+ * @param  None
+ * @retval None
+ */
+void
+LedColor_Init(void);
+
+/**
+ * @func   LedColor_SetCalibration
+ * @brief  Scale channels of a led so that equal components give white
+ * @param  led_id: LED_KIT_ID0, LED_KIT_ID1 or LED_ALL_ID
+ * @param  byRed, byGreen, byBlue: scale, 0 - LED_CALIB_FULL
+ * @retval None
+ */
+void
+LedColor_SetCalibration(
+    uint8_t led_id,
+    uint8_t byRed,
+    uint8_t byGreen,
+    uint8_t byBlue
+);
+
+/**
+ * @func   LedColor_SetRgb
+ * @brief  Set color of a led, applied now or by LedColor_Commit in a batch
+ * @param  led_id: LED_KIT_ID0, LED_KIT_ID1 or LED_ALL_ID
+ * @param  dwRgb: color 0xRRGGBB, perceived brightness is linear in components
+ * @retval None
+ */
+void
+LedColor_SetRgb(
+    uint8_t led_id,
+    uint32_t dwRgb
+);
+
+/**
+ * @func   LedColor_SetHsv
+ * @brief  Set color of a led by hue, saturation and value
+ * @param  led_id: LED_KIT_ID0, LED_KIT_ID1 or LED_ALL_ID
+ * @param  wHue: hue in degree, 0 - 359
+ * @param  bySat: saturation, 0 - 255
+ * @param  byVal: value, 0 - 255
+ * @retval None
+ */
+void
+LedColor_SetHsv(
+    uint8_t led_id,
+    uint16_t wHue,
+    uint8_t bySat,
+    uint8_t byVal
+);
+
+/**
+ * @func   LedColor_HsvToRgb
+ * @brief  Convert hue, saturation and value to RGB888
+ * @param  wHue: hue in degree, 0 - 359
+ * @param  bySat: saturation, 0 - 255
+ * @param  byVal: value, 0 - 255
+ * @retval Color 0xRRGGBB
+ */
+uint32_t
+LedColor_HsvToRgb(
+    uint16_t wHue,
+    uint8_t bySat,
+    uint8_t byVal
+);
+
+/**
+ * @func   LedColor_Begin
+ * @brief  Start a batch, colors are kept until LedColor_Commit
+ * @param  None
+ * @retval None
+ */
+void
+LedColor_Begin(void);
+
+/**
+ * @func   LedColor_Commit
+ * @brief  Write compare registers of all six channels, they change together
+ *         at next PWM period
+ * @param  None
+ * @retval None
+ */
+void
+LedColor_Commit(void);
+
+#endif
+
+/* END FILE */
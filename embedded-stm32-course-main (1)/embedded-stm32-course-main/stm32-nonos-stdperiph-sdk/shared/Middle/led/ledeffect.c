@@ -0,0 +1,658 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Led effects, duty cycles of fade, breath and blink are
+ *              computed into a table and written to PWM compare registers by
+ *              DMA, no CPU while effect runs
+ *
+ *              Led kit 0 (TIM1 CH1N/CH4/CH3): update event of TIM1, slowed
+ *              down by repetition counter, bursts a table row to CCR1..CCR4
+ *              Led kit 1 (TIM2 CH2/CH1, TIM3 CH3): compare events of TIM5
+ *              (step timer) move a table column to each CCR
+ *
+ *              Tables loop for repeats, transfer complete interrupt counts
+ *              the runs so an effect ends on its last step
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include "stm32f401re_rcc.h"
+#include "stm32f401re_tim.h"
+#include "stm32f401re_dma.h"
+#include "misc.h"
+#include "utilities.h"
+#include "led.h"
+#include "ledkit.h"
+#include "ledeffect.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+/* Kit 0: TIM1_UP is mapped on DMA2 stream 5 channel 6, a burst writes
+ * CCR1 - CCR4, a color is at offset of its register in g_pLedKitCcr */
+#define LED_KIT0_TIM                        TIM1
+#define LED_KIT0_DMA_STREAM                 DMA2_Stream5
+#define LED_KIT0_DMA_CHANNEL                DMA_Channel_6
+#define LED_KIT0_BURST                      4u
+#define LED_KIT0_BURST_SLOT(color)          ((uint8_t)(g_pLedKitCcr[0][color] - &LED_KIT0_TIM->CCR1))
+#define LED_KIT0_DMA_IT_TC                  DMA_IT_TCIF5
+#define LED_KIT0_DMA_IRQn                   DMA2_Stream5_IRQn
+#define LED_KIT0_DMA_IRQHandler             DMA2_Stream5_IRQHandler
+
+/* Kit 1: TIM5_CH1 / CH2 / CH4 are mapped on DMA1 stream 2 / 4 / 1
+ * channel 6, one stream per color */
+#define LED_STEP_TIM                        TIM5
+#define LED_STEP_TIM_CLK                    RCC_APB1Periph_TIM5
+#define LED_STEP_TIM_HZ                     10000u
+#define LED_KIT1_DMA_CHANNEL                DMA_Channel_6
+#define LED_KIT1_DMA_REQUEST                (TIM_DMA_CC1 | TIM_DMA_CC2 | TIM_DMA_CC4)
+
+/* Runs of kit 1 are counted on stream of red, streams move together */
+#define LED_KIT1_DMA_COUNT_STREAM           DMA1_Stream2
+#define LED_KIT1_DMA_IT_TC                  DMA_IT_TCIF2
+#define LED_KIT1_DMA_IRQn                   DMA1_Stream2_IRQn
+#define LED_KIT1_DMA_IRQHandler             DMA1_Stream2_IRQHandler
+
+#define LED_DMA_CLK                         (RCC_AHB1Periph_DMA1 | RCC_AHB1Periph_DMA2)
+
+/* Breath curve, level is square of a triangle in 0 - LED_BREATH_ONE */
+#define LED_BREATH_ONE                      1000u
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+static uint16_t g_pwDutyKit0[LED_EFFECT_STEPS_MAX][LED_KIT0_BURST];
+static uint16_t g_pwDutyKit1[NUM_OF_COLOR][LED_EFFECT_STEPS_MAX];
+
+static DMA_Stream_TypeDef * const g_pKit1Stream[NUM_OF_COLOR] = {
+    DMA1_Stream2,                           /* TIM5_CH1 -> TIM2 CCR2, red */
+    DMA1_Stream4,                           /* TIM5_CH2 -> TIM2 CCR1, green */
+    DMA1_Stream1,                           /* TIM5_CH4 -> TIM3 CCR3, blue */
+};
+
+/* Stream and transfer complete interrupt counting runs of each kit */
+static DMA_Stream_TypeDef * const g_pCountStream[LED_KIT_COUNT] = {
+    LED_KIT0_DMA_STREAM,
+    LED_KIT1_DMA_COUNT_STREAM,
+};
+
+static const uint32_t g_pdwCountIt[LED_KIT_COUNT] = {
+    LED_KIT0_DMA_IT_TC,
+    LED_KIT1_DMA_IT_TC,
+};
+
+/* Runs of table left before effect ends, 0 if not counted */
+static volatile uint8_t g_pbyRepeat[LED_KIT_COUNT];
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static void LedEffect_SetStep(uint8_t byKits, uint16_t wStep, uint8_t byRed, uint8_t byGreen, uint8_t byBlue);
+static void LedEffect_Start(uint8_t byKits, uint16_t wSteps, uint8_t byRepeat);
+static void LedEffect_StartKit0(uint16_t wSteps, uint8_t bCircular);
+static void LedEffect_StartKit1(uint16_t wSteps, uint8_t bCircular);
+static void LedEffect_StopKit(uint8_t byKit);
+static void LedEffect_DmaConfig(DMA_Stream_TypeDef *pStream, uint32_t dwPeripheral);
+static void LedEffect_RunDone(uint8_t byKit);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func   LedEffect_Init
+ * @brief  Initializes step timer and DMA of effects, after LedControl_Init
+ * @param  None
+ * @retval None
+ */
+void
+LedEffect_Init(void)
+{
+    TIM_TimeBaseInitTypeDef TIM_TimeBaseStructure;
+    TIM_OCInitTypeDef TIM_OCInitStructure;
+    NVIC_InitTypeDef NVIC_InitStructure;
+    uint8_t i;
+
+    RCC_AHB1PeriphClockCmd(LED_DMA_CLK, ENABLE);
+
+    /* Step timer, compare events at counter 0 request DMA of kit 1 */
+    RCC_APB1PeriphClockCmd(LED_STEP_TIM_CLK, ENABLE);
+
+    TIM_TimeBaseStructure.TIM_Prescaler = (uint16_t)(SystemCoreClock / LED_STEP_TIM_HZ - 1);
+    TIM_TimeBaseStructure.TIM_Period = LED_EFFECT_STEP_MS * (LED_STEP_TIM_HZ / 1000u) - 1;
+    TIM_TimeBaseStructure.TIM_ClockDivision = 0;
+    TIM_TimeBaseStructure.TIM_CounterMode = TIM_CounterMode_Up;
+    TIM_TimeBaseStructure.TIM_RepetitionCounter = 0;
+    TIM_TimeBaseInit(LED_STEP_TIM, &TIM_TimeBaseStructure);
+
+    TIM_OCStructInit(&TIM_OCInitStructure);
+    TIM_OCInitStructure.TIM_OCMode = TIM_OCMode_Timing;
+    TIM_OCInitStructure.TIM_Pulse = 0;
+    TIM_OC1Init(LED_STEP_TIM, &TIM_OCInitStructure);
+    TIM_OC2Init(LED_STEP_TIM, &TIM_OCInitStructure);
+    TIM_OC4Init(LED_STEP_TIM, &TIM_OCInitStructure);
+    TIM_Cmd(LED_STEP_TIM, ENABLE);
+
+    LedEffect_DmaConfig(LED_KIT0_DMA_STREAM, (uint32_t)&LED_KIT0_TIM->DMAR);
+    for (i = 0; i < NUM_OF_COLOR; i++) {
+        LedEffect_DmaConfig(g_pKit1Stream[i], (uint32_t)g_pLedKitCcr[1][i]);
+    }
+
+    /* Transfer complete of a counted effect, once per run of table */
+    NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 3;
+    NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0;
+    NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+    NVIC_InitStructure.NVIC_IRQChannel = LED_KIT0_DMA_IRQn;
+    NVIC_Init(&NVIC_InitStructure);
+    NVIC_InitStructure.NVIC_IRQChannel = LED_KIT1_DMA_IRQn;
+    NVIC_Init(&NVIC_InitStructure);
+}
+
+/**
+ * @func   LedEffect_Fade
+ * @brief  Fade from a color to another, led keeps last color
+ * @param  led_id: LED_KIT_ID0, LED_KIT_ID1 or LED_ALL_ID
+ * @param  pFrom: first color
+ * @param  pTo: last color
+ * @param  wTime: time of fade (ms)
+ * @retval LED_EFFECT_OK or error code
+ */
+uint8_t
+LedEffect_Fade(
+    uint8_t led_id,
+    const led_rgb_t *pFrom,
+    const led_rgb_t *pTo,
+    uint16_t wTime
+) {
+    uint8_t byKits = LedKit_GetMask(led_id);
+    uint16_t wSteps = wTime / LED_EFFECT_STEP_MS;
+    uint16_t i;
+
+    if (byKits == 0) {
+        return LED_EFFECT_ERR_PARAM;
+    }
+
+    if (wSteps == 0) {
+        wSteps = 1;
+    } else if (wSteps > LED_EFFECT_STEPS_MAX) {
+        return LED_EFFECT_ERR_LENGTH;
+    }
+
+    LedEffect_Stop(led_id);
+
+    for (i = 0; i < wSteps; i++) {
+        LedEffect_SetStep(byKits, i,
+            (uint8_t)(pFrom->byRed + ((int16_t)pTo->byRed - pFrom->byRed) * (i + 1) / wSteps),
+            (uint8_t)(pFrom->byGreen + ((int16_t)pTo->byGreen - pFrom->byGreen) * (i + 1) / wSteps),
+            (uint8_t)(pFrom->byBlue + ((int16_t)pTo->byBlue - pFrom->byBlue) * (i + 1) / wSteps));
+    }
+
+    LedEffect_Start(byKits, wSteps, 1);
+
+    return LED_EFFECT_OK;
+}
+
+/**
+ * @func   LedEffect_Breath
+ * @brief  Breathe a color, from off to color and back to off
+ * @param  led_id: LED_KIT_ID0, LED_KIT_ID1 or LED_ALL_ID
+ * @param  pColor: brightest color
+ * @param  wPeriod: time of a breath (ms)
+ * @param  byRepeat: number of breaths, BLINK_FOREVER to run until stop
+ * @retval LED_EFFECT_OK or error code
+ */
+uint8_t
+LedEffect_Breath(
+    uint8_t led_id,
+    const led_rgb_t *pColor,
+    uint16_t wPeriod,
+    uint8_t byRepeat
+) {
+    uint8_t byKits = LedKit_GetMask(led_id);
+    uint16_t wSteps = wPeriod / LED_EFFECT_STEP_MS;
+    uint32_t dwLevel;
+    uint16_t i;
+
+    if ((byKits == 0) || (byRepeat == 0)) {
+        return LED_EFFECT_ERR_PARAM;
+    }
+
+    if ((wSteps < 2) || (wSteps > LED_EFFECT_STEPS_MAX)) {
+        return LED_EFFECT_ERR_LENGTH;
+    }
+
+    LedEffect_Stop(led_id);
+
+    for (i = 0; i < wSteps; i++) {
+        /* Triangle up then down, squared so the led looks linear to eye */
+        dwLevel = (uint32_t)i * 2 * LED_BREATH_ONE / wSteps;
+        if (dwLevel > LED_BREATH_ONE) {
+            dwLevel = 2 * LED_BREATH_ONE - dwLevel;
+        }
+        dwLevel = dwLevel * dwLevel / LED_BREATH_ONE;
+
+        LedEffect_SetStep(byKits, i,
+                          (uint8_t)(pColor->byRed * dwLevel / LED_BREATH_ONE),
+                          (uint8_t)(pColor->byGreen * dwLevel / LED_BREATH_ONE),
+                          (uint8_t)(pColor->byBlue * dwLevel / LED_BREATH_ONE));
+    }
+
+    LedEffect_Start(byKits, wSteps, byRepeat);
+
+    return LED_EFFECT_OK;
+}
+
+/**
+ * @func   LedEffect_Pattern
+ * @brief  Blink a pattern of bits, led is on at bits 1
+ * @param  led_id: LED_KIT_ID0, LED_KIT_ID1 or LED_ALL_ID
+ * @param  pColor: color at bits 1
+ * @param  dwPattern: bits, most significant of byBits first
+ * @param  byBits: number of bits, 1 - 32
+ * @param  wBitTime: time of a bit (ms)
+ * @param  byRepeat: number of patterns, BLINK_FOREVER to run until stop
+ * @retval LED_EFFECT_OK or error code
+ */
+uint8_t
+LedEffect_Pattern(
+    uint8_t led_id,
+    const led_rgb_t *pColor,
+    uint32_t dwPattern,
+    uint8_t byBits,
+    uint16_t wBitTime,
+    uint8_t byRepeat
+) {
+    uint8_t byKits = LedKit_GetMask(led_id);
+    uint16_t wBitSteps = wBitTime / LED_EFFECT_STEP_MS;
+    uint16_t wStep = 0;
+    uint16_t i;
+    uint8_t byBit;
+
+    if ((byKits == 0) || (byBits == 0) || (byBits > 32) || (byRepeat == 0)) {
+        return LED_EFFECT_ERR_PARAM;
+    }
+
+    if (wBitSteps == 0) {
+        wBitSteps = 1;
+    }
+
+    if ((uint32_t)wBitSteps * byBits > LED_EFFECT_STEPS_MAX) {
+        return LED_EFFECT_ERR_LENGTH;
+    }
+
+    LedEffect_Stop(led_id);
+
+    for (byBit = byBits; byBit > 0; byBit--) {
+        for (i = 0; i < wBitSteps; i++) {
+            if (dwPattern & (1ul << (byBit - 1))) {
+                LedEffect_SetStep(byKits, wStep++, pColor->byRed, pColor->byGreen, pColor->byBlue);
+            } else {
+                LedEffect_SetStep(byKits, wStep++, 0, 0, 0);
+            }
+        }
+    }
+
+    LedEffect_Start(byKits, wStep, byRepeat);
+
+    return LED_EFFECT_OK;
+}
+
+/**
+ * @func   LedEffect_Blink
+ * @brief  Same blink as LedControl_BlinkStart, done by DMA
+ * @param  led_id: LED_KIT_ID0, LED_KIT_ID1 or LED_ALL_ID
+ * @param  led_blink: color of blink
+ * @param  byRepeat: number of blinks, BLINK_FOREVER to run until stop
+ * @param  wInterval: time on and time off (ms)
+ * @retval LED_EFFECT_OK or error code
+ */
+uint8_t
+LedEffect_Blink(
+    uint8_t led_id,
+    led_blink_type_t led_blink,
+    uint8_t byRepeat,
+    uint16_t wInterval
+) {
+    led_rgb_t color = { 0, 0, 0 };
+
+    switch (led_blink) {
+    case BLINK_RED:
+        color.byRed = 100;
+        break;
+
+    case BLINK_GREEN:
+        color.byGreen = 100;
+        break;
+
+    case BLINK_BLUE:
+        color.byBlue = 100;
+        break;
+
+    case BLINK_WHITE:
+        color.byRed = 100;
+        color.byGreen = 100;
+        color.byBlue = 100;
+        break;
+
+    default:
+        return LED_EFFECT_ERR_PARAM;
+    }
+
+    return LedEffect_Pattern(led_id, &color, 0x02, 2, wInterval, byRepeat);
+}
+
+/**
+ * @func   LedEffect_Stop
+ * @brief  Stop effect, led keeps its current color. Must be called before
+ *         LedControl_SetColor* on a led running an effect
+ * @param  led_id: LED_KIT_ID0, LED_KIT_ID1 or LED_ALL_ID
+ * @retval None
+ */
+void
+LedEffect_Stop(
+    uint8_t led_id
+) {
+    uint8_t byKits = LedKit_GetMask(led_id);
+    uint8_t i;
+
+    for (i = 0; i < LED_KIT_COUNT; i++) {
+        if (byKits & (1u << i)) {
+            LedEffect_StopKit(i);
+        }
+    }
+}
+
+/**
+ * @func   LedEffect_IsRunning
+ * @brief  Check an effect is running on a led
+ * @param  led_id: LED_KIT_ID0 or LED_KIT_ID1
+ * @retval 1 if running; 0 otherwise
+ */
+uint8_t
+LedEffect_IsRunning(
+    uint8_t led_id
+) {
+    switch (led_id) {
+    case LED_KIT_ID0:
+        return DMA_GetCmdStatus(LED_KIT0_DMA_STREAM) == ENABLE;
+
+    case LED_KIT_ID1:
+        return DMA_GetCmdStatus(g_pKit1Stream[LED_KIT_RED]) == ENABLE;
+
+    default:
+        return 0;
+    }
+}
+
+/**
+ * @func   LED_KIT0_DMA_IRQHandler
+ * @brief  A run of kit 0 table is done
+ * @param  None
+ * @retval None
+ */
+void
+LED_KIT0_DMA_IRQHandler(void)
+{
+    if (DMA_GetITStatus(LED_KIT0_DMA_STREAM, LED_KIT0_DMA_IT_TC) != RESET) {
+        DMA_ClearITPendingBit(LED_KIT0_DMA_STREAM, LED_KIT0_DMA_IT_TC);
+        LedEffect_RunDone(0);
+    }
+}
+
+/**
+ * @func   LED_KIT1_DMA_IRQHandler
+ * @brief  A run of kit 1 tables is done
+ * @param  None
+ * @retval None
+ */
+void
+LED_KIT1_DMA_IRQHandler(void)
+{
+    if (DMA_GetITStatus(LED_KIT1_DMA_COUNT_STREAM, LED_KIT1_DMA_IT_TC) != RESET) {
+        DMA_ClearITPendingBit(LED_KIT1_DMA_COUNT_STREAM, LED_KIT1_DMA_IT_TC);
+        LedEffect_RunDone(1);
+    }
+}
+
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+/**
+ * @func   LedEffect_SetStep
+ * @brief  Store a color in tables as compare values
+ * @param  byKits: kits to store in
+ * @param  wStep: step of table
+ * @param  byRed, byGreen, byBlue: levels (0 - 100%)
+ * @retval None
+ */
+static void
+LedEffect_SetStep(
+    uint8_t byKits,
+    uint16_t wStep,
+    uint8_t byRed,
+    uint8_t byGreen,
+    uint8_t byBlue
+) {
+    uint8_t pbyLevel[NUM_OF_COLOR];
+    uint32_t dwPeriod;
+    uint8_t i;
+
+    pbyLevel[LED_KIT_RED] = byRed;
+    pbyLevel[LED_KIT_GREEN] = byGreen;
+    pbyLevel[LED_KIT_BLUE] = byBlue;
+
+    if (byKits & 0x01) {
+        for (i = 0; i < NUM_OF_COLOR; i++) {
+            dwPeriod = g_pLedKitTimer[0][i]->ARR + 1;
+            g_pwDutyKit0[wStep][LED_KIT0_BURST_SLOT(i)] = (uint16_t)(pbyLevel[i] * dwPeriod / 100);
+        }
+    }
+
+    if (byKits & 0x02) {
+        for (i = 0; i < NUM_OF_COLOR; i++) {
+            dwPeriod = g_pLedKitTimer[1][i]->ARR + 1;
+            g_pwDutyKit1[i][wStep] = (uint16_t)(pbyLevel[i] * dwPeriod / 100);
+        }
+    }
+}
+
+/**
+ * @func   LedEffect_Start
+ * @brief  Start DMA of tables. A single run stops on last step, other
+ *         repeats loop, a counted one is ended by transfer complete of its
+ *         last run
+ * @param  byKits: kits to start
+ * @param  wSteps: steps of tables
+ * @param  byRepeat: number of runs, BLINK_FOREVER to run until stop
+ * @retval None
+ */
+static void
+LedEffect_Start(
+    uint8_t byKits,
+    uint16_t wSteps,
+    uint8_t byRepeat
+) {
+    uint8_t bCircular = (byRepeat != 1);
+    uint8_t bCounted = bCircular && (byRepeat != BLINK_FOREVER);
+    uint8_t i;
+
+    /* Stream is configured while disabled, a stale flag is no run */
+    for (i = 0; i < LED_KIT_COUNT; i++) {
+        if (byKits & (1u << i)) {
+            g_pbyRepeat[i] = bCounted ? byRepeat : 0;
+            DMA_ClearITPendingBit(g_pCountStream[i], g_pdwCountIt[i]);
+            DMA_ITConfig(g_pCountStream[i], DMA_IT_TC, bCounted ? ENABLE : DISABLE);
+        }
+    }
+
+    if (byKits & 0x01) {
+        LedEffect_StartKit0(wSteps, bCircular);
+    }
+
+    if (byKits & 0x02) {
+        LedEffect_StartKit1(wSteps, bCircular);
+    }
+}
+
+/**
+ * @func   LedEffect_StartKit0
+ * @brief  Every LED_EFFECT_STEP_MS, update event of TIM1 bursts a table row
+ *         to CCR1..CCR4
+ * @param  wSteps: steps of table
+ * @param  bCircular: 1 to loop table
+ * @retval None
+ */
+static void
+LedEffect_StartKit0(
+    uint16_t wSteps,
+    uint8_t bCircular
+) {
+    uint32_t dwRepetition = (SystemCoreClock / (LED_KIT0_TIM->ARR + 1)) * LED_EFFECT_STEP_MS / 1000u;
+
+    /* Update event once per step, 8-bit repetition counter */
+    if (dwRepetition > 256) {
+        dwRepetition = 256;
+    }
+    LED_KIT0_TIM->RCR = (uint16_t)(dwRepetition - 1);
+
+    if (bCircular) {
+        LED_KIT0_DMA_STREAM->CR |= DMA_SxCR_CIRC;
+    } else {
+        LED_KIT0_DMA_STREAM->CR &= ~DMA_SxCR_CIRC;
+    }
+    LED_KIT0_DMA_STREAM->M0AR = (uint32_t)g_pwDutyKit0;
+    DMA_SetCurrDataCounter(LED_KIT0_DMA_STREAM, (uint16_t)(wSteps * LED_KIT0_BURST));
+    DMA_Cmd(LED_KIT0_DMA_STREAM, ENABLE);
+
+    TIM_DMAConfig(LED_KIT0_TIM, TIM_DMABase_CCR1, TIM_DMABurstLength_4Transfers);
+    TIM_DMACmd(LED_KIT0_TIM, TIM_DMA_Update, ENABLE);
+}
+
+/**
+ * @func   LedEffect_StartKit1
+ * @brief  Every LED_EFFECT_STEP_MS, compare events of step timer move a step
+ *         of each color to its CCR
+ * @param  wSteps: steps of table
+ * @param  bCircular: 1 to loop table
+ * @retval None
+ */
+static void
+LedEffect_StartKit1(
+    uint16_t wSteps,
+    uint8_t bCircular
+) {
+    DMA_Stream_TypeDef *pStream;
+    uint8_t i;
+
+    for (i = 0; i < NUM_OF_COLOR; i++) {
+        pStream = g_pKit1Stream[i];
+        if (bCircular) {
+            pStream->CR |= DMA_SxCR_CIRC;
+        } else {
+            pStream->CR &= ~DMA_SxCR_CIRC;
+        }
+        pStream->M0AR = (uint32_t)g_pwDutyKit1[i];
+        DMA_SetCurrDataCounter(pStream, wSteps);
+        DMA_Cmd(pStream, ENABLE);
+    }
+
+    TIM_DMACmd(LED_STEP_TIM, LED_KIT1_DMA_REQUEST, ENABLE);
+}
+
+/**
+ * @func   LedEffect_StopKit
+ * @brief  Stop DMA of a kit, TIM1 is back to an update event per PWM period
+ * @param  byKit: 0 or 1
+ * @retval None
+ */
+static void
+LedEffect_StopKit(
+    uint8_t byKit
+) {
+    uint8_t i;
+
+    g_pbyRepeat[byKit] = 0;
+    DMA_ITConfig(g_pCountStream[byKit], DMA_IT_TC, DISABLE);
+
+    if (byKit == 0) {
+        TIM_DMACmd(LED_KIT0_TIM, TIM_DMA_Update, DISABLE);
+        DMA_Cmd(LED_KIT0_DMA_STREAM, DISABLE);
+        while (DMA_GetCmdStatus(LED_KIT0_DMA_STREAM) != DISABLE);
+        LED_KIT0_TIM->RCR = 0;
+        return;
+    }
+
+    TIM_DMACmd(LED_STEP_TIM, LED_KIT1_DMA_REQUEST, DISABLE);
+    for (i = 0; i < NUM_OF_COLOR; i++) {
+        DMA_Cmd(g_pKit1Stream[i], DISABLE);
+        while (DMA_GetCmdStatus(g_pKit1Stream[i]) != DISABLE);
+    }
+}
+
+/**
+ * @func   LedEffect_DmaConfig
+ * @brief  DMA stream from a table to compare registers, started by
+ *         LedEffect_StartKit0 / LedEffect_StartKit1
+ * @param  pStream: stream
+ * @param  dwPeripheral: address of register
+ * @retval None
+ */
+static void
+LedEffect_DmaConfig(
+    DMA_Stream_TypeDef *pStream,
+    uint32_t dwPeripheral
+) {
+    DMA_InitTypeDef DMA_InitStructure;
+
+    DMA_DeInit(pStream);
+
+    DMA_InitStructure.DMA_Channel = (pStream == LED_KIT0_DMA_STREAM) ?
+                                    LED_KIT0_DMA_CHANNEL : LED_KIT1_DMA_CHANNEL;
+    DMA_InitStructure.DMA_PeripheralBaseAddr = dwPeripheral;
+    DMA_InitStructure.DMA_Memory0BaseAddr = 0;
+    DMA_InitStructure.DMA_DIR = DMA_DIR_MemoryToPeripheral;
+    DMA_InitStructure.DMA_BufferSize = 1;
+    DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+    DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
+    DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_HalfWord;
+    DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_HalfWord;
+    DMA_InitStructure.DMA_Mode = DMA_Mode_Normal;
+    DMA_InitStructure.DMA_Priority = DMA_Priority_Low;
+    DMA_InitStructure.DMA_FIFOMode = DMA_FIFOMode_Disable;
+    DMA_InitStructure.DMA_FIFOThreshold = DMA_FIFOThreshold_Full;
+    DMA_InitStructure.DMA_MemoryBurst = DMA_MemoryBurst_Single;
+    DMA_InitStructure.DMA_PeripheralBurst = DMA_PeripheralBurst_Single;
+    DMA_Init(pStream, &DMA_InitStructure);
+}
+
+/**
+ * @func   LedEffect_RunDone
+ * @brief  Transfer complete interrupt, a run of table is done. After last
+ *         repeat the effect stops and led is off, before next step
+ * @param  byKit: 0 or 1
+ * @retval None
+ */
+static void
+LedEffect_RunDone(
+    uint8_t byKit
+) {
+    if ((g_pbyRepeat[byKit] == 0) || (--g_pbyRepeat[byKit] != 0)) {
+        return;
+    }
+
+    LedEffect_StopKit(byKit);
+    LedControl_SetColorGeneral((byKit == 0) ? LED_KIT_ID0 : LED_KIT_ID1, LED_COLOR_BLACK, 0);
+}
+
+/* END FILE */
@@ -0,0 +1,161 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Led effects, duty cycles of fade, breath and blink are
+ *              computed into a table and written to PWM compare registers by
+ *              DMA, no CPU while effect runs
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+#ifndef _LEDEFFECT_H_
+#define _LEDEFFECT_H_
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <stdint.h>
+#include "led.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+/*! @brief Time of a table step (ms) and table length, longest effect period
+ *         is LED_EFFECT_STEP_MS * LED_EFFECT_STEPS_MAX */
+#define LED_EFFECT_STEP_MS                  10u
+#define LED_EFFECT_STEPS_MAX                200u
+
+/*! @brief Return code of effects */
+#define LED_EFFECT_OK                       0x00u
+#define LED_EFFECT_ERR_PARAM                0x01u   /*< Board led or bad color */
+#define LED_EFFECT_ERR_LENGTH               0x02u   /*< Period over table */
+
+/*! @brief Color of an effect, level of each led color (0 - 100%) */
+typedef struct {
+    uint8_t byRed;
+    uint8_t byGreen;
+    uint8_t byBlue;
+} led_rgb_t;
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func   LedEffect_Init
+ * @brief  Initializes step timer and DMA of effects, after LedControl_Init
+ * @param  None
+ * @retval None
+ */
+void
+LedEffect_Init(void);
+
+/**
+ * @func   LedEffect_Fade
+ * @brief  Fade from a color to another, led keeps last color
+ * @param  led_id: LED_KIT_ID0, LED_KIT_ID1 or LED_ALL_ID
+ * @param  pFrom: first color
+ * @param  pTo: last color
+ * @param  wTime: time of fade (ms)
+ * @retval LED_EFFECT_OK or error code
+ */
+uint8_t
+LedEffect_Fade(
+    uint8_t led_id,
+    const led_rgb_t *pFrom,
+    const led_rgb_t *pTo,
+    uint16_t wTime
+);
+
+/**
+ * @func   LedEffect_Breath
+ * @brief  Breathe a color, from off to color and back to off
+ * @param  led_id: LED_KIT_ID0, LED_KIT_ID1 or LED_ALL_ID
+ * @param  pColor: brightest color
+ * @param  wPeriod: time of a breath (ms)
+ * @param  byRepeat: number of breaths, BLINK_FOREVER to run until stop
+ * @retval LED_EFFECT_OK or error code
+ */
+uint8_t
+LedEffect_Breath(
+    uint8_t led_id,
+    const led_rgb_t *pColor,
+    uint16_t wPeriod,
+    uint8_t byRepeat
+);
+
+/**
+ * @func   LedEffect_Pattern
+ * @brief  Blink a pattern of bits, led is on at bits 1
+ * @param  led_id: LED_KIT_ID0, LED_KIT_ID1 or LED_ALL_ID
+ * @param  pColor: color at bits 1
+ * @param  dwPattern: bits, most significant of byBits first
+ * @param  byBits: number of bits, 1 - 32
+ * @param  wBitTime: time of a bit (ms)
+ * @param  byRepeat: number of patterns, BLINK_FOREVER to run until stop
+ * @retval LED_EFFECT_OK or error code
+ */
+uint8_t
+LedEffect_Pattern(
+    uint8_t led_id,
+    const led_rgb_t *pColor,
+    uint32_t dwPattern,
+    uint8_t byBits,
+    uint16_t wBitTime,
+    uint8_t byRepeat
+);
+
+/**
+ * @func   LedEffect_Blink
+ * @brief  Same blink as LedControl_BlinkStart, done by DMA
+ * @param  led_id: LED_KIT_ID0, LED_KIT_ID1 or LED_ALL_ID
+ * @param  led_blink: color of blink
+ * @param  byRepeat: number of blinks, BLINK_FOREVER to run until stop
+ * @param  wInterval: time on and time off (ms)
+ * @retval LED_EFFECT_OK or error code
+ */
+uint8_t
+LedEffect_Blink(
+    uint8_t led_id,
+    led_blink_type_t led_blink,
+    uint8_t byRepeat,
+    uint16_t wInterval
+);
+
+/**
+ * @func   LedEffect_Stop
+ * @brief  Stop effect, led keeps its current color. Must be called before
+ *         LedControl_SetColor* on a led running an effect
+ * @param  led_id: LED_KIT_ID0, LED_KIT_ID1 or LED_ALL_ID
+ * @retval None
+ */
+void
+LedEffect_Stop(
+    uint8_t led_id
+);
+
+/**
+ * @func   LedEffect_IsRunning
+ * @brief  Check an effect is running on a led
+ * @param  led_id: LED_KIT_ID0 or LED_KIT_ID1
+ * @retval 1 if running; 0 otherwise
+ */
+uint8_t
+LedEffect_IsRunning(
+    uint8_t led_id
+);
+
+#endif
+
+/* END FILE */
@@ -0,0 +1,64 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Timer and compare register of each color of the kit leds,
+ *              shared by LedColor_* and LedEffect_*
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include "ledkit.h"
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+volatile uint32_t * const g_pLedKitCcr[LED_KIT_COUNT][NUM_OF_COLOR] = {
+    { &TIM1->CCR1, &TIM1->CCR4, &TIM1->CCR3 },
+    { &TIM2->CCR2, &TIM2->CCR1, &TIM3->CCR3 },
+};
+
+/* ARR of TIM3 follows the note of the buzzer */
+TIM_TypeDef * const g_pLedKitTimer[LED_KIT_COUNT][NUM_OF_COLOR] = {
+    { TIM1, TIM1, TIM1 },
+    { TIM2, TIM2, TIM3 },
+};
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func   LedKit_GetMask
+ * @brief  Kits of a led id, board led has no PWM
+ * @param  led_id: identify of led
+ * @retval Bit 0 kit 0, bit 1 kit 1; 0 if none
+ */
+uint8_t
+LedKit_GetMask(
+    uint8_t led_id
+) {
+    switch (led_id) {
+    case LED_KIT_ID0:
+        return 0x01;
+
+    case LED_KIT_ID1:
+        return 0x02;
+
+    case LED_ALL_ID:
+        return LED_KIT_MASK_ALL;
+
+    default:
+        return 0;
+    }
+}
+
+/* END FILE */
@@ -0,0 +1,62 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Timer and compare register of each color of the kit leds,
+ *              shared by LedColor_* and LedEffect_*
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+#ifndef _LEDKIT_H_
+#define _LEDKIT_H_
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <stdint.h>
+#include "stm32f401re.h"
+#include "led.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define LED_KIT_COUNT                       2u
+#define LED_KIT_MASK_ALL                    0x03u
+
+/* Color index of the tables, same order as components of 0xRRGGBB */
+#define LED_KIT_RED                         0u
+#define LED_KIT_GREEN                       1u
+#define LED_KIT_BLUE                        2u
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+/*! @brief Compare register of each color: kit 0 on TIM1 CH1N/CH4/CH3, kit 1
+ *         on TIM2 CH2/CH1 and TIM3 CH3 */
+extern volatile uint32_t * const g_pLedKitCcr[LED_KIT_COUNT][NUM_OF_COLOR];
+
+/*! @brief Timer of each compare register in g_pLedKitCcr */
+extern TIM_TypeDef * const g_pLedKitTimer[LED_KIT_COUNT][NUM_OF_COLOR];
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func   LedKit_GetMask
+ * @brief  Kits of a led id, board led has no PWM
+ * @param  led_id: identify of led
+ * @retval Bit 0 kit 0, bit 1 kit 1; 0 if none
+ */
+uint8_t
+LedKit_GetMask(
+    uint8_t led_id
+);
+
+#endif
+
+/* END FILE */
@@ -0,0 +1,403 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Sensor sampling service, values are read from a cache
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include "utilities.h"
+#include "timer.h"
+#include "lightsensor.h"
+#include "temhumsensor.h"
+#include "si7020.h"
+#include "sensorservice.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+typedef struct {
+    uint8_t byId;
+    uint8_t byTimerId;
+    uint8_t bValid;
+    uint8_t bPending;        /*< Sample is due but driver is busy */
+    uint8_t bConverting;     /*< Sample started on driver */
+    uint8_t bRespond;        /*< Respond frame waits for sample */
+    int16_t iValue;
+    uint32_t dwTimestamp;
+    uint32_t dwPeriod;
+    uint32_t dwMaxAge;
+    sensor_stat_t stat;
+} sensor_entry_t, *sensor_entry_p;
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+static sensor_entry_t g_pSensor[SENSOR_ID_COUNT];
+static const uint32_t g_pdwPeriodDefault[SENSOR_ID_COUNT] = {
+    SENSOR_PERIOD_LIGHT_DEFAULT,
+    SENSOR_PERIOD_TEMP_DEFAULT,
+    SENSOR_PERIOD_HUMI_DEFAULT
+};
+static uint32_t g_dwStatStart;
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static void SensorService_Sample(void *pData);
+static void SensorService_StartSi7020(void);
+static void SensorService_Si7020Done(uint8_t byStatus, int16_t iHumi, int16_t iTemp);
+static void SensorService_Update(sensor_entry_p pEntry, uint8_t byStatus, int16_t iValue);
+static void SensorService_Send(sensor_entry_p pEntry);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func   SensorService_Init
+ * @brief  Start sampling all sensors at default period. LightSensor (DMA
+ *         mode), I2C engine and Si7020 driver must be initialized before
+ * @param  None
+ * @retval None
+ */
+void
+SensorService_Init(void)
+{
+    uint8_t i;
+
+    memsetl((uint8_t *)g_pSensor, 0, sizeof(g_pSensor));
+
+    for (i = 0; i < SENSOR_ID_COUNT; i++) {
+        g_pSensor[i].byId = i;
+        g_pSensor[i].byTimerId = NO_TIMER;
+        g_pSensor[i].dwMaxAge = SENSOR_MAX_AGE_DEFAULT;
+        SensorService_SetPeriod(i, g_pdwPeriodDefault[i]);
+    }
+
+    g_dwStatStart = GetMilSecTick();
+}
+
+/**
+ * @func   SensorService_SetPeriod
+ * @brief  Change sampling period of a sensor
+ * @param  byId: sensor_id_t
+ * @param  dwPeriod: period in ms, 0 to stop sampling
+ * @retval None
+ */
+void
+SensorService_SetPeriod(
+    uint8_t byId,
+    uint32_t dwPeriod
+) {
+    sensor_entry_p pEntry;
+
+    if (byId >= SENSOR_ID_COUNT) {
+        return;
+    }
+
+    pEntry = &g_pSensor[byId];
+    pEntry->dwPeriod = dwPeriod;
+
+    if (pEntry->byTimerId != NO_TIMER) {
+        TimerStop(pEntry->byTimerId);
+        pEntry->byTimerId = NO_TIMER;
+    }
+
+    if (dwPeriod != 0) {
+        pEntry->byTimerId = TimerStart("sensor", dwPeriod, TIMER_REPEAT_FOREVER,
+                                       SensorService_Sample, pEntry);
+    }
+}
+
+/**
+ * @func   SensorService_SetMaxAge
+ * @brief  Change max age of cached value of a sensor
+ * @param  byId: sensor_id_t
+ * @param  dwMaxAge: max age in ms
+ * @retval None
+ */
+void
+SensorService_SetMaxAge(
+    uint8_t byId,
+    uint32_t dwMaxAge
+) {
+    if (byId < SENSOR_ID_COUNT) {
+        g_pSensor[byId].dwMaxAge = dwMaxAge;
+    }
+}
+
+/**
+ * @func   SensorService_Read
+ * @brief  Read latest value of a sensor from cache, no hardware access.
+ *         Light: ADC code; temperature: 0.01 Celsius degree; humidity: 0.01 %RH
+ * @param  byId: sensor_id_t
+ * @param  piValue: latest value
+ * @param  pdwTimestamp: GetMilSecTick() of sample, may be NULL
+ * @retval SENSOR_OK, SENSOR_ERR_STALE (piValue still updated) or error code
+ */
+uint8_t
+SensorService_Read(
+    uint8_t byId,
+    int16_t *piValue,
+    uint32_t *pdwTimestamp
+) {
+    sensor_entry_p pEntry;
+
+    if (byId >= SENSOR_ID_COUNT) {
+        return SENSOR_ERR_PARAM;
+    }
+
+    pEntry = &g_pSensor[byId];
+    pEntry->stat.dwRead++;
+
+    if (!pEntry->bValid) {
+        return SENSOR_ERR_NO_DATA;
+    }
+
+    *piValue = pEntry->iValue;
+    if (pdwTimestamp != NULL) {
+        *pdwTimestamp = pEntry->dwTimestamp;
+    }
+
+    /* As old as max age is stale, as for TemHumSensor_Measure */
+    if ((GetMilSecTick() - pEntry->dwTimestamp) >= pEntry->dwMaxAge) {
+        return SENSOR_ERR_STALE;
+    }
+
+    pEntry->stat.dwHit++;
+
+    return SENSOR_OK;
+}
+
+/**
+ * @func   SensorService_SendPacketRespond
+ * @brief  Respond frame value of a sensor. A value within max age is sent
+ *         from cache, else a sample is started and the frame is sent when
+ *         it is done: new value, or last value if the sample failed
+ * @param  byId: sensor_id_t
+ * @retval SENSOR_OK if sent, SENSOR_PENDING or SENSOR_ERR_PARAM
+ */
+uint8_t
+SensorService_SendPacketRespond(
+    uint8_t byId
+) {
+    sensor_entry_p pEntry;
+    int16_t iValue;
+    uint8_t byStatus = SensorService_Read(byId, &iValue, NULL);
+
+    if (byStatus == SENSOR_ERR_PARAM) {
+        return byStatus;
+    }
+
+    pEntry = &g_pSensor[byId];
+
+    if (byStatus == SENSOR_OK) {
+        SensorService_Send(pEntry);
+        return SENSOR_OK;
+    }
+
+    /* Stale or no data: light is sampled at once, Si7020 answers later */
+    pEntry->bRespond = 1;
+    SensorService_Sample(pEntry);
+
+    return pEntry->bRespond ? SENSOR_PENDING : SENSOR_OK;
+}
+
+/**
+ * @func   SensorService_GetStatistic
+ * @brief  Get sample rate and cache hit ratio of a sensor
+ * @param  byId: sensor_id_t
+ * @param  pStat: statistic
+ * @retval None
+ */
+void
+SensorService_GetStatistic(
+    uint8_t byId,
+    sensor_stat_p pStat
+) {
+    uint32_t dwElapsed = GetMilSecTick() - g_dwStatStart;
+    uint64_t qwRate;
+
+    if (byId >= SENSOR_ID_COUNT) {
+        return;
+    }
+
+    *pStat = g_pSensor[byId].stat;
+
+    pStat->wSampleRate = 0;
+    if (dwElapsed != 0) {
+        qwRate = ((uint64_t)pStat->dwSample * 100000) / dwElapsed;
+        pStat->wSampleRate = (qwRate > 0xFFFF) ? 0xFFFF : (uint16_t)qwRate;
+    }
+
+    pStat->byHitRatio = 0;
+    if (pStat->dwRead != 0) {
+        pStat->byHitRatio = (uint8_t)(((uint64_t)pStat->dwHit * 100) / pStat->dwRead);
+    }
+}
+
+/**
+ * @func   SensorService_ResetStatistic
+ * @brief  Clear statistic of all sensors
+ * @param  None
+ * @retval None
+ */
+void
+SensorService_ResetStatistic(void)
+{
+    uint8_t i;
+
+    for (i = 0; i < SENSOR_ID_COUNT; i++) {
+        memsetl((uint8_t *)&g_pSensor[i].stat, 0, sizeof(sensor_stat_t));
+    }
+
+    g_dwStatStart = GetMilSecTick();
+}
+
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+/**
+ * @func   SensorService_Sample
+ * @brief  Timer callback, sample a sensor
+ * @param  pData: sensor entry
+ * @retval None
+ */
+static void
+SensorService_Sample(
+    void *pData
+) {
+    sensor_entry_p pEntry = (sensor_entry_p)pData;
+
+    if (pEntry->byId == SENSOR_ID_LIGHT) {
+        /* Light driver returns a value only, a read cannot fail */
+        SensorService_Update(pEntry, SENSOR_OK,
+                             (int16_t)LightSensor_MeasureUseDMAMode());
+    } else if (!pEntry->bConverting) {
+        /* A conversion running gives this sensor a sample too */
+        pEntry->bPending = 1;
+        SensorService_StartSi7020();
+    }
+}
+
+/**
+ * @func   SensorService_StartSi7020
+ * @brief  Start a combined conversion for pending temperature and humidity
+ *         if driver is free, else keep them pending. One conversion gives
+ *         both values
+ * @param  None
+ * @retval None
+ */
+static void
+SensorService_StartSi7020(void)
+{
+    sensor_entry_p pTemp = &g_pSensor[SENSOR_ID_TEMP];
+    sensor_entry_p pHumi = &g_pSensor[SENSOR_ID_HUMI];
+
+    if ((!pTemp->bPending && !pHumi->bPending) || Si7020_IsBusy()) {
+        return;
+    }
+
+    if (Si7020_MeasureAsync(SensorService_Si7020Done) == SI7020_OK) {
+        pTemp->bPending = 0;
+        pHumi->bPending = 0;
+        pTemp->bConverting = 1;
+        pHumi->bConverting = 1;
+    }
+}
+
+/**
+ * @func   SensorService_Si7020Done
+ * @brief  Combined conversion finished, both sensors are updated
+ * @param  byStatus: SI7020_OK or error
+ * @param  iHumi: humidity
+ * @param  iTemp: temperature
+ * @retval None
+ */
+static void
+SensorService_Si7020Done(
+    uint8_t byStatus,
+    int16_t iHumi,
+    int16_t iTemp
+) {
+    uint8_t bySensorStatus = (byStatus == SI7020_OK) ? SENSOR_OK : SENSOR_ERR_DEVICE;
+
+    g_pSensor[SENSOR_ID_TEMP].bConverting = 0;
+    g_pSensor[SENSOR_ID_HUMI].bConverting = 0;
+    SensorService_Update(&g_pSensor[SENSOR_ID_TEMP], bySensorStatus, iTemp);
+    SensorService_Update(&g_pSensor[SENSOR_ID_HUMI], bySensorStatus, iHumi);
+    SensorService_StartSi7020();
+}
+
+/**
+ * @func   SensorService_Update
+ * @brief  Store a sample into cache, send respond frame waiting for it
+ * @param  pEntry: sensor entry
+ * @param  byStatus: SENSOR_OK or SENSOR_ERR_DEVICE
+ * @param  iValue: value sampled
+ * @retval None
+ */
+static void
+SensorService_Update(
+    sensor_entry_p pEntry,
+    uint8_t byStatus,
+    int16_t iValue
+) {
+    if (byStatus != SENSOR_OK) {
+        pEntry->stat.dwError++;
+    } else {
+        pEntry->iValue = iValue;
+        pEntry->dwTimestamp = GetMilSecTick();
+        pEntry->bValid = 1;
+        pEntry->stat.dwSample++;
+    }
+
+    if (pEntry->bRespond) {
+        pEntry->bRespond = 0;
+        if (pEntry->bValid) {
+            SensorService_Send(pEntry);
+        }
+    }
+}
+
+/**
+ * @func   SensorService_Send
+ * @brief  Respond frame of cached value
+ * @param  pEntry: sensor entry
+ * @retval None
+ */
+static void
+SensorService_Send(
+    sensor_entry_p pEntry
+) {
+    switch (pEntry->byId) {
+    case SENSOR_ID_LIGHT:
+        LightSensor_SendPacketRespond((uint16_t)pEntry->iValue);
+        break;
+
+    case SENSOR_ID_TEMP:
+        TempSensor_SendPacketRespond((uint16_t)pEntry->iValue);
+        break;
+
+    case SENSOR_ID_HUMI:
+        HumiSensor_SendPacketRespond((uint16_t)pEntry->iValue);
+        break;
+
+    default:
+        break;
+    }
+}
+
+/* END FILE */
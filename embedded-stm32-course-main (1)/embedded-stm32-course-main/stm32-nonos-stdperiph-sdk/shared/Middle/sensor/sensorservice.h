@@ -0,0 +1,160 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Sensor sampling service, values are read from a cache
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+#ifndef _SENSORSERVICE_H_
+#define _SENSORSERVICE_H_
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <stdint.h>
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+typedef enum {
+    SENSOR_ID_LIGHT = 0,
+    SENSOR_ID_TEMP,
+    SENSOR_ID_HUMI,
+    SENSOR_ID_COUNT
+} sensor_id_t;
+
+/*! @brief Default sampling period (ms) */
+#define SENSOR_PERIOD_LIGHT_DEFAULT          100u
+#define SENSOR_PERIOD_TEMP_DEFAULT           1000u
+#define SENSOR_PERIOD_HUMI_DEFAULT           1000u
+
+/*! @brief Default max age (ms) of a cached value, served without sampling */
+#define SENSOR_MAX_AGE_DEFAULT               2000u
+
+/*! @brief Return code of SensorService_Read / SendPacketRespond */
+#define SENSOR_OK                            0x00u
+#define SENSOR_ERR_STALE                     0x01u  /*< Value as old as max age or older */
+#define SENSOR_ERR_NO_DATA                   0x02u  /*< Not sampled yet */
+#define SENSOR_ERR_PARAM                     0x03u
+#define SENSOR_ERR_DEVICE                    0x04u  /*< Sample failed on hardware */
+#define SENSOR_PENDING                       0x05u  /*< Respond sent when sampled */
+
+/*!
+ * Statistic of a sensor, since SensorService_ResetStatistic.
+ * Sample rate in 0.01 Hz, hit ratio in percent of reads served fresh.
+ */
+typedef struct {
+    uint32_t dwSample;       /*< Samples done on hardware */
+    uint32_t dwError;        /*< Failed samples */
+    uint32_t dwRead;         /*< Reads of cache */
+    uint32_t dwHit;          /*< Reads served within max age */
+    uint16_t wSampleRate;    /*< Samples per 100 s, saturated at 0xFFFF */
+    uint8_t byHitRatio;      /*< dwHit * 100 / dwRead */
+} sensor_stat_t, *sensor_stat_p;
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func   SensorService_Init
+ * @brief  Start sampling all sensors at default period. LightSensor (DMA
+ *         mode), I2C engine and Si7020 driver must be initialized before
+ * @param  None
+ * @retval None
+ */
+void
+SensorService_Init(void);
+
+/**
+ * @func   SensorService_SetPeriod
+ * @brief  Change sampling period of a sensor
+ * @param  byId: sensor_id_t
+ * @param  dwPeriod: period in ms, 0 to stop sampling
+ * @retval None
+ */
+void
+SensorService_SetPeriod(
+    uint8_t byId,
+    uint32_t dwPeriod
+);
+
+/**
+ * @func   SensorService_SetMaxAge
+ * @brief  Change max age of cached value of a sensor
+ * @param  byId: sensor_id_t
+ * @param  dwMaxAge: max age in ms
+ * @retval None
+ */
+void
+SensorService_SetMaxAge(
+    uint8_t byId,
+    uint32_t dwMaxAge
+);
+
+/**
+ * @func   SensorService_Read
+ * @brief  Read latest value of a sensor from cache, no hardware access.
+ *         Light: ADC code; temperature: 0.01 Celsius degree; humidity: 0.01 %RH
+ * @param  byId: sensor_id_t
+ * @param  piValue: latest value
+ * @param  pdwTimestamp: GetMilSecTick() of sample, may be NULL
+ * @retval SENSOR_OK, SENSOR_ERR_STALE (piValue still updated) or error code
+ */
+uint8_t
+SensorService_Read(
+    uint8_t byId,
+    int16_t *piValue,
+    uint32_t *pdwTimestamp
+);
+
+/**
+ * @func   SensorService_SendPacketRespond
+ * @brief  Respond frame value of a sensor. A value within max age is sent
+ *         from cache, else a sample is started and the frame is sent when
+ *         it is done: new value, or last value if the sample failed
+ * @param  byId: sensor_id_t
+ * @retval SENSOR_OK if sent, SENSOR_PENDING or SENSOR_ERR_PARAM
+ */
+uint8_t
+SensorService_SendPacketRespond(
+    uint8_t byId
+);
+
+/**
+ * @func   SensorService_GetStatistic
+ * @brief  Get sample rate and cache hit ratio of a sensor
+ * @param  byId: sensor_id_t
+ * @param  pStat: statistic
+ * @retval None
+ */
+void
+SensorService_GetStatistic(
+    uint8_t byId,
+    sensor_stat_p pStat
+);
+
+/**
+ * @func   SensorService_ResetStatistic
+ * @brief  Clear statistic of all sensors
+ * @param  None
+ * @retval None
+ */
+void
+SensorService_ResetStatistic(void);
+
+#endif
+
+/* END FILE */
@@ -0,0 +1,409 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Non-blocking driver of sensor SI7020 on top of I2C engine
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include "utilities.h"
+#include "timer.h"
+#include "i2cengine.h"
+#include "temhumsensor.h"
+#include "si7020.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define SI7020_CRC8_POLYNOMIAL               0x31
+#define SI7020_TIME_RETRY                    1u   // ms
+
+typedef enum {
+    SI7020_STATE_IDLE,
+    SI7020_STATE_COMMAND,
+    SI7020_STATE_CONVERT,
+    SI7020_STATE_READ,
+    SI7020_STATE_READ_TEMP
+} si7020_state_t;
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+static si7020_state_t g_state = SI7020_STATE_IDLE;
+static si7020_callback g_pCallback = NULL;
+static si7020_temhum_callback g_pTemHumCallback = NULL;
+static i2c_xfer_t g_xfer;
+static uint8_t g_byCommand;
+static uint8_t g_byTimeConv;
+static uint8_t g_byRetry;
+static uint8_t g_pbyRxBuffer[3];
+static int16_t g_iHumi;                      /* Humidity of a combined measurement */
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static uint8_t Si7020_StartMeasure(uint8_t byCommand, uint8_t byTimeConv, si7020_callback callback);
+static void Si7020_CommandDone(void *pData, uint8_t byStatus);
+static void Si7020_ConversionDone(void *pData);
+static void Si7020_ReadDone(void *pData, uint8_t byStatus);
+static void Si7020_ReadTempDone(void *pData, uint8_t byStatus);
+static void Si7020_Finish(uint8_t byStatus, int16_t iValue);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func   Si7020_Init
+ * @brief  Initialize driver, I2C engine must be initialized before
+ * @param  None
+ * @retval None
+ */
+void
+Si7020_Init(void)
+{
+    g_state = SI7020_STATE_IDLE;
+    g_pCallback = NULL;
+    g_pTemHumCallback = NULL;
+}
+
+/**
+ * @func   Si7020_MeasureHumiAsync
+ * @brief  Start a humidity conversion, result is reported by callback
+ * @param  callback: called when value is ready
+ * @retval SI7020_OK or SI7020_ERR_BUSY
+ */
+uint8_t
+Si7020_MeasureHumiAsync(
+    si7020_callback callback
+) {
+    return Si7020_StartMeasure(SI7020_CMD_MEASURE_RH_NOHOLD, SI7020_TIME_CONV_RH, callback);
+}
+
+/**
+ * @func   Si7020_MeasureTempAsync
+ * @brief  Start a temperature conversion, result is reported by callback
+ * @param  callback: called when value is ready
+ * @retval SI7020_OK or SI7020_ERR_BUSY
+ */
+uint8_t
+Si7020_MeasureTempAsync(
+    si7020_callback callback
+) {
+    return Si7020_StartMeasure(SI7020_CMD_MEASURE_T_NOHOLD, SI7020_TIME_CONV_T, callback);
+}
+
+/**
+ * @func   Si7020_MeasureAsync
+ * @brief  Start a humidity conversion, temperature of the same conversion
+ *         is read back after it. Both are reported by callback
+ * @param  callback: called when values are ready
+ * @retval SI7020_OK or SI7020_ERR_BUSY
+ */
+uint8_t
+Si7020_MeasureAsync(
+    si7020_temhum_callback callback
+) {
+    uint8_t byStatus = Si7020_StartMeasure(SI7020_CMD_MEASURE_RH_NOHOLD, SI7020_TIME_CONV_RH, NULL);
+
+    if (byStatus == SI7020_OK) {
+        g_pTemHumCallback = callback;
+    }
+
+    return byStatus;
+}
+
+/**
+ * @func   Si7020_IsBusy
+ * @brief  Check a measurement is in progress
+ * @param  None
+ * @retval 1 if busy; 0 otherwise
+ */
+uint8_t
+Si7020_IsBusy(void)
+{
+    return (g_state != SI7020_STATE_IDLE);
+}
+
+/**
+ * @func   Si7020_ConvertHumi
+ * @brief  Convert raw code to humidity: RH = 125 * code / 65536 - 6
+ * @param  wCode: raw code read from sensor
+ * @retval Humidity in 0.01 %RH
+ */
+int16_t
+Si7020_ConvertHumi(
+    uint16_t wCode
+) {
+    int32_t iHumi = (int32_t)((12500UL * wCode) >> 16) - 600;
+
+    if (iHumi < 0) {
+        iHumi = 0;
+    } else if (iHumi > 10000) {
+        iHumi = 10000;
+    }
+
+    return (int16_t)iHumi;
+}
+
+/**
+ * @func   Si7020_ConvertTemp
+ * @brief  Convert raw code to temperature: T = 175.72 * code / 65536 - 46.85
+ * @param  wCode: raw code read from sensor
+ * @retval Temperature in 0.01 Celsius degree
+ */
+int16_t
+Si7020_ConvertTemp(
+    uint16_t wCode
+) {
+    return (int16_t)((int32_t)((17572UL * wCode) >> 16) - 4685);
+}
+
+/**
+ * @func   Si7020_CalculateCRC8
+ * @brief  CRC-8 of sensor, polynomial x^8 + x^5 + x^4 + 1, init 0x00
+ * @param  pbyData: data
+ * @param  byLength: length of data
+ * @retval CRC
+ */
+uint8_t
+Si7020_CalculateCRC8(
+    const uint8_t *pbyData,
+    uint8_t byLength
+) {
+    uint8_t byCrc = 0x00;
+    uint8_t i, j;
+
+    for (i = 0; i < byLength; i++) {
+        byCrc ^= pbyData[i];
+        for (j = 0; j < 8; j++) {
+            if (byCrc & 0x80) {
+                byCrc = (byCrc << 1) ^ SI7020_CRC8_POLYNOMIAL;
+            } else {
+                byCrc <<= 1;
+            }
+        }
+    }
+
+    return byCrc;
+}
+
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+/**
+ * @func   Si7020_StartMeasure
+ * @brief  Send measure command, conversion runs while the bus is free
+ * @param  byCommand: measure command
+ * @param  byTimeConv: conversion time (ms)
+ * @param  callback: called when value is ready
+ * @retval SI7020_OK or SI7020_ERR_BUSY
+ */
+static uint8_t
+Si7020_StartMeasure(
+    uint8_t byCommand,
+    uint8_t byTimeConv,
+    si7020_callback callback
+) {
+    if (g_state != SI7020_STATE_IDLE) {
+        return SI7020_ERR_BUSY;
+    }
+
+    g_byCommand = byCommand;
+    g_byTimeConv = byTimeConv;
+    g_byRetry = SI7020_READ_RETRY;
+    g_pCallback = callback;
+    g_pTemHumCallback = NULL;
+
+    g_xfer.byAddress = SI7020_ADDR;
+    g_xfer.pTxData = &g_byCommand;
+    g_xfer.byTxLength = 1;
+    g_xfer.pRxData = NULL;
+    g_xfer.byRxLength = 0;
+    g_xfer.callback = Si7020_CommandDone;
+    g_xfer.pCallbackData = NULL;
+
+    if (I2CEngine_Submit(&g_xfer) != I2C_ENGINE_OK) {
+        return SI7020_ERR_BUSY;
+    }
+
+    g_state = SI7020_STATE_COMMAND;
+
+    return SI7020_OK;
+}
+
+/**
+ * @func   Si7020_CommandDone
+ * @brief  Command was sent, wait conversion time without holding the bus
+ * @param  pData: None
+ * @param  byStatus: status of transfer
+ * @retval None
+ */
+static void
+Si7020_CommandDone(
+    void *pData,
+    uint8_t byStatus
+) {
+    (void)pData;
+
+    if (byStatus != I2C_XFER_DONE) {
+        Si7020_Finish(SI7020_ERR_BUS, 0);
+        return;
+    }
+
+    g_state = SI7020_STATE_CONVERT;
+    if (TimerStart("si7020", g_byTimeConv, TIMER_REPEAT_ONE_TIME,
+                   Si7020_ConversionDone, NULL) == NO_TIMER) {
+        Si7020_Finish(SI7020_ERR_BUSY, 0);
+    }
+}
+
+/**
+ * @func   Si7020_ConversionDone
+ * @brief  Conversion time elapsed, read value and checksum
+ * @param  pData: None
+ * @retval None
+ */
+static void
+Si7020_ConversionDone(
+    void *pData
+) {
+    (void)pData;
+
+    g_xfer.pTxData = NULL;
+    g_xfer.byTxLength = 0;
+    g_xfer.pRxData = g_pbyRxBuffer;
+    g_xfer.byRxLength = sizeof(g_pbyRxBuffer);
+    g_xfer.callback = Si7020_ReadDone;
+    g_xfer.pCallbackData = NULL;
+
+    g_state = SI7020_STATE_READ;
+    if (I2CEngine_Submit(&g_xfer) != I2C_ENGINE_OK) {
+        Si7020_Finish(SI7020_ERR_BUSY, 0);
+    }
+}
+
+/**
+ * @func   Si7020_ReadDone
+ * @brief  Check and convert value read from sensor
+ * @param  pData: None
+ * @param  byStatus: status of transfer
+ * @retval None
+ */
+static void
+Si7020_ReadDone(
+    void *pData,
+    uint8_t byStatus
+) {
+    uint16_t wCode;
+
+    (void)pData;
+
+    if ((byStatus == I2C_XFER_ERR_NACK) && (g_byRetry != 0)) {
+        /* Conversion is not finished yet */
+        g_byRetry--;
+        g_state = SI7020_STATE_CONVERT;
+        if (TimerStart("si7020", SI7020_TIME_RETRY, TIMER_REPEAT_ONE_TIME,
+                       Si7020_ConversionDone, NULL) == NO_TIMER) {
+            Si7020_Finish(SI7020_ERR_BUSY, 0);
+        }
+        return;
+    }
+
+    if (byStatus != I2C_XFER_DONE) {
+        Si7020_Finish(SI7020_ERR_BUS, 0);
+        return;
+    }
+
+    if (Si7020_CalculateCRC8(g_pbyRxBuffer, 2) != g_pbyRxBuffer[2]) {
+        Si7020_Finish(SI7020_ERR_CRC, 0);
+        return;
+    }
+
+    wCode = ((uint16_t)g_pbyRxBuffer[0] << 8) | g_pbyRxBuffer[1];
+
+    if (g_pTemHumCallback != NULL) {
+        /* Temperature of this conversion, no new one */
+        g_iHumi = Si7020_ConvertHumi(wCode);
+        g_byCommand = SI7020_CMD_READ_T_PREVIOUS;
+        g_xfer.pTxData = &g_byCommand;
+        g_xfer.byTxLength = 1;
+        g_xfer.byRxLength = 2;
+        g_xfer.callback = Si7020_ReadTempDone;
+
+        g_state = SI7020_STATE_READ_TEMP;
+        if (I2CEngine_Submit(&g_xfer) != I2C_ENGINE_OK) {
+            Si7020_Finish(SI7020_ERR_BUSY, 0);
+        }
+        return;
+    }
+
+    if (g_byCommand == SI7020_CMD_MEASURE_RH_NOHOLD) {
+        Si7020_Finish(SI7020_OK, Si7020_ConvertHumi(wCode));
+    } else {
+        Si7020_Finish(SI7020_OK, Si7020_ConvertTemp(wCode));
+    }
+}
+
+/**
+ * @func   Si7020_ReadTempDone
+ * @brief  Temperature of a combined measurement read back, it has no
+ *         checksum
+ * @param  pData: None
+ * @param  byStatus: status of transfer
+ * @retval None
+ */
+static void
+Si7020_ReadTempDone(
+    void *pData,
+    uint8_t byStatus
+) {
+    (void)pData;
+
+    if (byStatus != I2C_XFER_DONE) {
+        Si7020_Finish(SI7020_ERR_BUS, 0);
+        return;
+    }
+
+    Si7020_Finish(SI7020_OK,
+                  Si7020_ConvertTemp(((uint16_t)g_pbyRxBuffer[0] << 8) | g_pbyRxBuffer[1]));
+}
+
+/**
+ * @func   Si7020_Finish
+ * @brief  Release driver and report result
+ * @param  byStatus: status of measurement
+ * @param  iValue: value measured, temperature of a combined measurement
+ * @retval None
+ */
+static void
+Si7020_Finish(
+    uint8_t byStatus,
+    int16_t iValue
+) {
+    si7020_callback callback = g_pCallback;
+    si7020_temhum_callback temhum = g_pTemHumCallback;
+
+    g_state = SI7020_STATE_IDLE;
+    g_pCallback = NULL;
+    g_pTemHumCallback = NULL;
+
+    if (temhum != NULL) {
+        temhum(byStatus, (byStatus == SI7020_OK) ? g_iHumi : 0, iValue);
+    } else if (callback != NULL) {
+        callback(byStatus, iValue);
+    }
+}
+
+/* END FILE */
@@ -0,0 +1,152 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Non-blocking driver of sensor SI7020 on top of I2C engine
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+#ifndef _SI7020_H_
+#define _SI7020_H_
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <stdint.h>
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+/*! @brief Commands, "no hold master" mode: sensor NACKs while converting */
+#define SI7020_CMD_MEASURE_RH_NOHOLD         0xF5
+#define SI7020_CMD_MEASURE_T_NOHOLD          0xF3
+#define SI7020_CMD_READ_T_PREVIOUS           0xE0
+
+/*! @brief Conversion time (ms, max) at resolution RH12/T14. A RH
+ *  conversion includes a temperature conversion. */
+#define SI7020_TIME_CONV_RH                  23u
+#define SI7020_TIME_CONV_T                   11u
+
+/*! @brief Read retries while sensor still NACKs, 1 ms apart */
+#define SI7020_READ_RETRY                    5u
+
+/*! @brief Status passed to callback */
+#define SI7020_OK                            0x00u
+#define SI7020_ERR_BUSY                      0x01u
+#define SI7020_ERR_BUS                       0x02u
+#define SI7020_ERR_CRC                       0x03u
+
+/*!
+ * Measurement callback.
+ * Humidity in 0.01 %RH (0 - 10000), temperature in 0.01 Celsius degree.
+ */
+typedef void (* si7020_callback)(uint8_t byStatus, int16_t iValue);
+
+/*! @brief Combined measurement callback, values as si7020_callback */
+typedef void (* si7020_temhum_callback)(uint8_t byStatus, int16_t iHumi, int16_t iTemp);
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func   Si7020_Init
+ * @brief  Initialize driver, I2C engine must be initialized before
+ * @param  None
+ * @retval None
+ */
+void
+Si7020_Init(void);
+
+/**
+ * @func   Si7020_MeasureHumiAsync
+ * @brief  Start a humidity conversion, result is reported by callback
+ * @param  callback: called when value is ready
+ * @retval SI7020_OK or SI7020_ERR_BUSY
+ */
+uint8_t
+Si7020_MeasureHumiAsync(
+    si7020_callback callback
+);
+
+/**
+ * @func   Si7020_MeasureTempAsync
+ * @brief  Start a temperature conversion, result is reported by callback
+ * @param  callback: called when value is ready
+ * @retval SI7020_OK or SI7020_ERR_BUSY
+ */
+uint8_t
+Si7020_MeasureTempAsync(
+    si7020_callback callback
+);
+
+/**
+ * @func   Si7020_MeasureAsync
+ * @brief  Start a humidity conversion, temperature of the same conversion
+ *         is read back after it. Both are reported by callback
+ * @param  callback: called when values are ready
+ * @retval SI7020_OK or SI7020_ERR_BUSY
+ */
+uint8_t
+Si7020_MeasureAsync(
+    si7020_temhum_callback callback
+);
+
+/**
+ * @func   Si7020_IsBusy
+ * @brief  Check a measurement is in progress
+ * @param  None
+ * @retval 1 if busy; 0 otherwise
+ */
+uint8_t
+Si7020_IsBusy(void);
+
+/**
+ * @func   Si7020_ConvertHumi
+ * @brief  Convert raw code to humidity
+ * @param  wCode: raw code read from sensor
+ * @retval Humidity in 0.01 %RH
+ */
+int16_t
+Si7020_ConvertHumi(
+    uint16_t wCode
+);
+
+/**
+ * @func   Si7020_ConvertTemp
+ * @brief  Convert raw code to temperature
+ * @param  wCode: raw code read from sensor
+ * @retval Temperature in 0.01 Celsius degree
+ */
+int16_t
+Si7020_ConvertTemp(
+    uint16_t wCode
+);
+
+/**
+ * @func   Si7020_CalculateCRC8
+ * @brief  CRC-8 of sensor, polynomial x^8 + x^5 + x^4 + 1, init 0x00
+ * @param  pbyData: data
+ * @param  byLength: length of data
+ * @retval CRC
+ */
+uint8_t
+Si7020_CalculateCRC8(
+    const uint8_t *pbyData,
+    uint8_t byLength
+);
+
+#endif
+
+/* END FILE */
@@ -0,0 +1,322 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Combined humidity + temperature measurement with cache
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include "utilities.h"
+#include "timer.h"
+#include "i2cengine.h"
+#include "si7020.h"
+#include "temhumsensor.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define TEMHUM_NUM_RESOLUTION                4u
+#define TEMHUM_TIMEOUT_REG                   5u  // ms
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+/* Max conversion time of RH + T, indexed by ADC_RES_xxx (datasheet table 2) */
+static const uint8_t g_pbyTimeConv[TEMHUM_NUM_RESOLUTION] = {
+    23,     /* ADC_RES_RH12_T14: 12 + 10.8 ms */
+    7,      /* ADC_RES_RH08_T12: 3.1 + 3.8 ms */
+    11,     /* ADC_RES_RH10_T13: 4.5 + 6.2 ms */
+    10      /* ADC_RES_RH11_T11: 7 + 2.4 ms */
+};
+
+/* Transfers are static: engine keeps a reference until processI2CEngine */
+static i2c_xfer_t g_xferCommand;
+static i2c_xfer_t g_xferTemp;
+static uint8_t g_pbyTxBuffer[2];
+static uint8_t g_byTxTemp = CMDR_MEASURE_VALUE;
+static uint8_t g_pbyRxHumi[3];
+static uint8_t g_pbyRxTemp[2];
+
+static temhum_value_t g_valueCache;
+static uint8_t g_bCacheValid = 0;
+static uint32_t g_dwMaxAge = TEMHUM_MAX_AGE_DEFAULT;
+static uint8_t g_byResolution = ADC_RES_RH12_T14;
+static uint8_t g_byResolutionApplied = 0xFF;
+static temhum_stat_t g_stat;
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static uint8_t TemHumSensor_WaitXfer(i2c_xfer_p pXfer, uint32_t dwTimeout);
+static uint8_t TemHumSensor_ApplyResolution(void);
+static uint8_t TemHumSensor_Convert(void);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func    TemHumSensor_Measure
+ * @brief   Get humidity and temperature with one conversion. The value is
+ *          cached, a request within the maximum age costs no bus access
+ * @param   pValue: value measured
+ * @retval  TEMHUM_OK or error code, pValue holds the last value on error
+ */
+uint8_t
+TemHumSensor_Measure(
+    temhum_value_p pValue
+) {
+    uint8_t byStatus;
+
+    if (g_bCacheValid &&
+        ((GetMilSecTick() - g_valueCache.dwTimestamp) < g_dwMaxAge)) {
+        g_stat.dwCacheHit++;
+        *pValue = g_valueCache;
+        return TEMHUM_OK;
+    }
+
+    /* Previous transfers timed out and are still on the bus */
+    if ((g_xferCommand.byStatus == I2C_XFER_PENDING) ||
+        (g_xferCommand.byStatus == I2C_XFER_ACTIVE) ||
+        (g_xferTemp.byStatus == I2C_XFER_PENDING) ||
+        (g_xferTemp.byStatus == I2C_XFER_ACTIVE) ||
+        Si7020_IsBusy()) {
+        *pValue = g_valueCache;
+        return TEMHUM_ERR_BUSY;
+    }
+
+    byStatus = TemHumSensor_ApplyResolution();
+
+    if (byStatus == TEMHUM_OK) {
+        /* Hold master mode: sensor stretches SCL during conversion, then
+         * temperature of this conversion is read back without a new one */
+        g_pbyTxBuffer[0] = CMDR_MEASURE_RH_HOLD;
+        g_xferCommand.byAddress = SI7020_ADDR;
+        g_xferCommand.pTxData = g_pbyTxBuffer;
+        g_xferCommand.byTxLength = 1;
+        g_xferCommand.pRxData = g_pbyRxHumi;
+        g_xferCommand.byRxLength = sizeof(g_pbyRxHumi);
+        g_xferCommand.byTimeout = g_pbyTimeConv[g_byResolution] + TEMHUM_TIMEOUT_MARGIN;
+        g_xferCommand.callback = NULL;
+
+        g_xferTemp.byAddress = SI7020_ADDR;
+        g_xferTemp.pTxData = &g_byTxTemp;
+        g_xferTemp.byTxLength = 1;
+        g_xferTemp.pRxData = g_pbyRxTemp;
+        g_xferTemp.byRxLength = sizeof(g_pbyRxTemp);
+        g_xferTemp.byTimeout = 0;
+        g_xferTemp.callback = NULL;
+
+        if ((I2CEngine_Submit(&g_xferCommand) != I2C_ENGINE_OK) ||
+            (I2CEngine_Submit(&g_xferTemp) != I2C_ENGINE_OK)) {
+            byStatus = TEMHUM_ERR_BUSY;
+        } else {
+            g_stat.dwConversion++;
+            byStatus = TemHumSensor_WaitXfer(&g_xferTemp,
+                           g_pbyTimeConv[g_byResolution] + TEMHUM_TIMEOUT_MARGIN +
+                           I2C_ENGINE_TIMEOUT_DEFAULT);
+        }
+    }
+
+    if ((byStatus == TEMHUM_OK) && (g_xferCommand.byStatus != I2C_XFER_DONE)) {
+        byStatus = TEMHUM_ERR_BUS;
+    }
+
+    if (byStatus == TEMHUM_OK) {
+        byStatus = TemHumSensor_Convert();
+    }
+
+    if (byStatus != TEMHUM_OK) {
+        g_stat.dwError++;
+    }
+
+    *pValue = g_valueCache;
+
+    return byStatus;
+}
+
+/**
+ * @func    TemHumSensor_SetResolution
+ * @brief   Set resolution used by TemHumSensor_Measure
+ * @param   byResolution: ADC_RES_RH12_T14 ... ADC_RES_RH11_T11
+ * @retval  None
+ */
+void
+TemHumSensor_SetResolution(
+    uint8_t byResolution
+) {
+    if (byResolution < TEMHUM_NUM_RESOLUTION) {
+        g_byResolution = byResolution;
+    }
+}
+
+/**
+ * @func    TemHumSensor_GetResolution
+ * @brief   Get resolution used by TemHumSensor_Measure
+ * @param   None
+ * @retval  ADC_RES_RH12_T14 ... ADC_RES_RH11_T11
+ */
+uint8_t
+TemHumSensor_GetResolution(void)
+{
+    return g_byResolution;
+}
+
+/**
+ * @func    TemHumSensor_GetTimeConversion
+ * @brief   Get max conversion time of a humidity conversion (includes temperature)
+ * @param   byResolution: ADC_RES_RH12_T14 ... ADC_RES_RH11_T11
+ * @retval  Time in ms
+ */
+uint8_t
+TemHumSensor_GetTimeConversion(
+    uint8_t byResolution
+) {
+    if (byResolution >= TEMHUM_NUM_RESOLUTION) {
+        byResolution = ADC_RES_RH12_T14;
+    }
+
+    return g_pbyTimeConv[byResolution];
+}
+
+/**
+ * @func    TemHumSensor_SetMaxAge
+ * @brief   Set freshness window of cached value
+ * @param   dwMaxAge: max age in ms, 0 to always measure
+ * @retval  None
+ */
+void
+TemHumSensor_SetMaxAge(
+    uint32_t dwMaxAge
+) {
+    g_dwMaxAge = dwMaxAge;
+}
+
+/**
+ * @func    TemHumSensor_GetStatistic
+ * @brief   Get counters of combined measurement
+ * @param   pStat: counters
+ * @retval  None
+ */
+void
+TemHumSensor_GetStatistic(
+    temhum_stat_p pStat
+) {
+    *pStat = g_stat;
+}
+
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+/**
+ * @func   TemHumSensor_WaitXfer
+ * @brief  Wait a transfer finished, bounded by timeout
+ * @param  pXfer: transfer
+ * @param  dwTimeout: timeout (ms)
+ * @retval TEMHUM_OK or TEMHUM_ERR_TIMEOUT or TEMHUM_ERR_BUS
+ */
+static uint8_t
+TemHumSensor_WaitXfer(
+    i2c_xfer_p pXfer,
+    uint32_t dwTimeout
+) {
+    uint32_t dwStart = GetMilSecTick();
+
+    while ((pXfer->byStatus == I2C_XFER_PENDING) ||
+           (pXfer->byStatus == I2C_XFER_ACTIVE)) {
+        /* Main loop is blocked here, engine timeout must still run */
+        I2CEngine_CheckTimeout();
+        if ((GetMilSecTick() - dwStart) > dwTimeout) {
+            return TEMHUM_ERR_TIMEOUT;
+        }
+    }
+
+    return (pXfer->byStatus == I2C_XFER_DONE) ? TEMHUM_OK : TEMHUM_ERR_BUS;
+}
+
+/**
+ * @func   TemHumSensor_ApplyResolution
+ * @brief  Read-modify-write user register if resolution changed
+ * @param  None
+ * @retval TEMHUM_OK or error code
+ */
+static uint8_t
+TemHumSensor_ApplyResolution(void)
+{
+    uint8_t byStatus;
+
+    if (g_byResolutionApplied == g_byResolution) {
+        return TEMHUM_OK;
+    }
+
+    g_pbyTxBuffer[0] = CMDR_READ_USER_REG;
+    g_xferCommand.byAddress = SI7020_ADDR;
+    g_xferCommand.pTxData = g_pbyTxBuffer;
+    g_xferCommand.byTxLength = 1;
+    g_xferCommand.pRxData = g_pbyRxHumi;
+    g_xferCommand.byRxLength = 1;
+    g_xferCommand.byTimeout = 0;
+    g_xferCommand.callback = NULL;
+
+    if (I2CEngine_Submit(&g_xferCommand) != I2C_ENGINE_OK) {
+        return TEMHUM_ERR_BUSY;
+    }
+
+    byStatus = TemHumSensor_WaitXfer(&g_xferCommand, TEMHUM_TIMEOUT_REG);
+    if (byStatus != TEMHUM_OK) {
+        return byStatus;
+    }
+
+    /* RES1 is bit 7, RES0 is bit 0 */
+    g_pbyTxBuffer[0] = CMDW_WRITE_USER_REG;
+    g_pbyTxBuffer[1] = (g_pbyRxHumi[0] & ~USER_REG_RES_MASK) |
+                       ((g_byResolution & 0x02) << 6) | (g_byResolution & 0x01);
+    g_xferCommand.byTxLength = 2;
+    g_xferCommand.pRxData = NULL;
+    g_xferCommand.byRxLength = 0;
+
+    if (I2CEngine_Submit(&g_xferCommand) != I2C_ENGINE_OK) {
+        return TEMHUM_ERR_BUSY;
+    }
+
+    byStatus = TemHumSensor_WaitXfer(&g_xferCommand, TEMHUM_TIMEOUT_REG);
+    if (byStatus == TEMHUM_OK) {
+        g_byResolutionApplied = g_byResolution;
+    }
+
+    return byStatus;
+}
+
+/**
+ * @func   TemHumSensor_Convert
+ * @brief  Check and convert raw values into cache
+ * @param  None
+ * @retval TEMHUM_OK or TEMHUM_ERR_CRC
+ */
+static uint8_t
+TemHumSensor_Convert(void)
+{
+    if (Si7020_CalculateCRC8(g_pbyRxHumi, 2) != g_pbyRxHumi[2]) {
+        return TEMHUM_ERR_CRC;
+    }
+
+    g_valueCache.iHumi = Si7020_ConvertHumi(((uint16_t)g_pbyRxHumi[0] << 8) | g_pbyRxHumi[1]);
+    g_valueCache.iTemp = Si7020_ConvertTemp(((uint16_t)g_pbyRxTemp[0] << 8) | g_pbyRxTemp[1]);
+    g_valueCache.dwTimestamp = GetMilSecTick();
+    g_bCacheValid = 1;
+
+    return TEMHUM_OK;
+}
+
+/* END FILE */
@@ -49,6 +49,35 @@
 #define I2C_GPIO							 GPIOB
 #define I2C_PIN_SDA			    		 	 GPIO_Pin_9
 #define I2C_PIN_SCL			    			 GPIO_Pin_8
+
+/* Combined measurement */
+#define CMDR_MEASURE_RH_HOLD                 0xE5
+#define CMDR_READ_USER_REG                   0xE7
+#define CMDW_WRITE_USER_REG                  0xE6
+#define USER_REG_RES_MASK                    0x81
+
+#define TEMHUM_MAX_AGE_DEFAULT               1000u // ms
+#define TEMHUM_TIMEOUT_MARGIN                10u   // ms
+
+#define TEMHUM_OK                            0x00u
+#define TEMHUM_ERR_BUSY                      0x01u
+#define TEMHUM_ERR_BUS                       0x02u
+#define TEMHUM_ERR_CRC                       0x03u
+#define TEMHUM_ERR_TIMEOUT                   0x04u
+
+/*! @brief Value of a combined measurement */
+typedef struct {
+    int16_t iTemp;           /*< Temperature, 0.01 Celsius degree */
+    int16_t iHumi;           /*< Humidity, 0.01 %RH */
+    uint32_t dwTimestamp;    /*< GetMilSecTick() at the end of conversion */
+} temhum_value_t, *temhum_value_p;
+
+/*! @brief Statistic of combined measurement */
+typedef struct {
+    uint32_t dwConversion;   /*< Conversions done on sensor */
+    uint32_t dwCacheHit;     /*< Requests served from cache */
+    uint32_t dwError;        /*< Failed measurements */
+} temhum_stat_t, *temhum_stat_p;
 /******************************************************************************/
 /*                              PRIVATE DATA                                  */
 /******************************************************************************/
@@ -128,6 +157,71 @@ TemHumSensor_GetHumi(void);
 uint32_t
 TemHumSensor_GetTemp(void);
 
+/**
+ * @func    TemHumSensor_Measure
+ * @brief   Get humidity and temperature with one conversion. The value is
+ *          cached, a request within the maximum age costs no bus access
+ * @param   pValue: value measured
+ * @retval  TEMHUM_OK or error code, pValue holds the last value on error
+ */
+uint8_t
+TemHumSensor_Measure(
+    temhum_value_p pValue
+);
+
+/**
+ * @func    TemHumSensor_SetResolution
+ * @brief   Set resolution used by TemHumSensor_Measure
+ * @param   byResolution: ADC_RES_RH12_T14 ... ADC_RES_RH11_T11
+ * @retval  None
+ */
+void
+TemHumSensor_SetResolution(
+    uint8_t byResolution
+);
+
+/**
+ * @func    TemHumSensor_GetResolution
+ * @brief   Get resolution used by TemHumSensor_Measure
+ * @param   None
+ * @retval  ADC_RES_RH12_T14 ... ADC_RES_RH11_T11
+ */
+uint8_t
+TemHumSensor_GetResolution(void);
+
+/**
+ * @func    TemHumSensor_GetTimeConversion
+ * @brief   Get max conversion time of a humidity conversion (includes temperature)
+ * @param   byResolution: ADC_RES_RH12_T14 ... ADC_RES_RH11_T11
+ * @retval  Time in ms
+ */
+uint8_t
+TemHumSensor_GetTimeConversion(
+    uint8_t byResolution
+);
+
+/**
+ * @func    TemHumSensor_SetMaxAge
+ * @brief   Set freshness window of cached value
+ * @param   dwMaxAge: max age in ms, 0 to always measure
+ * @retval  None
+ */
+void
+TemHumSensor_SetMaxAge(
+    uint32_t dwMaxAge
+);
+
+/**
+ * @func    TemHumSensor_GetStatistic
+ * @brief   Get counters of combined measurement
+ * @param   pStat: counters
+ * @retval  None
+ */
+void
+TemHumSensor_GetStatistic(
+    temhum_stat_p pStat
+);
+
 /** Public function prototypes ---------------------------------------------- */
 void i2c_config(void);
 void i2c_write_no_reg(uint8_t address, uint8_t data);
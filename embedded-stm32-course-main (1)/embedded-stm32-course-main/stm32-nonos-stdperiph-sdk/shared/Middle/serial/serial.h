@@ -169,6 +169,7 @@ typedef void (* serial_handle_event)(void *);
 #define CMD_ID_HUMI_SENSOR 						0x85
 #define CMD_ID_LIGHT_SENSOR 					0x86
 #define CMD_ID_LCD								0x87
+#define CMD_ID_I2C_DIAG							0x88
 
 /*! @brief Size of payload field */
 #define CMD_SIZE_OF_PAYLOAD_BUTTON              2
@@ -179,6 +180,7 @@ typedef void (* serial_handle_event)(void *);
 #define CMD_SIZE_OF_PAYLOAD_HUMISEN             2
 #define CMD_SIZE_OF_PAYLOAD_LIGHTSEN            2
 #define CMD_SIZE_OF_PAYLOAD_LCD                 3
+#define CMD_SIZE_OF_PAYLOAD_I2C_DIAG            16
 /******************************************************************************/
 /*                              PRIVATE DATA                                  */
 /******************************************************************************/
@@ -55,4 +55,241 @@
 
 void Ucglib4WireSWSPI_begin(ucg_t *ucg, uint8_t is_transparent);
 
+/* Hardware SPI1 + DMA, same wiring as software SPI (Ucglib_hwspi.c) */
+void Ucglib4WireHWSPI_begin(ucg_t *ucg, uint8_t is_transparent);
+int16_t ucg_com_stm32_HW_SPI(ucg_t *ucg, int16_t msg, uint16_t arg, uint8_t *data);
+uint8_t UcgHwSpi_IsBusy(void);
+void UcgHwSpi_Wait(void);
+void UcgHwSpi_SendAsync(uint8_t *pbyData, uint16_t wLength);
+
+/* ST7735 commands and address window of backends writing panel RAM (Ucglib_st7735.c) */
+#define ST7735_CASET 0x2A
+#define ST7735_RASET 0x2B
+#define ST7735_RAMWR 0x2C
+#define ST7735_MADCTL 0x36
+#define ST7735_COLMOD 0x3A
+#define ST7735_COLMOD_16BIT 0x05        /* RGB565 of framebuffer, strips, gradients */
+#define ST7735_COLMOD_18BIT 0x06        /* Used by ucg_dev_st7735 */
+#define ST7735_MADCTL_MY 0x80           /* Row address order */
+#define ST7735_MADCTL_MX 0x40           /* Column address order */
+#define ST7735_MADCTL_MV 0x20           /* Row / column exchange */
+#define ST7735_RAM_COLUMNS 132          /* Glass of 128 x 128 starts at display_offset */
+#define ST7735_RAM_ROWS 162
+#define ST7735_GLASS_SIZE 128
+void UcgSt7735_Begin(ucg_t *ucg, uint8_t byMadctl);
+void UcgSt7735_SetColmod(ucg_t *ucg, uint8_t byColmod);
+void UcgSt7735_SetWindow(ucg_t *ucg, ucg_int_t x0, ucg_int_t y0, ucg_int_t x1, ucg_int_t y1);
+void UcgSt7735_SetRamWindow(ucg_t *ucg, ucg_int_t x0, ucg_int_t y0, ucg_int_t x1, ucg_int_t y1);
+
+/* Off-screen RGB565 framebuffer, dirty regions sent by ucg_Flush (Ucglib_fb.c) */
+void ucg_fb_Attach(ucg_t *ucg);
+void ucg_fb_Detach(ucg_t *ucg);
+ucg_int_t ucg_dev_fb(ucg_t *ucg, ucg_int_t msg, void *data);
+void ucg_Flush(ucg_t *ucg);
+
+/* Strip renderer, frame is drawn by a callback replayed per strip (Ucglib_tile.c) */
+typedef void (*ucg_tile_draw_fnptr)(ucg_t *ucg, void *data);
+void ucg_tile_Attach(ucg_t *ucg);
+void ucg_tile_Detach(ucg_t *ucg);
+ucg_int_t ucg_dev_tile(ucg_t *ucg, ucg_int_t msg, void *data);
+void ucg_tile_Render(ucg_t *ucg, ucg_tile_draw_fnptr draw, void *data);
+void ucg_tile_GetFrameTime(uint16_t *pwRenderMs, uint16_t *pwFrameMs);
+
+/* Rotation by ST7735 MADCTL, software rotation on other devices (Ucglib_rotate.c) */
+#define UCG_ROTATE_0 0
+#define UCG_ROTATE_90 1
+#define UCG_ROTATE_180 2
+#define UCG_ROTATE_270 3
+void ucg_SetRotateNative(ucg_t *ucg, uint8_t byRotation);
+uint8_t ucg_GetRotateNative(ucg_t *ucg);
+ucg_int_t ucg_dev_st7735_native(ucg_t *ucg, ucg_int_t msg, void *data);
+
+/* LRU cache of decoded glyphs (Ucglib_glyph.c) */
+typedef struct {
+    uint32_t dwHit;
+    uint32_t dwMiss;
+    uint32_t dwEvict;       /* Misses that replaced a cached glyph */
+    uint32_t dwBypass;      /* Glyphs too large for a slot, drawn by decoder */
+    uint8_t byHitRatio;     /* dwHit * 100 / (dwHit + dwMiss) */
+} ucg_glyph_stat_t, *ucg_glyph_stat_p;
+ucg_int_t ucg_DrawGlyphCached(ucg_t *ucg, ucg_int_t x, ucg_int_t y, uint8_t dir, uint8_t encoding);
+ucg_int_t ucg_DrawStringCached(ucg_t *ucg, ucg_int_t x, ucg_int_t y, uint8_t dir, const char *str);
+ucg_int_t ucg_DrawStringSolid(ucg_t *ucg, ucg_int_t x, ucg_int_t y, const char *str);
+void ucg_glyph_Clear(void);
+void ucg_glyph_GetStatistic(ucg_glyph_stat_p pStat);
+void ucg_glyph_ResetStatistic(void);
+
+/* Palette + run-length images (Ucglib_image.c) */
+#define UCG_IMAGE_FLAG_TRANSPARENT 0x01   /* Color index 0 is not drawn */
+ucg_int_t ucg_GetImageWidth(const uint8_t *pbyImage);
+ucg_int_t ucg_GetImageHeight(const uint8_t *pbyImage);
+uint8_t ucg_GetImageFlags(const uint8_t *pbyImage);
+void ucg_DrawImage(ucg_t *ucg, ucg_int_t x, ucg_int_t y, const uint8_t *pbyImage);
+
+/* Disc and rounded box as one line per row, same pixels as ucglib (Ucglib_span.c) */
+void ucg_DrawDiscSpan(ucg_t *ucg, ucg_int_t x0, ucg_int_t y0, ucg_int_t rad, uint8_t option);
+void ucg_DrawRBoxSpan(ucg_t *ucg, ucg_int_t x, ucg_int_t y, ucg_int_t w, ucg_int_t h, ucg_int_t r);
+
+/* Gradients as one RGB565 transfer on ST7735 (Ucglib_gradient.c) */
+void ucg_DrawGradientLineFast(ucg_t *ucg, ucg_int_t x, ucg_int_t y, ucg_int_t len, ucg_int_t dir);
+void ucg_DrawGradientBoxFast(ucg_t *ucg, ucg_int_t x, ucg_int_t y, ucg_int_t w, ucg_int_t h);
+
+/* Column of a line plot, only rows that differ from screen are drawn.
+ * Used by sparkline and chart (Ucglib_column.c) */
+#define UCG_COLUMN_EMPTY 0xFF           /* Top of a column with nothing drawn */
+#define UCG_COLUMN_COLOR_FG 0           /* Color index of line */
+#define UCG_COLUMN_COLOR_BG 1           /* Color index of background */
+typedef void (*ucg_column_line_fnptr)(ucg_t *ucg, void *data, uint8_t color, ucg_int_t x, ucg_int_t y, ucg_int_t len);
+void ucg_DrawColumnDiff(ucg_t *ucg, ucg_int_t x, ucg_int_t y, uint8_t *pbyTop, uint8_t *pbyBottom,
+                        uint8_t byTop, uint8_t byBottom, ucg_column_line_fnptr line, void *data);
+
+/* Retained widgets, only changed pixels are drawn (Ucglib_widget.c) */
+#define UCG_WIDGET_LABEL 0
+#define UCG_WIDGET_VALUE 1
+#define UCG_WIDGET_BAR 2
+#define UCG_WIDGET_ICON 3
+#define UCG_WIDGET_SPARKLINE 4
+
+#define UCG_WIDGET_TEXT_SIZE 21         /* 20 characters of cmd_lcd_display_t + '\0' */
+#define UCG_WIDGET_DECIMALS_MAX 9       /* Digits after decimal point of a value */
+#ifndef UCG_WIDGET_SPARK_MAX
+#define UCG_WIDGET_SPARK_MAX 32         /* Samples of a sparkline, one per column */
+#endif
+
+typedef struct {
+    char pText[UCG_WIDGET_TEXT_SIZE];
+    char pDrawn[UCG_WIDGET_TEXT_SIZE];  /* Text on screen */
+    ucg_int_t iDrawnWidth;
+    int32_t iValue;
+    uint8_t byDecimals;
+    const char *pUnit;
+} ucg_widget_text_t, *ucg_widget_text_p;
+
+typedef struct {
+    int32_t iValue;
+    int32_t iMin;
+    int32_t iMax;
+    ucg_int_t iDrawnFill;
+} ucg_widget_bar_t, *ucg_widget_bar_p;
+
+typedef struct {
+    const uint8_t *pbyImage;
+    const uint8_t *pbyDrawn;
+} ucg_widget_icon_t, *ucg_widget_icon_p;
+
+typedef struct {
+    int16_t piSample[UCG_WIDGET_SPARK_MAX];
+    int16_t iMin;
+    int16_t iMax;
+    uint8_t byHead;
+    uint8_t byCount;
+    uint8_t bChanged;
+    uint8_t pbyTop[UCG_WIDGET_SPARK_MAX];       /* Line of each column on screen */
+    uint8_t pbyBottom[UCG_WIDGET_SPARK_MAX];
+} ucg_widget_spark_t, *ucg_widget_spark_p;
+
+typedef struct {
+    uint8_t byType;
+    uint8_t bDrawn;                     /* Box is on screen, draw only changes */
+    ucg_int_t x;
+    ucg_int_t y;
+    ucg_int_t w;
+    ucg_int_t h;
+    const ucg_fntpgm_uint8_t *pFont;
+    uint8_t pbyColor[2][3];             /* Foreground, background */
+    union {
+        ucg_widget_text_t text;
+        ucg_widget_bar_t bar;
+        ucg_widget_icon_t icon;
+        ucg_widget_spark_t spark;
+    } u;
+} ucg_widget_t, *ucg_widget_p;
+
+typedef struct {
+    uint32_t dwPixelSent;
+    uint32_t dwPixelFull;               /* Whole boxes of the same redraws */
+    uint32_t dwRedraw;
+} ucg_widget_stat_t, *ucg_widget_stat_p;
+
+void ucg_widget_Init(ucg_widget_p pWidget, uint8_t byType, ucg_int_t x, ucg_int_t y, ucg_int_t w, ucg_int_t h);
+void ucg_widget_SetFont(ucg_widget_p pWidget, const ucg_fntpgm_uint8_t *pFont);
+void ucg_widget_SetColor(ucg_widget_p pWidget, uint8_t byIndex, uint8_t r, uint8_t g, uint8_t b);
+void ucg_widget_SetText(ucg_widget_p pWidget, const char *pText);
+void ucg_widget_SetFormat(ucg_widget_p pWidget, uint8_t byDecimals, const char *pUnit);
+void ucg_widget_SetValue(ucg_widget_p pWidget, int32_t iValue);
+void ucg_widget_SetRange(ucg_widget_p pWidget, int32_t iMin, int32_t iMax);
+void ucg_widget_SetImage(ucg_widget_p pWidget, const uint8_t *pbyImage);
+void ucg_widget_AddSample(ucg_widget_p pWidget, int16_t iSample);
+void ucg_widget_Invalidate(ucg_widget_p pWidget);
+void ucg_widget_Draw(ucg_t *ucg, ucg_widget_p pWidget);
+void ucg_widget_DrawAll(ucg_t *ucg, ucg_widget_p pWidget, uint8_t byCount);
+void ucg_widget_GetStatistic(ucg_widget_stat_p pStat);
+void ucg_widget_ResetStatistic(void);
+
+/* Scrolling chart, scrolled by ST7735 when rotated 90 / 270 (Ucglib_chart.c) */
+#ifndef UCG_CHART_WIDTH_MAX
+#define UCG_CHART_WIDTH_MAX 128         /* Samples shown, one per column */
+#endif
+
+typedef struct {
+    ucg_int_t x;
+    ucg_int_t y;
+    ucg_int_t w;
+    ucg_int_t h;
+    int16_t iMin;
+    int16_t iMax;
+    uint8_t pbyColor[2][3];             /* Line, background */
+    int16_t piSample[UCG_CHART_WIDTH_MAX];      /* Ring of last w samples */
+    uint8_t byHead;
+    uint8_t byCount;
+    uint8_t byRotation;                 /* UCG_ROTATE_90 / 270 if controller scrolls */
+    uint8_t byScrollTop;                /* First controller row of scroll area */
+    uint8_t byScroll;                   /* Scroll start in scroll area */
+    uint8_t pbyTop[UCG_CHART_WIDTH_MAX];        /* Line of each column on screen */
+    uint8_t pbyBottom[UCG_CHART_WIDTH_MAX];
+    uint32_t dwPixelSent;
+} ucg_chart_t, *ucg_chart_p;
+
+void ucg_chart_Init(ucg_chart_p pChart, ucg_int_t x, ucg_int_t y, ucg_int_t w, ucg_int_t h);
+void ucg_chart_SetRange(ucg_chart_p pChart, int16_t iMin, int16_t iMax);
+void ucg_chart_SetColor(ucg_chart_p pChart, uint8_t byIndex, uint8_t r, uint8_t g, uint8_t b);
+void ucg_chart_Begin(ucg_t *ucg, ucg_chart_p pChart);
+void ucg_chart_End(ucg_t *ucg, ucg_chart_p pChart);
+void ucg_chart_AddSample(ucg_t *ucg, ucg_chart_p pChart, int16_t iSample);
+
+/* Recorder of com messages, counted per marked section (Ucglib_trace.c) */
+#ifndef UCG_TRACE_SECTION_MAX
+#define UCG_TRACE_SECTION_MAX 16
+#endif
+#ifndef UCG_TRACE_SPI_HZ
+#define UCG_TRACE_SPI_HZ 10500000u     /* SPI clock of Ucglib_hwspi.c */
+#endif
+
+/* Count a drawing call in a section: UCG_TRACE("box", ucg_DrawBox(&ucg, 0, 0, 8, 8)).
+ * Messages sent after the call returns are not in the section: ucg_DrawString
+ * of the prebuilt library is drawn by a timer task, its bytes land in "other"
+ * or in the section open when the task runs. Trace ucg_DrawStringCached, which
+ * draws at once, or mark the section inside the draw task */
+#define UCG_TRACE(name, call) do { ucg_trace_Mark(name); call; ucg_trace_Mark(NULL); } while (0)
+
+typedef struct {
+    const char *pName;
+    uint32_t dwCount;                   /* Times the section was marked */
+    uint32_t dwMessages;
+    uint32_t dwCmdBytes;
+    uint32_t dwDataBytes;
+    uint32_t dwCsToggles;
+    uint32_t dwMicroSec;                /* Bytes at UCG_TRACE_SPI_HZ */
+} ucg_trace_section_t, *ucg_trace_section_p;
+
+typedef void (*ucg_trace_write_fnptr)(const char *pText);
+
+void ucg_trace_Attach(ucg_t *ucg);
+void ucg_trace_Detach(ucg_t *ucg);
+void ucg_trace_Clear(void);
+void ucg_trace_Mark(const char *pName);
+uint8_t ucg_trace_GetSection(uint8_t byIndex, ucg_trace_section_p pSection);
+void ucg_trace_Dump(ucg_trace_write_fnptr pWrite);
+int16_t ucg_com_trace(ucg_t *ucg, int16_t msg, uint16_t arg, uint8_t *data);
+
 #endif /* _UCGLIB_HH */
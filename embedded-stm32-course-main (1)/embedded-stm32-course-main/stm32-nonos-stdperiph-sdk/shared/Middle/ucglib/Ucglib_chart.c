@@ -0,0 +1,406 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Scrolling chart of sensor samples, one column per sample.
+ *              On ST7735 rotated 90 / 270 by ucg_SetRotateNative the
+ *              controller scrolls the chart and only the new column is
+ *              drawn, otherwise the columns that changed are drawn again
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include "utilities.h"
+#include "Ucglib.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+/* Scroll is along the rows of controller RAM, ST7735_GLASS_SIZE of them are
+ * on glass from display_offset.y */
+#define ST7735_VSCRDEF                      0x33    /* Scroll area */
+#define ST7735_VSCRSADD                     0x37    /* Scroll start address */
+
+#define UCG_CHART_COLOR_FG                  UCG_COLUMN_COLOR_FG
+#define UCG_CHART_COLOR_BG                  UCG_COLUMN_COLOR_BG
+
+/* Column with nothing drawn */
+#define UCG_CHART_EMPTY                     UCG_COLUMN_EMPTY
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static uint8_t UcgChart_GetRow(ucg_chart_p pChart, int16_t iSample);
+static void UcgChart_DrawColumn(ucg_t *ucg, ucg_chart_p pChart, uint8_t byColumn, ucg_int_t x, uint8_t byTop, uint8_t byBottom);
+static void UcgChart_VLine(ucg_t *ucg, void *data, uint8_t byColor, ucg_int_t x, ucg_int_t y, ucg_int_t len);
+static void UcgChart_SetScrollArea(ucg_t *ucg, uint8_t byTop, uint8_t byHeight);
+static void UcgChart_SetScrollStart(ucg_t *ucg, uint8_t byStart);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func   ucg_chart_Init
+ * @brief  Initialize a chart, white on black, range 0 - 100
+ * @param  pChart: chart
+ * @param  x, y: upper left
+ * @param  w: width, number of samples shown, up to UCG_CHART_WIDTH_MAX
+ * @param  h: height, up to 254
+ * @retval None
+ */
+void
+ucg_chart_Init(
+    ucg_chart_p pChart,
+    ucg_int_t x,
+    ucg_int_t y,
+    ucg_int_t w,
+    ucg_int_t h
+) {
+    memsetl((uint8_t *)pChart, 0, sizeof(ucg_chart_t));
+
+    pChart->x = x;
+    pChart->y = y;
+    pChart->w = (w < UCG_CHART_WIDTH_MAX) ? w : UCG_CHART_WIDTH_MAX;
+    pChart->h = (h < UCG_CHART_EMPTY) ? h : (UCG_CHART_EMPTY - 1);
+    pChart->iMax = 100;
+    memsetl(pChart->pbyColor[UCG_CHART_COLOR_FG], 0xFF, 3);
+}
+
+/**
+ * @func   ucg_chart_SetRange
+ * @brief  Samples at iMin are on bottom row, at iMax on top row
+ * @param  pChart: chart
+ * @param  iMin, iMax: range, iMax > iMin
+ * @retval None
+ */
+void
+ucg_chart_SetRange(
+    ucg_chart_p pChart,
+    int16_t iMin,
+    int16_t iMax
+) {
+    pChart->iMin = iMin;
+    pChart->iMax = iMax;
+}
+
+/**
+ * @func   ucg_chart_SetColor
+ * @brief  Line or background color, set before ucg_chart_Begin
+ * @param  pChart: chart
+ * @param  byIndex: 0 line, 1 background
+ * @param  r, g, b: color
+ * @retval None
+ */
+void
+ucg_chart_SetColor(
+    ucg_chart_p pChart,
+    uint8_t byIndex,
+    uint8_t r,
+    uint8_t g,
+    uint8_t b
+) {
+    pChart->pbyColor[byIndex & 0x01][0] = r;
+    pChart->pbyColor[byIndex & 0x01][1] = g;
+    pChart->pbyColor[byIndex & 0x01][2] = b;
+}
+
+/**
+ * @func   ucg_chart_Begin
+ * @brief  Clear chart and samples. The controller scrolls when screen is
+ *         rotated 90 / 270 by ucg_SetRotateNative and chart has full screen
+ *         height: the columns of chart are a band of controller rows then.
+ *         Anything else drawn in the band scrolls with the chart
+ * @param  ucg: ucg
+ * @param  pChart: chart
+ * @retval None
+ */
+void
+ucg_chart_Begin(
+    ucg_t *ucg,
+    ucg_chart_p pChart
+) {
+    uint8_t byRotation = ucg_GetRotateNative(ucg);
+
+    pChart->byHead = 0;
+    pChart->byCount = 0;
+    pChart->byScroll = 0;
+    pChart->byScrollTop = 0;
+    pChart->byRotation = UCG_ROTATE_0;
+    memsetl(pChart->pbyTop, UCG_CHART_EMPTY, UCG_CHART_WIDTH_MAX);
+
+    ucg_SetColor(ucg, 0, pChart->pbyColor[UCG_CHART_COLOR_BG][0],
+                 pChart->pbyColor[UCG_CHART_COLOR_BG][1], pChart->pbyColor[UCG_CHART_COLOR_BG][2]);
+    ucg_DrawBox(ucg, pChart->x, pChart->y, pChart->w, pChart->h);
+    pChart->dwPixelSent += (uint32_t)pChart->w * pChart->h;
+
+    if (((byRotation == UCG_ROTATE_90) || (byRotation == UCG_ROTATE_270)) &&
+        (pChart->y == 0) && (pChart->h == ST7735_GLASS_SIZE) &&
+        (pChart->x >= 0) && (pChart->x + pChart->w <= ST7735_GLASS_SIZE)) {
+        /* Rotate 90: glass row is screen x. Rotate 270: 127 - screen x */
+        pChart->byRotation = byRotation;
+        pChart->byScrollTop = (uint8_t)(((byRotation == UCG_ROTATE_90) ? pChart->x :
+                                         (ST7735_GLASS_SIZE - pChart->x - pChart->w)) +
+                                        ucg->display_offset.y);
+        UcgChart_SetScrollArea(ucg, pChart->byScrollTop, (uint8_t)pChart->w);
+        UcgChart_SetScrollStart(ucg, pChart->byScrollTop);
+    }
+}
+
+/**
+ * @func   ucg_chart_End
+ * @brief  Stop scrolling of controller, screen shows controller RAM as is
+ * @param  ucg: ucg
+ * @param  pChart: chart
+ * @retval None
+ */
+void
+ucg_chart_End(
+    ucg_t *ucg,
+    ucg_chart_p pChart
+) {
+    if (pChart->byRotation != UCG_ROTATE_0) {
+        UcgChart_SetScrollArea(ucg, 0, ST7735_RAM_ROWS);
+        UcgChart_SetScrollStart(ucg, 0);
+        pChart->byRotation = UCG_ROTATE_0;
+    }
+}
+
+/**
+ * @func   ucg_chart_AddSample
+ * @brief  Add a sample at right, chart moves left by one column. Column of
+ *         a sample is a line from previous sample to it
+ * @param  ucg: ucg
+ * @param  pChart: chart started by ucg_chart_Begin
+ * @param  iSample: sample
+ * @retval None
+ */
+void
+ucg_chart_AddSample(
+    ucg_t *ucg,
+    ucg_chart_p pChart,
+    int16_t iSample
+) {
+    uint8_t byWidth = (uint8_t)pChart->w;
+    uint8_t byFirst;
+    uint8_t byIndex;
+    uint8_t byRow;
+    uint8_t byPrev;
+    uint8_t bySlot;
+    uint8_t i;
+
+    if ((byWidth == 0) || (pChart->h <= 0) || (pChart->iMax <= pChart->iMin)) {
+        return;
+    }
+
+    /* Ring of the last w samples, oldest at byHead when full */
+    byPrev = UcgChart_GetRow(pChart, pChart->piSample[(pChart->byHead + byWidth - 1) % byWidth]);
+    pChart->piSample[pChart->byHead] = iSample;
+    pChart->byHead = (uint8_t)((pChart->byHead + 1) % byWidth);
+    if (pChart->byCount < byWidth) {
+        pChart->byCount++;
+    }
+
+    byRow = UcgChart_GetRow(pChart, iSample);
+    if (pChart->byCount == 1) {
+        byPrev = byRow;
+    }
+
+    if (pChart->byRotation == UCG_ROTATE_90) {
+        /* Oldest column goes to right end and is drawn again */
+        bySlot = pChart->byScroll;
+        pChart->byScroll = (uint8_t)((pChart->byScroll + 1) % byWidth);
+        UcgChart_SetScrollStart(ucg, pChart->byScrollTop + pChart->byScroll);
+        UcgChart_DrawColumn(ucg, pChart, bySlot, pChart->x + bySlot,
+                            (byRow < byPrev) ? byRow : byPrev, (byRow < byPrev) ? byPrev : byRow);
+
+        /* Column now at left end has no previous sample: a dot */
+        if (pChart->byCount == byWidth) {
+            bySlot = pChart->byScroll;
+            byRow = UcgChart_GetRow(pChart, pChart->piSample[pChart->byHead]);
+            UcgChart_DrawColumn(ucg, pChart, bySlot, pChart->x + bySlot, byRow, byRow);
+        }
+        return;
+    }
+
+    if (pChart->byRotation == UCG_ROTATE_270) {
+        /* Controller rows run right to left, scroll the other way */
+        pChart->byScroll = (uint8_t)((pChart->byScroll + byWidth - 1) % byWidth);
+        bySlot = pChart->byScroll;
+        UcgChart_SetScrollStart(ucg, pChart->byScrollTop + pChart->byScroll);
+        UcgChart_DrawColumn(ucg, pChart, bySlot, pChart->x + byWidth - 1 - bySlot,
+                            (byRow < byPrev) ? byRow : byPrev, (byRow < byPrev) ? byPrev : byRow);
+
+        if (pChart->byCount == byWidth) {
+            bySlot = (uint8_t)((pChart->byScroll + byWidth - 1) % byWidth);
+            byRow = UcgChart_GetRow(pChart, pChart->piSample[pChart->byHead]);
+            UcgChart_DrawColumn(ucg, pChart, bySlot, pChart->x + byWidth - 1 - bySlot, byRow, byRow);
+        }
+        return;
+    }
+
+    /* No scroll: every column moves, only the rows that differ are drawn */
+    byFirst = (uint8_t)(byWidth - pChart->byCount);
+    byPrev = 0;
+    for (i = 0; i < byWidth; i++) {
+        if (i < byFirst) {
+            UcgChart_DrawColumn(ucg, pChart, i, pChart->x + i, UCG_CHART_EMPTY, 0);
+            continue;
+        }
+
+        byIndex = (uint8_t)((pChart->byHead + i) % byWidth);
+        byRow = UcgChart_GetRow(pChart, pChart->piSample[byIndex]);
+        if (i == byFirst) {
+            byPrev = byRow;
+        }
+        UcgChart_DrawColumn(ucg, pChart, i, pChart->x + i,
+                            (byRow < byPrev) ? byRow : byPrev, (byRow < byPrev) ? byPrev : byRow);
+        byPrev = byRow;
+    }
+}
+
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+/**
+ * @func   UcgChart_GetRow
+ * @brief  Row of a sample from top of chart
+ * @param  pChart: chart
+ * @param  iSample: sample
+ * @retval Row
+ */
+static uint8_t
+UcgChart_GetRow(
+    ucg_chart_p pChart,
+    int16_t iSample
+) {
+    int32_t iValue = iSample;
+
+    if (iValue < pChart->iMin) iValue = pChart->iMin;
+    if (iValue > pChart->iMax) iValue = pChart->iMax;
+
+    return (uint8_t)(pChart->h - 1 - ((iValue - pChart->iMin) * (pChart->h - 1)) /
+                                     (pChart->iMax - pChart->iMin));
+}
+
+/**
+ * @func   UcgChart_DrawColumn
+ * @brief  Draw a column from what is on screen to a new line
+ * @param  ucg: ucg
+ * @param  pChart: chart
+ * @param  byColumn: column in controller RAM order
+ * @param  x: screen x of column without scroll
+ * @param  byTop, byBottom: new line, byTop UCG_CHART_EMPTY for none
+ * @retval None
+ */
+static void
+UcgChart_DrawColumn(
+    ucg_t *ucg,
+    ucg_chart_p pChart,
+    uint8_t byColumn,
+    ucg_int_t x,
+    uint8_t byTop,
+    uint8_t byBottom
+) {
+    ucg_DrawColumnDiff(ucg, x, pChart->y, &pChart->pbyTop[byColumn], &pChart->pbyBottom[byColumn],
+                       byTop, byBottom, UcgChart_VLine, pChart);
+}
+
+/**
+ * @func   UcgChart_VLine
+ * @brief  Vertical line in a color of chart, counted in pixels sent
+ * @param  ucg: ucg
+ * @param  data: chart
+ * @param  byColor: UCG_CHART_COLOR_xxx
+ * @param  x, y: top
+ * @param  len: length, nothing drawn if not positive
+ * @retval None
+ */
+static void
+UcgChart_VLine(
+    ucg_t *ucg,
+    void *data,
+    uint8_t byColor,
+    ucg_int_t x,
+    ucg_int_t y,
+    ucg_int_t len
+) {
+    ucg_chart_p pChart = (ucg_chart_p)data;
+    uint8_t *pbyColor = pChart->pbyColor[byColor];
+
+    if (len <= 0) {
+        return;
+    }
+
+    ucg_SetColor(ucg, 0, pbyColor[0], pbyColor[1], pbyColor[2]);
+    ucg_DrawVLine(ucg, x, y, len);
+    pChart->dwPixelSent += (uint32_t)len;
+}
+
+/**
+ * @func   UcgChart_SetScrollArea
+ * @brief  Rows of controller RAM that scroll, the others are fixed
+ * @param  ucg: ucg
+ * @param  byTop: first row
+ * @param  byHeight: number of rows
+ * @retval None
+ */
+static void
+UcgChart_SetScrollArea(
+    ucg_t *ucg,
+    uint8_t byTop,
+    uint8_t byHeight
+) {
+    ucg_pgm_uint8_t pbySeq[] = {
+        UCG_CS(0),
+        UCG_C16(ST7735_VSCRDEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00),
+        UCG_CS(1),
+        UCG_END()
+    };
+
+    pbySeq[4] = byTop;
+    pbySeq[6] = byHeight;
+    pbySeq[8] = (uint8_t)(ST7735_RAM_ROWS - byTop - byHeight);
+
+    ucg_com_SendCmdSeq(ucg, pbySeq);
+}
+
+/**
+ * @func   UcgChart_SetScrollStart
+ * @brief  Row of controller RAM shown first in scroll area
+ * @param  ucg: ucg
+ * @param  byStart: row
+ * @retval None
+ */
+static void
+UcgChart_SetScrollStart(
+    ucg_t *ucg,
+    uint8_t byStart
+) {
+    ucg_pgm_uint8_t pbySeq[] = {
+        UCG_CS(0),
+        UCG_C12(ST7735_VSCRSADD, 0x00, 0x00),
+        UCG_CS(1),
+        UCG_END()
+    };
+
+    pbySeq[4] = byStart;
+
+    ucg_com_SendCmdSeq(ucg, pbySeq);
+}
+
+/* END FILE */
@@ -0,0 +1,98 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Column of a line plot of ucglib redrawn from the rows on
+ *              screen: old rows out of the new line are erased, new rows not
+ *              on screen are drawn. Shared by sparkline widget and chart
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include "Ucglib.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func   ucg_DrawColumnDiff
+ * @brief  Draw a column from what is on screen to a new line: old rows out
+ *         of the line in background, new rows in line color. Line on screen
+ *         is updated
+ * @param  ucg: ucg
+ * @param  x: screen x of column
+ * @param  y: screen y of row 0
+ * @param  pbyTop, pbyBottom: line on screen, top UCG_COLUMN_EMPTY for none
+ * @param  byTop, byBottom: new line, byTop UCG_COLUMN_EMPTY for none
+ * @param  line: draws a vertical line in UCG_COLUMN_COLOR_xxx, len may be
+ *         0 or less
+ * @param  data: parameter of line
+ * @retval None
+ */
+void
+ucg_DrawColumnDiff(
+    ucg_t *ucg,
+    ucg_int_t x,
+    ucg_int_t y,
+    uint8_t *pbyTop,
+    uint8_t *pbyBottom,
+    uint8_t byTop,
+    uint8_t byBottom,
+    ucg_column_line_fnptr line,
+    void *data
+) {
+    uint8_t byOldTop = *pbyTop;
+    uint8_t byOldBottom = *pbyBottom;
+
+    if ((byTop == byOldTop) && ((byTop == UCG_COLUMN_EMPTY) || (byBottom == byOldBottom))) {
+        return;
+    }
+
+    /* Old rows outside new line */
+    if (byOldTop != UCG_COLUMN_EMPTY) {
+        if ((byTop == UCG_COLUMN_EMPTY) || (byBottom < byOldTop) || (byTop > byOldBottom)) {
+            line(ucg, data, UCG_COLUMN_COLOR_BG, x, y + byOldTop, byOldBottom - byOldTop + 1);
+            byOldTop = UCG_COLUMN_EMPTY;
+        } else {
+            line(ucg, data, UCG_COLUMN_COLOR_BG, x, y + byOldTop, byTop - byOldTop);
+            line(ucg, data, UCG_COLUMN_COLOR_BG, x, y + byBottom + 1, byOldBottom - byBottom);
+        }
+    }
+
+    /* New rows not on screen */
+    if (byTop != UCG_COLUMN_EMPTY) {
+        if (byOldTop == UCG_COLUMN_EMPTY) {
+            line(ucg, data, UCG_COLUMN_COLOR_FG, x, y + byTop, byBottom - byTop + 1);
+        } else {
+            line(ucg, data, UCG_COLUMN_COLOR_FG, x, y + byTop, byOldTop - byTop);
+            line(ucg, data, UCG_COLUMN_COLOR_FG, x, y + byOldBottom + 1, byBottom - byOldBottom);
+        }
+    }
+
+    *pbyTop = byTop;
+    *pbyBottom = byBottom;
+}
+
+/* END FILE */
@@ -0,0 +1,431 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Off-screen framebuffer device of ucglib (ST7735, RGB565),
+ *              only dirty rectangles are sent to the panel on ucg_Flush
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include "utilities.h"
+#include "Ucglib.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define UCG_FB_WIDTH                        128
+#define UCG_FB_HEIGHT                       128
+#define UCG_FB_BYTES_PER_PIXEL              2
+
+/* Dirty rectangles kept before they are merged together */
+#define UCG_FB_DIRTY_MAX                    4u
+
+typedef struct {
+    int16_t x0;
+    int16_t y0;
+    int16_t x1;                      /*< Inclusive */
+    int16_t y1;                      /*< Inclusive */
+} ucg_fb_rect_t, *ucg_fb_rect_p;
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+/* Pixels in panel byte order: RGB565, high byte first */
+static uint8_t g_pbyFrame[UCG_FB_HEIGHT][UCG_FB_WIDTH * UCG_FB_BYTES_PER_PIXEL];
+
+static ucg_fb_rect_t g_pDirty[UCG_FB_DIRTY_MAX];
+static uint8_t g_byDirtyCount;
+
+/* Panel device, receives all messages but drawing */
+static ucg_dev_fnptr g_pPanelCb;
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static void UcgFb_DrawLine(ucg_t *ucg, uint8_t bGradient);
+static void UcgFb_AddDirty(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+static void UcgFb_MergeInto(uint8_t byIndex);
+static uint8_t UcgFb_IsTouching(ucg_fb_rect_p pA, ucg_fb_rect_p pB);
+static void UcgFb_Union(ucg_fb_rect_p pA, ucg_fb_rect_p pB);
+static uint32_t UcgFb_Area(ucg_fb_rect_p pRect);
+static void UcgFb_SendRect(ucg_t *ucg, ucg_fb_rect_p pRect);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func   ucg_fb_Attach
+ * @brief  Redirect drawing of ucg into framebuffer. Call after ucg_Init and
+ *         before ucg_SetRotate*, whole screen is dirty until first flush.
+ *         ucg_DrawString of the library is drawn later by a timer task, so
+ *         its text is missing from the next ucg_Flush: use
+ *         ucg_DrawStringCached or ucg_DrawStringSolid
+ * @param  ucg: ucg of ST7735 128x128
+ * @retval None
+ */
+void
+ucg_fb_Attach(
+    ucg_t *ucg
+) {
+    if (ucg->device_cb == ucg_dev_fb) {
+        return;
+    }
+
+    memsetl(&g_pbyFrame[0][0], 0, sizeof(g_pbyFrame));
+
+    g_pPanelCb = ucg->device_cb;
+    ucg->device_cb = ucg_dev_fb;
+
+    g_byDirtyCount = 0;
+    UcgFb_AddDirty(0, 0, UCG_FB_WIDTH - 1, UCG_FB_HEIGHT - 1);
+}
+
+/**
+ * @func   ucg_fb_Detach
+ * @brief  Draw directly on panel again, pending dirty regions are dropped
+ * @param  ucg: ucg attached by ucg_fb_Attach, not rotated
+ * @retval None
+ */
+void
+ucg_fb_Detach(
+    ucg_t *ucg
+) {
+    if (ucg->device_cb != ucg_dev_fb) {
+        return;
+    }
+
+    ucg->device_cb = g_pPanelCb;
+    g_byDirtyCount = 0;
+}
+
+/**
+ * @func   ucg_dev_fb
+ * @brief  Device callback: pixels and lines are drawn into framebuffer,
+ *         other messages are handled by panel device
+ * @param  ucg: ucg
+ * @param  msg: UCG_MSG_xxx
+ * @param  data: message data
+ * @retval Result of message
+ */
+ucg_int_t
+ucg_dev_fb(
+    ucg_t *ucg,
+    ucg_int_t msg,
+    void *data
+) {
+    uint8_t i;
+
+    switch (msg) {
+    case UCG_MSG_DRAW_PIXEL:
+        if (ucg_clip_is_pixel_visible(ucg) != 0) {
+            ucg->arg.len = 1;
+            UcgFb_DrawLine(ucg, 0);
+        }
+        return 1;
+
+    case UCG_MSG_DRAW_L90FX:
+        if (ucg_clip_l90fx(ucg) != 0) {
+            UcgFb_DrawLine(ucg, 0);
+        }
+        return 1;
+
+    case UCG_MSG_DRAW_L90SE:
+        for (i = 0; i < 3; i++) {
+            ucg_ccs_init(ucg->arg.ccs_line + i, ucg->arg.rgb[0].color[i],
+                         ucg->arg.rgb[1].color[i], ucg->arg.len);
+        }
+        if (ucg_clip_l90se(ucg) != 0) {
+            UcgFb_DrawLine(ucg, 1);
+        }
+        return 1;
+
+    default:
+        break;
+    }
+
+    return g_pPanelCb(ucg, msg, data);
+}
+
+/**
+ * @func   ucg_Flush
+ * @brief  Send dirty regions of framebuffer to panel, one address window
+ *         per merged region. Text of ucg_DrawString is not in framebuffer
+ *         yet, it is drawn later by a timer task of the library
+ * @param  ucg: ucg attached by ucg_fb_Attach
+ * @retval None
+ */
+void
+ucg_Flush(
+    ucg_t *ucg
+) {
+    uint8_t i;
+
+    if (g_byDirtyCount == 0) {
+        return;
+    }
+
+    UcgSt7735_Begin(ucg, 0x00);
+    UcgSt7735_SetColmod(ucg, ST7735_COLMOD_16BIT);
+
+    for (i = 0; i < g_byDirtyCount; i++) {
+        UcgFb_SendRect(ucg, &g_pDirty[i]);
+    }
+
+    UcgSt7735_SetColmod(ucg, ST7735_COLMOD_18BIT);
+    ucg_com_SetCSLineStatus(ucg, 1);
+
+    g_byDirtyCount = 0;
+}
+
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+/**
+ * @func   UcgFb_DrawLine
+ * @brief  Write a clipped line of ucg->arg into framebuffer
+ * @param  ucg: ucg
+ * @param  bGradient: colors from ccs_line (L90SE), else from pixel.rgb
+ * @retval None
+ */
+static void
+UcgFb_DrawLine(
+    ucg_t *ucg,
+    uint8_t bGradient
+) {
+    static const int8_t pbyStepX[4] = { 1, 0, -1, 0 };
+    static const int8_t pbyStepY[4] = { 0, 1, 0, -1 };
+    int16_t x = ucg->arg.pixel.pos.x;
+    int16_t y = ucg->arg.pixel.pos.y;
+    int16_t iLen = ucg->arg.len;
+    uint8_t byDir = (uint8_t)(ucg->arg.dir & 0x03);
+    uint8_t *pbyColor = ucg->arg.pixel.rgb.color;
+    uint8_t byHigh;
+    uint8_t byLow;
+    int16_t iEndX;
+    int16_t iEndY;
+    uint8_t *pbyPixel;
+    uint8_t i;
+
+    if (iLen <= 0) {
+        return;
+    }
+
+    iEndX = x + pbyStepX[byDir] * (iLen - 1);
+    iEndY = y + pbyStepY[byDir] * (iLen - 1);
+
+    while (iLen-- > 0) {
+        if (bGradient) {
+            for (i = 0; i < 3; i++) {
+                pbyColor[i] = ucg->arg.ccs_line[i].current;
+            }
+        }
+        byHigh = (uint8_t)((pbyColor[0] & 0xF8) | (pbyColor[1] >> 5));
+        byLow = (uint8_t)(((pbyColor[1] & 0x1C) << 3) | (pbyColor[2] >> 3));
+
+        if ((x >= 0) && (x < UCG_FB_WIDTH) && (y >= 0) && (y < UCG_FB_HEIGHT)) {
+            pbyPixel = &g_pbyFrame[y][x * UCG_FB_BYTES_PER_PIXEL];
+            pbyPixel[0] = byHigh;
+            pbyPixel[1] = byLow;
+        }
+
+        if (bGradient) {
+            for (i = 0; i < 3; i++) {
+                ucg_ccs_step(ucg->arg.ccs_line + i);
+            }
+        }
+
+        x += pbyStepX[byDir];
+        y += pbyStepY[byDir];
+    }
+
+    /* Dirty area is limited to screen */
+    if (iEndX < ucg->arg.pixel.pos.x) {
+        x = iEndX;
+        iEndX = ucg->arg.pixel.pos.x;
+    } else {
+        x = ucg->arg.pixel.pos.x;
+    }
+    if (iEndY < ucg->arg.pixel.pos.y) {
+        y = iEndY;
+        iEndY = ucg->arg.pixel.pos.y;
+    } else {
+        y = ucg->arg.pixel.pos.y;
+    }
+
+    if (x < 0) x = 0;
+    if (y < 0) y = 0;
+    if (iEndX >= UCG_FB_WIDTH) iEndX = UCG_FB_WIDTH - 1;
+    if (iEndY >= UCG_FB_HEIGHT) iEndY = UCG_FB_HEIGHT - 1;
+
+    if ((x <= iEndX) && (y <= iEndY)) {
+        UcgFb_AddDirty(x, y, iEndX, iEndY);
+    }
+}
+
+/**
+ * @func   UcgFb_AddDirty
+ * @brief  Add a region to dirty list. It is merged with a region it touches,
+ *         or with the region growing least when the list is full
+ * @param  x0, y0: upper left
+ * @param  x1, y1: lower right, inclusive
+ * @retval None
+ */
+static void
+UcgFb_AddDirty(
+    int16_t x0,
+    int16_t y0,
+    int16_t x1,
+    int16_t y1
+) {
+    ucg_fb_rect_t rect = { x0, y0, x1, y1 };
+    ucg_fb_rect_t merged;
+    uint32_t dwGrowth;
+    uint32_t dwBest = 0xFFFFFFFFu;
+    uint8_t byBest = 0;
+    uint8_t i;
+
+    for (i = 0; i < g_byDirtyCount; i++) {
+        if (UcgFb_IsTouching(&g_pDirty[i], &rect)) {
+            UcgFb_Union(&g_pDirty[i], &rect);
+            UcgFb_MergeInto(i);
+            return;
+        }
+    }
+
+    if (g_byDirtyCount < UCG_FB_DIRTY_MAX) {
+        g_pDirty[g_byDirtyCount++] = rect;
+        return;
+    }
+
+    for (i = 0; i < g_byDirtyCount; i++) {
+        merged = g_pDirty[i];
+        UcgFb_Union(&merged, &rect);
+        dwGrowth = UcgFb_Area(&merged) - UcgFb_Area(&g_pDirty[i]);
+        if (dwGrowth < dwBest) {
+            dwBest = dwGrowth;
+            byBest = i;
+        }
+    }
+
+    UcgFb_Union(&g_pDirty[byBest], &rect);
+    UcgFb_MergeInto(byBest);
+}
+
+/**
+ * @func   UcgFb_MergeInto
+ * @brief  Merge other regions touching a grown region into it
+ * @param  byIndex: grown region
+ * @retval None
+ */
+static void
+UcgFb_MergeInto(
+    uint8_t byIndex
+) {
+    uint8_t i = 0;
+
+    while (i < g_byDirtyCount) {
+        if ((i != byIndex) && UcgFb_IsTouching(&g_pDirty[byIndex], &g_pDirty[i])) {
+            UcgFb_Union(&g_pDirty[byIndex], &g_pDirty[i]);
+
+            /* Remove region i, last one takes its place */
+            g_byDirtyCount--;
+            if (byIndex == g_byDirtyCount) {
+                byIndex = i;
+            }
+            g_pDirty[i] = g_pDirty[g_byDirtyCount];
+            i = 0;
+        } else {
+            i++;
+        }
+    }
+}
+
+/**
+ * @func   UcgFb_IsTouching
+ * @brief  Check two regions overlap or are adjacent
+ * @param  pA, pB: regions
+ * @retval 1 if touching, else 0
+ */
+static uint8_t
+UcgFb_IsTouching(
+    ucg_fb_rect_p pA,
+    ucg_fb_rect_p pB
+) {
+    return (pA->x0 <= pB->x1 + 1) && (pB->x0 <= pA->x1 + 1) &&
+           (pA->y0 <= pB->y1 + 1) && (pB->y0 <= pA->y1 + 1);
+}
+
+/**
+ * @func   UcgFb_Union
+ * @brief  Grow a region to cover another one
+ * @param  pA: region to grow
+ * @param  pB: region to cover
+ * @retval None
+ */
+static void
+UcgFb_Union(
+    ucg_fb_rect_p pA,
+    ucg_fb_rect_p pB
+) {
+    if (pB->x0 < pA->x0) pA->x0 = pB->x0;
+    if (pB->y0 < pA->y0) pA->y0 = pB->y0;
+    if (pB->x1 > pA->x1) pA->x1 = pB->x1;
+    if (pB->y1 > pA->y1) pA->y1 = pB->y1;
+}
+
+/**
+ * @func   UcgFb_Area
+ * @brief  Number of pixels of a region
+ * @param  pRect: region
+ * @retval Area
+ */
+static uint32_t
+UcgFb_Area(
+    ucg_fb_rect_p pRect
+) {
+    return (uint32_t)(pRect->x1 - pRect->x0 + 1) * (uint32_t)(pRect->y1 - pRect->y0 + 1);
+}
+
+/**
+ * @func   UcgFb_SendRect
+ * @brief  Set address window to a region and send its pixels. Full width
+ *         regions are contiguous in framebuffer and sent at once
+ * @param  ucg: ucg
+ * @param  pRect: region
+ * @retval None
+ */
+static void
+UcgFb_SendRect(
+    ucg_t *ucg,
+    ucg_fb_rect_p pRect
+) {
+    uint16_t wWidth = (uint16_t)(pRect->x1 - pRect->x0 + 1) * UCG_FB_BYTES_PER_PIXEL;
+    int16_t y;
+
+    UcgSt7735_SetWindow(ucg, pRect->x0, pRect->y0, pRect->x1, pRect->y1);
+
+    if (pRect->x1 - pRect->x0 + 1 == UCG_FB_WIDTH) {
+        ucg_com_SendString(ucg, wWidth * (uint16_t)(pRect->y1 - pRect->y0 + 1),
+                           &g_pbyFrame[pRect->y0][0]);
+        return;
+    }
+
+    for (y = pRect->y0; y <= pRect->y1; y++) {
+        ucg_com_SendString(ucg, wWidth,
+                           &g_pbyFrame[y][pRect->x0 * UCG_FB_BYTES_PER_PIXEL]);
+    }
+}
+
+/* END FILE */
@@ -0,0 +1,613 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: LRU cache of decoded glyphs (1 bit per pixel) for text of
+ *              ucglib, glyphs are decoded from font data only on miss
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include "utilities.h"
+#include "Ucglib.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+/* RAM budget: entries x slot size bytes of bitmaps */
+#ifndef UCG_GLYPH_CACHE_ENTRIES
+#define UCG_GLYPH_CACHE_ENTRIES             24u
+#endif
+
+#ifndef UCG_GLYPH_CACHE_SLOT_SIZE
+#define UCG_GLYPH_CACHE_SLOT_SIZE           48u     /* e.g. 16 x 24 pixels */
+#endif
+
+/* Font data header, glyphs follow it */
+#define UCG_FONT_HEADER_SIZE                21u
+
+/* Solid string: one address window, pixels in COLMOD 18-bit of ucg_dev_st7735 */
+#define UCG_SOLID_WIDTH_MAX                 128
+#define UCG_SOLID_BYTES_PER_PIXEL           3
+
+typedef struct {
+    const uint8_t *pbyFont;          /*< NULL: entry free */
+    uint32_t dwStamp;                /*< Last use, oldest is evicted */
+    uint8_t byEncoding;
+    uint8_t byWidth;
+    uint8_t byHeight;
+    int8_t iOffsetX;
+    int8_t iOffsetY;
+    int8_t iDelta;
+    uint8_t pbyBitmap[UCG_GLYPH_CACHE_SLOT_SIZE];
+} ucg_glyph_entry_t, *ucg_glyph_entry_p;
+
+typedef struct {
+    const uint8_t *pbyData;
+    uint8_t byBitPos;
+} ucg_glyph_reader_t, *ucg_glyph_reader_p;
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+static ucg_glyph_entry_t g_pEntry[UCG_GLYPH_CACHE_ENTRIES];
+static uint32_t g_dwStamp;
+static ucg_glyph_stat_t g_stat;
+
+/* A row of a solid string, copied by com before it is sent */
+static uint8_t g_pbyRow[UCG_SOLID_WIDTH_MAX * UCG_SOLID_BYTES_PER_PIXEL];
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static ucg_glyph_entry_p UcgGlyph_Lookup(ucg_t *ucg, uint8_t byEncoding);
+static const uint8_t *UcgGlyph_FindData(ucg_t *ucg, uint8_t byEncoding);
+static uint16_t UcgGlyph_GetBitmapSize(ucg_t *ucg, const uint8_t *pbyGlyph);
+static void UcgGlyph_Decode(ucg_t *ucg, const uint8_t *pbyGlyph, ucg_glyph_entry_p pEntry);
+static uint8_t UcgGlyph_GetUnsigned(ucg_glyph_reader_p pReader, uint8_t byCount);
+static int8_t UcgGlyph_GetSigned(ucg_glyph_reader_p pReader, uint8_t byCount);
+static void UcgGlyph_Draw(ucg_t *ucg, ucg_int_t x, ucg_int_t y, uint8_t dir, ucg_glyph_entry_p pEntry);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func   ucg_DrawGlyphCached
+ * @brief  Same as ucg_DrawGlyph, glyph is drawn from cache when present
+ * @param  ucg: ucg
+ * @param  x, y: reference point
+ * @param  dir: 0 - 3
+ * @param  encoding: character
+ * @retval Advance of reference point
+ */
+ucg_int_t
+ucg_DrawGlyphCached(
+    ucg_t *ucg,
+    ucg_int_t x,
+    ucg_int_t y,
+    uint8_t dir,
+    uint8_t encoding
+) {
+    ucg_glyph_entry_p pEntry = UcgGlyph_Lookup(ucg, encoding);
+    ucg_int_t iRef;
+
+    /* Not a glyph of font, or too large to be cached */
+    if (pEntry == NULL) {
+        return ucg_DrawGlyph(ucg, x, y, dir, encoding);
+    }
+
+    iRef = ucg->font_calc_vref(ucg);
+    switch (dir) {
+    case 0: y += iRef; break;
+    case 1: x -= iRef; break;
+    case 2: y -= iRef; break;
+    default: x += iRef; break;
+    }
+
+    UcgGlyph_Draw(ucg, x, y, dir, pEntry);
+
+    return pEntry->iDelta;
+}
+
+/**
+ * @func   ucg_DrawStringCached
+ * @brief  Draw a string at once (ucg_DrawString draws it later by timer),
+ *         glyphs are drawn from cache when present
+ * @param  ucg: ucg
+ * @param  x, y: reference point of first glyph
+ * @param  dir: 0 - 3
+ * @param  str: string
+ * @retval Width of string
+ */
+ucg_int_t
+ucg_DrawStringCached(
+    ucg_t *ucg,
+    ucg_int_t x,
+    ucg_int_t y,
+    uint8_t dir,
+    const char *str
+) {
+    ucg_int_t iSum = 0;
+    ucg_int_t iDelta;
+
+    while (*str != '\0') {
+        iDelta = ucg_DrawGlyphCached(ucg, x, y, dir, (uint8_t)*str);
+        switch (dir) {
+        case 0: x += iDelta; break;
+        case 1: y += iDelta; break;
+        case 2: x -= iDelta; break;
+        default: y -= iDelta; break;
+        }
+        iSum += iDelta;
+        str++;
+    }
+
+    return iSum;
+}
+
+/**
+ * @func   ucg_DrawStringSolid
+ * @brief  Draw a string in solid font mode, direction 0, as one address
+ *         window: the box of the string is rasterised row by row and
+ *         streamed to panel. Falls back to ucg_DrawStringCached if font
+ *         mode is transparent, drawing is redirected or rotated, or the
+ *         box is out of clip box
+ * @param  ucg: ucg of ST7735
+ * @param  x, y: reference point of first glyph
+ * @param  str: string, up to UCG_GLYPH_CACHE_ENTRIES characters
+ * @retval Width of string
+ */
+ucg_int_t
+ucg_DrawStringSolid(
+    ucg_t *ucg,
+    ucg_int_t x,
+    ucg_int_t y,
+    const char *str
+) {
+    ucg_glyph_entry_p ppGlyph[UCG_GLYPH_CACHE_ENTRIES];
+    ucg_int_t piLeft[UCG_GLYPH_CACHE_ENTRIES];
+    ucg_glyph_entry_p pGlyph;
+    ucg_int_t iPen = x;
+    ucg_int_t x0 = x;
+    ucg_int_t x1 = x;
+    ucg_int_t iBase;
+    ucg_int_t iTop;
+    ucg_int_t iHeight = ucg->font_info.max_char_height;
+    ucg_int_t iRow;
+    ucg_int_t iGlyphRow;
+    ucg_int_t iCol;
+    uint8_t *pbyPixel;
+    uint8_t *pbyColor;
+    uint8_t byStride;
+    uint8_t byCount = 0;
+    uint8_t i;
+    uint8_t j;
+
+    if ((ucg->font_decode.is_transparent != 0) ||
+        (ucg->device_cb != ucg_dev_st7735_18x128x128)) {
+        return ucg_DrawStringCached(ucg, x, y, 0, str);
+    }
+
+    /* Glyphs stay cached while string is drawn, it has less glyphs than entries */
+    while (str[byCount] != '\0') {
+        if (byCount >= UCG_GLYPH_CACHE_ENTRIES) {
+            return ucg_DrawStringCached(ucg, x, y, 0, str);
+        }
+        pGlyph = UcgGlyph_Lookup(ucg, (uint8_t)str[byCount]);
+        if (pGlyph == NULL) {
+            return ucg_DrawStringCached(ucg, x, y, 0, str);
+        }
+
+        ppGlyph[byCount] = pGlyph;
+        piLeft[byCount] = iPen + pGlyph->iOffsetX;
+        if ((pGlyph->byWidth != 0) && (piLeft[byCount] < x0)) {
+            x0 = piLeft[byCount];
+        }
+        if ((pGlyph->byWidth != 0) && (piLeft[byCount] + pGlyph->byWidth > x1)) {
+            x1 = piLeft[byCount] + pGlyph->byWidth;
+        }
+        iPen += pGlyph->iDelta;
+        if (iPen > x1) {
+            x1 = iPen;
+        }
+        byCount++;
+    }
+
+    /* Box of string: font height, from left most to right most pixel */
+    iBase = y + ucg->font_calc_vref(ucg);
+    iTop = iBase - (iHeight + ucg->font_info.y_offset);
+    x1--;
+
+    if ((x1 < x0) || (iHeight <= 0) || (x1 - x0 + 1 > UCG_SOLID_WIDTH_MAX) ||
+        (x0 < ucg->clip_box.ul.x) || (iTop < ucg->clip_box.ul.y) ||
+        (x1 >= ucg->clip_box.ul.x + ucg->clip_box.size.w) ||
+        (iTop + iHeight > ucg->clip_box.ul.y + ucg->clip_box.size.h)) {
+        return ucg_DrawStringCached(ucg, x, y, 0, str);
+    }
+
+    UcgSt7735_Begin(ucg, 0x00);
+    UcgSt7735_SetWindow(ucg, x0, iTop, x1, iTop + iHeight - 1);
+
+    for (iRow = iTop; iRow < iTop + iHeight; iRow++) {
+        pbyColor = ucg->arg.rgb[1].color;
+        for (iCol = x0; iCol <= x1; iCol++) {
+            pbyPixel = &g_pbyRow[(iCol - x0) * UCG_SOLID_BYTES_PER_PIXEL];
+            pbyPixel[0] = pbyColor[0];
+            pbyPixel[1] = pbyColor[1];
+            pbyPixel[2] = pbyColor[2];
+        }
+
+        pbyColor = ucg->arg.rgb[0].color;
+        for (i = 0; i < byCount; i++) {
+            pGlyph = ppGlyph[i];
+            iGlyphRow = iRow - (iBase - (pGlyph->byHeight + pGlyph->iOffsetY));
+            if ((iGlyphRow < 0) || (iGlyphRow >= pGlyph->byHeight)) {
+                continue;
+            }
+
+            byStride = (uint8_t)((pGlyph->byWidth + 7) >> 3);
+            for (j = 0; j < pGlyph->byWidth; j++) {
+                if ((pGlyph->pbyBitmap[iGlyphRow * byStride + (j >> 3)] &
+                     (0x80 >> (j & 0x07))) == 0) {
+                    continue;
+                }
+                pbyPixel = &g_pbyRow[(piLeft[i] + j - x0) * UCG_SOLID_BYTES_PER_PIXEL];
+                pbyPixel[0] = pbyColor[0];
+                pbyPixel[1] = pbyColor[1];
+                pbyPixel[2] = pbyColor[2];
+            }
+        }
+
+        ucg_com_SendString(ucg, (uint16_t)((x1 - x0 + 1) * UCG_SOLID_BYTES_PER_PIXEL), g_pbyRow);
+    }
+
+    ucg_com_SetCSLineStatus(ucg, 1);
+
+    return iPen - x;
+}
+
+/**
+ * @func   ucg_glyph_Clear
+ * @brief  Drop all cached glyphs
+ * @param  None
+ * @retval None
+ */
+void
+ucg_glyph_Clear(void)
+{
+    uint8_t i;
+
+    for (i = 0; i < UCG_GLYPH_CACHE_ENTRIES; i++) {
+        g_pEntry[i].pbyFont = NULL;
+    }
+}
+
+/**
+ * @func   ucg_glyph_GetStatistic
+ * @brief  Get hits and misses of cache
+ * @param  pStat: statistic
+ * @retval None
+ */
+void
+ucg_glyph_GetStatistic(
+    ucg_glyph_stat_p pStat
+) {
+    *pStat = g_stat;
+
+    pStat->byHitRatio = 0;
+    if ((g_stat.dwHit + g_stat.dwMiss) != 0) {
+        pStat->byHitRatio = (uint8_t)(((uint64_t)g_stat.dwHit * 100) /
+                                      (g_stat.dwHit + g_stat.dwMiss));
+    }
+}
+
+/**
+ * @func   ucg_glyph_ResetStatistic
+ * @brief  Clear statistic of cache
+ * @param  None
+ * @retval None
+ */
+void
+ucg_glyph_ResetStatistic(void)
+{
+    memsetl((uint8_t *)&g_stat, 0, sizeof(g_stat));
+}
+
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+/**
+ * @func   UcgGlyph_Lookup
+ * @brief  Find a glyph of current font in cache, decode it into least
+ *         recently used entry on miss
+ * @param  ucg: ucg, current font
+ * @param  byEncoding: character
+ * @retval Entry, NULL if glyph does not exist or does not fit a slot
+ */
+static ucg_glyph_entry_p
+UcgGlyph_Lookup(
+    ucg_t *ucg,
+    uint8_t byEncoding
+) {
+    ucg_glyph_entry_p pOldest = &g_pEntry[0];
+    const uint8_t *pbyGlyph;
+    uint8_t i;
+
+    g_dwStamp++;
+
+    for (i = 0; i < UCG_GLYPH_CACHE_ENTRIES; i++) {
+        if ((g_pEntry[i].pbyFont == ucg->font) && (g_pEntry[i].byEncoding == byEncoding)) {
+            g_pEntry[i].dwStamp = g_dwStamp;
+            g_stat.dwHit++;
+            return &g_pEntry[i];
+        }
+
+        if (pOldest->pbyFont == NULL) {
+            continue;
+        }
+        if ((g_pEntry[i].pbyFont == NULL) || (g_pEntry[i].dwStamp < pOldest->dwStamp)) {
+            pOldest = &g_pEntry[i];
+        }
+    }
+
+    g_stat.dwMiss++;
+
+    pbyGlyph = UcgGlyph_FindData(ucg, byEncoding);
+    if (pbyGlyph == NULL) {
+        return NULL;
+    }
+
+    /* Too large: drawn by decoder, cached glyphs are kept */
+    if (UcgGlyph_GetBitmapSize(ucg, pbyGlyph) > UCG_GLYPH_CACHE_SLOT_SIZE) {
+        g_stat.dwBypass++;
+        return NULL;
+    }
+
+    if (pOldest->pbyFont != NULL) {
+        g_stat.dwEvict++;
+    }
+
+    UcgGlyph_Decode(ucg, pbyGlyph, pOldest);
+
+    pOldest->pbyFont = ucg->font;
+    pOldest->byEncoding = byEncoding;
+    pOldest->dwStamp = g_dwStamp;
+
+    return pOldest;
+}
+
+/**
+ * @func   UcgGlyph_FindData
+ * @brief  Find data of a glyph in current font
+ * @param  ucg: ucg, current font
+ * @param  byEncoding: character
+ * @retval Glyph data, NULL if not in font
+ */
+static const uint8_t *
+UcgGlyph_FindData(
+    ucg_t *ucg,
+    uint8_t byEncoding
+) {
+    const uint8_t *pbyGlyph = ucg->font + UCG_FONT_HEADER_SIZE;
+
+    if (byEncoding >= 'a') {
+        pbyGlyph += ucg->font_info.start_pos_lower_a;
+    } else if (byEncoding >= 'A') {
+        pbyGlyph += ucg->font_info.start_pos_upper_A;
+    }
+
+    /* Glyph: encoding, size of glyph, bit stream */
+    while (pbyGlyph[1] != 0) {
+        if (pbyGlyph[0] == byEncoding) {
+            return pbyGlyph;
+        }
+        pbyGlyph += pbyGlyph[1];
+    }
+
+    return NULL;
+}
+
+/**
+ * @func   UcgGlyph_GetBitmapSize
+ * @brief  Size of the bitmap of a glyph, read from its header
+ * @param  ucg: ucg, current font
+ * @param  pbyGlyph: glyph data
+ * @retval Bytes, rows padded to a byte
+ */
+static uint16_t
+UcgGlyph_GetBitmapSize(
+    ucg_t *ucg,
+    const uint8_t *pbyGlyph
+) {
+    ucg_glyph_reader_t reader = { pbyGlyph + 2, 0 };
+    uint8_t byWidth = UcgGlyph_GetUnsigned(&reader, ucg->font_info.bits_per_char_width);
+    uint8_t byHeight = UcgGlyph_GetUnsigned(&reader, ucg->font_info.bits_per_char_height);
+
+    return (uint16_t)(((byWidth + 7) >> 3) * byHeight);
+}
+
+/**
+ * @func   UcgGlyph_Decode
+ * @brief  Decode run lengths of a glyph into a 1 bit per pixel bitmap, rows
+ *         padded to a byte
+ * @param  ucg: ucg, current font
+ * @param  pbyGlyph: glyph data, bitmap fits a slot
+ * @param  pEntry: entry
+ * @retval None
+ */
+static void
+UcgGlyph_Decode(
+    ucg_t *ucg,
+    const uint8_t *pbyGlyph,
+    ucg_glyph_entry_p pEntry
+) {
+    ucg_font_info_t *pInfo = &ucg->font_info;
+    ucg_glyph_reader_t reader = { pbyGlyph + 2, 0 };
+    uint8_t byStride;
+    uint8_t byZero;
+    uint8_t byOne;
+    uint8_t byLen;
+    uint8_t x = 0;
+    uint8_t y = 0;
+
+    pEntry->byWidth = UcgGlyph_GetUnsigned(&reader, pInfo->bits_per_char_width);
+    pEntry->byHeight = UcgGlyph_GetUnsigned(&reader, pInfo->bits_per_char_height);
+    pEntry->iOffsetX = UcgGlyph_GetSigned(&reader, pInfo->bits_per_char_x);
+    pEntry->iOffsetY = UcgGlyph_GetSigned(&reader, pInfo->bits_per_char_y);
+    pEntry->iDelta = UcgGlyph_GetSigned(&reader, pInfo->bits_per_delta_x);
+
+    byStride = (uint8_t)((pEntry->byWidth + 7) >> 3);
+
+    memsetl(pEntry->pbyBitmap, 0, UCG_GLYPH_CACHE_SLOT_SIZE);
+
+    if (pEntry->byWidth == 0) {
+        return;
+    }
+
+    /* Pairs of (background run, foreground run), repeated while next bit is 1 */
+    while (y < pEntry->byHeight) {
+        byZero = UcgGlyph_GetUnsigned(&reader, pInfo->bits_per_0);
+        byOne = UcgGlyph_GetUnsigned(&reader, pInfo->bits_per_1);
+
+        do {
+            byLen = byZero;
+            while ((byLen > 0) && (y < pEntry->byHeight)) {
+                byLen--;
+                if (++x >= pEntry->byWidth) {
+                    x = 0;
+                    y++;
+                }
+            }
+
+            byLen = byOne;
+            while ((byLen > 0) && (y < pEntry->byHeight)) {
+                pEntry->pbyBitmap[y * byStride + (x >> 3)] |= (uint8_t)(0x80 >> (x & 0x07));
+                byLen--;
+                if (++x >= pEntry->byWidth) {
+                    x = 0;
+                    y++;
+                }
+            }
+        } while (UcgGlyph_GetUnsigned(&reader, 1) != 0);
+    }
+}
+
+/**
+ * @func   UcgGlyph_GetUnsigned
+ * @brief  Read bits of glyph stream, LSB first
+ * @param  pReader: stream
+ * @param  byCount: number of bits, 1 - 8
+ * @retval Value
+ */
+static uint8_t
+UcgGlyph_GetUnsigned(
+    ucg_glyph_reader_p pReader,
+    uint8_t byCount
+) {
+    uint8_t byEnd = pReader->byBitPos + byCount;
+    uint16_t wValue = (uint16_t)(*pReader->pbyData >> pReader->byBitPos);
+
+    if (byEnd >= 8) {
+        pReader->pbyData++;
+        wValue |= (uint16_t)(*pReader->pbyData << (8 - pReader->byBitPos));
+        byEnd -= 8;
+    }
+
+    pReader->byBitPos = byEnd;
+
+    return (uint8_t)(wValue & ((1u << byCount) - 1));
+}
+
+/**
+ * @func   UcgGlyph_GetSigned
+ * @brief  Read a signed value of glyph stream, stored with offset
+ * @param  pReader: stream
+ * @param  byCount: number of bits
+ * @retval Value
+ */
+static int8_t
+UcgGlyph_GetSigned(
+    ucg_glyph_reader_p pReader,
+    uint8_t byCount
+) {
+    return (int8_t)((int16_t)UcgGlyph_GetUnsigned(pReader, byCount) - (1 << (byCount - 1)));
+}
+
+/**
+ * @func   UcgGlyph_Draw
+ * @brief  Draw runs of a cached bitmap, foreground by color 0 and, in solid
+ *         font mode, background by color 1
+ * @param  ucg: ucg
+ * @param  x, y: reference point, vertical reference applied
+ * @param  dir: 0 - 3
+ * @param  pEntry: glyph
+ * @retval None
+ */
+static void
+UcgGlyph_Draw(
+    ucg_t *ucg,
+    ucg_int_t x,
+    ucg_int_t y,
+    uint8_t dir,
+    ucg_glyph_entry_p pEntry
+) {
+    uint8_t byStride = (uint8_t)((pEntry->byWidth + 7) >> 3);
+    ucg_int_t iTop = -(ucg_int_t)(pEntry->byHeight + pEntry->iOffsetY);
+    uint8_t bSolid = (ucg->font_decode.is_transparent == 0);
+    uint8_t *pbyRow;
+    uint8_t bOn;
+    uint8_t byStart;
+    uint8_t lx;
+    uint8_t ly;
+    ucg_int_t dx;
+    ucg_int_t dy;
+
+    for (ly = 0; ly < pEntry->byHeight; ly++) {
+        pbyRow = &pEntry->pbyBitmap[ly * byStride];
+        byStart = 0;
+
+        for (lx = 1; lx <= pEntry->byWidth; lx++) {
+            bOn = (pbyRow[byStart >> 3] >> (7 - (byStart & 0x07))) & 0x01;
+
+            /* End of a run of same pixels */
+            if ((lx < pEntry->byWidth) &&
+                (((pbyRow[lx >> 3] >> (7 - (lx & 0x07))) & 0x01) == bOn)) {
+                continue;
+            }
+
+            if (bOn || bSolid) {
+                dx = pEntry->iOffsetX + byStart;
+                dy = iTop + ly;
+                switch (dir) {
+                case 0:
+                    ucg_Draw90Line(ucg, x + dx, y + dy, lx - byStart, 0, bOn ? 0 : 1);
+                    break;
+                case 1:
+                    ucg_Draw90Line(ucg, x - dy, y + dx, lx - byStart, 1, bOn ? 0 : 1);
+                    break;
+                case 2:
+                    ucg_Draw90Line(ucg, x - dx, y - dy, lx - byStart, 2, bOn ? 0 : 1);
+                    break;
+                default:
+                    ucg_Draw90Line(ucg, x + dy, y - dx, lx - byStart, 3, bOn ? 0 : 1);
+                    break;
+                }
+            }
+
+            byStart = lx;
+        }
+    }
+}
+
+/* END FILE */
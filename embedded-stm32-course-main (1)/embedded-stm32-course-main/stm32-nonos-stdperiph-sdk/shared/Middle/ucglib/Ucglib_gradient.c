@@ -0,0 +1,373 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Gradient line and box of ucglib on ST7735 as one address
+ *              window, RGB565 rows made by fixed point steps
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include "utilities.h"
+#include "Ucglib.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define UCG_GRADIENT_WIDTH_MAX              128
+#define UCG_GRADIENT_BYTES_PER_PIXEL        2
+
+/* Color component in 16.16 fixed point, rounded */
+#define UCG_GRADIENT_FIXED(c)               (((int32_t)(c) << 16) + 0x8000)
+
+typedef struct {
+    int32_t piValue[3];                     /* R, G, B in 16.16 */
+    int32_t piStep[3];
+} ucg_gradient_t, *ucg_gradient_p;
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+/* Row being made and row on DMA */
+static uint8_t g_pbyRow[2][UCG_GRADIENT_WIDTH_MAX * UCG_GRADIENT_BYTES_PER_PIXEL];
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static void UcgGradient_Init(ucg_gradient_p pGradient, const uint8_t *pbyStart, const uint8_t *pbyEnd, ucg_int_t iSteps);
+static void UcgGradient_Seek(ucg_gradient_p pGradient, ucg_int_t iSteps);
+static void UcgGradient_MakeRow(uint8_t *pbyRow, const ucg_gradient_t *pGradient, ucg_int_t iLength);
+static uint8_t UcgGradient_Clip(ucg_t *ucg, ucg_int_t *px0, ucg_int_t *py0, ucg_int_t *px1, ucg_int_t *py1);
+static void UcgGradient_Begin(ucg_t *ucg, ucg_int_t x0, ucg_int_t y0, ucg_int_t x1, ucg_int_t y1);
+static void UcgGradient_Send(ucg_t *ucg, uint8_t *pbyData, uint16_t wLength);
+static void UcgGradient_End(ucg_t *ucg);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func   ucg_DrawGradientLineFast
+ * @brief  Same as ucg_DrawGradientLine, from color 0 to color 1. On ST7735
+ *         the line is made in RGB565 and sent as one transfer, other devices
+ *         are drawn by ucglib
+ * @param  ucg: ucg
+ * @param  x, y: start
+ * @param  len: length
+ * @param  dir: 0 right, 1 down, 2 left, 3 up
+ * @retval None
+ */
+void
+ucg_DrawGradientLineFast(
+    ucg_t *ucg,
+    ucg_int_t x,
+    ucg_int_t y,
+    ucg_int_t len,
+    ucg_int_t dir
+) {
+    ucg_gradient_t gradient;
+    ucg_int_t x0 = x;
+    ucg_int_t y0 = y;
+    ucg_int_t x1 = x;
+    ucg_int_t y1 = y;
+    ucg_int_t iSkip;
+    ucg_int_t iLength;
+    uint8_t *pbyStart = ucg->arg.rgb[0].color;
+    uint8_t *pbyEnd = ucg->arg.rgb[1].color;
+
+    if ((ucg->device_cb != ucg_dev_st7735_18x128x128) || (len > UCG_GRADIENT_WIDTH_MAX)) {
+        ucg_DrawGradientLine(ucg, x, y, len, dir);
+        return;
+    }
+
+    if (len <= 0) {
+        return;
+    }
+
+    /* Left and up are drawn from the other end with colors swapped */
+    switch (dir) {
+    case 0:
+        x1 = x + len - 1;
+        break;
+
+    case 1:
+        y1 = y + len - 1;
+        break;
+
+    case 2:
+        x0 = x - len + 1;
+        pbyStart = ucg->arg.rgb[1].color;
+        pbyEnd = ucg->arg.rgb[0].color;
+        break;
+
+    default:
+        y0 = y - len + 1;
+        pbyStart = ucg->arg.rgb[1].color;
+        pbyEnd = ucg->arg.rgb[0].color;
+        break;
+    }
+
+    UcgGradient_Init(&gradient, pbyStart, pbyEnd, len);
+
+    iSkip = (dir & 0x01) ? y0 : x0;
+    if (!UcgGradient_Clip(ucg, &x0, &y0, &x1, &y1)) {
+        return;
+    }
+    iSkip = ((dir & 0x01) ? y0 : x0) - iSkip;
+    iLength = (dir & 0x01) ? (y1 - y0 + 1) : (x1 - x0 + 1);
+
+    UcgGradient_Seek(&gradient, iSkip);
+    UcgGradient_MakeRow(g_pbyRow[0], &gradient, iLength);
+
+    UcgGradient_Begin(ucg, x0, y0, x1, y1);
+    UcgGradient_Send(ucg, g_pbyRow[0], (uint16_t)(iLength * UCG_GRADIENT_BYTES_PER_PIXEL));
+    UcgGradient_End(ucg);
+}
+
+/**
+ * @func   ucg_DrawGradientBoxFast
+ * @brief  Same as ucg_DrawGradientBox: left edge from color 0 to color 2,
+ *         right edge from color 1 to color 3, top to bottom. On ST7735 the
+ *         box is one address window, rows are made in RGB565 while the
+ *         previous row is on DMA. Other devices are drawn by ucglib
+ * @param  ucg: ucg
+ * @param  x, y: upper left
+ * @param  w, h: size
+ * @retval None
+ */
+void
+ucg_DrawGradientBoxFast(
+    ucg_t *ucg,
+    ucg_int_t x,
+    ucg_int_t y,
+    ucg_int_t w,
+    ucg_int_t h
+) {
+    ucg_gradient_t left;
+    ucg_gradient_t right;
+    ucg_gradient_t row;
+    uint8_t pbyLeft[3];
+    uint8_t pbyRight[3];
+    ucg_int_t x0 = x;
+    ucg_int_t y0 = y;
+    ucg_int_t x1 = x + w - 1;
+    ucg_int_t y1 = y + h - 1;
+    ucg_int_t iRow;
+    uint8_t byBuffer = 0;
+    uint8_t i;
+
+    if ((ucg->device_cb != ucg_dev_st7735_18x128x128) || (w > UCG_GRADIENT_WIDTH_MAX)) {
+        ucg_DrawGradientBox(ucg, x, y, w, h);
+        return;
+    }
+
+    if ((w <= 0) || (h <= 0) || !UcgGradient_Clip(ucg, &x0, &y0, &x1, &y1)) {
+        return;
+    }
+
+    UcgGradient_Init(&left, ucg->arg.rgb[0].color, ucg->arg.rgb[2].color, h);
+    UcgGradient_Init(&right, ucg->arg.rgb[1].color, ucg->arg.rgb[3].color, h);
+    UcgGradient_Seek(&left, y0 - y);
+    UcgGradient_Seek(&right, y0 - y);
+
+    UcgGradient_Begin(ucg, x0, y0, x1, y1);
+
+    for (iRow = y0; iRow <= y1; iRow++) {
+        for (i = 0; i < 3; i++) {
+            pbyLeft[i] = (uint8_t)(left.piValue[i] >> 16);
+            pbyRight[i] = (uint8_t)(right.piValue[i] >> 16);
+            left.piValue[i] += left.piStep[i];
+            right.piValue[i] += right.piStep[i];
+        }
+
+        /* Steps of a row are kept across the whole width, only visible part is made */
+        UcgGradient_Init(&row, pbyLeft, pbyRight, w);
+        UcgGradient_Seek(&row, x0 - x);
+        UcgGradient_MakeRow(g_pbyRow[byBuffer], &row, x1 - x0 + 1);
+
+        UcgGradient_Send(ucg, g_pbyRow[byBuffer],
+                         (uint16_t)((x1 - x0 + 1) * UCG_GRADIENT_BYTES_PER_PIXEL));
+        byBuffer ^= 1;
+    }
+
+    UcgGradient_End(ucg);
+}
+
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+/**
+ * @func   UcgGradient_Init
+ * @brief  Start and step of each component, one division per component
+ *         instead of one per pixel
+ * @param  pGradient: gradient
+ * @param  pbyStart: color of first pixel
+ * @param  pbyEnd: color of last pixel
+ * @param  iSteps: number of pixels
+ * @retval None
+ */
+static void
+UcgGradient_Init(
+    ucg_gradient_p pGradient,
+    const uint8_t *pbyStart,
+    const uint8_t *pbyEnd,
+    ucg_int_t iSteps
+) {
+    uint8_t i;
+
+    for (i = 0; i < 3; i++) {
+        pGradient->piValue[i] = UCG_GRADIENT_FIXED(pbyStart[i]);
+        pGradient->piStep[i] = 0;
+        if (iSteps > 1) {
+            /* Delta may be negative: scaled by multiply, not shift */
+            pGradient->piStep[i] = (((int32_t)pbyEnd[i] - pbyStart[i]) * 0x10000) / (iSteps - 1);
+        }
+    }
+}
+
+/**
+ * @func   UcgGradient_Seek
+ * @brief  Skip pixels cut by clip box
+ * @param  pGradient: gradient
+ * @param  iSteps: number of pixels
+ * @retval None
+ */
+static void
+UcgGradient_Seek(
+    ucg_gradient_p pGradient,
+    ucg_int_t iSteps
+) {
+    uint8_t i;
+
+    for (i = 0; i < 3; i++) {
+        pGradient->piValue[i] += pGradient->piStep[i] * iSteps;
+    }
+}
+
+/**
+ * @func   UcgGradient_MakeRow
+ * @brief  Make pixels in RGB565, big endian. Three adds per pixel, no branch
+ * @param  pbyRow: pixels
+ * @param  pGradient: gradient at first pixel, not changed
+ * @param  iLength: number of pixels
+ * @retval None
+ */
+static void
+UcgGradient_MakeRow(
+    uint8_t *pbyRow,
+    const ucg_gradient_t *pGradient,
+    ucg_int_t iLength
+) {
+    int32_t iRed = pGradient->piValue[0];
+    int32_t iGreen = pGradient->piValue[1];
+    int32_t iBlue = pGradient->piValue[2];
+    uint16_t wPixel;
+
+    while (iLength-- > 0) {
+        wPixel = (uint16_t)(((iRed >> 8) & 0xF800) |
+                            ((iGreen >> 13) & 0x07E0) |
+                            ((iBlue >> 19) & 0x001F));
+        *pbyRow++ = (uint8_t)(wPixel >> 8);
+        *pbyRow++ = (uint8_t)wPixel;
+
+        iRed += pGradient->piStep[0];
+        iGreen += pGradient->piStep[1];
+        iBlue += pGradient->piStep[2];
+    }
+}
+
+/**
+ * @func   UcgGradient_Clip
+ * @brief  Cut a box by clip box of ucg
+ * @param  ucg: ucg
+ * @param  px0, py0: upper left, changed
+ * @param  px1, py1: lower right, inclusive, changed
+ * @retval 0 if nothing is visible
+ */
+static uint8_t
+UcgGradient_Clip(
+    ucg_t *ucg,
+    ucg_int_t *px0,
+    ucg_int_t *py0,
+    ucg_int_t *px1,
+    ucg_int_t *py1
+) {
+    ucg_int_t iRight = ucg->clip_box.ul.x + ucg->clip_box.size.w - 1;
+    ucg_int_t iBottom = ucg->clip_box.ul.y + ucg->clip_box.size.h - 1;
+
+    if (*px0 < ucg->clip_box.ul.x) *px0 = ucg->clip_box.ul.x;
+    if (*py0 < ucg->clip_box.ul.y) *py0 = ucg->clip_box.ul.y;
+    if (*px1 > iRight) *px1 = iRight;
+    if (*py1 > iBottom) *py1 = iBottom;
+
+    return (*px0 <= *px1) && (*py0 <= *py1);
+}
+
+/**
+ * @func   UcgGradient_Begin
+ * @brief  Switch panel to RGB565 and set address window, CS stays low
+ * @param  ucg: ucg
+ * @param  x0, y0: upper left
+ * @param  x1, y1: lower right, inclusive
+ * @retval None
+ */
+static void
+UcgGradient_Begin(
+    ucg_t *ucg,
+    ucg_int_t x0,
+    ucg_int_t y0,
+    ucg_int_t x1,
+    ucg_int_t y1
+) {
+    UcgSt7735_Begin(ucg, 0x00);
+    UcgSt7735_SetColmod(ucg, ST7735_COLMOD_16BIT);
+    UcgSt7735_SetWindow(ucg, x0, y0, x1, y1);
+}
+
+/**
+ * @func   UcgGradient_Send
+ * @brief  Send a row, on DMA without waiting if com is hardware SPI
+ * @param  ucg: ucg
+ * @param  pbyData: row
+ * @param  wLength: number of bytes
+ * @retval None
+ */
+static void
+UcgGradient_Send(
+    ucg_t *ucg,
+    uint8_t *pbyData,
+    uint16_t wLength
+) {
+    if (ucg->com_cb == ucg_com_stm32_HW_SPI) {
+        UcgHwSpi_SendAsync(pbyData, wLength);
+    } else {
+        ucg_com_SendString(ucg, wLength, pbyData);
+    }
+}
+
+/**
+ * @func   UcgGradient_End
+ * @brief  Back to 18 bit color of ucg_dev_st7735, release CS
+ * @param  ucg: ucg
+ * @retval None
+ */
+static void
+UcgGradient_End(
+    ucg_t *ucg
+) {
+    /* com_cb waits for the last row before the command */
+    UcgSt7735_SetColmod(ucg, ST7735_COLMOD_18BIT);
+    ucg_com_SetCSLineStatus(ucg, 1);
+}
+
+/* END FILE */
@@ -0,0 +1,536 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Communication of ucglib on hardware SPI1 + DMA (ST7735)
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include "stm32f401re_rcc.h"
+#include "stm32f401re_gpio.h"
+#include "stm32f401re_spi.h"
+#include "stm32f401re_dma.h"
+#include "system_stm32f4xx.h"
+#include "Ucglib.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+/* Wiring of LCD on the kit, same pins as software SPI */
+#define LCD_SPI                             SPI1
+#define LCD_SPI_CLK                         RCC_APB2Periph_SPI1
+#define LCD_SPI_PRESCALER                   SPI_BaudRatePrescaler_8  /* 84 / 8 = 10.5 MHz */
+#define LCD_SPI_AF                          GPIO_AF_SPI1
+
+#define LCD_SCK_PORT                        GPIOA
+#define LCD_SCK_PIN                         GPIO_Pin_5
+#define LCD_SCK_SOURCE                      GPIO_PinSource5
+#define LCD_MOSI_PORT                       GPIOA
+#define LCD_MOSI_PIN                        GPIO_Pin_7
+#define LCD_MOSI_SOURCE                     GPIO_PinSource7
+#define LCD_CD_PORT                         GPIOA
+#define LCD_CD_PIN                          GPIO_Pin_9
+#define LCD_MODE_PORT                       GPIOA
+#define LCD_MODE_PIN                        GPIO_Pin_8
+#define LCD_CS_PORT                         GPIOB
+#define LCD_CS_PIN                          GPIO_Pin_6
+#define LCD_ENABLE_PORT                     GPIOB
+#define LCD_ENABLE_PIN                      GPIO_Pin_10
+#define LCD_RST_PORT                        GPIOC
+#define LCD_RST_PIN                         GPIO_Pin_7
+#define LCD_GPIO_CLK                        (RCC_AHB1Periph_GPIOA | RCC_AHB1Periph_GPIOB | \
+                                             RCC_AHB1Periph_GPIOC)
+
+/* SPI1_TX is mapped on DMA2 stream 3 channel 3 */
+#define LCD_DMA_CLK                         RCC_AHB1Periph_DMA2
+#define LCD_DMA_STREAM                      DMA2_Stream3
+#define LCD_DMA_CHANNEL                     DMA_Channel_3
+#define LCD_DMA_FLAGS                       (DMA_FLAG_TCIF3 | DMA_FLAG_HTIF3 | \
+                                             DMA_FLAG_TEIF3 | DMA_FLAG_DMEIF3 | \
+                                             DMA_FLAG_FEIF3)
+#define LCD_DMA_MAX_COUNT                   0xFFFFu
+
+/* Pattern / string buffer, multiple of 2 and 3 bytes */
+#define UCG_HWSPI_BUFFER_SIZE               384u
+
+/* Shorter transfers are written by CPU, DMA setup costs more */
+#define UCG_HWSPI_DMA_MIN_LENGTH            8u
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+static uint8_t g_pbyBuffer[UCG_HWSPI_BUFFER_SIZE];
+static uint8_t g_byRepeat;                  /* Source of 1 byte repeat */
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static void UcgHwSpi_GpioConfig(void);
+static void UcgHwSpi_SpiConfig(void);
+static void UcgHwSpi_DmaConfig(void);
+static void UcgHwSpi_Delay(uint16_t wMicroSec);
+static void UcgHwSpi_SendByte(uint8_t byData);
+static void UcgHwSpi_SendPolling(uint8_t *pbyData, uint16_t wLength);
+static void UcgHwSpi_StartDma(uint8_t *pbyData, uint16_t wLength, uint8_t bIncrement);
+static void UcgHwSpi_Repeat1Byte(uint8_t byData, uint16_t wCount);
+static void UcgHwSpi_RepeatPattern(uint8_t *pbyPattern, uint8_t bySize, uint16_t wCount);
+static void UcgHwSpi_SendString(uint8_t *pbyData, uint16_t wLength);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func   ucg_com_stm32_HW_SPI
+ * @brief  com_cb of ucglib on SPI1. Long transfers run on DMA and the call
+ *         returns while they are on the wire; next message waits for them
+ * @param  ucg: ucg object
+ * @param  msg: UCG_COM_MSG_xxx
+ * @param  arg: argument of message
+ * @param  data: data of message
+ * @retval 1
+ */
+int16_t
+ucg_com_stm32_HW_SPI(
+    ucg_t *ucg,
+    int16_t msg,
+    uint16_t arg,
+    uint8_t *data
+) {
+    (void)ucg;
+
+    /* CS/CD must not change and buffer must not be refilled under a transfer */
+    UcgHwSpi_Wait();
+
+    switch (msg) {
+    case UCG_COM_MSG_POWER_UP:
+        UcgHwSpi_GpioConfig();
+        UcgHwSpi_SpiConfig();
+        UcgHwSpi_DmaConfig();
+        GPIO_WriteBit(LCD_RST_PORT, LCD_RST_PIN, Bit_SET);
+        GPIO_WriteBit(LCD_CS_PORT, LCD_CS_PIN, Bit_SET);
+        GPIO_WriteBit(LCD_CD_PORT, LCD_CD_PIN, Bit_SET);
+        GPIO_WriteBit(LCD_ENABLE_PORT, LCD_ENABLE_PIN, Bit_SET);
+        GPIO_WriteBit(LCD_MODE_PORT, LCD_MODE_PIN, Bit_SET);
+        break;
+
+    case UCG_COM_MSG_POWER_DOWN:
+        SPI_Cmd(LCD_SPI, DISABLE);
+        break;
+
+    case UCG_COM_MSG_DELAY:
+        UcgHwSpi_Delay(arg);
+        break;
+
+    case UCG_COM_MSG_CHANGE_RESET_LINE:
+        GPIO_WriteBit(LCD_RST_PORT, LCD_RST_PIN, arg ? Bit_SET : Bit_RESET);
+        break;
+
+    case UCG_COM_MSG_CHANGE_CS_LINE:
+        GPIO_WriteBit(LCD_CS_PORT, LCD_CS_PIN, arg ? Bit_SET : Bit_RESET);
+        break;
+
+    case UCG_COM_MSG_CHANGE_CD_LINE:
+        GPIO_WriteBit(LCD_CD_PORT, LCD_CD_PIN, arg ? Bit_SET : Bit_RESET);
+        break;
+
+    case UCG_COM_MSG_SEND_BYTE:
+        UcgHwSpi_SendByte((uint8_t)arg);
+        break;
+
+    case UCG_COM_MSG_REPEAT_1_BYTE:
+        UcgHwSpi_Repeat1Byte(data[0], arg);
+        break;
+
+    case UCG_COM_MSG_REPEAT_2_BYTES:
+        UcgHwSpi_RepeatPattern(data, 2, arg);
+        break;
+
+    case UCG_COM_MSG_REPEAT_3_BYTES:
+        UcgHwSpi_RepeatPattern(data, 3, arg);
+        break;
+
+    case UCG_COM_MSG_SEND_STR:
+        UcgHwSpi_SendString(data, arg);
+        break;
+
+    case UCG_COM_MSG_SEND_CD_DATA_SEQUENCE:
+        while (arg > 0) {
+            if (*data != 0) {
+                UcgHwSpi_Wait();
+                GPIO_WriteBit(LCD_CD_PORT, LCD_CD_PIN, (*data == 1) ? Bit_RESET : Bit_SET);
+            }
+            data++;
+            UcgHwSpi_SendByte(*data);
+            data++;
+            arg--;
+        }
+        break;
+
+    default:
+        break;
+    }
+
+    return 1;
+}
+
+/**
+ * @func   Ucglib4WireHWSPI_begin
+ * @brief  Initialize ST7735 128x128 on hardware SPI
+ * @param  ucg: ucg object
+ * @param  is_transparent: font mode
+ * @retval None
+ */
+void
+Ucglib4WireHWSPI_begin(
+    ucg_t *ucg,
+    uint8_t is_transparent
+) {
+    ucg_Init(ucg, ucg_dev_st7735_18x128x128, ucg_ext_st7735_18, ucg_com_stm32_HW_SPI);
+    ucg_SetFontMode(ucg, is_transparent);
+}
+
+/**
+ * @func   UcgHwSpi_IsBusy
+ * @brief  Check a transfer is still on the wire
+ * @param  None
+ * @retval 1 if busy; 0 otherwise
+ */
+uint8_t
+UcgHwSpi_IsBusy(void)
+{
+    return (DMA_GetCmdStatus(LCD_DMA_STREAM) != DISABLE) ||
+           (SPI_I2S_GetFlagStatus(LCD_SPI, SPI_I2S_FLAG_TXE) == RESET) ||
+           (SPI_I2S_GetFlagStatus(LCD_SPI, SPI_I2S_FLAG_BSY) == SET);
+}
+
+/**
+ * @func   UcgHwSpi_Wait
+ * @brief  Wait last transfer is on the wire
+ * @param  None
+ * @retval None
+ */
+void
+UcgHwSpi_Wait(void)
+{
+    if ((LCD_SPI->CR1 & SPI_CR1_SPE) == 0) {
+        return;
+    }
+
+    while (UcgHwSpi_IsBusy());
+}
+
+/**
+ * @func   UcgHwSpi_SendAsync
+ * @brief  Send data of caller buffer on DMA and return. Buffer must not be
+ *         changed until UcgHwSpi_IsBusy() returns 0
+ * @param  pbyData: data
+ * @param  wLength: number of bytes
+ * @retval None
+ */
+void
+UcgHwSpi_SendAsync(
+    uint8_t *pbyData,
+    uint16_t wLength
+) {
+    UcgHwSpi_Wait();
+
+    if (wLength < UCG_HWSPI_DMA_MIN_LENGTH) {
+        UcgHwSpi_SendPolling(pbyData, wLength);
+        return;
+    }
+
+    UcgHwSpi_StartDma(pbyData, wLength, 1);
+}
+
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+/**
+ * @func   UcgHwSpi_GpioConfig
+ * @brief  SCK/MOSI in alternate function, control lines in output
+ * @param  None
+ * @retval None
+ */
+static void
+UcgHwSpi_GpioConfig(void)
+{
+    GPIO_InitTypeDef GPIO_InitStructure;
+
+    RCC_AHB1PeriphClockCmd(LCD_GPIO_CLK, ENABLE);
+
+    GPIO_InitStructure.GPIO_Mode = GPIO_Mode_AF;
+    GPIO_InitStructure.GPIO_OType = GPIO_OType_PP;
+    GPIO_InitStructure.GPIO_PuPd = GPIO_PuPd_NOPULL;
+    GPIO_InitStructure.GPIO_Speed = GPIO_Speed_100MHz;
+    GPIO_InitStructure.GPIO_Pin = LCD_SCK_PIN | LCD_MOSI_PIN;
+    GPIO_Init(LCD_SCK_PORT, &GPIO_InitStructure);
+    GPIO_PinAFConfig(LCD_SCK_PORT, LCD_SCK_SOURCE, LCD_SPI_AF);
+    GPIO_PinAFConfig(LCD_MOSI_PORT, LCD_MOSI_SOURCE, LCD_SPI_AF);
+
+    GPIO_InitStructure.GPIO_Mode = GPIO_Mode_OUT;
+    GPIO_InitStructure.GPIO_Pin = LCD_CD_PIN | LCD_MODE_PIN;
+    GPIO_Init(LCD_CD_PORT, &GPIO_InitStructure);
+
+    GPIO_InitStructure.GPIO_Pin = LCD_CS_PIN | LCD_ENABLE_PIN;
+    GPIO_Init(LCD_CS_PORT, &GPIO_InitStructure);
+
+    GPIO_InitStructure.GPIO_Pin = LCD_RST_PIN;
+    GPIO_Init(LCD_RST_PORT, &GPIO_InitStructure);
+}
+
+/**
+ * @func   UcgHwSpi_SpiConfig
+ * @brief  SPI1 master, transmit only, mode 0, MSB first
+ * @param  None
+ * @retval None
+ */
+static void
+UcgHwSpi_SpiConfig(void)
+{
+    SPI_InitTypeDef SPI_InitStructure;
+
+    RCC_APB2PeriphClockCmd(LCD_SPI_CLK, ENABLE);
+    SPI_I2S_DeInit(LCD_SPI);
+
+    SPI_InitStructure.SPI_Direction = SPI_Direction_1Line_Tx;
+    SPI_InitStructure.SPI_Mode = SPI_Mode_Master;
+    SPI_InitStructure.SPI_DataSize = SPI_DataSize_8b;
+    SPI_InitStructure.SPI_CPOL = SPI_CPOL_Low;
+    SPI_InitStructure.SPI_CPHA = SPI_CPHA_1Edge;
+    SPI_InitStructure.SPI_NSS = SPI_NSS_Soft;
+    SPI_InitStructure.SPI_BaudRatePrescaler = LCD_SPI_PRESCALER;
+    SPI_InitStructure.SPI_FirstBit = SPI_FirstBit_MSB;
+    SPI_InitStructure.SPI_CRCPolynomial = 7;
+    SPI_Init(LCD_SPI, &SPI_InitStructure);
+
+    SPI_I2S_DMACmd(LCD_SPI, SPI_I2S_DMAReq_Tx, ENABLE);
+    SPI_Cmd(LCD_SPI, ENABLE);
+}
+
+/**
+ * @func   UcgHwSpi_DmaConfig
+ * @brief  DMA stream memory to SPI data register
+ * @param  None
+ * @retval None
+ */
+static void
+UcgHwSpi_DmaConfig(void)
+{
+    DMA_InitTypeDef DMA_InitStructure;
+
+    RCC_AHB1PeriphClockCmd(LCD_DMA_CLK, ENABLE);
+    DMA_DeInit(LCD_DMA_STREAM);
+
+    DMA_InitStructure.DMA_Channel = LCD_DMA_CHANNEL;
+    DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t)&LCD_SPI->DR;
+    DMA_InitStructure.DMA_Memory0BaseAddr = (uint32_t)g_pbyBuffer;
+    DMA_InitStructure.DMA_DIR = DMA_DIR_MemoryToPeripheral;
+    DMA_InitStructure.DMA_BufferSize = 1;
+    DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+    DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
+    DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Byte;
+    DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_Byte;
+    DMA_InitStructure.DMA_Mode = DMA_Mode_Normal;
+    DMA_InitStructure.DMA_Priority = DMA_Priority_Medium;
+    DMA_InitStructure.DMA_FIFOMode = DMA_FIFOMode_Disable;
+    DMA_InitStructure.DMA_FIFOThreshold = DMA_FIFOThreshold_Full;
+    DMA_InitStructure.DMA_MemoryBurst = DMA_MemoryBurst_Single;
+    DMA_InitStructure.DMA_PeripheralBurst = DMA_PeripheralBurst_Single;
+    DMA_Init(LCD_DMA_STREAM, &DMA_InitStructure);
+}
+
+/**
+ * @func   UcgHwSpi_Delay
+ * @brief  Busy wait
+ * @param  wMicroSec: delay in us
+ * @retval None
+ */
+static void
+UcgHwSpi_Delay(
+    uint16_t wMicroSec
+) {
+    /* About 4 cycles per loop */
+    volatile uint32_t dwLoop = (SystemCoreClock / 4000000) * wMicroSec;
+
+    while (dwLoop-- != 0);
+}
+
+/**
+ * @func   UcgHwSpi_SendByte
+ * @brief  Write one byte by CPU
+ * @param  byData: byte
+ * @retval None
+ */
+static void
+UcgHwSpi_SendByte(
+    uint8_t byData
+) {
+    while (SPI_I2S_GetFlagStatus(LCD_SPI, SPI_I2S_FLAG_TXE) == RESET);
+    SPI_I2S_SendData(LCD_SPI, byData);
+}
+
+/**
+ * @func   UcgHwSpi_SendPolling
+ * @brief  Write bytes by CPU
+ * @param  pbyData: bytes
+ * @param  wLength: number of bytes
+ * @retval None
+ */
+static void
+UcgHwSpi_SendPolling(
+    uint8_t *pbyData,
+    uint16_t wLength
+) {
+    while (wLength-- != 0) {
+        UcgHwSpi_SendByte(*pbyData++);
+    }
+}
+
+/**
+ * @func   UcgHwSpi_StartDma
+ * @brief  Start a DMA transfer, previous one must be finished
+ * @param  pbyData: source
+ * @param  wLength: number of bytes, 1 - 65535
+ * @param  bIncrement: 1 to walk the source; 0 to repeat its first byte
+ * @retval None
+ */
+static void
+UcgHwSpi_StartDma(
+    uint8_t *pbyData,
+    uint16_t wLength,
+    uint8_t bIncrement
+) {
+    DMA_ClearFlag(LCD_DMA_STREAM, LCD_DMA_FLAGS);
+
+    if (bIncrement) {
+        LCD_DMA_STREAM->CR |= DMA_SxCR_MINC;
+    } else {
+        LCD_DMA_STREAM->CR &= ~DMA_SxCR_MINC;
+    }
+    LCD_DMA_STREAM->M0AR = (uint32_t)pbyData;
+    DMA_SetCurrDataCounter(LCD_DMA_STREAM, wLength);
+    DMA_Cmd(LCD_DMA_STREAM, ENABLE);
+}
+
+/**
+ * @func   UcgHwSpi_Repeat1Byte
+ * @brief  Send a byte wCount times, DMA reads the same byte
+ * @param  byData: byte
+ * @param  wCount: repeat
+ * @retval None
+ */
+static void
+UcgHwSpi_Repeat1Byte(
+    uint8_t byData,
+    uint16_t wCount
+) {
+    if (wCount < UCG_HWSPI_DMA_MIN_LENGTH) {
+        while (wCount-- != 0) {
+            UcgHwSpi_SendByte(byData);
+        }
+        return;
+    }
+
+    g_byRepeat = byData;
+    UcgHwSpi_StartDma(&g_byRepeat, wCount, 0);
+}
+
+/**
+ * @func   UcgHwSpi_RepeatPattern
+ * @brief  Send a 2 or 3 bytes pattern wCount times. A pattern of equal bytes
+ *         (black, white, grey) goes in one DMA transfer, others are sent
+ *         from a buffer filled with the pattern
+ * @param  pbyPattern: pattern
+ * @param  bySize: 2 or 3
+ * @param  wCount: repeat
+ * @retval None
+ */
+static void
+UcgHwSpi_RepeatPattern(
+    uint8_t *pbyPattern,
+    uint8_t bySize,
+    uint16_t wCount
+) {
+    uint32_t dwTotal = (uint32_t)bySize * wCount;
+    uint16_t wChunk;
+    uint16_t i;
+    uint8_t bUniform = (pbyPattern[0] == pbyPattern[1]) &&
+                       ((bySize == 2) || (pbyPattern[0] == pbyPattern[2]));
+
+    if (dwTotal < UCG_HWSPI_DMA_MIN_LENGTH) {
+        while (wCount-- != 0) {
+            UcgHwSpi_SendPolling(pbyPattern, bySize);
+        }
+        return;
+    }
+
+    if (bUniform) {
+        g_byRepeat = pbyPattern[0];
+        while (dwTotal != 0) {
+            wChunk = (dwTotal > LCD_DMA_MAX_COUNT) ? LCD_DMA_MAX_COUNT : dwTotal;
+            UcgHwSpi_Wait();
+            UcgHwSpi_StartDma(&g_byRepeat, wChunk, 0);
+            dwTotal -= wChunk;
+        }
+        return;
+    }
+
+    /* Buffer size is a multiple of pattern size */
+    wChunk = (dwTotal > UCG_HWSPI_BUFFER_SIZE) ? UCG_HWSPI_BUFFER_SIZE : dwTotal;
+    for (i = 0; i < wChunk; i++) {
+        g_pbyBuffer[i] = pbyPattern[i % bySize];
+    }
+
+    while (dwTotal != 0) {
+        wChunk = (dwTotal > UCG_HWSPI_BUFFER_SIZE) ? UCG_HWSPI_BUFFER_SIZE : dwTotal;
+        UcgHwSpi_Wait();
+        UcgHwSpi_StartDma(g_pbyBuffer, wChunk, 1);
+        dwTotal -= wChunk;
+    }
+}
+
+/**
+ * @func   UcgHwSpi_SendString
+ * @brief  Send bytes. Caller may reuse its buffer on return, so a string
+ *         longer than the buffer is sent before returning
+ * @param  pbyData: bytes
+ * @param  wLength: number of bytes
+ * @retval None
+ */
+static void
+UcgHwSpi_SendString(
+    uint8_t *pbyData,
+    uint16_t wLength
+) {
+    uint16_t i;
+
+    if (wLength < UCG_HWSPI_DMA_MIN_LENGTH) {
+        UcgHwSpi_SendPolling(pbyData, wLength);
+        return;
+    }
+
+    if (wLength <= UCG_HWSPI_BUFFER_SIZE) {
+        for (i = 0; i < wLength; i++) {
+            g_pbyBuffer[i] = pbyData[i];
+        }
+        UcgHwSpi_StartDma(g_pbyBuffer, wLength, 1);
+        return;
+    }
+
+    UcgHwSpi_StartDma(pbyData, wLength, 1);
+    UcgHwSpi_Wait();
+}
+
+/* END FILE */
@@ -0,0 +1,165 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Palette + run-length images for ucglib, decoded while drawn
+ *              as horizontal lines (tools/ucg_image_conv makes the data)
+ *
+ *              Image data:
+ *                0       width
+ *                1       height
+ *                2       number of colors N, 0 means 256
+ *                3       flags, UCG_IMAGE_FLAG_xxx
+ *                4       N x (red, green, blue)
+ *                4+3N    runs, rows from top, left to right, a run may
+ *                        continue on next row:
+ *                          N <= 16: (length - 1) << 4 | index
+ *                          N > 16:  length - 1, index
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include "utilities.h"
+#include "Ucglib.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define UCG_IMAGE_HEADER_SIZE               4u
+#define UCG_IMAGE_SMALL_PALETTE             16u
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func   ucg_GetImageWidth
+ * @brief  Width of an image
+ * @param  pbyImage: image data
+ * @retval Width in pixels
+ */
+ucg_int_t
+ucg_GetImageWidth(
+    const uint8_t *pbyImage
+) {
+    return pbyImage[0];
+}
+
+/**
+ * @func   ucg_GetImageHeight
+ * @brief  Height of an image
+ * @param  pbyImage: image data
+ * @retval Height in pixels
+ */
+ucg_int_t
+ucg_GetImageHeight(
+    const uint8_t *pbyImage
+) {
+    return pbyImage[1];
+}
+
+/**
+ * @func   ucg_GetImageFlags
+ * @brief  Flags of an image
+ * @param  pbyImage: image data
+ * @retval UCG_IMAGE_FLAG_xxx
+ */
+uint8_t
+ucg_GetImageFlags(
+    const uint8_t *pbyImage
+) {
+    return pbyImage[3];
+}
+
+/**
+ * @func   ucg_DrawImage
+ * @brief  Draw an image, each run is one line message to device. Colors of
+ *         ucg are not changed
+ * @param  ucg: ucg
+ * @param  x, y: upper left
+ * @param  pbyImage: image data
+ * @retval None
+ */
+void
+ucg_DrawImage(
+    ucg_t *ucg,
+    ucg_int_t x,
+    ucg_int_t y,
+    const uint8_t *pbyImage
+) {
+    uint8_t byWidth = pbyImage[0];
+    uint8_t byHeight = pbyImage[1];
+    uint16_t wColors = (pbyImage[2] == 0) ? 256 : pbyImage[2];
+    uint8_t bTransparent = (ucg_GetImageFlags(pbyImage) & UCG_IMAGE_FLAG_TRANSPARENT) != 0;
+    const uint8_t *pbyPalette = &pbyImage[UCG_IMAGE_HEADER_SIZE];
+    const uint8_t *pbyRun = pbyPalette + wColors * 3;
+    const uint8_t *pbyColor;
+    uint16_t wLength;
+    uint8_t byIndex;
+    uint8_t byCol = 0;
+    uint8_t byRow = 0;
+    uint8_t bySpan;
+
+    if ((byWidth == 0) || (byHeight == 0)) {
+        return;
+    }
+
+    while (byRow < byHeight) {
+        if (wColors <= UCG_IMAGE_SMALL_PALETTE) {
+            wLength = (uint16_t)((*pbyRun >> 4) + 1);
+            byIndex = *pbyRun & 0x0F;
+            pbyRun++;
+        } else {
+            wLength = (uint16_t)(pbyRun[0] + 1);
+            byIndex = pbyRun[1];
+            pbyRun += 2;
+        }
+
+        pbyColor = &pbyPalette[byIndex * 3];
+
+        /* Split run at end of rows */
+        while ((wLength > 0) && (byRow < byHeight)) {
+            bySpan = byWidth - byCol;
+            if (wLength < bySpan) {
+                bySpan = (uint8_t)wLength;
+            }
+
+            if (!bTransparent || (byIndex != 0)) {
+                ucg->arg.pixel.rgb.color[0] = pbyColor[0];
+                ucg->arg.pixel.rgb.color[1] = pbyColor[1];
+                ucg->arg.pixel.rgb.color[2] = pbyColor[2];
+                ucg->arg.pixel.pos.x = x + byCol;
+                ucg->arg.pixel.pos.y = y + byRow;
+                ucg->arg.len = bySpan;
+                ucg->arg.dir = 0;           /* Changed by rotation */
+                ucg_DrawL90FXWithArg(ucg);
+            }
+
+            wLength -= bySpan;
+            byCol += bySpan;
+            if (byCol >= byWidth) {
+                byCol = 0;
+                byRow++;
+            }
+        }
+    }
+}
+
+/* END FILE */
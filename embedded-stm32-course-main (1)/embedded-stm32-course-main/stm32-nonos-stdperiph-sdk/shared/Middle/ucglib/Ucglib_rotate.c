@@ -0,0 +1,270 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Rotation of ST7735 by MADCTL register, without software
+ *              transform of every pixel and line message
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include "utilities.h"
+#include "Ucglib.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+/* Offset added to CASET / RASET, index of UcgRotate_SetWindow table. A
+ * mirrored axis counts from the far end of RAM */
+#define UCG_ROTATE_OFS_COLUMN               0       /* display_offset.x */
+#define UCG_ROTATE_OFS_ROW                  1       /* display_offset.y */
+#define UCG_ROTATE_OFS_COLUMN_MIRROR        2       /* RAM columns after glass */
+#define UCG_ROTATE_OFS_ROW_MIRROR           3       /* RAM rows after glass */
+
+#define UCG_ROTATE_LINE_MAX                 128     /* Longest line after clipping */
+#define UCG_ROTATE_BYTES_PER_PIXEL          3       /* COLMOD 18-bit of ucg_dev_st7735 */
+
+typedef struct {
+    uint8_t byMadctl;
+    uint8_t byOffsetX;                       /*< UCG_ROTATE_OFS_xxx added to CASET */
+    uint8_t byOffsetY;                       /*< UCG_ROTATE_OFS_xxx added to RASET */
+} ucg_rotate_cfg_t;
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+/* Same orientation as ucg_SetRotate90/180/270 (clockwise) */
+static const ucg_rotate_cfg_t g_pRotateCfg[4] = {
+    { 0x00, UCG_ROTATE_OFS_COLUMN, UCG_ROTATE_OFS_ROW },
+    { ST7735_MADCTL_MX | ST7735_MADCTL_MV, UCG_ROTATE_OFS_ROW, UCG_ROTATE_OFS_COLUMN_MIRROR },
+    { ST7735_MADCTL_MX | ST7735_MADCTL_MY, UCG_ROTATE_OFS_COLUMN_MIRROR, UCG_ROTATE_OFS_ROW_MIRROR },
+    { ST7735_MADCTL_MY | ST7735_MADCTL_MV, UCG_ROTATE_OFS_ROW_MIRROR, UCG_ROTATE_OFS_COLUMN },
+};
+
+static const ucg_rotate_cfg_t *g_pCfg = &g_pRotateCfg[UCG_ROTATE_0];
+
+/* Panel device, receives all messages but drawing */
+static ucg_dev_fnptr g_pPanelCb;
+
+/* Pixels of a gradient line, in address window order */
+static uint8_t g_pbyLine[UCG_ROTATE_LINE_MAX * UCG_ROTATE_BYTES_PER_PIXEL];
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static void UcgRotate_SetWindow(ucg_t *ucg, ucg_int_t iLen);
+static void UcgRotate_DrawGradient(ucg_t *ucg);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func   ucg_SetRotateNative
+ * @brief  Rotate screen clockwise. On ST7735 the controller rotates by
+ *         MADCTL, other devices use ucg_SetRotate90/180/270. Not to be used
+ *         together with ucg_fb_Attach / ucg_tile_Attach
+ * @param  ucg: ucg
+ * @param  byRotation: UCG_ROTATE_0, _90, _180 or _270
+ * @retval None
+ */
+void
+ucg_SetRotateNative(
+    ucg_t *ucg,
+    uint8_t byRotation
+) {
+    byRotation &= 0x03;
+
+    ucg_UndoRotate(ucg);
+    if (ucg->device_cb == ucg_dev_st7735_native) {
+        ucg->device_cb = g_pPanelCb;
+    }
+
+    if (ucg->device_cb == ucg_dev_st7735_18x128x128) {
+        g_pCfg = &g_pRotateCfg[byRotation];
+        if (byRotation != UCG_ROTATE_0) {
+            g_pPanelCb = ucg->device_cb;
+            ucg->device_cb = ucg_dev_st7735_native;
+        }
+        ucg_SetMaxClipRange(ucg);
+        return;
+    }
+
+    switch (byRotation) {
+    case UCG_ROTATE_90:
+        ucg_SetRotate90(ucg);
+        break;
+
+    case UCG_ROTATE_180:
+        ucg_SetRotate180(ucg);
+        break;
+
+    case UCG_ROTATE_270:
+        ucg_SetRotate270(ucg);
+        break;
+
+    default:
+        break;
+    }
+}
+
+/**
+ * @func   ucg_GetRotateNative
+ * @brief  Rotation done by MADCTL
+ * @param  ucg: ucg
+ * @retval UCG_ROTATE_xxx, UCG_ROTATE_0 if the controller does not rotate
+ */
+uint8_t
+ucg_GetRotateNative(
+    ucg_t *ucg
+) {
+    if (ucg->device_cb != ucg_dev_st7735_native) {
+        return UCG_ROTATE_0;
+    }
+
+    return (uint8_t)(g_pCfg - g_pRotateCfg);
+}
+
+/**
+ * @func   ucg_dev_st7735_native
+ * @brief  Device callback of rotated ST7735: pixels and lines are written in
+ *         screen coordinates, controller maps them by MADCTL. Other
+ *         messages are handled by panel device
+ * @param  ucg: ucg
+ * @param  msg: UCG_MSG_xxx
+ * @param  data: message data
+ * @retval Result of message
+ */
+ucg_int_t
+ucg_dev_st7735_native(
+    ucg_t *ucg,
+    ucg_int_t msg,
+    void *data
+) {
+    uint8_t i;
+
+    switch (msg) {
+    case UCG_MSG_DRAW_PIXEL:
+        if (ucg_clip_is_pixel_visible(ucg) != 0) {
+            ucg->arg.dir = 0;
+            UcgRotate_SetWindow(ucg, 1);
+            ucg_com_SendString(ucg, UCG_ROTATE_BYTES_PER_PIXEL, ucg->arg.pixel.rgb.color);
+            ucg_com_SetCSLineStatus(ucg, 1);
+        }
+        return 1;
+
+    case UCG_MSG_DRAW_L90FX:
+        if (ucg_clip_l90fx(ucg) != 0) {
+            UcgRotate_SetWindow(ucg, ucg->arg.len);
+            ucg_com_SendRepeat3Bytes(ucg, ucg->arg.len, ucg->arg.pixel.rgb.color);
+            ucg_com_SetCSLineStatus(ucg, 1);
+        }
+        return 1;
+
+    case UCG_MSG_DRAW_L90SE:
+        for (i = 0; i < 3; i++) {
+            ucg_ccs_init(ucg->arg.ccs_line + i, ucg->arg.rgb[0].color[i],
+                         ucg->arg.rgb[1].color[i], ucg->arg.len);
+        }
+        if (ucg_clip_l90se(ucg) != 0) {
+            UcgRotate_DrawGradient(ucg);
+        }
+        return 1;
+
+    default:
+        break;
+    }
+
+    return g_pPanelCb(ucg, msg, data);
+}
+
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+/**
+ * @func   UcgRotate_SetWindow
+ * @brief  Set MADCTL of rotation and address window covering a line, leave
+ *         CS low and controller waiting for pixels
+ * @param  ucg: ucg, line in ucg->arg
+ * @param  iLen: number of pixels
+ * @retval None
+ */
+static void
+UcgRotate_SetWindow(
+    ucg_t *ucg,
+    ucg_int_t iLen
+) {
+    uint8_t pbyOffset[4];
+    ucg_int_t x0 = ucg->arg.pixel.pos.x;
+    ucg_int_t y0 = ucg->arg.pixel.pos.y;
+    ucg_int_t x1 = x0;
+    ucg_int_t y1 = y0;
+
+    switch (ucg->arg.dir) {
+    case 0: x1 = x0 + iLen - 1; break;
+    case 1: y1 = y0 + iLen - 1; break;
+    case 2: x0 = x1 - iLen + 1; break;
+    default: y0 = y1 - iLen + 1; break;
+    }
+
+    pbyOffset[UCG_ROTATE_OFS_COLUMN] = (uint8_t)ucg->display_offset.x;
+    pbyOffset[UCG_ROTATE_OFS_ROW] = (uint8_t)ucg->display_offset.y;
+    pbyOffset[UCG_ROTATE_OFS_COLUMN_MIRROR] =
+        (uint8_t)(ST7735_RAM_COLUMNS - ST7735_GLASS_SIZE - ucg->display_offset.x);
+    pbyOffset[UCG_ROTATE_OFS_ROW_MIRROR] =
+        (uint8_t)(ST7735_RAM_ROWS - ST7735_GLASS_SIZE - ucg->display_offset.y);
+
+    UcgSt7735_Begin(ucg, g_pCfg->byMadctl);
+    UcgSt7735_SetRamWindow(ucg, x0 + pbyOffset[g_pCfg->byOffsetX], y0 + pbyOffset[g_pCfg->byOffsetY],
+                           x1 + pbyOffset[g_pCfg->byOffsetX], y1 + pbyOffset[g_pCfg->byOffsetY]);
+}
+
+/**
+ * @func   UcgRotate_DrawGradient
+ * @brief  Send a clipped L90SE line. Window is filled left to right / top
+ *         to bottom, so colors of direction 2 and 3 are stored reversed
+ * @param  ucg: ucg, line and color sliders in ucg->arg
+ * @retval None
+ */
+static void
+UcgRotate_DrawGradient(
+    ucg_t *ucg
+) {
+    ucg_int_t iLen = ucg->arg.len;
+    ucg_int_t iPos;
+    uint8_t *pbyPixel;
+    uint8_t i;
+
+    if (iLen > UCG_ROTATE_LINE_MAX) {
+        iLen = UCG_ROTATE_LINE_MAX;
+    }
+
+    for (iPos = 0; iPos < iLen; iPos++) {
+        if (ucg->arg.dir >= 2) {
+            pbyPixel = &g_pbyLine[(iLen - 1 - iPos) * UCG_ROTATE_BYTES_PER_PIXEL];
+        } else {
+            pbyPixel = &g_pbyLine[iPos * UCG_ROTATE_BYTES_PER_PIXEL];
+        }
+
+        for (i = 0; i < 3; i++) {
+            pbyPixel[i] = ucg->arg.ccs_line[i].current;
+            ucg_ccs_step(ucg->arg.ccs_line + i);
+        }
+    }
+
+    UcgRotate_SetWindow(ucg, iLen);
+    ucg_com_SendString(ucg, (uint16_t)(iLen * UCG_ROTATE_BYTES_PER_PIXEL), g_pbyLine);
+    ucg_com_SetCSLineStatus(ucg, 1);
+}
+
+/* END FILE */
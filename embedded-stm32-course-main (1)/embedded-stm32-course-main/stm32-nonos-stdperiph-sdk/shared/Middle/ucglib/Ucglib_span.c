@@ -0,0 +1,335 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Filled disc and rounded box of ucglib drawn as merged
+ *              horizontal spans, same pixels as ucg_DrawDisc / ucg_DrawRBox
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include "utilities.h"
+#include "Ucglib.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+/* Larger radius is drawn by ucglib */
+#define UCG_SPAN_RADIUS_MAX                 127
+
+/* Spans of a row before they are merged */
+#define UCG_SPAN_ROW_MAX                    5u
+
+typedef struct {
+    ucg_int_t x0;
+    ucg_int_t x1;                    /*< Inclusive */
+} ucg_span_t, *ucg_span_p;
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+/*
+ * Half width of a quarter disc at each row distance from center, from the
+ * midpoint algorithm of ucg_DrawDisc
+ */
+static ucg_int_t g_piHalfWidth[UCG_SPAN_RADIUS_MAX + 1];
+static ucg_int_t g_iRadius = -1;
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static void UcgSpan_SetRadius(ucg_int_t iRadius);
+static uint8_t UcgSpan_IsVisible(ucg_t *ucg, ucg_int_t x, ucg_int_t y, ucg_int_t w, ucg_int_t h);
+static void UcgSpan_DrawRow(ucg_t *ucg, ucg_int_t y, ucg_span_p pSpan, uint8_t byCount);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func   ucg_DrawDiscSpan
+ * @brief  Same pixels as ucg_DrawDisc, at most one line per row and quarters
+ *         of a row merged
+ * @param  ucg: ucg, color 0
+ * @param  x0, y0: center
+ * @param  rad: radius
+ * @param  option: UCG_DRAW_xxx quarters
+ * @retval None
+ */
+void
+ucg_DrawDiscSpan(
+    ucg_t *ucg,
+    ucg_int_t x0,
+    ucg_int_t y0,
+    ucg_int_t rad,
+    uint8_t option
+) {
+    ucg_span_t pSpan[2];
+    ucg_int_t d;
+    uint8_t byCount;
+    uint8_t byLeft;
+    uint8_t byRight;
+
+    if ((rad < 0) || (rad > UCG_SPAN_RADIUS_MAX)) {
+        ucg_DrawDisc(ucg, x0, y0, rad, option);
+        return;
+    }
+
+    if (!UcgSpan_IsVisible(ucg, x0 - rad, y0 - rad, 2 * rad + 1, 2 * rad + 1)) {
+        return;
+    }
+
+    UcgSpan_SetRadius(rad);
+
+    for (d = -rad; d <= rad; d++) {
+        /* Center row belongs to upper and lower quarters */
+        byLeft = 0;
+        byRight = 0;
+        if (d <= 0) {
+            byLeft |= option & UCG_DRAW_UPPER_LEFT;
+            byRight |= option & UCG_DRAW_UPPER_RIGHT;
+        }
+        if (d >= 0) {
+            byLeft |= option & UCG_DRAW_LOWER_LEFT;
+            byRight |= option & UCG_DRAW_LOWER_RIGHT;
+        }
+
+        byCount = 0;
+        if (byLeft) {
+            pSpan[byCount].x0 = x0 - g_piHalfWidth[(d < 0) ? -d : d];
+            pSpan[byCount].x1 = x0;
+            byCount++;
+        }
+        if (byRight) {
+            pSpan[byCount].x0 = x0;
+            pSpan[byCount].x1 = x0 + g_piHalfWidth[(d < 0) ? -d : d];
+            byCount++;
+        }
+
+        UcgSpan_DrawRow(ucg, y0 + d, pSpan, byCount);
+    }
+}
+
+/**
+ * @func   ucg_DrawRBoxSpan
+ * @brief  Same pixels as ucg_DrawRBox, at most one line per row instead of
+ *         four quarter discs and three boxes
+ * @param  ucg: ucg, color 0
+ * @param  x, y: upper left
+ * @param  w, h: size
+ * @param  r: radius of corners
+ * @retval None
+ */
+void
+ucg_DrawRBoxSpan(
+    ucg_t *ucg,
+    ucg_int_t x,
+    ucg_int_t y,
+    ucg_int_t w,
+    ucg_int_t h,
+    ucg_int_t r
+) {
+    ucg_span_t pSpan[UCG_SPAN_ROW_MAX];
+    ucg_int_t xl = x + r;                   /* Centers of corners */
+    ucg_int_t xr = x + w - r - 1;
+    ucg_int_t yu = y + r;
+    ucg_int_t yl = y + h - r - 1;
+    ucg_int_t ww = w - 2 * r - 2;           /* Boxes between corners */
+    ucg_int_t hh = h - 2 * r - 2;
+    ucg_int_t iLeft = (x < xr) ? x : xr;    /* Corners cross if box is small */
+    ucg_int_t iRight = (xl > xr + r) ? xl : (xr + r);
+    ucg_int_t iTop = (y < yl) ? y : yl;
+    ucg_int_t iBottom = (yu > yl + r) ? yu : (yl + r);
+    ucg_int_t row;
+    uint8_t byCount;
+
+    if ((r < 0) || (r > UCG_SPAN_RADIUS_MAX)) {
+        ucg_DrawRBox(ucg, x, y, w, h, r);
+        return;
+    }
+
+    if (!UcgSpan_IsVisible(ucg, iLeft, iTop, iRight - iLeft + 1, iBottom - iTop + 1)) {
+        return;
+    }
+
+    UcgSpan_SetRadius(r);
+
+    for (row = iTop; row <= iBottom; row++) {
+        byCount = 0;
+
+        /* Upper corners */
+        if ((row >= yu - r) && (row <= yu)) {
+            pSpan[byCount].x0 = xl - g_piHalfWidth[yu - row];
+            pSpan[byCount].x1 = xl;
+            byCount++;
+            pSpan[byCount].x0 = xr;
+            pSpan[byCount].x1 = xr + g_piHalfWidth[yu - row];
+            byCount++;
+        }
+
+        /* Lower corners */
+        if ((row >= yl) && (row <= yl + r)) {
+            pSpan[byCount].x0 = xl - g_piHalfWidth[row - yl];
+            pSpan[byCount].x1 = xl;
+            byCount++;
+            pSpan[byCount].x0 = xr;
+            pSpan[byCount].x1 = xr + g_piHalfWidth[row - yl];
+            byCount++;
+        }
+
+        if ((ww >= 0) && (((row >= y) && (row <= y + r)) || ((row >= yl) && (row <= yl + r)))) {
+            pSpan[byCount].x0 = xl + 1;
+            pSpan[byCount].x1 = xl + ww;
+            byCount++;
+        }
+
+        if ((hh >= 0) && (row >= yu + 1) && (row < yu + 1 + hh)) {
+            pSpan[0].x0 = x;
+            pSpan[0].x1 = x + w - 1;
+            byCount = 1;
+        }
+
+        UcgSpan_DrawRow(ucg, row, pSpan, byCount);
+    }
+}
+
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+/**
+ * @func   UcgSpan_SetRadius
+ * @brief  Fill half widths of a quarter disc. ucg_DrawDisc draws vertical
+ *         lines at x and y of each midpoint step, the width of row d is the
+ *         farthest line reaching it
+ * @param  iRadius: radius
+ * @retval None
+ */
+static void
+UcgSpan_SetRadius(
+    ucg_int_t iRadius
+) {
+    ucg_int_t f = 1 - iRadius;
+    ucg_int_t ddFx = 1;
+    ucg_int_t ddFy = -2 * iRadius;
+    ucg_int_t x = 0;
+    ucg_int_t y = iRadius;
+    ucg_int_t d;
+
+    if (iRadius == g_iRadius) {
+        return;
+    }
+    g_iRadius = iRadius;
+
+    for (d = 0; d <= iRadius; d++) {
+        g_piHalfWidth[d] = 0;
+    }
+
+    for (;;) {
+        /* Line at column x reaches rows 0..y, line at column y rows 0..x */
+        for (d = 0; d <= y; d++) {
+            if (g_piHalfWidth[d] < x) {
+                g_piHalfWidth[d] = x;
+            }
+        }
+        for (d = 0; d <= x; d++) {
+            if (g_piHalfWidth[d] < y) {
+                g_piHalfWidth[d] = y;
+            }
+        }
+
+        if (x >= y) {
+            break;
+        }
+
+        if (f >= 0) {
+            y--;
+            ddFy += 2;
+            f += ddFy;
+        }
+        x++;
+        ddFx += 2;
+        f += ddFx;
+    }
+}
+
+/**
+ * @func   UcgSpan_IsVisible
+ * @brief  Check a box is in clip box, one check per primitive. Not checked
+ *         under software rotation, clip box is in display coordinates then
+ * @param  ucg: ucg
+ * @param  x, y: upper left
+ * @param  w, h: size
+ * @retval 0 if nothing is visible
+ */
+static uint8_t
+UcgSpan_IsVisible(
+    ucg_t *ucg,
+    ucg_int_t x,
+    ucg_int_t y,
+    ucg_int_t w,
+    ucg_int_t h
+) {
+    if (ucg->rotate_chain_device_cb != NULL) {
+        return 1;
+    }
+
+    return (w > 0) && (h > 0) &&
+           (x < ucg->clip_box.ul.x + ucg->clip_box.size.w) &&
+           (x + w > ucg->clip_box.ul.x) &&
+           (y < ucg->clip_box.ul.y + ucg->clip_box.size.h) &&
+           (y + h > ucg->clip_box.ul.y);
+}
+
+/**
+ * @func   UcgSpan_DrawRow
+ * @brief  Merge overlapping or adjacent spans of a row, draw one line each
+ * @param  ucg: ucg, color 0
+ * @param  y: row
+ * @param  pSpan: spans, changed
+ * @param  byCount: number of spans
+ * @retval None
+ */
+static void
+UcgSpan_DrawRow(
+    ucg_t *ucg,
+    ucg_int_t y,
+    ucg_span_p pSpan,
+    uint8_t byCount
+) {
+    ucg_span_t span;
+    uint8_t i;
+    uint8_t j;
+
+    /* Few spans, insertion sort by start */
+    for (i = 1; i < byCount; i++) {
+        span = pSpan[i];
+        for (j = i; (j > 0) && (pSpan[j - 1].x0 > span.x0); j--) {
+            pSpan[j] = pSpan[j - 1];
+        }
+        pSpan[j] = span;
+    }
+
+    i = 0;
+    while (i < byCount) {
+        span = pSpan[i++];
+        while ((i < byCount) && (pSpan[i].x0 <= span.x1 + 1)) {
+            if (pSpan[i].x1 > span.x1) {
+                span.x1 = pSpan[i].x1;
+            }
+            i++;
+        }
+        ucg_DrawHLine(ucg, span.x0, y, span.x1 - span.x0 + 1);
+    }
+}
+
+/* END FILE */
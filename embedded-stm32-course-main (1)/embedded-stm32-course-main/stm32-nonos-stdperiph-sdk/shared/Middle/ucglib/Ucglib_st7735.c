@@ -0,0 +1,141 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: ST7735 command sequences shared by ucglib backends writing
+ *              panel RAM directly: CS and MADCTL, COLMOD, address window of
+ *              glass at display_offset
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include "Ucglib.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func   UcgSt7735_Begin
+ * @brief  Pull CS low and set address order. Released by
+ *         ucg_com_SetCSLineStatus(ucg, 1)
+ * @param  ucg: ucg
+ * @param  byMadctl: 0 or ST7735_MADCTL_xxx of a rotation
+ * @retval None
+ */
+void
+UcgSt7735_Begin(
+    ucg_t *ucg,
+    uint8_t byMadctl
+) {
+    ucg_pgm_uint8_t pbySeq[] = {
+        UCG_CS(0),
+        UCG_C11(ST7735_MADCTL, 0x00),
+        UCG_END()
+    };
+
+    pbySeq[3] = byMadctl;
+
+    ucg_com_SendCmdSeq(ucg, pbySeq);
+}
+
+/**
+ * @func   UcgSt7735_SetColmod
+ * @brief  Set pixel format, CS is low. ST7735_COLMOD_18BIT must be set back
+ *         before ucg_dev_st7735 draws again
+ * @param  ucg: ucg
+ * @param  byColmod: ST7735_COLMOD_16BIT or ST7735_COLMOD_18BIT
+ * @retval None
+ */
+void
+UcgSt7735_SetColmod(
+    ucg_t *ucg,
+    uint8_t byColmod
+) {
+    ucg_pgm_uint8_t pbySeq[] = {
+        UCG_C11(ST7735_COLMOD, 0x00),
+        UCG_END()
+    };
+
+    pbySeq[2] = byColmod;
+
+    ucg_com_SendCmdSeq(ucg, pbySeq);
+}
+
+/**
+ * @func   UcgSt7735_SetWindow
+ * @brief  Set address window in glass coordinates, MADCTL 0. CS is low and
+ *         stays low, controller waits for pixels
+ * @param  ucg: ucg
+ * @param  x0, y0: upper left
+ * @param  x1, y1: lower right, inclusive
+ * @retval None
+ */
+void
+UcgSt7735_SetWindow(
+    ucg_t *ucg,
+    ucg_int_t x0,
+    ucg_int_t y0,
+    ucg_int_t x1,
+    ucg_int_t y1
+) {
+    /* Glass starts at display_offset of panel RAM */
+    UcgSt7735_SetRamWindow(ucg, x0 + ucg->display_offset.x, y0 + ucg->display_offset.y,
+                           x1 + ucg->display_offset.x, y1 + ucg->display_offset.y);
+}
+
+/**
+ * @func   UcgSt7735_SetRamWindow
+ * @brief  Set address window in panel RAM addresses, as counted by MADCTL.
+ *         CS is low and stays low, controller waits for pixels
+ * @param  ucg: ucg
+ * @param  x0, y0: first column and row
+ * @param  x1, y1: last column and row, inclusive
+ * @retval None
+ */
+void
+UcgSt7735_SetRamWindow(
+    ucg_t *ucg,
+    ucg_int_t x0,
+    ucg_int_t y0,
+    ucg_int_t x1,
+    ucg_int_t y1
+) {
+    ucg_pgm_uint8_t pbySeq[] = {
+        UCG_C14(ST7735_CASET, 0x00, 0x00, 0x00, 0x00),
+        UCG_C14(ST7735_RASET, 0x00, 0x00, 0x00, 0x00),
+        UCG_C10(ST7735_RAMWR),
+        UCG_DATA(),
+        UCG_END()
+    };
+
+    pbySeq[3] = (uint8_t)x0;
+    pbySeq[5] = (uint8_t)x1;
+    pbySeq[9] = (uint8_t)y0;
+    pbySeq[11] = (uint8_t)y1;
+
+    ucg_com_SendCmdSeq(ucg, pbySeq);
+}
+
+/* END FILE */
@@ -0,0 +1,326 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Strip renderer of ucglib (ST7735, RGB565). A frame is drawn
+ *              by a callback replayed once per strip; a strip is sent on
+ *              DMA while the next one is rendered into the other buffer
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include "utilities.h"
+#include "timer.h"
+#include "Ucglib.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define UCG_TILE_WIDTH                      128
+#define UCG_TILE_SCREEN_HEIGHT              128
+#define UCG_TILE_HEIGHT                     16      /* 128 x 16 x 2 = 4 KB per strip */
+#define UCG_TILE_BYTES_PER_PIXEL            2
+#define UCG_TILE_ROW_SIZE                   (UCG_TILE_WIDTH * UCG_TILE_BYTES_PER_PIXEL)
+#define UCG_TILE_SIZE                       (UCG_TILE_ROW_SIZE * UCG_TILE_HEIGHT)
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+/* Ping-pong strips in panel byte order: RGB565, high byte first */
+static uint8_t g_pbyTile[2][UCG_TILE_SIZE];
+static uint8_t *g_pbyCurrent;
+static int16_t g_iTileY;                    /* First row of current strip */
+
+/* Clip box set by application, in panel coordinates */
+static ucg_box_t g_clipBox;
+
+/* Panel device, receives all messages but drawing */
+static ucg_dev_fnptr g_pPanelCb;
+
+static uint16_t g_wRenderMs;
+static uint16_t g_wFrameMs;
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static void UcgTile_SetClip(ucg_t *ucg);
+static void UcgTile_DrawLine(ucg_t *ucg, uint8_t bGradient);
+static void UcgTile_Send(ucg_t *ucg, uint8_t *pbyData, uint16_t wLength);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func   ucg_tile_Attach
+ * @brief  Redirect drawing of ucg into strips. Call after ucg_Init and
+ *         before ucg_SetRotate*
+ * @param  ucg: ucg of ST7735 128x128
+ * @retval None
+ */
+void
+ucg_tile_Attach(
+    ucg_t *ucg
+) {
+    if (ucg->device_cb == ucg_dev_tile) {
+        return;
+    }
+
+    g_pPanelCb = ucg->device_cb;
+    ucg->device_cb = ucg_dev_tile;
+    g_clipBox = ucg->clip_box;
+    g_pbyCurrent = NULL;
+}
+
+/**
+ * @func   ucg_tile_Detach
+ * @brief  Draw directly on panel again
+ * @param  ucg: ucg attached by ucg_tile_Attach, not rotated
+ * @retval None
+ */
+void
+ucg_tile_Detach(
+    ucg_t *ucg
+) {
+    if (ucg->device_cb != ucg_dev_tile) {
+        return;
+    }
+
+    ucg->device_cb = g_pPanelCb;
+    ucg->clip_box = g_clipBox;
+}
+
+/**
+ * @func   ucg_dev_tile
+ * @brief  Device callback: pixels and lines are drawn into current strip,
+ *         dropped outside ucg_tile_Render. Other messages are handled by
+ *         panel device
+ * @param  ucg: ucg
+ * @param  msg: UCG_MSG_xxx
+ * @param  data: message data
+ * @retval Result of message
+ */
+ucg_int_t
+ucg_dev_tile(
+    ucg_t *ucg,
+    ucg_int_t msg,
+    void *data
+) {
+    ucg_int_t iResult;
+    uint8_t i;
+
+    switch (msg) {
+    case UCG_MSG_DRAW_PIXEL:
+        if ((g_pbyCurrent != NULL) && (ucg_clip_is_pixel_visible(ucg) != 0)) {
+            ucg->arg.len = 1;
+            UcgTile_DrawLine(ucg, 0);
+        }
+        return 1;
+
+    case UCG_MSG_DRAW_L90FX:
+        if ((g_pbyCurrent != NULL) && (ucg_clip_l90fx(ucg) != 0)) {
+            UcgTile_DrawLine(ucg, 0);
+        }
+        return 1;
+
+    case UCG_MSG_DRAW_L90SE:
+        if (g_pbyCurrent == NULL) {
+            return 1;
+        }
+        for (i = 0; i < 3; i++) {
+            ucg_ccs_init(ucg->arg.ccs_line + i, ucg->arg.rgb[0].color[i],
+                         ucg->arg.rgb[1].color[i], ucg->arg.len);
+        }
+        if (ucg_clip_l90se(ucg) != 0) {
+            UcgTile_DrawLine(ucg, 1);
+        }
+        return 1;
+
+    case UCG_MSG_SET_CLIP_BOX:
+        /* Keep box of application, drawing is clipped to strip too */
+        iResult = g_pPanelCb(ucg, msg, data);
+        g_clipBox = ucg->clip_box;
+        if (g_pbyCurrent != NULL) {
+            UcgTile_SetClip(ucg);
+        }
+        return iResult;
+
+    default:
+        break;
+    }
+
+    return g_pPanelCb(ucg, msg, data);
+}
+
+/**
+ * @func   ucg_tile_Render
+ * @brief  Render a full frame strip by strip and send it to panel. draw is
+ *         called once per strip and must draw the same frame each time,
+ *         only drawing functions of ucg may be used in it. ucg_DrawString
+ *         of the library is drawn later by a timer task, after the strips
+ *         are sent, and never shows in the frame: use ucg_DrawStringCached
+ *         or ucg_DrawStringSolid
+ * @param  ucg: ucg attached by ucg_tile_Attach
+ * @param  draw: draws the frame
+ * @param  data: parameter of draw
+ * @retval None
+ */
+void
+ucg_tile_Render(
+    ucg_t *ucg,
+    ucg_tile_draw_fnptr draw,
+    void *data
+) {
+    uint32_t dwStart = GetMilSecTick();
+    uint32_t dwRender = 0;
+    uint32_t dwDraw;
+    uint8_t byStrip;
+
+    /* One address window for the frame, strips follow each other in RAM */
+    UcgSt7735_Begin(ucg, 0x00);
+    UcgSt7735_SetColmod(ucg, ST7735_COLMOD_16BIT);
+    UcgSt7735_SetWindow(ucg, 0, 0, UCG_TILE_WIDTH - 1, UCG_TILE_SCREEN_HEIGHT - 1);
+
+    for (byStrip = 0; byStrip < UCG_TILE_SCREEN_HEIGHT / UCG_TILE_HEIGHT; byStrip++) {
+        /* Strip sent two turns ago has finished, next send waits for it */
+        g_pbyCurrent = g_pbyTile[byStrip & 1];
+        g_iTileY = (int16_t)(byStrip * UCG_TILE_HEIGHT);
+
+        dwDraw = GetMilSecTick();
+        memsetl(g_pbyCurrent, 0, UCG_TILE_SIZE);
+        UcgTile_SetClip(ucg);
+        draw(ucg, data);
+        dwRender += GetMilSecTick() - dwDraw;
+
+        UcgTile_Send(ucg, g_pbyCurrent, UCG_TILE_SIZE);
+    }
+
+    g_pbyCurrent = NULL;
+    ucg->clip_box = g_clipBox;
+
+    /* com_cb waits for the last strip before the command */
+    UcgSt7735_SetColmod(ucg, ST7735_COLMOD_18BIT);
+    ucg_com_SetCSLineStatus(ucg, 1);
+
+    g_wRenderMs = (uint16_t)dwRender;
+    g_wFrameMs = (uint16_t)(GetMilSecTick() - dwStart);
+}
+
+/**
+ * @func   ucg_tile_GetFrameTime
+ * @brief  Time spent on last frame of ucg_tile_Render
+ * @param  pwRenderMs: time in draw callbacks (ms)
+ * @param  pwFrameMs: time of render and transfer (ms)
+ * @retval None
+ */
+void
+ucg_tile_GetFrameTime(
+    uint16_t *pwRenderMs,
+    uint16_t *pwFrameMs
+) {
+    *pwRenderMs = g_wRenderMs;
+    *pwFrameMs = g_wFrameMs;
+}
+
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+/**
+ * @func   UcgTile_SetClip
+ * @brief  Clip box of application limited to current strip, so lines out of
+ *         the strip are dropped by ucg_clip_xxx
+ * @param  ucg: ucg
+ * @retval None
+ */
+static void
+UcgTile_SetClip(
+    ucg_t *ucg
+) {
+    ucg_int_t iTop = g_clipBox.ul.y;
+    ucg_int_t iBottom = g_clipBox.ul.y + g_clipBox.size.h;
+
+    if (iTop < g_iTileY) {
+        iTop = g_iTileY;
+    }
+    if (iBottom > g_iTileY + UCG_TILE_HEIGHT) {
+        iBottom = g_iTileY + UCG_TILE_HEIGHT;
+    }
+
+    ucg->clip_box = g_clipBox;
+    ucg->clip_box.ul.y = iTop;
+    ucg->clip_box.size.h = (iBottom > iTop) ? (iBottom - iTop) : 0;
+}
+
+/**
+ * @func   UcgTile_DrawLine
+ * @brief  Write a clipped line of ucg->arg into current strip
+ * @param  ucg: ucg
+ * @param  bGradient: colors from ccs_line (L90SE), else from pixel.rgb
+ * @retval None
+ */
+static void
+UcgTile_DrawLine(
+    ucg_t *ucg,
+    uint8_t bGradient
+) {
+    static const int8_t pbyStepX[4] = { 1, 0, -1, 0 };
+    static const int8_t pbyStepY[4] = { 0, 1, 0, -1 };
+    int16_t x = ucg->arg.pixel.pos.x;
+    int16_t y = ucg->arg.pixel.pos.y - g_iTileY;
+    int16_t iLen = ucg->arg.len;
+    uint8_t byDir = (uint8_t)(ucg->arg.dir & 0x03);
+    uint8_t *pbyColor = ucg->arg.pixel.rgb.color;
+    uint8_t *pbyPixel;
+    uint8_t i;
+
+    while (iLen-- > 0) {
+        if (bGradient) {
+            for (i = 0; i < 3; i++) {
+                pbyColor[i] = ucg->arg.ccs_line[i].current;
+                ucg_ccs_step(ucg->arg.ccs_line + i);
+            }
+        }
+
+        if ((x >= 0) && (x < UCG_TILE_WIDTH) && (y >= 0) && (y < UCG_TILE_HEIGHT)) {
+            pbyPixel = &g_pbyCurrent[y * UCG_TILE_ROW_SIZE + x * UCG_TILE_BYTES_PER_PIXEL];
+            pbyPixel[0] = (uint8_t)((pbyColor[0] & 0xF8) | (pbyColor[1] >> 5));
+            pbyPixel[1] = (uint8_t)(((pbyColor[1] & 0x1C) << 3) | (pbyColor[2] >> 3));
+        }
+
+        x += pbyStepX[byDir];
+        y += pbyStepY[byDir];
+    }
+}
+
+/**
+ * @func   UcgTile_Send
+ * @brief  Send a strip, on DMA without waiting if com is hardware SPI
+ * @param  ucg: ucg
+ * @param  pbyData: strip
+ * @param  wLength: number of bytes
+ * @retval None
+ */
+static void
+UcgTile_Send(
+    ucg_t *ucg,
+    uint8_t *pbyData,
+    uint16_t wLength
+) {
+    if (ucg->com_cb == ucg_com_stm32_HW_SPI) {
+        UcgHwSpi_SendAsync(pbyData, wLength);
+    } else {
+        ucg_com_SendString(ucg, wLength, pbyData);
+    }
+}
+
+/* END FILE */
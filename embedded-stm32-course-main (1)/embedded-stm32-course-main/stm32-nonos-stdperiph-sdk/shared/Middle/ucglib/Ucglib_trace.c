@@ -0,0 +1,403 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Recorder of ucglib com messages. Every message to com_cb is
+ *              stored in a trace and counted in the section marked by the
+ *              application (UCG_TRACE), the trace is dumped as hex text for
+ *              tools/ucg_trace_replay
+ *
+ *              Record:
+ *                0       UCG_COM_MSG_xxx, or UCG_TRACE_MARK
+ *                1, 2    arg, little endian
+ *                3       data: SEND_STR arg bytes, REPEAT_n_BYTES n bytes,
+ *                        SEND_CD_DATA_SEQUENCE 2 x arg bytes, mark arg
+ *                        characters of section name
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include "utilities.h"
+#include "Ucglib.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#ifndef UCG_TRACE_SIZE
+#define UCG_TRACE_SIZE                      4096u
+#endif
+
+/* Write index of the buffer is 16-bit */
+#if UCG_TRACE_SIZE > 65535u
+#error "UCG_TRACE_SIZE must be at most 65535"
+#endif
+
+#define UCG_TRACE_MARK                      0x80
+#define UCG_TRACE_HEADER_SIZE               3u
+#define UCG_TRACE_NAME_MAX                  32u
+#define UCG_TRACE_DUMP_LINE                 32u     /* Bytes per line of dump */
+
+/* Section 0 takes messages out of any section */
+#define UCG_TRACE_OTHER                     0
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+static ucg_com_fnptr g_pComCb;
+
+static uint8_t g_pbyTrace[UCG_TRACE_SIZE];
+static uint16_t g_wLength;
+static uint8_t g_bOverflow;
+
+static ucg_trace_section_t g_pSection[UCG_TRACE_SECTION_MAX];
+static uint8_t g_bySectionCount;
+static uint8_t g_byCurrent;
+
+/* CD line, 0 while command bytes are sent */
+static uint8_t g_byCd = 1;
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static void UcgTrace_Record(uint8_t byMsg, uint16_t wArg, const uint8_t *pbyData, uint16_t wLength);
+static void UcgTrace_Count(int16_t msg, uint16_t arg, const uint8_t *data);
+static uint8_t UcgTrace_IsName(const char *pName, const char *pOther);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func   ucg_trace_Attach
+ * @brief  Record com messages of ucg from now, trace and sections are
+ *         cleared. Transfers are not on DMA while recording
+ * @param  ucg: ucg
+ * @retval None
+ */
+void
+ucg_trace_Attach(
+    ucg_t *ucg
+) {
+    if (ucg->com_cb == ucg_com_trace) {
+        return;
+    }
+
+    g_pComCb = ucg->com_cb;
+    ucg->com_cb = ucg_com_trace;
+    ucg_trace_Clear();
+}
+
+/**
+ * @func   ucg_trace_Detach
+ * @brief  Stop recording, trace is kept for ucg_trace_Dump
+ * @param  ucg: ucg
+ * @retval None
+ */
+void
+ucg_trace_Detach(
+    ucg_t *ucg
+) {
+    if (ucg->com_cb == ucg_com_trace) {
+        ucg->com_cb = g_pComCb;
+    }
+}
+
+/**
+ * @func   ucg_trace_Clear
+ * @brief  Clear trace and sections
+ * @param  None
+ * @retval None
+ */
+void
+ucg_trace_Clear(void)
+{
+    g_wLength = 0;
+    g_bOverflow = 0;
+    memsetl((uint8_t *)g_pSection, 0, sizeof(g_pSection));
+    g_pSection[UCG_TRACE_OTHER].pName = "other";
+    g_bySectionCount = 1;
+    g_byCurrent = UCG_TRACE_OTHER;
+}
+
+/**
+ * @func   ucg_trace_Mark
+ * @brief  Count next messages in a section, e.g. name of the ucg_Draw* call.
+ *         Sections are found by name, up to UCG_TRACE_SECTION_MAX - 1 of
+ *         them, later ones are counted in "other". Only messages sent
+ *         before the section ends are counted: ucg_DrawString of the
+ *         library is drawn later by a timer task, mark it in that task or
+ *         trace ucg_DrawStringCached
+ * @param  pName: name of section, stays valid. NULL ends the section
+ * @retval None
+ */
+void
+ucg_trace_Mark(
+    const char *pName
+) {
+    uint16_t wLength;
+    uint8_t i;
+
+    g_byCurrent = UCG_TRACE_OTHER;
+    if (pName == NULL) {
+        UcgTrace_Record(UCG_TRACE_MARK, 0, NULL, 0);
+        return;
+    }
+
+    for (i = 1; i < g_bySectionCount; i++) {
+        if (UcgTrace_IsName(g_pSection[i].pName, pName)) {
+            break;
+        }
+    }
+
+    if (i == g_bySectionCount) {
+        if (g_bySectionCount >= UCG_TRACE_SECTION_MAX) {
+            UcgTrace_Record(UCG_TRACE_MARK, 0, NULL, 0);
+            return;
+        }
+        g_pSection[i].pName = pName;
+        g_bySectionCount++;
+    }
+
+    g_byCurrent = i;
+    g_pSection[i].dwCount++;
+
+    /* Name in trace is cut to UCG_TRACE_NAME_MAX characters */
+    wLength = 0;
+    while ((wLength < UCG_TRACE_NAME_MAX) && (pName[wLength] != '\0')) {
+        wLength++;
+    }
+    UcgTrace_Record(UCG_TRACE_MARK, wLength, (const uint8_t *)pName, wLength);
+}
+
+/**
+ * @func   ucg_trace_GetSection
+ * @brief  Counters of a section
+ * @param  byIndex: 0 - number of sections - 1, section 0 is "other"
+ * @param  pSection: counters, dwMicroSec is time of bytes at
+ *         UCG_TRACE_SPI_HZ
+ * @retval 0 if there is no such section
+ */
+uint8_t
+ucg_trace_GetSection(
+    uint8_t byIndex,
+    ucg_trace_section_p pSection
+) {
+    if (byIndex >= g_bySectionCount) {
+        return 0;
+    }
+
+    *pSection = g_pSection[byIndex];
+    pSection->dwMicroSec = (uint32_t)(((uint64_t)(pSection->dwCmdBytes + pSection->dwDataBytes) *
+                                       8 * 1000000u) / UCG_TRACE_SPI_HZ);
+
+    return 1;
+}
+
+/**
+ * @func   ucg_trace_Dump
+ * @brief  Write trace as hex text, input of tools/ucg_trace_replay
+ * @param  pWrite: output, e.g. a UART
+ * @retval None
+ */
+void
+ucg_trace_Dump(
+    ucg_trace_write_fnptr pWrite
+) {
+    static const char pHex[] = "0123456789ABCDEF";
+    char pLine[UCG_TRACE_DUMP_LINE * 3 + 1];
+    uint16_t wPos;
+    uint8_t byCol;
+
+    pWrite(g_bOverflow ? "# ucg trace, overflow\n" : "# ucg trace\n");
+
+    for (wPos = 0; wPos < g_wLength; wPos += UCG_TRACE_DUMP_LINE) {
+        for (byCol = 0; (byCol < UCG_TRACE_DUMP_LINE) && (wPos + byCol < g_wLength); byCol++) {
+            pLine[byCol * 3] = pHex[g_pbyTrace[wPos + byCol] >> 4];
+            pLine[byCol * 3 + 1] = pHex[g_pbyTrace[wPos + byCol] & 0x0F];
+            pLine[byCol * 3 + 2] = ' ';
+        }
+        pLine[byCol * 3 - 1] = '\n';
+        pLine[byCol * 3] = '\0';
+        pWrite(pLine);
+    }
+}
+
+/**
+ * @func   ucg_com_trace
+ * @brief  com_cb while recording: store and count message, then pass it to
+ *         com_cb of panel
+ * @param  ucg: ucg
+ * @param  msg: UCG_COM_MSG_xxx
+ * @param  arg: argument of message
+ * @param  data: data of message
+ * @retval Result of com_cb of panel
+ */
+int16_t
+ucg_com_trace(
+    ucg_t *ucg,
+    int16_t msg,
+    uint16_t arg,
+    uint8_t *data
+) {
+    uint16_t wLength = 0;
+
+    switch (msg) {
+    case UCG_COM_MSG_REPEAT_1_BYTE:
+    case UCG_COM_MSG_REPEAT_2_BYTES:
+    case UCG_COM_MSG_REPEAT_3_BYTES:
+        wLength = (uint16_t)(msg - UCG_COM_MSG_REPEAT_1_BYTE + 1);
+        break;
+
+    case UCG_COM_MSG_SEND_STR:
+        wLength = arg;
+        break;
+
+    case UCG_COM_MSG_SEND_CD_DATA_SEQUENCE:
+        wLength = (uint16_t)(arg * 2);
+        break;
+
+    default:
+        break;
+    }
+
+    UcgTrace_Record((uint8_t)msg, arg, data, wLength);
+    UcgTrace_Count(msg, arg, data);
+
+    return g_pComCb(ucg, msg, arg, data);
+}
+
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+/**
+ * @func   UcgTrace_Record
+ * @brief  Append a record, recording stops at the first one not fitting
+ * @param  byMsg: message
+ * @param  wArg: argument
+ * @param  pbyData: data
+ * @param  wLength: number of data bytes
+ * @retval None
+ */
+static void
+UcgTrace_Record(
+    uint8_t byMsg,
+    uint16_t wArg,
+    const uint8_t *pbyData,
+    uint16_t wLength
+) {
+    if (g_bOverflow || (g_wLength + UCG_TRACE_HEADER_SIZE + wLength > UCG_TRACE_SIZE)) {
+        g_bOverflow = 1;
+        return;
+    }
+
+    g_pbyTrace[g_wLength++] = byMsg;
+    g_pbyTrace[g_wLength++] = (uint8_t)wArg;
+    g_pbyTrace[g_wLength++] = (uint8_t)(wArg >> 8);
+    if (wLength > 0) {
+        memcpyl(&g_pbyTrace[g_wLength], (uint8_t *)pbyData, wLength);
+        g_wLength += wLength;
+    }
+}
+
+/**
+ * @func   UcgTrace_Count
+ * @brief  Count bytes on the wire and CS toggles in current section
+ * @param  msg: UCG_COM_MSG_xxx
+ * @param  arg: argument of message
+ * @param  data: data of message
+ * @retval None
+ */
+static void
+UcgTrace_Count(
+    int16_t msg,
+    uint16_t arg,
+    const uint8_t *data
+) {
+    ucg_trace_section_p pSection = &g_pSection[g_byCurrent];
+    uint32_t dwBytes = 0;
+    uint16_t i;
+
+    pSection->dwMessages++;
+
+    switch (msg) {
+    case UCG_COM_MSG_CHANGE_CS_LINE:
+        pSection->dwCsToggles++;
+        return;
+
+    case UCG_COM_MSG_CHANGE_CD_LINE:
+        g_byCd = (uint8_t)arg;
+        return;
+
+    case UCG_COM_MSG_SEND_BYTE:
+        dwBytes = 1;
+        break;
+
+    case UCG_COM_MSG_REPEAT_1_BYTE:
+    case UCG_COM_MSG_REPEAT_2_BYTES:
+    case UCG_COM_MSG_REPEAT_3_BYTES:
+        dwBytes = (uint32_t)arg * (uint32_t)(msg - UCG_COM_MSG_REPEAT_1_BYTE + 1);
+        break;
+
+    case UCG_COM_MSG_SEND_STR:
+        dwBytes = arg;
+        break;
+
+    case UCG_COM_MSG_SEND_CD_DATA_SEQUENCE:
+        /* Pairs of CD change (0 none, 1 command, 2 data) and byte */
+        for (i = 0; i < arg; i++) {
+            if (data[i * 2] != 0) {
+                g_byCd = (data[i * 2] == 1) ? 0 : 1;
+            }
+            if (g_byCd == 0) {
+                pSection->dwCmdBytes++;
+            } else {
+                pSection->dwDataBytes++;
+            }
+        }
+        return;
+
+    default:
+        return;
+    }
+
+    if (g_byCd == 0) {
+        pSection->dwCmdBytes += dwBytes;
+    } else {
+        pSection->dwDataBytes += dwBytes;
+    }
+}
+
+/**
+ * @func   UcgTrace_IsName
+ * @brief  Compare names of sections
+ * @param  pName, pOther: names
+ * @retval 1 if same text
+ */
+static uint8_t
+UcgTrace_IsName(
+    const char *pName,
+    const char *pOther
+) {
+    if (pName == pOther) {
+        return 1;
+    }
+
+    while ((*pName != '\0') && (*pName == *pOther)) {
+        pName++;
+        pOther++;
+    }
+
+    return *pName == *pOther;
+}
+
+/* END FILE */
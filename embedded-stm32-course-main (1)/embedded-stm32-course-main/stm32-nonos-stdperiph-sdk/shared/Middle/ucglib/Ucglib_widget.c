@@ -0,0 +1,724 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Retained widgets over ucglib. Each widget keeps its box and
+ *              what is on screen, ucg_widget_Draw only sends the pixels that
+ *              changed since last draw
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include "utilities.h"
+#include "Ucglib.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define UCG_WIDGET_COLOR_FG                 UCG_COLUMN_COLOR_FG
+#define UCG_WIDGET_COLOR_BG                 UCG_COLUMN_COLOR_BG
+
+/* Column of sparkline with nothing drawn */
+#define UCG_WIDGET_SPARK_EMPTY              UCG_COLUMN_EMPTY
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+static ucg_widget_stat_t g_stat;
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static void UcgWidget_FormatValue(ucg_widget_p pWidget);
+static void UcgWidget_SetColor(ucg_t *ucg, ucg_widget_p pWidget, uint8_t byColor);
+static void UcgWidget_Box(ucg_t *ucg, ucg_widget_p pWidget, uint8_t byColor, ucg_int_t x, ucg_int_t y, ucg_int_t w, ucg_int_t h);
+static void UcgWidget_DrawText(ucg_t *ucg, ucg_widget_p pWidget, uint8_t bFull);
+static void UcgWidget_DrawBar(ucg_t *ucg, ucg_widget_p pWidget, uint8_t bFull);
+static void UcgWidget_DrawIcon(ucg_t *ucg, ucg_widget_p pWidget, uint8_t bFull);
+static void UcgWidget_DrawSparkline(ucg_t *ucg, ucg_widget_p pWidget, uint8_t bFull);
+static void UcgWidget_VLine(ucg_t *ucg, void *data, uint8_t byColor, ucg_int_t x, ucg_int_t y, ucg_int_t len);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func   ucg_widget_Init
+ * @brief  Initialize a widget, white on black, drawn in full by next draw
+ * @param  pWidget: widget
+ * @param  byType: UCG_WIDGET_xxx
+ * @param  x, y: upper left of box
+ * @param  w, h: size of box
+ * @retval None
+ */
+void
+ucg_widget_Init(
+    ucg_widget_p pWidget,
+    uint8_t byType,
+    ucg_int_t x,
+    ucg_int_t y,
+    ucg_int_t w,
+    ucg_int_t h
+) {
+    memsetl((uint8_t *)pWidget, 0, sizeof(ucg_widget_t));
+
+    pWidget->byType = byType;
+    pWidget->x = x;
+    pWidget->y = y;
+    pWidget->w = w;
+    pWidget->h = h;
+    memsetl(pWidget->pbyColor[UCG_WIDGET_COLOR_FG], 0xFF, 3);
+
+    if (byType == UCG_WIDGET_BAR) {
+        pWidget->u.bar.iMax = 100;
+    } else if (byType == UCG_WIDGET_SPARKLINE) {
+        pWidget->u.spark.iMax = 100;
+    }
+}
+
+/**
+ * @func   ucg_widget_SetFont
+ * @brief  Font of label and value
+ * @param  pWidget: widget
+ * @param  pFont: ucglib font
+ * @retval None
+ */
+void
+ucg_widget_SetFont(
+    ucg_widget_p pWidget,
+    const ucg_fntpgm_uint8_t *pFont
+) {
+    if (pWidget->pFont != pFont) {
+        pWidget->pFont = pFont;
+        pWidget->bDrawn = 0;
+    }
+}
+
+/**
+ * @func   ucg_widget_SetColor
+ * @brief  Foreground or background color, widget is drawn again in full
+ *         if it changes
+ * @param  pWidget: widget
+ * @param  byIndex: 0 foreground, 1 background
+ * @param  r, g, b: color
+ * @retval None
+ */
+void
+ucg_widget_SetColor(
+    ucg_widget_p pWidget,
+    uint8_t byIndex,
+    uint8_t r,
+    uint8_t g,
+    uint8_t b
+) {
+    uint8_t *pbyColor = pWidget->pbyColor[byIndex & 0x01];
+
+    if ((pbyColor[0] != r) || (pbyColor[1] != g) || (pbyColor[2] != b)) {
+        pbyColor[0] = r;
+        pbyColor[1] = g;
+        pbyColor[2] = b;
+        pWidget->bDrawn = 0;
+    }
+}
+
+/**
+ * @func   ucg_widget_SetText
+ * @brief  Text of label, up to UCG_WIDGET_TEXT_SIZE - 1 characters (text of
+ *         cmd_lcd_display_t fits), longer text is cut
+ * @param  pWidget: label
+ * @param  pText: text
+ * @retval None
+ */
+void
+ucg_widget_SetText(
+    ucg_widget_p pWidget,
+    const char *pText
+) {
+    uint8_t byLength = 0;
+
+    while ((pText[byLength] != '\0') && (byLength < UCG_WIDGET_TEXT_SIZE - 1)) {
+        pWidget->u.text.pText[byLength] = pText[byLength];
+        byLength++;
+    }
+    pWidget->u.text.pText[byLength] = '\0';
+}
+
+/**
+ * @func   ucg_widget_SetFormat
+ * @brief  Format of numeric value
+ * @param  pWidget: value
+ * @param  byDecimals: digits after decimal point, value 1234 with 2
+ *         decimals is shown as 12.34, up to UCG_WIDGET_DECIMALS_MAX
+ * @param  pUnit: text after number, NULL if none, cut to fit the text
+ * @retval None
+ */
+void
+ucg_widget_SetFormat(
+    ucg_widget_p pWidget,
+    uint8_t byDecimals,
+    const char *pUnit
+) {
+    if (byDecimals > UCG_WIDGET_DECIMALS_MAX) {
+        byDecimals = UCG_WIDGET_DECIMALS_MAX;
+    }
+
+    pWidget->u.text.byDecimals = byDecimals;
+    pWidget->u.text.pUnit = pUnit;
+    UcgWidget_FormatValue(pWidget);
+}
+
+/**
+ * @func   ucg_widget_SetValue
+ * @brief  Value of numeric value or bar gauge
+ * @param  pWidget: value or bar
+ * @param  iValue: value
+ * @retval None
+ */
+void
+ucg_widget_SetValue(
+    ucg_widget_p pWidget,
+    int32_t iValue
+) {
+    if (pWidget->byType == UCG_WIDGET_BAR) {
+        pWidget->u.bar.iValue = iValue;
+    } else {
+        pWidget->u.text.iValue = iValue;
+        UcgWidget_FormatValue(pWidget);
+    }
+}
+
+/**
+ * @func   ucg_widget_SetRange
+ * @brief  Range of bar gauge or sparkline, default 0 - 100
+ * @param  pWidget: bar or sparkline
+ * @param  iMin, iMax: range, iMax > iMin
+ * @retval None
+ */
+void
+ucg_widget_SetRange(
+    ucg_widget_p pWidget,
+    int32_t iMin,
+    int32_t iMax
+) {
+    if (pWidget->byType == UCG_WIDGET_BAR) {
+        pWidget->u.bar.iMin = iMin;
+        pWidget->u.bar.iMax = iMax;
+    } else {
+        pWidget->u.spark.iMin = (int16_t)iMin;
+        pWidget->u.spark.iMax = (int16_t)iMax;
+    }
+}
+
+/**
+ * @func   ucg_widget_SetImage
+ * @brief  Image of icon, data of ucg_DrawImage
+ * @param  pWidget: icon
+ * @param  pbyImage: image, NULL for none
+ * @retval None
+ */
+void
+ucg_widget_SetImage(
+    ucg_widget_p pWidget,
+    const uint8_t *pbyImage
+) {
+    pWidget->u.icon.pbyImage = pbyImage;
+}
+
+/**
+ * @func   ucg_widget_AddSample
+ * @brief  Add a sample to sparkline, oldest sample is dropped when full
+ * @param  pWidget: sparkline
+ * @param  iSample: sample
+ * @retval None
+ */
+void
+ucg_widget_AddSample(
+    ucg_widget_p pWidget,
+    int16_t iSample
+) {
+    ucg_widget_spark_p pSpark = &pWidget->u.spark;
+    uint8_t byColumns = (pWidget->w < UCG_WIDGET_SPARK_MAX) ? (uint8_t)pWidget->w : UCG_WIDGET_SPARK_MAX;
+
+    pSpark->piSample[pSpark->byHead] = iSample;
+    pSpark->byHead = (uint8_t)((pSpark->byHead + 1) % UCG_WIDGET_SPARK_MAX);
+    if (pSpark->byCount < byColumns) {
+        pSpark->byCount++;
+    }
+    pSpark->bChanged = 1;
+}
+
+/**
+ * @func   ucg_widget_Invalidate
+ * @brief  Draw widget again in full by next draw, e.g. after screen is
+ *         cleared
+ * @param  pWidget: widget
+ * @retval None
+ */
+void
+ucg_widget_Invalidate(
+    ucg_widget_p pWidget
+) {
+    pWidget->bDrawn = 0;
+}
+
+/**
+ * @func   ucg_widget_Draw
+ * @brief  Send what changed since last draw. Colors 0, 1, font, font mode
+ *         and clip range of ucg are changed
+ * @param  ucg: ucg
+ * @param  pWidget: widget
+ * @retval None
+ */
+void
+ucg_widget_Draw(
+    ucg_t *ucg,
+    ucg_widget_p pWidget
+) {
+    uint8_t bFull = !pWidget->bDrawn;
+    uint32_t dwSent = g_stat.dwPixelSent;
+
+    if (bFull) {
+        UcgWidget_Box(ucg, pWidget, UCG_WIDGET_COLOR_BG, pWidget->x, pWidget->y,
+                      pWidget->w, pWidget->h);
+    }
+
+    ucg_SetClipRange(ucg, pWidget->x, pWidget->y, pWidget->w, pWidget->h);
+
+    switch (pWidget->byType) {
+    case UCG_WIDGET_LABEL:
+    case UCG_WIDGET_VALUE:
+        UcgWidget_DrawText(ucg, pWidget, bFull);
+        break;
+
+    case UCG_WIDGET_BAR:
+        UcgWidget_DrawBar(ucg, pWidget, bFull);
+        break;
+
+    case UCG_WIDGET_ICON:
+        UcgWidget_DrawIcon(ucg, pWidget, bFull);
+        break;
+
+    case UCG_WIDGET_SPARKLINE:
+        UcgWidget_DrawSparkline(ucg, pWidget, bFull);
+        break;
+
+    default:
+        break;
+    }
+
+    ucg_SetMaxClipRange(ucg);
+    pWidget->bDrawn = 1;
+
+    /* Naive redraw sends the whole box on each change */
+    if (g_stat.dwPixelSent != dwSent) {
+        g_stat.dwPixelFull += (uint32_t)pWidget->w * pWidget->h;
+        g_stat.dwRedraw++;
+    }
+}
+
+/**
+ * @func   ucg_widget_DrawAll
+ * @brief  Draw widgets of an array
+ * @param  ucg: ucg
+ * @param  pWidget: widgets
+ * @param  byCount: number of widgets
+ * @retval None
+ */
+void
+ucg_widget_DrawAll(
+    ucg_t *ucg,
+    ucg_widget_p pWidget,
+    uint8_t byCount
+) {
+    uint8_t i;
+
+    for (i = 0; i < byCount; i++) {
+        ucg_widget_Draw(ucg, &pWidget[i]);
+    }
+}
+
+/**
+ * @func   ucg_widget_GetStatistic
+ * @brief  Pixels sent by widgets and by a full redraw of the same changes
+ * @param  pStat: statistic
+ * @retval None
+ */
+void
+ucg_widget_GetStatistic(
+    ucg_widget_stat_p pStat
+) {
+    *pStat = g_stat;
+}
+
+/**
+ * @func   ucg_widget_ResetStatistic
+ * @brief  Clear statistic
+ * @param  None
+ * @retval None
+ */
+void
+ucg_widget_ResetStatistic(void)
+{
+    memsetl((uint8_t *)&g_stat, 0, sizeof(g_stat));
+}
+
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+/**
+ * @func   UcgWidget_FormatValue
+ * @brief  Make text of numeric value, unit is cut to fit the text
+ * @param  pWidget: value
+ * @retval None
+ */
+static void
+UcgWidget_FormatValue(
+    ucg_widget_p pWidget
+) {
+    /* 10 digits of 32 bits, 1 more for leading 0 of UCG_WIDGET_DECIMALS_MAX */
+    char pDigit[12];
+    char *pText = pWidget->u.text.pText;
+    uint32_t dwValue;
+    uint8_t byDecimals = pWidget->u.text.byDecimals;
+    uint8_t byDigits = 0;
+    uint8_t byLength = 0;
+    const char *pUnit = pWidget->u.text.pUnit;
+
+    if (byDecimals > UCG_WIDGET_DECIMALS_MAX) {
+        byDecimals = UCG_WIDGET_DECIMALS_MAX;
+    }
+
+    /* Magnitude of INT32_MIN fits, negate in unsigned */
+    dwValue = (pWidget->u.text.iValue < 0) ? 0u - (uint32_t)pWidget->u.text.iValue :
+                                             (uint32_t)pWidget->u.text.iValue;
+
+    /* Digits from lowest, at least one before decimal point */
+    do {
+        pDigit[byDigits++] = (char)('0' + dwValue % 10);
+        dwValue /= 10;
+    } while ((dwValue != 0) || (byDigits <= byDecimals));
+
+    if (pWidget->u.text.iValue < 0) {
+        pText[byLength++] = '-';
+    }
+
+    /* Room for decimal point and digit */
+    while ((byDigits > 0) && (byLength < UCG_WIDGET_TEXT_SIZE - 2)) {
+        if (byDigits == byDecimals) {
+            pText[byLength++] = '.';
+        }
+        pText[byLength++] = pDigit[--byDigits];
+    }
+
+    while ((pUnit != NULL) && (*pUnit != '\0') && (byLength < UCG_WIDGET_TEXT_SIZE - 1)) {
+        pText[byLength++] = *pUnit++;
+    }
+
+    pText[byLength] = '\0';
+}
+
+/**
+ * @func   UcgWidget_SetColor
+ * @brief  Set color 0 of ucg to a color of widget
+ * @param  ucg: ucg
+ * @param  pWidget: widget
+ * @param  byColor: UCG_WIDGET_COLOR_xxx
+ * @retval None
+ */
+static void
+UcgWidget_SetColor(
+    ucg_t *ucg,
+    ucg_widget_p pWidget,
+    uint8_t byColor
+) {
+    uint8_t *pbyColor = pWidget->pbyColor[byColor];
+
+    ucg_SetColor(ucg, 0, pbyColor[0], pbyColor[1], pbyColor[2]);
+}
+
+/**
+ * @func   UcgWidget_Box
+ * @brief  Fill a box in a color of widget, counted in statistic
+ * @param  ucg: ucg
+ * @param  pWidget: widget
+ * @param  byColor: UCG_WIDGET_COLOR_xxx
+ * @param  x, y: upper left
+ * @param  w, h: size
+ * @retval None
+ */
+static void
+UcgWidget_Box(
+    ucg_t *ucg,
+    ucg_widget_p pWidget,
+    uint8_t byColor,
+    ucg_int_t x,
+    ucg_int_t y,
+    ucg_int_t w,
+    ucg_int_t h
+) {
+    if ((w <= 0) || (h <= 0)) {
+        return;
+    }
+
+    UcgWidget_SetColor(ucg, pWidget, byColor);
+    ucg_DrawBox(ucg, x, y, w, h);
+    g_stat.dwPixelSent += (uint32_t)w * h;
+}
+
+/**
+ * @func   UcgWidget_DrawText
+ * @brief  Characters before the first changed one stay on screen. From it,
+ *         old text is erased up to its width and new text is drawn
+ * @param  ucg: ucg
+ * @param  pWidget: label or value
+ * @param  bFull: box was just cleared
+ * @retval None
+ */
+static void
+UcgWidget_DrawText(
+    ucg_t *ucg,
+    ucg_widget_p pWidget,
+    uint8_t bFull
+) {
+    char *pText = pWidget->u.text.pText;
+    char *pDrawn = pWidget->u.text.pDrawn;
+    ucg_int_t iPrefix = 0;
+    ucg_int_t iWidth;
+    uint8_t i = 0;
+
+    if (pWidget->pFont == NULL) {
+        return;
+    }
+
+    if (bFull) {
+        pDrawn[0] = '\0';
+        pWidget->u.text.iDrawnWidth = 0;
+    }
+
+    ucg_SetFont(ucg, pWidget->pFont);
+
+    /* Same characters at start are at same place, also in proportional fonts */
+    while ((pText[i] != '\0') && (pText[i] == pDrawn[i])) {
+        iPrefix += ucg_GetGlyphWidth(ucg, (uint8_t)pText[i]);
+        i++;
+    }
+
+    if ((pText[i] == '\0') && (pDrawn[i] == '\0')) {
+        return;
+    }
+
+    iWidth = iPrefix;
+    while (pText[i] != '\0') {
+        iWidth += ucg_GetGlyphWidth(ucg, (uint8_t)pText[i]);
+        i++;
+    }
+
+    /* Old characters from first change */
+    UcgWidget_Box(ucg, pWidget, UCG_WIDGET_COLOR_BG, pWidget->x + iPrefix, pWidget->y,
+                  pWidget->u.text.iDrawnWidth - iPrefix, pWidget->h);
+
+    i = 0;
+    while ((pText[i] != '\0') && (pText[i] == pDrawn[i])) {
+        i++;
+    }
+
+    UcgWidget_SetColor(ucg, pWidget, UCG_WIDGET_COLOR_FG);
+    ucg_SetFontMode(ucg, UCG_FONT_MODE_TRANSPARENT);
+    ucg_SetFontPosBaseline(ucg);
+    ucg_DrawStringCached(ucg, pWidget->x + iPrefix, pWidget->y + ucg_GetFontAscent(ucg), 0, &pText[i]);
+
+    /* Glyphs are counted as their cells */
+    if (iWidth > iPrefix) {
+        g_stat.dwPixelSent += (uint32_t)(iWidth - iPrefix) * ucg->font_info.max_char_height;
+    }
+
+    /* Drawn text matches up to first change */
+    while (pText[i] != '\0') {
+        pDrawn[i] = pText[i];
+        i++;
+    }
+    pDrawn[i] = '\0';
+    pWidget->u.text.iDrawnWidth = iWidth;
+}
+
+/**
+ * @func   UcgWidget_DrawBar
+ * @brief  Frame and horizontal fill, only the part between old and new
+ *         fill is drawn
+ * @param  ucg: ucg
+ * @param  pWidget: bar
+ * @param  bFull: box was just cleared
+ * @retval None
+ */
+static void
+UcgWidget_DrawBar(
+    ucg_t *ucg,
+    ucg_widget_p pWidget,
+    uint8_t bFull
+) {
+    ucg_widget_bar_p pBar = &pWidget->u.bar;
+    ucg_int_t iInner = pWidget->w - 2;
+    ucg_int_t iFill;
+    int32_t iValue = pBar->iValue;
+
+    if ((iInner <= 0) || (pWidget->h <= 2) || (pBar->iMax <= pBar->iMin)) {
+        return;
+    }
+
+    if (iValue < pBar->iMin) iValue = pBar->iMin;
+    if (iValue > pBar->iMax) iValue = pBar->iMax;
+    iFill = (ucg_int_t)(((int64_t)(iValue - pBar->iMin) * iInner) / (pBar->iMax - pBar->iMin));
+
+    if (bFull) {
+        UcgWidget_SetColor(ucg, pWidget, UCG_WIDGET_COLOR_FG);
+        ucg_DrawFrame(ucg, pWidget->x, pWidget->y, pWidget->w, pWidget->h);
+        g_stat.dwPixelSent += 2 * ((uint32_t)pWidget->w + pWidget->h);
+        pBar->iDrawnFill = 0;
+    }
+
+    if (iFill > pBar->iDrawnFill) {
+        UcgWidget_Box(ucg, pWidget, UCG_WIDGET_COLOR_FG, pWidget->x + 1 + pBar->iDrawnFill,
+                      pWidget->y + 1, iFill - pBar->iDrawnFill, pWidget->h - 2);
+    } else if (iFill < pBar->iDrawnFill) {
+        UcgWidget_Box(ucg, pWidget, UCG_WIDGET_COLOR_BG, pWidget->x + 1 + iFill,
+                      pWidget->y + 1, pBar->iDrawnFill - iFill, pWidget->h - 2);
+    }
+
+    pBar->iDrawnFill = iFill;
+}
+
+/**
+ * @func   UcgWidget_DrawIcon
+ * @brief  Draw image when it changes, box is erased first if the image does
+ *         not cover it
+ * @param  ucg: ucg
+ * @param  pWidget: icon
+ * @param  bFull: box was just cleared
+ * @retval None
+ */
+static void
+UcgWidget_DrawIcon(
+    ucg_t *ucg,
+    ucg_widget_p pWidget,
+    uint8_t bFull
+) {
+    const uint8_t *pbyImage = pWidget->u.icon.pbyImage;
+
+    if (!bFull && (pbyImage == pWidget->u.icon.pbyDrawn)) {
+        return;
+    }
+
+    if (!bFull && ((pbyImage == NULL) ||
+                   (ucg_GetImageWidth(pbyImage) < pWidget->w) ||
+                   (ucg_GetImageHeight(pbyImage) < pWidget->h) ||
+                   (ucg_GetImageFlags(pbyImage) & UCG_IMAGE_FLAG_TRANSPARENT))) {
+        UcgWidget_Box(ucg, pWidget, UCG_WIDGET_COLOR_BG, pWidget->x, pWidget->y,
+                      pWidget->w, pWidget->h);
+    }
+
+    if (pbyImage != NULL) {
+        ucg_DrawImage(ucg, pWidget->x, pWidget->y, pbyImage);
+        g_stat.dwPixelSent += (uint32_t)ucg_GetImageWidth(pbyImage) * ucg_GetImageHeight(pbyImage);
+    }
+
+    pWidget->u.icon.pbyDrawn = pbyImage;
+}
+
+/**
+ * @func   UcgWidget_DrawSparkline
+ * @brief  One column per sample, newest at right. A column is a vertical
+ *         line from previous sample to its sample, only the rows that
+ *         differ from the column on screen are drawn
+ * @param  ucg: ucg
+ * @param  pWidget: sparkline
+ * @param  bFull: box was just cleared
+ * @retval None
+ */
+static void
+UcgWidget_DrawSparkline(
+    ucg_t *ucg,
+    ucg_widget_p pWidget,
+    uint8_t bFull
+) {
+    ucg_widget_spark_p pSpark = &pWidget->u.spark;
+    uint8_t byColumns = (pWidget->w < UCG_WIDGET_SPARK_MAX) ? (uint8_t)pWidget->w : UCG_WIDGET_SPARK_MAX;
+    uint8_t byFirst = (uint8_t)(byColumns - pSpark->byCount);
+    uint8_t byIndex;
+    uint8_t byTop;
+    uint8_t byBottom;
+    uint8_t byPrev = 0;
+    uint8_t byRow;
+    uint8_t i;
+    int32_t iSample;
+
+    if (bFull) {
+        memsetl(pSpark->pbyTop, UCG_WIDGET_SPARK_EMPTY, UCG_WIDGET_SPARK_MAX);
+    } else if (!pSpark->bChanged) {
+        return;
+    }
+    pSpark->bChanged = 0;
+
+    if ((pWidget->h <= 0) || (pWidget->h > UCG_WIDGET_SPARK_EMPTY) ||
+        (pSpark->iMax <= pSpark->iMin)) {
+        return;
+    }
+
+    for (i = 0; i < byColumns; i++) {
+        byTop = UCG_WIDGET_SPARK_EMPTY;
+        byBottom = 0;
+
+        if (i >= byFirst) {
+            byIndex = (uint8_t)((pSpark->byHead + UCG_WIDGET_SPARK_MAX - byColumns + i) %
+                                UCG_WIDGET_SPARK_MAX);
+            iSample = pSpark->piSample[byIndex];
+            if (iSample < pSpark->iMin) iSample = pSpark->iMin;
+            if (iSample > pSpark->iMax) iSample = pSpark->iMax;
+            byRow = (uint8_t)(pWidget->h - 1 - ((iSample - pSpark->iMin) * (pWidget->h - 1)) /
+                                               (pSpark->iMax - pSpark->iMin));
+
+            if (i == byFirst) {
+                byPrev = byRow;
+            }
+            byTop = (byRow < byPrev) ? byRow : byPrev;
+            byBottom = (byRow < byPrev) ? byPrev : byRow;
+            byPrev = byRow;
+        }
+
+        ucg_DrawColumnDiff(ucg, pWidget->x + i, pWidget->y, &pSpark->pbyTop[i], &pSpark->pbyBottom[i],
+                           byTop, byBottom, UcgWidget_VLine, pWidget);
+    }
+}
+
+/**
+ * @func   UcgWidget_VLine
+ * @brief  Column line of a sparkline in a color of widget
+ * @param  ucg: ucg
+ * @param  data: widget
+ * @param  byColor: UCG_WIDGET_COLOR_xxx
+ * @param  x, y: top
+ * @param  len: length, nothing drawn if not positive
+ * @retval None
+ */
+static void
+UcgWidget_VLine(
+    ucg_t *ucg,
+    void *data,
+    uint8_t byColor,
+    ucg_int_t x,
+    ucg_int_t y,
+    ucg_int_t len
+) {
+    UcgWidget_Box(ucg, (ucg_widget_p)data, byColor, x, y, 1, len);
+}
+
+/* END FILE */
@@ -0,0 +1,281 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Host test of buttons woken by EXTI (Middle/button/
+ *              buttonexti.c): scripted presses with 3 ms of bounce on the
+ *              GPIO and EXTI models, events of presses, holds and edges,
+ *              wake ups per second while idle, latency and interrupt mask
+ *              kept by statistic. Built and run by ../run_host_tests.sh
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <string.h>
+#include "host.h"
+#include "stm32f401re_gpio.h"
+#include "timer.h"
+#include "buttonexti.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define TEST_LOOP_US                        1000u
+#define TEST_BOUNCE_MS                      3u
+#define TEST_LOG_SIZE                       32u
+#define TEST_IDLE_MS                        60000u
+
+/* First edge to debounced state: KEY_COUNT_IS_PRESS samples after bounce */
+#define TEST_LATENCY_MAX                    (KEY_COUNT_IS_PRESS * KEY_TIME_SCAN + TEST_BOUNCE_MS)
+
+/* Button pressed at dwStart for dwDuration ms */
+typedef struct {
+    uint32_t dwStart;
+    uint32_t dwDuration;
+    GPIO_TypeDef *pGpio;
+    uint16_t wPin;
+} test_press_t;
+
+typedef struct {
+    button_event_t event;
+    uint8_t byId;
+    uint16_t wTime;
+} test_event_t;
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+static test_event_t g_pLog[TEST_LOG_SIZE];
+static uint8_t g_byLogCount;
+static uint32_t g_dwRandom;
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+void EXTI0_IRQHandler(void);
+void EXTI3_IRQHandler(void);
+void EXTI4_IRQHandler(void);
+void EXTI9_5_IRQHandler(void);
+void EXTI15_10_IRQHandler(void);
+
+static uint8_t
+Test_ExtiPending(
+    uint32_t dwLines
+) {
+    return (EXTI->PR & EXTI->IMR & dwLines) != 0;
+}
+
+static uint8_t Test_Exti0Pending(void) { return Test_ExtiPending(0x0001u); }
+static uint8_t Test_Exti3Pending(void) { return Test_ExtiPending(0x0008u); }
+static uint8_t Test_Exti4Pending(void) { return Test_ExtiPending(0x0010u); }
+static uint8_t Test_Exti9_5Pending(void) { return Test_ExtiPending(0x03E0u); }
+static uint8_t Test_Exti15_10Pending(void) { return Test_ExtiPending(0xFC00u); }
+
+static void
+Test_Log(
+    button_event_t event,
+    uint8_t byId,
+    uint16_t wTime
+) {
+    if (g_byLogCount < TEST_LOG_SIZE) {
+        g_pLog[g_byLogCount].event = event;
+        g_pLog[g_byLogCount].byId = byId;
+        g_pLog[g_byLogCount].wTime = wTime;
+        g_byLogCount++;
+    }
+}
+
+static void Test_OnEdge(uint8_t id, uint16_t time) { Test_Log(BUTTON_EVENT_EDGE, id, time); }
+static void Test_OnPress(uint8_t id, uint16_t time) { Test_Log(BUTTON_EVENT_PRESS, id, time); }
+static void Test_OnHold(uint8_t id, uint16_t time) { Test_Log(BUTTON_EVENT_HOLD, id, time); }
+static void Test_OnRelease(uint8_t id, uint16_t time) { Test_Log(BUTTON_EVENT_RELEASE, id, time); }
+
+static void
+Test_Setup(void)
+{
+    Host_Reset();
+    Host_PeriphReset();
+    Host_TimerReset();
+    Host_RegisterIrq(Test_Exti0Pending, EXTI0_IRQHandler);
+    Host_RegisterIrq(Test_Exti3Pending, EXTI3_IRQHandler);
+    Host_RegisterIrq(Test_Exti4Pending, EXTI4_IRQHandler);
+    Host_RegisterIrq(Test_Exti9_5Pending, EXTI9_5_IRQHandler);
+    Host_RegisterIrq(Test_Exti15_10Pending, EXTI15_10_IRQHandler);
+
+    g_byLogCount = 0;
+    g_dwRandom = 1;
+
+    ButtonExti_Init();
+    ButtonExti_RegisterEventCallback(BUTTON_EVENT_EDGE, Test_OnEdge);
+    ButtonExti_RegisterEventCallback(BUTTON_EVENT_PRESS, Test_OnPress);
+    ButtonExti_RegisterEventCallback(BUTTON_EVENT_HOLD, Test_OnHold);
+    ButtonExti_RegisterEventCallback(BUTTON_EVENT_RELEASE, Test_OnRelease);
+    ButtonExti_SetMode(BUTTON_KIT_ID2, BUTTON_TYPE_LOGIC | BUTTON_TYPE_EDGE);
+}
+
+/* Level of a pin at dwMs of a press: random for TEST_BOUNCE_MS after each edge */
+static int8_t
+Test_Level(
+    const test_press_t *pPress,
+    uint32_t dwMs
+) {
+    uint32_t dwEnd = pPress->dwStart + pPress->dwDuration;
+
+    if (((dwMs >= pPress->dwStart) && (dwMs < pPress->dwStart + TEST_BOUNCE_MS)) ||
+        ((dwMs >= dwEnd) && (dwMs < dwEnd + TEST_BOUNCE_MS))) {
+        g_dwRandom = g_dwRandom * 1103515245u + 12345u;
+        return (int8_t)((g_dwRandom >> 16) & 1u);
+    }
+    if (dwMs == pPress->dwStart + TEST_BOUNCE_MS) {
+        return 0;
+    }
+    if (dwMs == dwEnd + TEST_BOUNCE_MS) {
+        return 1;
+    }
+
+    return -1;
+}
+
+/* Main loop for dwMs with presses of script, edges taken as they come */
+static void
+Test_Run(
+    const test_press_t *pPress,
+    uint8_t byPresses,
+    uint32_t dwMs
+) {
+    uint32_t dwStart = GetMilSecTick();
+    uint32_t dwNow;
+    int8_t iLevel;
+    uint8_t i;
+
+    while ((dwNow = GetMilSecTick() - dwStart) < dwMs) {
+        for (i = 0; i < byPresses; i++) {
+            iLevel = Test_Level(&pPress[i], dwNow);
+            if (iLevel >= 0) {
+                Host_GpioSetInput(pPress[i].pGpio, pPress[i].wPin, (uint8_t)iLevel);
+                Host_Poll();
+            }
+        }
+        processButtonExti();
+        processTimerScheduler();
+        Host_Advance(TEST_LOOP_US);
+    }
+}
+
+static uint8_t
+Test_Logged(
+    uint8_t byIndex,
+    button_event_t event,
+    uint8_t byId,
+    uint16_t wTime
+) {
+    return (byIndex < g_byLogCount) && (g_pLog[byIndex].event == event) &&
+           (g_pLog[byIndex].byId == byId) && (g_pLog[byIndex].wTime == wTime);
+}
+
+static void
+Test_Idle(void)
+{
+    button_stat_t stat;
+
+    Test_Setup();
+    Test_Run(NULL, 0, TEST_IDLE_MS);
+    ButtonExti_GetStatistic(&stat);
+
+    /* Only kit 4 polled, sharing line 4 with kit 2. Last poll is due at end */
+    HOST_CHECK(stat.dwWake == 0);
+    HOST_CHECK(stat.dwScan == 0);
+    HOST_CHECK(stat.dwPoll == TEST_IDLE_MS / BUTTON_EXTI_POLL_IDLE - 1u);
+    HOST_CHECK(stat.wWakeRate >= 100000u / BUTTON_EXTI_POLL_IDLE - 5u);
+    HOST_CHECK(stat.wWakeRate <= 100000u / BUTTON_EXTI_POLL_IDLE);
+    HOST_CHECK(g_byLogCount == 0);
+    HOST_CHECK(ButtonExti_IsIdle());
+    printf("  idle %u s: %u.%02u wake ups/s (polled driver %u/s)\n",
+           TEST_IDLE_MS / 1000u, stat.wWakeRate / 100u, stat.wWakeRate % 100u,
+           1000u / KEY_TIME_SCAN);
+}
+
+static void
+Test_Events(void)
+{
+    static const test_press_t pPress[] = {
+        { 100, 80, GPIOB, GPIO_Pin_5 },       /* Kit 0, twice */
+        { 300, 80, GPIOB, GPIO_Pin_5 },
+        { 2000, 120, GPIOC, GPIO_Pin_13 },    /* Board */
+        { 4000, 3500, GPIOB, GPIO_Pin_3 },    /* Kit 1 held, edge mode */
+        { 9000, 150, GPIOA, GPIO_Pin_4 },     /* Kit 2 and kit 4 on line 4 */
+        { 10000, 150, GPIOB, GPIO_Pin_4 },
+    };
+    button_stat_t stat;
+
+    Test_Setup();
+    Test_Run(pPress, sizeof(pPress) / sizeof(pPress[0]), 12000u);
+    ButtonExti_GetStatistic(&stat);
+
+    HOST_CHECK(g_byLogCount == 9);
+    HOST_CHECK(Test_Logged(0, BUTTON_EVENT_PRESS, BUTTON_KIT_ID1, 2));
+    HOST_CHECK(Test_Logged(1, BUTTON_EVENT_PRESS, BUTTON_BOARD_ID, 1));
+    HOST_CHECK(Test_Logged(2, BUTTON_EVENT_EDGE, BUTTON_KIT_ID2, BUTTON_EDGE_FALLING));
+    HOST_CHECK(Test_Logged(3, BUTTON_EVENT_HOLD, BUTTON_KIT_ID2, KEY_TIME_HOLD1S));
+    HOST_CHECK(Test_Logged(4, BUTTON_EVENT_HOLD, BUTTON_KIT_ID2, KEY_TIME_HOLD3S));
+    HOST_CHECK(Test_Logged(5, BUTTON_EVENT_EDGE, BUTTON_KIT_ID2, BUTTON_EDGE_RISING));
+    HOST_CHECK((g_byLogCount > 6) && (g_pLog[6].event == BUTTON_EVENT_RELEASE) &&
+               (g_pLog[6].byId == BUTTON_KIT_ID2) && (g_pLog[6].wTime >= 3500u - KEY_TIME_SCAN) &&
+               (g_pLog[6].wTime <= 3500u + KEY_TIME_SCAN));
+    HOST_CHECK(Test_Logged(7, BUTTON_EVENT_PRESS, BUTTON_KIT_ID3, 1));
+    HOST_CHECK(Test_Logged(8, BUTTON_EVENT_PRESS, BUTTON_KIT_ID5, 1));
+
+    /* Edges of kit 0, board, kit 1 and kit 2, kit 4 is found by poll */
+    HOST_CHECK(stat.dwWake == 4);
+    HOST_CHECK(stat.dwEvent == g_byLogCount);
+    HOST_CHECK(stat.wLatencyMax <= TEST_LATENCY_MAX);
+    HOST_CHECK(ButtonExti_IsIdle());
+    printf("  %u events, %u wake ups, %u scans, latency max %u ms\n",
+           stat.dwEvent, stat.dwWake, stat.dwScan, stat.wLatencyMax);
+}
+
+static void
+Test_Primask(void)
+{
+    static const test_press_t press = { 10, 100, GPIOB, GPIO_Pin_0 };
+    button_stat_t stat;
+
+    Test_Setup();
+    Test_Run(&press, 1, 1000u);
+
+    /* Called with interrupts masked: still masked after */
+    __disable_irq();
+    ButtonExti_GetStatistic(&stat);
+    HOST_CHECK(__get_PRIMASK() == 1);
+    HOST_CHECK(stat.dwWake != 0);
+    ButtonExti_ResetStatistic();
+    HOST_CHECK(__get_PRIMASK() == 1);
+    __enable_irq();
+
+    ButtonExti_GetStatistic(&stat);
+    HOST_CHECK(__get_PRIMASK() == 0);
+    HOST_CHECK((stat.dwWake == 0) && (stat.dwScan == 0) && (stat.dwEvent == 0));
+    HOST_CHECK(Test_Logged(0, BUTTON_EVENT_PRESS, BUTTON_KIT_ID4, 1));
+}
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+int
+main(void)
+{
+    Test_Idle();
+    Test_Events();
+    Test_Primask();
+
+    return Host_Result("buttonexti");
+}
+
+/* END FILE */
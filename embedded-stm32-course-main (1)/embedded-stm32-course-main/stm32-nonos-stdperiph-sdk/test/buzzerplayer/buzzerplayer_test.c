@@ -0,0 +1,521 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Host test of melody player (Middle/buzzer/buzzerplayer.c) on
+ *              the TIM model: TIM4 interrupt loads notes into TIM3, the
+ *              period and compare values taken by TIM3 at each update event
+ *              are logged. Pitch, duty and start of each note are checked
+ *              from the log, which is also rendered to buzzerplayer.wav next
+ *              to the test. Fur Elise of elise.txt, compiled by tools/
+ *              buzzer_rtttl, is played as compact melody and rendered to
+ *              elise.wav. Built and run by ../run_host_tests.sh
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <string.h>
+#include <math.h>
+#include "host.h"
+#include "stm32f401re_tim.h"
+#include "system_stm32f4xx.h"
+#include "buzzer.h"
+#include "buzzerplayer.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define TEST_SEGMENT_MAX                    1024u
+#define TEST_PATH_MAX                       512u
+#define TEST_LOOP_US                        1000u
+#define TEST_PLAY_MS_MAX                    60000u
+
+#define TEST_WAV_RATE                       44100u
+#define TEST_WAV_MS_MAX                     30000u
+#define TEST_WAV_LEVEL                      8000
+
+/* Compact melody: rest, whole note at 125 beats per minute */
+#define TEST_REST                           0xFFu
+#define TEST_ELISE_WHOLE_MS                 1920u
+#define TEST_NOTE_MAX                       64u
+
+/* PWM of buzzer from an update event of TIM3 to the next change */
+typedef struct {
+    uint64_t qwUs;                          /* Time of update event */
+    uint32_t dwCycles;                      /* Period, clocks of timer */
+    uint32_t dwHigh;                        /* Output high, clocks of timer */
+} test_segment_t;
+
+/* Note of RTTTL: semitones above C1 or TEST_REST, 1 / n of whole note */
+typedef struct {
+    uint8_t byNote;
+    uint8_t byDivision;
+    uint8_t bDotted;
+} test_note_t;
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+static test_segment_t g_pSegment[TEST_SEGMENT_MAX];
+static uint16_t g_wSegmentCount;
+static uint64_t g_qwPlayUs;
+static uint64_t g_qwEndUs;
+
+static int16_t g_piWav[TEST_WAV_RATE * (TEST_WAV_MS_MAX / 1000u)];
+static uint32_t g_dwWavCount;
+
+static char g_pDir[TEST_PATH_MAX / 2];
+
+static tone_t g_pMelody[] = {
+    { 440, 200 }, { 0, 100 }, { 880, 150 }, { 1000, 50 }, { 0, 0 }
+};
+
+/* Generated from elise.txt by tools/buzzer_rtttl */
+extern const uint8_t g_pbyMelodyElise[];
+
+/* Notes of elise.txt: e6 64, d#6 63, d6 62, c6 60, b5 59, a5 57, g#5 56,
+ * e5 52, d5 50, c5 48 */
+static const test_note_t g_pElise[] = {
+    { TEST_REST, 32, 0 }, { 64, 8, 0 }, { 63, 8, 0 }, { 64, 8, 0 }, { 63, 8, 0 },
+    { 64, 8, 0 }, { 59, 8, 0 }, { 62, 8, 0 }, { 60, 8, 0 }, { 57, 4, 1 },
+    { TEST_REST, 32, 0 }, { 48, 8, 0 }, { 52, 8, 0 }, { 57, 8, 0 }, { 59, 4, 1 },
+    { TEST_REST, 32, 0 }, { 52, 8, 0 }, { 56, 8, 0 }, { 59, 8, 0 }, { 60, 4, 1 },
+    { TEST_REST, 32, 0 }, { 52, 8, 0 }, { 64, 8, 0 }, { 63, 8, 0 }, { 64, 8, 0 },
+    { 63, 8, 0 }, { 64, 8, 0 }, { 59, 8, 0 }, { 62, 8, 0 }, { 60, 8, 0 },
+    { 57, 4, 1 }, { TEST_REST, 32, 0 }, { 48, 8, 0 }, { 52, 8, 0 }, { 57, 8, 0 },
+    { 59, 4, 1 }, { TEST_REST, 32, 0 }, { 50, 8, 0 }, { 60, 8, 0 }, { 59, 8, 0 },
+    { 57, 2, 0 },
+};
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+void TIM4_IRQHandler(void);
+
+static uint8_t
+Test_Tim4Pending(void)
+{
+    return Host_TimIrqPending(TIM4);
+}
+
+/* Update event of TIM3: log values taken when they change */
+static void
+Test_Hook(
+    TIM_TypeDef *pTim
+) {
+    test_segment_t *pLast;
+    uint32_t dwCycles;
+    uint32_t dwHigh;
+
+    if (pTim != TIM3) {
+        return;
+    }
+
+    dwCycles = (uint32_t)Host_TimPeriod(TIM3);
+    dwHigh = Host_TimCompare(TIM3, 4) * (Host_TimPrescaler(TIM3) + 1);
+    if (dwHigh > dwCycles) {
+        dwHigh = dwCycles;
+    }
+
+    if (g_wSegmentCount != 0) {
+        pLast = &g_pSegment[g_wSegmentCount - 1];
+        if ((pLast->dwCycles == dwCycles) && (pLast->dwHigh == dwHigh)) {
+            return;
+        }
+    }
+
+    if (g_wSegmentCount < TEST_SEGMENT_MAX) {
+        g_pSegment[g_wSegmentCount].qwUs = Host_GetUs();
+        g_pSegment[g_wSegmentCount].dwCycles = dwCycles;
+        g_pSegment[g_wSegmentCount].dwHigh = dwHigh;
+        g_wSegmentCount++;
+    }
+}
+
+static void
+Test_Setup(void)
+{
+    Host_Reset();
+    Host_PeriphReset();
+    Host_TimReset();
+    Host_TimerReset();
+    Host_RegisterIrq(Test_Tim4Pending, TIM4_IRQHandler);
+
+    BuzzerControl_Init();
+    BuzzerPlayer_Init();
+    BuzzerPlayer_SetVolume(BUZZER_VOLUME_DEFAULT);
+    Host_TimSetHook(Test_Hook);
+}
+
+/* Log from now, run until melody is over and buzzer silent */
+static void
+Test_Start(void)
+{
+    g_wSegmentCount = 0;
+    g_qwPlayUs = Host_GetUs();
+}
+
+static void
+Test_Run(void)
+{
+    uint32_t i;
+
+    for (i = 0; (i < TEST_PLAY_MS_MAX) && BuzzerPlayer_IsPlaying(); i++) {
+        Host_Advance(TEST_LOOP_US);
+    }
+    HOST_CHECK(!BuzzerPlayer_IsPlaying());
+
+    /* Silence is taken at next period of the last note */
+    Host_Advance(10u * TEST_LOOP_US);
+    g_qwEndUs = Host_GetUs();
+}
+
+static double
+Test_Freq(
+    const test_segment_t *pSegment
+) {
+    return (double)SystemCoreClock / pSegment->dwCycles;
+}
+
+/* Number of notes not at their pitch, duty or start. A note starts at the
+ * first PWM period after its exact time, times do not add up */
+static uint16_t
+Test_Check(
+    const tone_t *pMelody,
+    uint16_t wTempo,
+    uint8_t byRepeat,
+    uint8_t byVolume
+) {
+    const test_segment_t *pSegment;
+    uint64_t qwExpectUs = 0;
+    uint64_t qwLateUs;
+    uint64_t qwSlackUs = 0;
+    uint16_t wBad = 0;
+    uint16_t wCount = 0;
+    uint16_t i;
+
+    while (byRepeat-- != 0) {
+        for (i = 0; (pMelody[i].freq != 0) || (pMelody[i].duration != 0); i++) {
+            if (wCount >= g_wSegmentCount) {
+                return (uint16_t)(wBad + 1);
+            }
+            pSegment = &g_pSegment[wCount++];
+
+            if (pMelody[i].freq == 0) {
+                wBad += (pSegment->dwHigh != 0);
+            } else {
+                wBad += (fabs(Test_Freq(pSegment) / pMelody[i].freq - 1.0) > 0.001);
+                wBad += (fabs((double)pSegment->dwHigh / pSegment->dwCycles - byVolume / 100.0) > 0.01);
+            }
+
+            qwLateUs = pSegment->qwUs - g_qwPlayUs - qwExpectUs;
+            wBad += ((pSegment->qwUs < g_qwPlayUs + qwExpectUs) || (qwLateUs > qwSlackUs + 2u));
+
+            qwExpectUs += (uint64_t)pMelody[i].duration * 1000u * BUZZER_TEMPO_NORMAL / wTempo;
+            qwSlackUs = (uint64_t)pSegment->dwCycles * 1000000u / SystemCoreClock;
+        }
+    }
+
+    /* Then silent, nothing else */
+    wBad += (wCount + 1u != g_wSegmentCount) || (g_pSegment[wCount].dwHigh != 0);
+
+    return wBad;
+}
+
+/* Buzzer output from the log: square wave, 0 while compare is 0 */
+static void
+Test_Render(void)
+{
+    const test_segment_t *pSegment = &g_pSegment[0];
+    double fUs;
+    uint64_t qwCycle;
+    uint32_t i;
+
+    g_dwWavCount = (uint32_t)((g_qwEndUs - g_qwPlayUs) * TEST_WAV_RATE / 1000000u);
+    if (g_dwWavCount > sizeof(g_piWav) / sizeof(g_piWav[0])) {
+        g_dwWavCount = sizeof(g_piWav) / sizeof(g_piWav[0]);
+    }
+
+    for (i = 0; i < g_dwWavCount; i++) {
+        fUs = g_qwPlayUs + i * 1e6 / TEST_WAV_RATE;
+        while ((pSegment + 1 < &g_pSegment[g_wSegmentCount]) && (pSegment[1].qwUs <= fUs)) {
+            pSegment++;
+        }
+
+        if ((pSegment->dwHigh == 0) || (fUs < pSegment->qwUs)) {
+            g_piWav[i] = 0;
+            continue;
+        }
+
+        qwCycle = (uint64_t)((fUs - pSegment->qwUs) * (SystemCoreClock / 1e6)) % pSegment->dwCycles;
+        g_piWav[i] = (qwCycle < pSegment->dwHigh) ? TEST_WAV_LEVEL : -TEST_WAV_LEVEL;
+    }
+}
+
+/* Pitch of the rendered output between two times, from rising edges */
+static double
+Test_WavPitch(
+    uint32_t dwFromMs,
+    uint32_t dwToMs
+) {
+    uint32_t dwFirst = 0;
+    uint32_t dwLast = 0;
+    uint32_t dwEdges = 0;
+    uint32_t i;
+
+    for (i = dwFromMs * (TEST_WAV_RATE / 1000u) + 1; i < dwToMs * (TEST_WAV_RATE / 1000u); i++) {
+        if ((g_piWav[i - 1] <= 0) && (g_piWav[i] > 0)) {
+            if (dwEdges++ == 0) {
+                dwFirst = i;
+            }
+            dwLast = i;
+        }
+    }
+
+    if (dwEdges < 2) {
+        return 0;
+    }
+
+    return (dwEdges - 1) * (double)TEST_WAV_RATE / (dwLast - dwFirst);
+}
+
+static void
+Test_Put32(
+    uint8_t *pbyData,
+    uint32_t dwValue
+) {
+    pbyData[0] = (uint8_t)dwValue;
+    pbyData[1] = (uint8_t)(dwValue >> 8);
+    pbyData[2] = (uint8_t)(dwValue >> 16);
+    pbyData[3] = (uint8_t)(dwValue >> 24);
+}
+
+/* 16-bit mono WAV of the rendered output */
+static void
+Test_WriteWav(
+    const char *pName
+) {
+    char pPath[TEST_PATH_MAX];
+    uint8_t pbyHeader[44];
+    FILE *pFile;
+    uint32_t i;
+
+    snprintf(pPath, sizeof(pPath), "%s/%s", g_pDir, pName);
+    pFile = fopen(pPath, "wb");
+    HOST_CHECK(pFile != NULL);
+    if (pFile == NULL) {
+        return;
+    }
+
+    memcpy(&pbyHeader[0], "RIFF", 4);
+    Test_Put32(&pbyHeader[4], g_dwWavCount * 2 + 36);
+    memcpy(&pbyHeader[8], "WAVEfmt ", 8);
+    memcpy(&pbyHeader[16], "\x10\x00\x00\x00\x01\x00\x01\x00", 8);
+    Test_Put32(&pbyHeader[24], TEST_WAV_RATE);
+    Test_Put32(&pbyHeader[28], TEST_WAV_RATE * 2);
+    memcpy(&pbyHeader[32], "\x02\x00\x10\x00", 4);
+    memcpy(&pbyHeader[36], "data", 4);
+    Test_Put32(&pbyHeader[40], g_dwWavCount * 2);
+    fwrite(pbyHeader, 1, sizeof(pbyHeader), pFile);
+
+    for (i = 0; i < g_dwWavCount; i++) {
+        fputc(g_piWav[i] & 0xFF, pFile);
+        fputc((g_piWav[i] >> 8) & 0xFF, pFile);
+    }
+    fclose(pFile);
+}
+
+static void
+Test_Play(void)
+{
+    double fPitch440;
+    double fPitch880;
+
+    Test_Setup();
+    Test_Start();
+    BuzzerPlayer_Play(g_pMelody, BUZZER_TEMPO_NORMAL, 1);
+    HOST_CHECK(BuzzerPlayer_IsPlaying());
+    Test_Run();
+
+    HOST_CHECK(Test_Check(g_pMelody, BUZZER_TEMPO_NORMAL, 1, BUZZER_VOLUME_DEFAULT) == 0);
+
+    /* Note timer is stopped, no more interrupt */
+    HOST_CHECK(!(TIM4->CR1 & TIM_CR1_CEN));
+    HOST_CHECK(!Test_Tim4Pending());
+
+    Test_Render();
+    Test_WriteWav("buzzerplayer.wav");
+    fPitch440 = Test_WavPitch(10, 190);
+    fPitch880 = Test_WavPitch(310, 440);
+    HOST_CHECK(fabs(fPitch440 / 440.0 - 1.0) < 0.002);
+    HOST_CHECK(fabs(fPitch880 / 880.0 - 1.0) < 0.002);
+
+    printf("  buzzerplayer.wav: %u ms from TIM3 registers, pitch of 440 Hz note %.2f Hz, "
+           "880 Hz note %.2f Hz\n",
+           (unsigned)((g_qwEndUs - g_qwPlayUs) / 1000u), fPitch440, fPitch880);
+}
+
+static void
+Test_Tempo(void)
+{
+    Test_Setup();
+    Test_Start();
+    BuzzerPlayer_Play(g_pMelody, 2u * BUZZER_TEMPO_NORMAL, 3);
+    Test_Run();
+    HOST_CHECK(Test_Check(g_pMelody, 2u * BUZZER_TEMPO_NORMAL, 3, BUZZER_VOLUME_DEFAULT) == 0);
+
+    /* Three plays of 250 ms, last note ends on time */
+    HOST_CHECK(g_pSegment[g_wSegmentCount - 1].qwUs - g_qwPlayUs >= 750000u);
+    HOST_CHECK(g_pSegment[g_wSegmentCount - 1].qwUs - g_qwPlayUs <= 751002u);
+}
+
+static void
+Test_Volume(void)
+{
+    Test_Setup();
+    BuzzerPlayer_SetVolume(10);
+    Test_Start();
+    BuzzerPlayer_Play(g_pMelody, BUZZER_TEMPO_NORMAL, 1);
+    Test_Run();
+    HOST_CHECK(Test_Check(g_pMelody, BUZZER_TEMPO_NORMAL, 1, 10) == 0);
+
+    /* Duty above half is not louder */
+    BuzzerPlayer_SetVolume(80);
+    Test_Start();
+    BuzzerPlayer_Play(g_pMelody, BUZZER_TEMPO_NORMAL, 1);
+    Test_Run();
+    HOST_CHECK(Test_Check(g_pMelody, BUZZER_TEMPO_NORMAL, 1, 50) == 0);
+}
+
+static void
+Test_Elise(void)
+{
+    static tone_t pTone[TEST_NOTE_MAX];
+    const uint8_t byNotes = sizeof(g_pElise) / sizeof(g_pElise[0]);
+    uint32_t dwMs = 0;
+    uint8_t i;
+
+    /* Same melody as tone_t: pitch of equal temperament, length at tempo */
+    for (i = 0; i < byNotes; i++) {
+        pTone[i].freq = 0;
+        if (g_pElise[i].byNote != TEST_REST) {
+            pTone[i].freq = (uint16_t)lround(440.0 * pow(2.0, (g_pElise[i].byNote - 45) / 12.0));
+        }
+        pTone[i].duration = (uint16_t)(TEST_ELISE_WHOLE_MS / g_pElise[i].byDivision);
+        if (g_pElise[i].bDotted) {
+            pTone[i].duration += pTone[i].duration / 2u;
+        }
+        dwMs += pTone[i].duration;
+    }
+    pTone[byNotes].freq = 0;
+    pTone[byNotes].duration = 0;
+
+    HOST_CHECK((g_pbyMelodyElise[0] | (g_pbyMelodyElise[1] << 8)) == byNotes);
+
+    Test_Setup();
+    Test_Start();
+    BuzzerPlayer_PlayCompact(g_pbyMelodyElise, BUZZER_TEMPO_NORMAL, 1);
+    HOST_CHECK(BuzzerPlayer_IsPlaying());
+    Test_Run();
+    HOST_CHECK(Test_Check(pTone, BUZZER_TEMPO_NORMAL, 1, BUZZER_VOLUME_DEFAULT) == 0);
+
+    Test_Render();
+    Test_WriteWav("elise.wav");
+
+    printf("  elise.wav: %u notes, %u ms written, %u ms played from TIM3 registers\n",
+           byNotes, dwMs, (unsigned)((g_pSegment[g_wSegmentCount - 1].qwUs - g_qwPlayUs) / 1000u));
+}
+
+static void
+Test_Reject(void)
+{
+    /* One note of semitone 0 above the lowest, quarter note at 60 bpm */
+    uint8_t pbyMelody[] = { 1, 0, 60, 0, 95, 2, 2, 2, 0x01 };
+
+    /* B8, highest note of table */
+    Test_Setup();
+    Test_Start();
+    BuzzerPlayer_PlayCompact(pbyMelody, BUZZER_TEMPO_NORMAL, 1);
+    HOST_CHECK(BuzzerPlayer_IsPlaying());
+    Host_Advance(TEST_LOOP_US);
+    HOST_CHECK(fabs(Test_Freq(&g_pSegment[0]) / 7902.1 - 1.0) < 0.001);
+    BuzzerPlayer_Stop();
+
+    /* Above B8: melody is not played, nothing wraps to a low note */
+    pbyMelody[8] = 0x02;
+    Test_Start();
+    BuzzerPlayer_PlayCompact(pbyMelody, BUZZER_TEMPO_NORMAL, 1);
+    HOST_CHECK(!BuzzerPlayer_IsPlaying());
+    Host_Advance(10u * TEST_LOOP_US);
+    HOST_CHECK((g_wSegmentCount == 0) || (g_pSegment[g_wSegmentCount - 1].dwHigh == 0));
+
+    /* Lowest note out of table */
+    pbyMelody[4] = BUZZER_NOTE_COUNT;
+    pbyMelody[8] = 0x01;
+    BuzzerPlayer_PlayCompact(pbyMelody, BUZZER_TEMPO_NORMAL, 1);
+    HOST_CHECK(!BuzzerPlayer_IsPlaying());
+
+    /* A rest is in range whatever lowest note is */
+    pbyMelody[4] = 95;
+    pbyMelody[8] = 0x00;
+    BuzzerPlayer_PlayCompact(pbyMelody, BUZZER_TEMPO_NORMAL, 1);
+    HOST_CHECK(BuzzerPlayer_IsPlaying());
+    BuzzerPlayer_Stop();
+}
+
+static void
+Test_Stop(void)
+{
+    uint16_t wCount;
+
+    Test_Setup();
+    Test_Start();
+    BuzzerPlayer_Play(g_pMelody, BUZZER_TEMPO_NORMAL, BUZZER_PLAY_FOREVER);
+    Host_Advance(1000000u);
+    HOST_CHECK(BuzzerPlayer_IsPlaying());
+    HOST_CHECK(g_wSegmentCount >= 8);
+
+    /* Silent from next period, no note after */
+    BuzzerPlayer_Stop();
+    Host_Advance(10u * TEST_LOOP_US);
+    wCount = g_wSegmentCount;
+    HOST_CHECK(g_pSegment[wCount - 1].dwHigh == 0);
+    Host_Advance(1000000u);
+    HOST_CHECK(g_wSegmentCount == wCount);
+    HOST_CHECK(!BuzzerPlayer_IsPlaying());
+}
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+int
+main(
+    int argc,
+    char **argv
+) {
+    const char *pSlash = strrchr(argv[0], '/');
+
+    (void)argc;
+
+    snprintf(g_pDir, sizeof(g_pDir), "%.*s",
+             (pSlash != NULL) ? (int)(pSlash - argv[0]) : 1,
+             (pSlash != NULL) ? argv[0] : ".");
+
+    Test_Play();
+    Test_Tempo();
+    Test_Volume();
+    Test_Stop();
+    Test_Elise();
+    Test_Reject();
+
+    return Host_Result("buzzerplayer");
+}
+
+/* END FILE */
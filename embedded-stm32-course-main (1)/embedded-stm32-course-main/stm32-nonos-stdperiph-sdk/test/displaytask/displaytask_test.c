@@ -0,0 +1,251 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Host test of display task (Middle/display/displaytask.c):
+ *              invalidations coalesced into one render per frame, clients
+ *              rendered in order of id also after a frame cut by budget,
+ *              interrupt mask kept, frame rate and frame time. Clients are
+ *              mock renders taking simulated time. Built and run by
+ *              ../run_host_tests.sh
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <string.h>
+#include "host.h"
+#include "timer.h"
+#include "displaytask.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define TEST_LOOP_US                        100u
+#define TEST_CLIENTS                        5u
+#define TEST_LOG_SIZE                       64u
+#define TEST_FRAME_MS                       (1000u / DISPLAY_FPS_DEFAULT)
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+/* Render time of each client (us) */
+static uint32_t g_pdwRenderUs[TEST_CLIENTS];
+static uint32_t g_pdwRender[TEST_CLIENTS];
+static uint8_t g_pbyClient[TEST_CLIENTS];
+
+/* Ids in order of render */
+static uint8_t g_pbyLog[TEST_LOG_SIZE];
+static uint8_t g_byLogCount;
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+static void
+Test_Render(
+    void *pData
+) {
+    uint8_t byClient = *(uint8_t *)pData;
+
+    g_pdwRender[byClient]++;
+    if (g_byLogCount < TEST_LOG_SIZE) {
+        g_pbyLog[g_byLogCount++] = byClient;
+    }
+    Host_Advance(g_pdwRenderUs[byClient]);
+}
+
+static void
+Test_Setup(
+    uint8_t byClients,
+    uint32_t dwRenderUs
+) {
+    uint8_t i;
+
+    Host_Reset();
+    Host_PeriphReset();
+    Host_TimerReset();
+
+    memset(g_pdwRender, 0, sizeof(g_pdwRender));
+    g_byLogCount = 0;
+
+    DisplayTask_Init();
+    for (i = 0; i < byClients; i++) {
+        g_pbyClient[i] = i;
+        g_pdwRenderUs[i] = dwRenderUs;
+        HOST_CHECK(DisplayTask_Register(Test_Render, &g_pbyClient[i]) == i);
+    }
+}
+
+static void
+Test_Run(
+    uint32_t dwUs
+) {
+    uint64_t qwEnd = Host_GetUs() + dwUs;
+
+    while (Host_GetUs() < qwEnd) {
+        processTimerScheduler();
+        Host_Advance(TEST_LOOP_US);
+    }
+}
+
+/* Run until the next frame has rendered something */
+static void
+Test_NextFrame(void)
+{
+    uint8_t byLogCount = g_byLogCount;
+
+    while (g_byLogCount == byLogCount) {
+        Test_Run(TEST_LOOP_US);
+    }
+}
+
+static void
+Test_Coalesce(void)
+{
+    display_stat_t stat;
+    uint8_t i;
+
+    Test_Setup(3, 1000u);
+    Test_NextFrame();
+    HOST_CHECK(g_byLogCount == 3);
+    DisplayTask_ResetStatistic();
+
+    /* Burst of events between two frames: one render */
+    for (i = 0; i < 10; i++) {
+        DisplayTask_Invalidate(1);
+    }
+    DisplayTask_Invalidate(DISPLAY_NO_CLIENT);
+    Test_NextFrame();
+    HOST_CHECK(g_pdwRender[0] == 1);
+    HOST_CHECK(g_pdwRender[1] == 2);
+    HOST_CHECK(g_pdwRender[2] == 1);
+
+    DisplayTask_GetStatistic(&stat);
+    HOST_CHECK(stat.dwInvalidate == 10);
+    HOST_CHECK(stat.dwCoalesced == 9);
+    HOST_CHECK(stat.dwFrame == 1);
+
+    /* Nothing invalid: idle frames */
+    Test_Run(5u * TEST_FRAME_MS * 1000u);
+    DisplayTask_GetStatistic(&stat);
+    HOST_CHECK(stat.dwFrame == 1);
+    HOST_CHECK(stat.dwIdle >= 4);
+    HOST_CHECK(g_byLogCount == 4);
+}
+
+static void
+Test_Order(void)
+{
+    display_stat_t stat;
+    static const uint8_t pbyFirst[] = { 0, 1, 2 };
+    static const uint8_t pbySecond[] = { 0, 3, 4 };
+
+    /* 8 ms per client, budget of 20 ms: three clients per frame */
+    Test_Setup(TEST_CLIENTS, 8000u);
+    Test_NextFrame();
+    HOST_CHECK(g_byLogCount == 3);
+    HOST_CHECK(memcmp(g_pbyLog, pbyFirst, sizeof(pbyFirst)) == 0);
+
+    /* Background invalid again: drawn before clients left over */
+    DisplayTask_Invalidate(0);
+    g_byLogCount = 0;
+    Test_NextFrame();
+    HOST_CHECK(g_byLogCount == 3);
+    HOST_CHECK(memcmp(g_pbyLog, pbySecond, sizeof(pbySecond)) == 0);
+
+    DisplayTask_GetStatistic(&stat);
+    HOST_CHECK(stat.dwOverBudget == 1);
+    HOST_CHECK(stat.wFrameTimeMax == 24);
+
+    /* Nothing left over */
+    g_byLogCount = 0;
+    Test_Run(3u * TEST_FRAME_MS * 1000u);
+    HOST_CHECK(g_byLogCount == 0);
+}
+
+static void
+Test_Primask(void)
+{
+    display_stat_t stat;
+
+    Test_Setup(2, 1000u);
+    Test_NextFrame();
+
+    /* Called with interrupts masked: still masked after */
+    __disable_irq();
+    DisplayTask_Invalidate(1);
+    HOST_CHECK(__get_PRIMASK() == 1);
+    DisplayTask_GetStatistic(&stat);
+    HOST_CHECK(__get_PRIMASK() == 1);
+    DisplayTask_ResetStatistic();
+    HOST_CHECK(__get_PRIMASK() == 1);
+    __enable_irq();
+
+    DisplayTask_GetStatistic(&stat);
+    HOST_CHECK(__get_PRIMASK() == 0);
+
+    DisplayTask_Invalidate(0);
+    HOST_CHECK(__get_PRIMASK() == 0);
+    Test_NextFrame();
+    HOST_CHECK(g_pdwRender[0] == 2);
+    HOST_CHECK(g_pdwRender[1] == 2);
+}
+
+static void
+Test_Benchmark(void)
+{
+    display_stat_t stat;
+    uint32_t dwMs;
+
+    /* Buttons and serial invalidate two clients every 3 ms, sensor one
+     * client every 50 ms, for 1000 ms of main loop. Render 8 ms per client */
+    Test_Setup(3, 8000u);
+    Test_NextFrame();
+    DisplayTask_ResetStatistic();
+    memset(g_pdwRender, 0, sizeof(g_pdwRender));
+
+    for (dwMs = 0; dwMs < 1000u; dwMs++) {
+        if ((dwMs % 3u) == 0) {
+            DisplayTask_Invalidate(0);
+            DisplayTask_Invalidate(1);
+        }
+        if ((dwMs % 50u) == 0) {
+            DisplayTask_Invalidate(2);
+        }
+        Test_Run(1000u);
+    }
+
+    DisplayTask_GetStatistic(&stat);
+    HOST_CHECK(stat.dwCoalesced > stat.dwInvalidate / 2u);
+    HOST_CHECK(g_pdwRender[2] == 20);
+    HOST_CHECK(stat.wFrameTimeMax <= 24);
+    printf("  1000 ms of events: %u invalidations, %u coalesced, renders %u/%u/%u, "
+           "%u frames (%u.%02u fps), frame time avg %u ms max %u ms, %u over budget\n",
+           stat.dwInvalidate, stat.dwCoalesced,
+           g_pdwRender[0], g_pdwRender[1], g_pdwRender[2],
+           stat.dwFrame, stat.wFps / 100u, stat.wFps % 100u,
+           stat.wFrameTimeAvg, stat.wFrameTimeMax, stat.dwOverBudget);
+}
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+int
+main(void)
+{
+    Test_Coalesce();
+    Test_Order();
+    Test_Primask();
+    Test_Benchmark();
+
+    return Host_Result("displaytask");
+}
+
+/* END FILE */
@@ -0,0 +1,350 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Host test of gestures of buttons (Middle/button/gesture.c):
+ *              timestamped edges of the *.trace files replayed against the
+ *              table of eventbutton.h events, gestures checked against those
+ *              expected by each trace; tables rejected by Gesture_Load; a
+ *              click from the pin through ButtonExti; host time of a tick.
+ *              Built and run by ../run_host_tests.sh
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <string.h>
+#include <time.h>
+#include "host.h"
+#include "stm32f401re_gpio.h"
+#include "timer.h"
+#include "buttonexti.h"
+#include "gesture.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define TEST_LOG_SIZE                       16u
+#define TEST_LINE_SIZE                      80u
+#define TEST_BENCH_TICKS                    10000000u
+
+/* Events of application */
+enum {
+    TEST_EVENT_CLICK,
+    TEST_EVENT_HOLD,
+    TEST_EVENT_RELEASE,
+    TEST_EVENT_CHORD,
+    TEST_EVENT_EDGE,
+    TEST_EVENT_MAX
+};
+
+typedef struct {
+    uint8_t byEvent;
+    uint8_t byButton;
+    uint16_t wParam;
+} test_gesture_t;
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+static const char *g_ppEventName[TEST_EVENT_MAX] = {
+    "CLICK", "HOLD", "RELEASE", "CHORD", "EDGE"
+};
+
+/* eventbutton.h events, chord of kit 0 + kit 1, edges of kit 4 */
+static const gesture_t g_pTable[] = {
+    GESTURE_CLICK_OF(GESTURE_ALL_BUTTONS, 1, TEST_EVENT_CLICK),
+    GESTURE_CLICK_OF(GESTURE_ALL_BUTTONS, 2, TEST_EVENT_CLICK),
+    GESTURE_CLICK_OF(GESTURE_ALL_BUTTONS, 5, TEST_EVENT_CLICK),
+    GESTURE_HOLD_OF(GESTURE_ALL_BUTTONS, KEY_TIME_HOLD10S, TEST_EVENT_HOLD),
+    GESTURE_HOLD_OF(GESTURE_ALL_BUTTONS, KEY_TIME_HOLD1S, TEST_EVENT_HOLD),
+    GESTURE_HOLD_OF(GESTURE_ALL_BUTTONS, KEY_TIME_HOLD3S, TEST_EVENT_HOLD),
+    GESTURE_HOLD_OF(GESTURE_ALL_BUTTONS, KEY_TIME_HOLD5S, TEST_EVENT_HOLD),
+    GESTURE_RELEASE_OF(GESTURE_ALL_BUTTONS, KEY_TIME_HOLD1S, TEST_EVENT_RELEASE),
+    GESTURE_RELEASE_OF(GESTURE_ALL_BUTTONS, KEY_TIME_HOLD3S, TEST_EVENT_RELEASE),
+    GESTURE_RELEASE_OF(GESTURE_ALL_BUTTONS, KEY_TIME_HOLD5S, TEST_EVENT_RELEASE),
+    GESTURE_RELEASE_OF(GESTURE_ALL_BUTTONS, KEY_TIME_HOLD10S, TEST_EVENT_RELEASE),
+    GESTURE_CHORD_OF(0x06, 500, TEST_EVENT_CHORD),
+    GESTURE_EDGE_OF(0x20, TEST_EVENT_EDGE),
+};
+
+static const char *g_ppTrace[] = {
+    "gesture/click_single.trace",
+    "gesture/click_double.trace",
+    "gesture/click_five.trace",
+    "gesture/click_two_buttons.trace",
+    "gesture/hold_3s.trace",
+    "gesture/hold_10s.trace",
+    "gesture/chord.trace",
+    "gesture/edge_click.trace",
+};
+
+static test_gesture_t g_pLog[TEST_LOG_SIZE];
+static uint8_t g_byLogCount;
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+void EXTI9_5_IRQHandler(void);
+
+static uint8_t
+Test_Exti9_5Pending(void)
+{
+    return (EXTI->PR & EXTI->IMR & 0x03E0u) != 0;
+}
+
+static void
+Test_OnGesture(
+    uint8_t byEvent,
+    uint8_t byButton,
+    uint16_t wParam
+) {
+    if (g_byLogCount < TEST_LOG_SIZE) {
+        g_pLog[g_byLogCount].byEvent = byEvent;
+        g_pLog[g_byLogCount].byButton = byButton;
+        g_pLog[g_byLogCount].wParam = wParam;
+        g_byLogCount++;
+    }
+}
+
+static uint8_t
+Test_Load(
+    const gesture_t *pTable,
+    uint8_t byCount
+) {
+    g_byLogCount = 0;
+    return Gesture_Load(pTable, byCount, Test_OnGesture);
+}
+
+static uint8_t
+Test_EventOfName(
+    const char *pName
+) {
+    uint8_t i;
+
+    for (i = 0; i < TEST_EVENT_MAX; i++) {
+        if (strcmp(pName, g_ppEventName[i]) == 0) {
+            break;
+        }
+    }
+
+    return i;
+}
+
+/* Edges of a trace at their tick, Gesture_Process every GESTURE_TICK as the
+ * gesture timer. Returns 1 if gestures are those expected by the trace */
+static uint8_t
+Test_Replay(
+    const char *pPath
+) {
+    FILE *pFile = fopen(pPath, "r");
+    test_gesture_t pExpect[TEST_LOG_SIZE];
+    char pLine[TEST_LINE_SIZE];
+    char pName[16];
+    uint32_t dwTick, dwButton, dwValue;
+    uint32_t dwNow = 0;
+    uint8_t byExpect = 0;
+    uint8_t bOk = 1;
+    uint8_t i;
+
+    if (pFile == NULL) {
+        return 0;
+    }
+
+    HOST_CHECK(Test_Load(g_pTable, sizeof(g_pTable) / sizeof(g_pTable[0])));
+
+    while (bOk && (fgets(pLine, sizeof(pLine), pFile) != NULL)) {
+        if ((pLine[0] == '#') || (pLine[0] == '\n')) {
+            continue;
+        }
+
+        if (sscanf(pLine, "e %u %u %u", &dwTick, &dwButton, &dwValue) == 3) {
+            for (; dwNow < dwTick; dwNow++) {
+                if (dwNow % GESTURE_TICK == 0) {
+                    Gesture_Process(dwNow);
+                }
+            }
+            Gesture_Input((uint8_t)dwButton, (uint8_t)dwValue, dwTick);
+        } else if (sscanf(pLine, "g %15s %u %u", pName, &dwButton, &dwValue) == 3) {
+            bOk = (byExpect < TEST_LOG_SIZE) && (Test_EventOfName(pName) < TEST_EVENT_MAX);
+            if (bOk) {
+                pExpect[byExpect].byEvent = Test_EventOfName(pName);
+                pExpect[byExpect].byButton = (uint8_t)dwButton;
+                pExpect[byExpect].wParam = (uint16_t)dwValue;
+                byExpect++;
+            }
+        } else if (sscanf(pLine, "end %u", &dwTick) == 1) {
+            for (; dwNow <= dwTick; dwNow++) {
+                if (dwNow % GESTURE_TICK == 0) {
+                    Gesture_Process(dwNow);
+                }
+            }
+        } else {
+            bOk = 0;
+        }
+    }
+    fclose(pFile);
+
+    bOk = bOk && (byExpect == g_byLogCount) && !Gesture_Process(dwNow);
+    for (i = 0; bOk && (i < byExpect); i++) {
+        bOk = (pExpect[i].byEvent == g_pLog[i].byEvent) &&
+              (pExpect[i].byButton == g_pLog[i].byButton) &&
+              (pExpect[i].wParam == g_pLog[i].wParam);
+    }
+
+    printf("  %-4s %s:", bOk ? "ok" : "FAIL", pPath);
+    for (i = 0; i < g_byLogCount; i++) {
+        printf(" %s %u %u;", g_ppEventName[g_pLog[i].byEvent % TEST_EVENT_MAX],
+               g_pLog[i].byButton, g_pLog[i].wParam);
+    }
+    printf("\n");
+
+    return bOk;
+}
+
+static void
+Test_Traces(void)
+{
+    uint8_t i;
+
+    for (i = 0; i < sizeof(g_ppTrace) / sizeof(g_ppTrace[0]); i++) {
+        HOST_CHECK(Test_Replay(g_ppTrace[i]));
+    }
+}
+
+static void
+Test_Reject(void)
+{
+    static const gesture_t pEdges[] = {
+        GESTURE_EDGE_OF(0x01, TEST_EVENT_EDGE),
+        GESTURE_EDGE_OF(0x03, TEST_EVENT_EDGE),
+    };
+    static const gesture_t pClicks[] = {
+        GESTURE_CLICK_OF(GESTURE_ALL_BUTTONS, 2, TEST_EVENT_CLICK),
+        GESTURE_CLICK_OF(0x02, 2, TEST_EVENT_CLICK),
+    };
+    static const gesture_t pDisjoint[] = {
+        GESTURE_EDGE_OF(0x01, TEST_EVENT_EDGE),
+        GESTURE_EDGE_OF(0x02, TEST_EVENT_EDGE),
+        GESTURE_CLICK_OF(0x01, 2, TEST_EVENT_CLICK),
+        GESTURE_CLICK_OF(0x02, 2, TEST_EVENT_CLICK),
+        GESTURE_CLICK_OF(0x03, 1, TEST_EVENT_CLICK),
+    };
+    static const gesture_t pLimits[] = {
+        GESTURE_CLICK_OF(0x01, 0, TEST_EVENT_CLICK),
+        GESTURE_CLICK_OF(0x01, GESTURE_CLICK_MAX + 1, TEST_EVENT_CLICK),
+        GESTURE_CLICK_OF(0, 1, TEST_EVENT_CLICK),
+    };
+    static const gesture_t pHolds[] = {
+        GESTURE_HOLD_OF(0x01, 1000, TEST_EVENT_HOLD),
+        GESTURE_HOLD_OF(0x01, 2000, TEST_EVENT_HOLD),
+        GESTURE_HOLD_OF(0x01, 3000, TEST_EVENT_HOLD),
+        GESTURE_HOLD_OF(0x01, 4000, TEST_EVENT_HOLD),
+        GESTURE_HOLD_OF(0x01, 5000, TEST_EVENT_HOLD),
+    };
+    uint8_t i;
+
+    /* Second edge or same count of clicks on a button */
+    HOST_CHECK(!Test_Load(pEdges, 2));
+    HOST_CHECK(!Test_Load(pClicks, 2));
+    HOST_CHECK(Test_Load(pDisjoint, 5));
+
+    for (i = 0; i < 3; i++) {
+        HOST_CHECK(!Test_Load(&pLimits[i], 1));
+    }
+    HOST_CHECK(Test_Load(pHolds, GESTURE_HOLD_MAX));
+    HOST_CHECK(!Test_Load(pHolds, GESTURE_HOLD_MAX + 1));
+
+    /* Rejected table: no gesture */
+    HOST_CHECK(!Test_Load(pEdges, 2));
+    Gesture_Input(0, 1, 100);
+    Gesture_Input(0, 0, 180);
+    HOST_CHECK(!Gesture_Process(1000));
+    HOST_CHECK(g_byLogCount == 0);
+}
+
+/* Kit 0 pressed on its pin: debounced by ButtonExti, timed by gesture timer */
+static void
+Test_Pin(void)
+{
+    uint32_t dwMs;
+
+    Host_Reset();
+    Host_PeriphReset();
+    Host_TimerReset();
+    Host_RegisterIrq(Test_Exti9_5Pending, EXTI9_5_IRQHandler);
+
+    ButtonExti_Init();
+    Gesture_Init();
+    HOST_CHECK(Test_Load(g_pTable, sizeof(g_pTable) / sizeof(g_pTable[0])));
+
+    for (dwMs = 0; dwMs < 1000u; dwMs++) {
+        if ((dwMs == 100u) || (dwMs == 200u)) {
+            Host_GpioSetInput(GPIOB, GPIO_Pin_5, dwMs == 200u);
+            Host_Poll();
+        }
+        processButtonExti();
+        processTimerScheduler();
+        Host_Advance(1000u);
+    }
+
+    HOST_CHECK(g_byLogCount == 1);
+    HOST_CHECK((g_pLog[0].byEvent == TEST_EVENT_CLICK) && (g_pLog[0].byButton == 1) &&
+               (g_pLog[0].wParam == 1));
+    HOST_CHECK(ButtonExti_IsIdle());
+
+    /* Gesture timer stopped, idle poll of kit 4 left */
+    HOST_CHECK(Host_TimerCount() == 1);
+}
+
+static void
+Test_Benchmark(void)
+{
+    clock_t idle, pressed;
+    volatile uint8_t byActive = 0;
+    uint32_t i;
+
+    HOST_CHECK(Gesture_Load(g_pTable, sizeof(g_pTable) / sizeof(g_pTable[0]), NULL));
+
+    idle = clock();
+    for (i = 0; i < TEST_BENCH_TICKS; i++) {
+        byActive += Gesture_Process(i);
+    }
+    idle = clock() - idle;
+    HOST_CHECK(byActive == 0);
+
+    for (i = 0; i < BUTTON_MAX; i++) {
+        Gesture_Input((uint8_t)i, 1, 0);
+    }
+    pressed = clock();
+    for (i = 0; i < TEST_BENCH_TICKS; i++) {
+        byActive += Gesture_Process(i % 900u);
+    }
+    pressed = clock() - pressed;
+
+    printf("  host tick: idle %.1f ns, %u pressed %.1f ns\n",
+           idle * 1e9 / CLOCKS_PER_SEC / TEST_BENCH_TICKS, BUTTON_MAX,
+           pressed * 1e9 / CLOCKS_PER_SEC / TEST_BENCH_TICKS);
+}
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+int
+main(void)
+{
+    Test_Pin();
+    Test_Traces();
+    Test_Reject();
+    Test_Benchmark();
+
+    return Host_Result("gesture");
+}
+
+/* END FILE */
@@ -0,0 +1,43 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Host build, Cortex-M instructions of CMSIS as C. Found
+ *              before Drivers/CMSIS/Include by core_cm4.h
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+#ifndef __CORE_CMINSTR_H
+#define __CORE_CMINSTR_H
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <stdint.h>
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define __NOP()                             ((void)0)
+#define __WFI()                             Host_Spin()
+#define __WFE()                             Host_Spin()
+#define __SEV()                             ((void)0)
+#define __ISB()                             ((void)0)
+#define __DSB()                             ((void)0)
+#define __DMB()                             ((void)0)
+#define __REV(value)                        __builtin_bswap32(value)
+#define __REV16(value)                      ((uint32_t)((((value) & 0xFF00FF00u) >> 8) | \
+                                                        (((value) & 0x00FF00FFu) << 8)))
+#define __CLZ(value)                        ((uint8_t)(((value) == 0) ? 32 : __builtin_clz(value)))
+
+void Host_Spin(void);
+
+#endif
+
+/* END FILE */
@@ -0,0 +1,23 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Host build, no SIMD instructions. Found before
+ *              Drivers/CMSIS/Include by core_cm4.h
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+#ifndef __CORE_CMSIMD_H
+#define __CORE_CMSIMD_H
+
+#endif
+
+/* END FILE */
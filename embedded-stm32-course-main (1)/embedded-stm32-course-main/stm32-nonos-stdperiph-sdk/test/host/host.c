@@ -0,0 +1,407 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Host build, simulated time, events of peripheral models,
+ *              PRIMASK and delivery of interrupts, checks of tests
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <stdlib.h>
+#include "host.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+/* Interrupts delivered in a row before the test is aborted: a flag is
+ * never cleared by its handler */
+#define HOST_IRQ_STORM                      100000u
+
+typedef struct {
+    uint64_t qwDue;
+    uint32_t dwSeq;          /* Events due together run in order scheduled */
+    host_event_cb callback;
+    void *pData;
+} host_event_t, *host_event_p;
+
+typedef struct {
+    host_irq_pending pending;
+    host_irq_handler handler;
+} host_irq_t;
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+static uint64_t g_qwNowUs;
+static host_event_t g_pEvent[HOST_EVENT_MAX];
+static uint8_t g_byEventCount;
+static uint32_t g_dwEventSeq;
+static host_irq_t g_pIrq[HOST_IRQ_MAX];
+static uint8_t g_byIrqCount;
+static uint32_t g_dwPrimask;
+static uint8_t g_bInIrq;
+static uint8_t g_bInAdvance;
+static uint32_t g_dwCheck;
+static uint32_t g_dwFail;
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static int8_t Host_NextEvent(uint64_t qwUntil);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func   Host_Reset
+ * @brief  Time back to 0, events dropped. Interrupt sources stay registered
+ * @param  None
+ * @retval None
+ */
+void
+Host_Reset(void)
+{
+    g_qwNowUs = 0;
+    g_byEventCount = 0;
+    g_dwPrimask = 0;
+    g_bInIrq = 0;
+    g_bInAdvance = 0;
+}
+
+/**
+ * @func   Host_GetUs
+ * @brief  Simulated time
+ * @param  None
+ * @retval Time (us)
+ */
+uint64_t
+Host_GetUs(void)
+{
+    return g_qwNowUs;
+}
+
+/**
+ * @func   Host_Advance
+ * @brief  Let time pass: events due are run in order, each followed by the
+ *         interrupts it made pending
+ * @param  dwUs: time (us)
+ * @retval None
+ */
+void
+Host_Advance(
+    uint32_t dwUs
+) {
+    uint64_t qwUntil = g_qwNowUs + dwUs;
+    host_event_t event;
+    int8_t iIndex;
+
+    g_bInAdvance = 1;
+
+    while ((iIndex = Host_NextEvent(qwUntil)) >= 0) {
+        event = g_pEvent[iIndex];
+        g_pEvent[iIndex] = g_pEvent[--g_byEventCount];
+
+        if (event.qwDue > g_qwNowUs) {
+            g_qwNowUs = event.qwDue;
+        }
+        event.callback(event.pData);
+        Host_Poll();
+    }
+
+    g_qwNowUs = qwUntil;
+    g_bInAdvance = 0;
+    Host_Poll();
+}
+
+/**
+ * @func   Host_Spin
+ * @brief  CPU time of one loop of a busy wait, nothing from an interrupt
+ *         or a model
+ * @param  None
+ * @retval None
+ */
+void
+Host_Spin(void)
+{
+    if (!g_bInIrq && !g_bInAdvance) {
+        Host_Advance(HOST_SPIN_US);
+    }
+}
+
+/**
+ * @func   Host_Schedule
+ * @brief  Run callback of a model after a delay
+ * @param  dwDelayUs: delay (us)
+ * @param  callback: event
+ * @param  pData: param of callback
+ * @retval None
+ */
+void
+Host_Schedule(
+    uint32_t dwDelayUs,
+    host_event_cb callback,
+    void *pData
+) {
+    if (g_byEventCount >= HOST_EVENT_MAX) {
+        fprintf(stderr, "host: too many events\n");
+        abort();
+    }
+
+    g_pEvent[g_byEventCount].qwDue = g_qwNowUs + dwDelayUs;
+    g_pEvent[g_byEventCount].dwSeq = g_dwEventSeq++;
+    g_pEvent[g_byEventCount].callback = callback;
+    g_pEvent[g_byEventCount].pData = pData;
+    g_byEventCount++;
+}
+
+/**
+ * @func   Host_Cancel
+ * @brief  Drop events of a callback
+ * @param  callback: event
+ * @retval None
+ */
+void
+Host_Cancel(
+    host_event_cb callback
+) {
+    uint8_t i = 0;
+
+    while (i < g_byEventCount) {
+        if (g_pEvent[i].callback == callback) {
+            g_pEvent[i] = g_pEvent[--g_byEventCount];
+        } else {
+            i++;
+        }
+    }
+}
+
+/**
+ * @func   Host_CancelData
+ * @brief  Drop events of a callback with a given param, a model with more
+ *         instances keeps the events of the others
+ * @param  callback: event
+ * @param  pData: param of callback
+ * @retval None
+ */
+void
+Host_CancelData(
+    host_event_cb callback,
+    void *pData
+) {
+    uint8_t i = 0;
+
+    while (i < g_byEventCount) {
+        if ((g_pEvent[i].callback == callback) && (g_pEvent[i].pData == pData)) {
+            g_pEvent[i] = g_pEvent[--g_byEventCount];
+        } else {
+            i++;
+        }
+    }
+}
+
+/**
+ * @func   Host_RegisterIrq
+ * @brief  Add an interrupt source, lower index has higher priority
+ * @param  pending: 1 while handler must run
+ * @param  handler: handler of module under test
+ * @retval None
+ */
+void
+Host_RegisterIrq(
+    host_irq_pending pending,
+    host_irq_handler handler
+) {
+    uint8_t i;
+
+    for (i = 0; i < g_byIrqCount; i++) {
+        if (g_pIrq[i].handler == handler) {
+            return;
+        }
+    }
+
+    if (g_byIrqCount < HOST_IRQ_MAX) {
+        g_pIrq[g_byIrqCount].pending = pending;
+        g_pIrq[g_byIrqCount].handler = handler;
+        g_byIrqCount++;
+    }
+}
+
+/**
+ * @func   Host_Poll
+ * @brief  Run handlers of pending interrupts, unless masked or already in
+ *         an interrupt (no nesting)
+ * @param  None
+ * @retval None
+ */
+void
+Host_Poll(void)
+{
+    uint32_t dwCount = 0;
+    uint8_t i;
+
+    if (g_dwPrimask || g_bInIrq) {
+        return;
+    }
+
+    for (i = 0; i < g_byIrqCount; i++) {
+        if (g_pIrq[i].pending()) {
+            if (++dwCount > HOST_IRQ_STORM) {
+                fprintf(stderr, "host: interrupt %u is never cleared\n", i);
+                abort();
+            }
+            g_bInIrq = 1;
+            g_pIrq[i].handler();
+            g_bInIrq = 0;
+            i = (uint8_t)-1;
+        }
+    }
+}
+
+/**
+ * @func   Host_InIrq
+ * @brief  Check code runs in an interrupt handler
+ * @param  None
+ * @retval 1 in handler; 0 otherwise
+ */
+uint8_t
+Host_InIrq(void)
+{
+    return g_bInIrq;
+}
+
+/**
+ * @func   __disable_irq
+ * @brief  Set PRIMASK
+ * @param  None
+ * @retval None
+ */
+void
+__disable_irq(void)
+{
+    g_dwPrimask = 1;
+}
+
+/**
+ * @func   __enable_irq
+ * @brief  Clear PRIMASK, pending interrupts are taken. A critical section
+ *         costs CPU time, so waits built on it see time pass
+ * @param  None
+ * @retval None
+ */
+void
+__enable_irq(void)
+{
+    g_dwPrimask = 0;
+    Host_Poll();
+    Host_Spin();
+}
+
+/**
+ * @func   __get_PRIMASK
+ * @brief  Read PRIMASK
+ * @param  None
+ * @retval 1 if interrupts are masked
+ */
+uint32_t
+__get_PRIMASK(void)
+{
+    return g_dwPrimask;
+}
+
+/**
+ * @func   __set_PRIMASK
+ * @brief  Write PRIMASK. Unmasking is taken as __enable_irq, restoring a
+ *         set mask leaves time alone
+ * @param  priMask: 1 to mask interrupts
+ * @retval None
+ */
+void
+__set_PRIMASK(
+    uint32_t priMask
+) {
+    g_dwPrimask = priMask & 1u;
+    if (g_dwPrimask == 0) {
+        Host_Poll();
+        Host_Spin();
+    }
+}
+
+/**
+ * @func   Host_Check
+ * @brief  Count a check, print it if failed
+ * @param  bOk: result
+ * @param  pCond: text of condition
+ * @param  pFile, iLine: place of check
+ * @retval None
+ */
+void
+Host_Check(
+    uint8_t bOk,
+    const char *pCond,
+    const char *pFile,
+    int iLine
+) {
+    g_dwCheck++;
+
+    if (!bOk) {
+        g_dwFail++;
+        printf("%s:%d: FAIL %s\n", pFile, iLine, pCond);
+    }
+}
+
+/**
+ * @func   Host_Result
+ * @brief  Print result of a test
+ * @param  pName: name of test
+ * @retval Exit code: 0 if all checks passed
+ */
+int
+Host_Result(
+    const char *pName
+) {
+    printf("%s: %u checks, %u failed\n", pName, g_dwCheck, g_dwFail);
+
+    return (g_dwFail == 0) ? 0 : 1;
+}
+
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+/**
+ * @func   Host_NextEvent
+ * @brief  Earliest event due before a time
+ * @param  qwUntil: time (us)
+ * @retval Index of event, -1 if none
+ */
+static int8_t
+Host_NextEvent(
+    uint64_t qwUntil
+) {
+    int8_t iIndex = -1;
+    uint8_t i;
+
+    for (i = 0; i < g_byEventCount; i++) {
+        if ((g_pEvent[i].qwDue <= qwUntil) &&
+            ((iIndex < 0) || (g_pEvent[i].qwDue < g_pEvent[iIndex].qwDue) ||
+             ((g_pEvent[i].qwDue == g_pEvent[iIndex].qwDue) &&
+              (g_pEvent[i].dwSeq < g_pEvent[iIndex].dwSeq)))) {
+            iIndex = (int8_t)i;
+        }
+    }
+
+    return iIndex;
+}
+
+/* END FILE */
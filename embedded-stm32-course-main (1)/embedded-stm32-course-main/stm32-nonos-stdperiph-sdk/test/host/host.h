@@ -0,0 +1,122 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Host build of Middle modules: simulated time, interrupts,
+ *              peripheral models and checks shared by tests of test/
+ *
+ *              Time is simulated in us. Models schedule events (end of a
+ *              byte, of a DMA transfer) and interrupts are delivered when
+ *              pending and not masked, as on target. Busy waits of modules
+ *              spend simulated CPU time through Host_Spin.
+ *
+ *              Binaries are linked with -no-pie: DMA registers are 32 bits,
+ *              DMA buffers must be static so their address fits.
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+#ifndef _HOST_H_
+#define _HOST_H_
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <stdint.h>
+#include <stdio.h>
+#include "stm32f401re.h"
+#include "serial.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+/*! @brief CPU time spent by each Host_Spin (us) */
+#define HOST_SPIN_US                        1u
+
+#define HOST_EVENT_MAX                      32u
+#define HOST_IRQ_MAX                        16u
+#define HOST_FRAME_MAX                      32u
+
+typedef void (*host_event_cb)(void *pData);
+
+/*! @brief Interrupt source: pending returns 1 while handler must run */
+typedef uint8_t (*host_irq_pending)(void);
+typedef void (*host_irq_handler)(void);
+
+/*! @brief Frame sent by Serial_SendPacket */
+typedef struct {
+    uint8_t byCmdId;
+    uint8_t byType;
+    uint8_t byLength;
+    uint8_t pbyPayload[CMD_LENGTH_MAX];
+    uint32_t dwTick;
+} host_frame_t, *host_frame_p;
+
+/*! @brief Check of a test, failure is printed and counted */
+#define HOST_CHECK(cond)                    Host_Check((cond) != 0, #cond, __FILE__, __LINE__)
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/* Time and events -----------------------------------------------------------*/
+void Host_Reset(void);
+uint64_t Host_GetUs(void);
+void Host_Advance(uint32_t dwUs);
+void Host_Spin(void);
+void Host_Schedule(uint32_t dwDelayUs, host_event_cb callback, void *pData);
+void Host_Cancel(host_event_cb callback);
+void Host_CancelData(host_event_cb callback, void *pData);
+
+/* Interrupts ----------------------------------------------------------------*/
+void Host_RegisterIrq(host_irq_pending pending, host_irq_handler handler);
+void Host_Poll(void);
+uint8_t Host_InIrq(void);
+
+/* Checks --------------------------------------------------------------------*/
+void Host_Check(uint8_t bOk, const char *pCond, const char *pFile, int iLine);
+int Host_Result(const char *pName);
+
+/* Software timers of timer.h (host_timer.c) ---------------------------------*/
+void Host_TimerReset(void);
+uint8_t Host_TimerCount(void);
+
+/* Serial frames (host_lib.c) ------------------------------------------------*/
+void Host_SerialReset(void);
+uint8_t Host_SerialCount(void);
+host_frame_p Host_SerialFrame(uint8_t byIndex);
+
+/* Deferred ucg_DrawString (host_ucg.c) -------------------------------------*/
+uint16_t Host_UcgTextPending(void);
+void Host_UcgRunText(void);
+
+/* Peripherals (host_periph.c) -----------------------------------------------*/
+void Host_PeriphReset(void);
+void Host_GpioSetInput(GPIO_TypeDef *pGpio, uint16_t wPin, uint8_t bHigh);
+void Host_GpioSetHook(void (*hook)(GPIO_TypeDef *pGpio, uint16_t wOld));
+uint8_t Host_DmaIndex(DMA_Stream_TypeDef *pStream);
+void Host_DmaSetHook(void (*hook)(DMA_Stream_TypeDef *pStream));
+uint16_t Host_DmaLength(DMA_Stream_TypeDef *pStream);
+void Host_DmaSetFlag(DMA_Stream_TypeDef *pStream, uint32_t dwFlag);
+uint8_t Host_DmaWrite(DMA_Stream_TypeDef *pStream, uint8_t byData);
+uint8_t Host_DmaIrqPending(DMA_Stream_TypeDef *pStream);
+
+/* Timers (host_tim.c) -------------------------------------------------------*/
+void Host_TimReset(void);
+void Host_TimSetHook(void (*hook)(TIM_TypeDef *pTim));
+uint32_t Host_TimCompare(TIM_TypeDef *pTim, uint8_t byChannel);
+uint64_t Host_TimPeriod(TIM_TypeDef *pTim);
+uint32_t Host_TimPrescaler(TIM_TypeDef *pTim);
+uint32_t Host_TimUpdates(TIM_TypeDef *pTim);
+uint8_t Host_TimIrqPending(TIM_TypeDef *pTim);
+
+/* Leds of the library (host_led.c) ------------------------------------------*/
+uint32_t Host_LedBlinkTicks(void);
+
+#endif
+
+/* END FILE */
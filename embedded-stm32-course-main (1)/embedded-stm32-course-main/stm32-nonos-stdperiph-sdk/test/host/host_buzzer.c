@@ -0,0 +1,63 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Host build, BuzzerControl_Init of the prebuilt library on the
+ *              TIM model: PWM of buzzer on TIM3 CH4 (PC9), silent
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include "host.h"
+#include "stm32f401re_tim.h"
+#include "system_stm32f4xx.h"
+#include "buzzer.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define HOST_BUZZER_TIM                     TIM3
+#define HOST_BUZZER_COUNT_HZ                1000000u
+#define HOST_BUZZER_HZ                      1000u
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func   BuzzerControl_Init
+ * @brief  PWM mode 1 at 1 kHz on TIM3 CH4, duty 0
+ * @param  None
+ * @retval None
+ */
+void
+BuzzerControl_Init(void)
+{
+    TIM_TimeBaseInitTypeDef TIM_TimeBaseStructure;
+    TIM_OCInitTypeDef TIM_OCInitStructure;
+
+    TIM_TimeBaseStructure.TIM_Prescaler = (uint16_t)(SystemCoreClock / HOST_BUZZER_COUNT_HZ - 1);
+    TIM_TimeBaseStructure.TIM_Period = HOST_BUZZER_COUNT_HZ / HOST_BUZZER_HZ - 1;
+    TIM_TimeBaseStructure.TIM_ClockDivision = 0;
+    TIM_TimeBaseStructure.TIM_CounterMode = TIM_CounterMode_Up;
+    TIM_TimeBaseStructure.TIM_RepetitionCounter = 0;
+    TIM_TimeBaseInit(HOST_BUZZER_TIM, &TIM_TimeBaseStructure);
+
+    TIM_OCStructInit(&TIM_OCInitStructure);
+    TIM_OCInitStructure.TIM_OCMode = TIM_OCMode_PWM1;
+    TIM_OCInitStructure.TIM_OutputState = TIM_OutputState_Enable;
+    TIM_OCInitStructure.TIM_Pulse = 0;
+    TIM_OC4Init(HOST_BUZZER_TIM, &TIM_OCInitStructure);
+
+    TIM_Cmd(HOST_BUZZER_TIM, ENABLE);
+}
+
+/* END FILE */
@@ -0,0 +1,217 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Host build, ucg_font_7x13B_tf of the prebuilt library, bytes
+ *              of section .rodata.ucg_font_7x13B_tf of ucg_pixel_font_data.o
+ *              in libLibraries.a. Font of host tests drawing text
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include "ucg.h"
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+const ucg_fntpgm_uint8_t ucg_font_7x13B_tf[2253] UCG_FONT_SECTION("ucg_font_7x13B_tf") = {
+    0xBF, 0x00, 0x03, 0x03, 0x03, 0x04, 0x03, 0x05, 0x04, 0x06, 0x0D, 0x00,
+    0xFE, 0x09, 0xFE, 0x09, 0x00, 0x01, 0x7D, 0x02, 0xD8, 0x20, 0x05, 0x00,
+    0xEE, 0x07, 0x21, 0x07, 0x4A, 0xC3, 0xC7, 0xA1, 0x44, 0x22, 0x08, 0x9D,
+    0xDA, 0x87, 0x84, 0x45, 0x00, 0x23, 0x10, 0xCD, 0xC2, 0x4F, 0x52, 0x24,
+    0x72, 0x98, 0xA4, 0x1C, 0x26, 0x49, 0x91, 0x08, 0x00, 0x24, 0x0F, 0x4E,
+    0xC2, 0x97, 0x8C, 0x12, 0xD1, 0x46, 0x93, 0xA8, 0x44, 0x68, 0x22, 0x00,
+    0x25, 0x0F, 0x4E, 0xC2, 0xC7, 0x48, 0x12, 0xA9, 0x04, 0x65, 0x8A, 0x91,
+    0x4A, 0x44, 0x34, 0x26, 0x0F, 0x4E, 0xC2, 0xCF, 0x48, 0xA2, 0xA7, 0x91,
+    0x24, 0x32, 0xA9, 0x88, 0x26, 0x01, 0x27, 0x07, 0x22, 0xD7, 0xC7, 0x21,
+    0x00, 0x28, 0x0C, 0xCC, 0xC2, 0x97, 0x44, 0x24, 0x11, 0xA9, 0x89, 0x64,
+    0x02, 0x29, 0x0D, 0xCC, 0xC2, 0x87, 0x4C, 0x24, 0x13, 0xA9, 0x88, 0x24,
+    0x22, 0x00, 0x2A, 0x0D, 0x36, 0xC6, 0x4F, 0x28, 0x26, 0x3A, 0x94, 0x64,
+    0xA1, 0x08, 0x00, 0x2B, 0x0B, 0x36, 0xC6, 0x97, 0x50, 0x74, 0x28, 0x09,
+    0x45, 0x00, 0x2C, 0x08, 0xA4, 0xBE, 0xCF, 0x8A, 0x12, 0x00, 0x2D, 0x06,
+    0x0E, 0xCE, 0x87, 0x01, 0x2E, 0x08, 0x9C, 0xBE, 0x8F, 0x84, 0x22, 0x01,
+    0x2F, 0x0C, 0x4E, 0xC2, 0xA7, 0x9A, 0x50, 0xA6, 0x28, 0x13, 0x0A, 0x01,
+    0x30, 0x0E, 0x4E, 0xC2, 0x97, 0x2C, 0x14, 0x11, 0xF1, 0x24, 0x09, 0xC5,
+    0x44, 0x00, 0x31, 0x0B, 0x4E, 0xC2, 0x97, 0x6C, 0x14, 0x11, 0xEA, 0xC9,
+    0x00, 0x32, 0x0E, 0x4E, 0xC2, 0x0F, 0x45, 0x44, 0x12, 0x8A, 0x46, 0x32,
+    0xA1, 0xD0, 0x00, 0x33, 0x0D, 0x4E, 0xC2, 0x87, 0x51, 0xA6, 0x46, 0x15,
+    0x92, 0x24, 0x14, 0x00, 0x34, 0x0D, 0x4E, 0xC2, 0xA7, 0x6C, 0x44, 0x91,
+    0x90, 0x48, 0x87, 0xA0, 0x02, 0x35, 0x0E, 0x4E, 0xC2, 0xC7, 0x21, 0x28,
+    0xAC, 0x88, 0x84, 0x42, 0x92, 0x84, 0x02, 0x36, 0x0E, 0x4E, 0xC2, 0x0F,
+    0x45, 0x44, 0x14, 0x56, 0x44, 0x4C, 0x12, 0x0A, 0x00, 0x37, 0x0D, 0x4E,
+    0xC2, 0x87, 0x51, 0x4D, 0x28, 0x13, 0xCA, 0x84, 0x32, 0x00, 0x38, 0x0E,
+    0x4E, 0xC2, 0x0F, 0x45, 0xC4, 0x24, 0xA1, 0x88, 0x98, 0x24, 0x14, 0x00,
+    0x39, 0x0E, 0x4E, 0xC2, 0x0F, 0x45, 0xC4, 0x24, 0x29, 0x0A, 0x49, 0x12,
+    0x0A, 0x00, 0x3A, 0x0C, 0xC4, 0xBE, 0x8F, 0x84, 0x22, 0x87, 0x49, 0x28,
+    0x12, 0x00, 0x3B, 0x0B, 0xC4, 0xBE, 0x8F, 0x84, 0x22, 0x9E, 0x4C, 0x94,
+    0x00, 0x3C, 0x08, 0x4E, 0xC2, 0xA7, 0x4C, 0x57, 0x1D, 0x3D, 0x07, 0x26,
+    0xCA, 0x87, 0x1D, 0x6A, 0x3E, 0x09, 0x4E, 0xC2, 0x87, 0x54, 0x37, 0x1D,
+    0x01, 0x3F, 0x0E, 0x4E, 0xC2, 0x0F, 0x45, 0x44, 0x12, 0x8A, 0x66, 0x72,
+    0x98, 0x50, 0x04, 0x40, 0x0F, 0x4E, 0xC2, 0x0F, 0x25, 0xB6, 0x52, 0x89,
+    0x4C, 0xAA, 0x31, 0x09, 0x05, 0x00, 0x41, 0x0B, 0x4E, 0xC2, 0x0F, 0x45,
+    0xC4, 0x74, 0x18, 0x71, 0x12, 0x42, 0x0C, 0x4E, 0xC2, 0x47, 0x45, 0xC4,
+    0x74, 0x11, 0x31, 0x5D, 0x00, 0x43, 0x0B, 0x4E, 0xC2, 0x0F, 0x45, 0x44,
+    0xD4, 0x93, 0x84, 0x02, 0x44, 0x0A, 0x4E, 0xC2, 0x47, 0x45, 0xC4, 0x4F,
+    0x17, 0x00, 0x45, 0x0B, 0x4E, 0xC2, 0xC7, 0x21, 0xA8, 0x58, 0x11, 0x2A,
+    0x1A, 0x46, 0x0B, 0x4E, 0xC2, 0xC7, 0x21, 0xA8, 0x58, 0x11, 0x6A, 0x04,
+    0x47, 0x0C, 0x4E, 0xC2, 0x0F, 0x45, 0x44, 0x54, 0x29, 0x31, 0x49, 0x0A,
+    0x48, 0x0B, 0x4E, 0xC2, 0x87, 0x88, 0xD3, 0x61, 0xC4, 0x49, 0x00, 0x49,
+    0x09, 0x4E, 0xC2, 0x87, 0x49, 0xA8, 0x4F, 0x06, 0x4A, 0x0A, 0x4E, 0xC2,
+    0xA7, 0x3E, 0x92, 0x24, 0x14, 0x00, 0x4B, 0x0F, 0x4E, 0xC2, 0x87, 0x6C,
+    0x44, 0x91, 0x90, 0x66, 0x24, 0x89, 0x12, 0x2D, 0x00, 0x4C, 0x08, 0x4E,
+    0xC2, 0x87, 0x50, 0x3F, 0x1A, 0x4D, 0x0B, 0x4E, 0xC2, 0x47, 0x70, 0x74,
+    0x38, 0x88, 0x78, 0x12, 0x4E, 0x0D, 0x4E, 0xC2, 0x87, 0x88, 0x54, 0xA9,
+    0x1C, 0x26, 0x4D, 0x24, 0x01, 0x4F, 0x0B, 0x4E, 0xC2, 0x0F, 0x45, 0xC4,
+    0x4F, 0x12, 0x0A, 0x00, 0x50, 0x0B, 0x4E, 0xC2, 0x47, 0x45, 0xC4, 0x74,
+    0x11, 0x6A, 0x04, 0x51, 0x0C, 0x56, 0xBE, 0x0F, 0x45, 0xC4, 0x53, 0x85,
+    0x32, 0xA1, 0x0A, 0x52, 0x0D, 0x4E, 0xC2, 0x47, 0x45, 0xC4, 0x74, 0x21,
+    0x49, 0x94, 0x68, 0x01, 0x53, 0x0E, 0x4E, 0xC2, 0x0F, 0x45, 0x44, 0x94,
+    0x52, 0x85, 0x24, 0x09, 0x05, 0x00, 0x54, 0x09, 0x4E, 0xC2, 0x87, 0x49,
+    0xA8, 0x9F, 0x00, 0x55, 0x0A, 0x4E, 0xC2, 0x87, 0x88, 0x3F, 0x49, 0x28,
+    0x00, 0x56, 0x0D, 0x4E, 0xC2, 0x87, 0x88, 0x49, 0x12, 0xCA, 0x44, 0x13,
+    0x2A, 0x01, 0x57, 0x0B, 0x4E, 0xC2, 0x87, 0x88, 0xA7, 0xC3, 0x41, 0x34,
+    0x0C, 0x58, 0x0F, 0x4E, 0xC2, 0x47, 0x70, 0x24, 0x09, 0x85, 0x68, 0x32,
+    0x52, 0x8A, 0x68, 0x18, 0x59, 0x0C, 0x4E, 0xC2, 0x87, 0x88, 0x24, 0x21,
+    0xD1, 0x84, 0x3A, 0x01, 0x5A, 0x0A, 0x4E, 0xC2, 0x87, 0x51, 0x4D, 0x47,
+    0xA1, 0x01, 0x5B, 0x08, 0xCC, 0xC2, 0x87, 0x49, 0x9F, 0x08, 0x5C, 0x0C,
+    0x4E, 0xC2, 0x87, 0x50, 0x2A, 0x94, 0x2A, 0x4A, 0x85, 0x02, 0x5D, 0x08,
+    0xCC, 0xC2, 0x07, 0x49, 0x9F, 0x0C, 0x5E, 0x09, 0x26, 0xD6, 0x97, 0x8C,
+    0x22, 0x1A, 0x06, 0x5F, 0x07, 0x16, 0xBE, 0xC7, 0xA1, 0x00, 0x60, 0x07,
+    0x9C, 0xDE, 0x87, 0x4C, 0x01, 0x61, 0x0A, 0x36, 0xC2, 0x0F, 0x55, 0x72,
+    0x22, 0x49, 0x0A, 0x62, 0x0B, 0x4E, 0xC2, 0x87, 0x50, 0xB1, 0x22, 0xE2,
+    0x74, 0x01, 0x63, 0x0B, 0x36, 0xC2, 0x0F, 0x45, 0x44, 0x54, 0x92, 0x50,
+    0x00, 0x64, 0x0A, 0x4E, 0xC2, 0xA7, 0x96, 0x13, 0x27, 0x49, 0x01, 0x65,
+    0x0C, 0x36, 0xC2, 0x0F, 0x45, 0x74, 0x18, 0x8A, 0x24, 0x14, 0x00, 0x66,
+    0x0C, 0x4E, 0xC2, 0xD7, 0x48, 0xA2, 0x28, 0xA3, 0x09, 0xB5, 0x01, 0x67,
+    0x0E, 0x46, 0xBA, 0xCF, 0x12, 0x49, 0x42, 0x91, 0x52, 0x44, 0x12, 0x0A,
+    0x00, 0x68, 0x0B, 0x4E, 0xC2, 0x87, 0x50, 0xB1, 0x22, 0xE2, 0x49, 0x00,
+    0x69, 0x0A, 0x4E, 0xC2, 0x97, 0x50, 0x0E, 0x1A, 0xEA, 0x64, 0x6A, 0x0C,
+    0x5E, 0xBA, 0xA7, 0x3A, 0x4C, 0xA8, 0x23, 0x49, 0x42, 0x01, 0x6B, 0x0D,
+    0x4E, 0xC2, 0x87, 0x50, 0x13, 0x45, 0x42, 0x22, 0x49, 0x94, 0x04, 0x6C,
+    0x08, 0x4E, 0xC2, 0xCF, 0x50, 0x3F, 0x19, 0x6D, 0x0A, 0x36, 0xC2, 0x87,
+    0x44, 0x72, 0x38, 0x31, 0x09, 0x6E, 0x09, 0x36, 0xC2, 0x47, 0x45, 0xC4,
+    0x93, 0x00, 0x6F, 0x0A, 0x36, 0xC2, 0x0F, 0x45, 0xC4, 0x49, 0x42, 0x01,
+    0x70, 0x0B, 0x46, 0xBA, 0x47, 0x45, 0xC4, 0x74, 0x11, 0x2A, 0x02, 0x71,
+    0x0A, 0x46, 0xBA, 0xCF, 0x89, 0x49, 0x52, 0xD4, 0x00, 0x72, 0x09, 0x36,
+    0xC2, 0x47, 0x45, 0x44, 0xD4, 0x08, 0x73, 0x0D, 0x36, 0xC2, 0x0F, 0x45,
+    0x24, 0x11, 0x4B, 0x44, 0x12, 0x0A, 0x00, 0x74, 0x0C, 0x46, 0xC2, 0x8F,
+    0x50, 0x56, 0x12, 0x6A, 0x11, 0x4D, 0x00, 0x75, 0x09, 0x36, 0xC2, 0x87,
+    0x88, 0x27, 0x49, 0x01, 0x76, 0x0B, 0x36, 0xC2, 0x87, 0x88, 0x49, 0x42,
+    0xA2, 0x89, 0x00, 0x77, 0x0B, 0x36, 0xC2, 0x87, 0x88, 0xE9, 0x70, 0x09,
+    0x45, 0x00, 0x78, 0x0C, 0x36, 0xC2, 0x87, 0x88, 0x24, 0x21, 0x51, 0x44,
+    0x24, 0x01, 0x79, 0x0C, 0x46, 0xBA, 0x87, 0x88, 0x93, 0xA4, 0x48, 0x92,
+    0x50, 0x00, 0x7A, 0x0A, 0x36, 0xC2, 0x87, 0x51, 0x26, 0x92, 0x09, 0x0D,
+    0x7B, 0x0C, 0xCC, 0xC2, 0x4F, 0x49, 0x26, 0x91, 0x49, 0x44, 0xB2, 0x01,
+    0x7C, 0x07, 0x4A, 0xC3, 0xC7, 0x03, 0x01, 0x7D, 0x0D, 0xCC, 0xC2, 0xC7,
+    0x4C, 0x24, 0x91, 0x49, 0x64, 0xA2, 0x0A, 0x00, 0x7E, 0x09, 0x1E, 0xDA,
+    0x8F, 0xE8, 0x10, 0x92, 0x00, 0xA0, 0x05, 0x00, 0xEE, 0x07, 0xA1, 0x07,
+    0x52, 0xC3, 0x07, 0xE9, 0x70, 0xA2, 0x0F, 0x46, 0xC6, 0x5F, 0xEC, 0x12,
+    0x99, 0x84, 0x24, 0x21, 0x49, 0x4A, 0x2D, 0x04, 0xA3, 0x0D, 0x4E, 0xC2,
+    0xD7, 0x48, 0xA2, 0x28, 0x2B, 0x09, 0x55, 0x56, 0x00, 0xA4, 0x0C, 0x36,
+    0xC6, 0x87, 0xE8, 0x10, 0x09, 0x65, 0x39, 0x84, 0x04, 0xA5, 0x0E, 0x4E,
+    0xC2, 0x87, 0x88, 0x24, 0x21, 0x51, 0x4C, 0x22, 0x93, 0x50, 0x04, 0xA6,
+    0x08, 0x52, 0xC3, 0xC7, 0x21, 0x78, 0x08, 0xA7, 0x0F, 0x56, 0xC2, 0x0F,
+    0x45, 0x44, 0xA5, 0x88, 0x48, 0x12, 0x2A, 0x49, 0x42, 0x01, 0xA8, 0x07,
+    0x95, 0xE2, 0x87, 0x84, 0x22, 0xA9, 0x10, 0x56, 0xC2, 0x0F, 0x45, 0x34,
+    0x94, 0x48, 0x48, 0x24, 0x89, 0xE2, 0x48, 0x42, 0x01, 0xAA, 0x09, 0xBD,
+    0xCA, 0x07, 0xF1, 0x10, 0xBA, 0x16, 0xAB, 0x11, 0x3E, 0xC6, 0x97, 0x24,
+    0x22, 0x89, 0x48, 0x42, 0x91, 0x98, 0x24, 0x26, 0x89, 0x49, 0x02, 0xAC,
+    0x07, 0x26, 0xC6, 0x87, 0x51, 0x03, 0xAD, 0x06, 0x8C, 0xCE, 0x07, 0x01,
+    0xAE, 0x11, 0x56, 0xC2, 0x0F, 0x45, 0x34, 0x94, 0x54, 0x22, 0x93, 0x8A,
+    0x4A, 0x84, 0x24, 0xA1, 0x00, 0xAF, 0x06, 0x8D, 0xE6, 0x47, 0x01, 0xB0,
+    0x0A, 0x26, 0xD6, 0x0F, 0x45, 0x44, 0x92, 0x50, 0x00, 0xB1, 0x0B, 0x3E,
+    0xC6, 0x97, 0x50, 0x64, 0x12, 0xCA, 0x21, 0x06, 0xB2, 0x0A, 0x34, 0xD2,
+    0xC7, 0x24, 0x22, 0x92, 0x28, 0x11, 0xB3, 0x0A, 0x34, 0xD2, 0xC7, 0x24,
+    0xA2, 0x36, 0xA9, 0x00, 0xB4, 0x08, 0x9C, 0xDE, 0x97, 0x44, 0x09, 0x00,
+    0xB5, 0x0A, 0x3E, 0xBE, 0x87, 0x88, 0xA7, 0x83, 0x14, 0x00, 0xB6, 0x10,
+    0x4E, 0xC2, 0xCF, 0xE1, 0x10, 0x69, 0x89, 0x4C, 0x42, 0x92, 0x90, 0x24,
+    0x24, 0x09, 0xB7, 0x06, 0x12, 0xD3, 0x07, 0x01, 0xB8, 0x07, 0x93, 0xBA,
+    0x0F, 0x05, 0x00, 0xB9, 0x09, 0x34, 0xD2, 0x8F, 0x64, 0xA4, 0x85, 0x00,
+    0xBA, 0x09, 0xBD, 0xCE, 0xCF, 0xC4, 0x66, 0x19, 0x17, 0xBB, 0x12, 0x3E,
+    0xC6, 0x47, 0x44, 0x16, 0x91, 0x45, 0x64, 0x91, 0x50, 0x44, 0x12, 0x91,
+    0x44, 0x44, 0x00, 0xBC, 0x0D, 0x56, 0xC2, 0x8F, 0x6C, 0xA8, 0xE9, 0x36,
+    0x92, 0x84, 0x88, 0x02, 0xBD, 0x0D, 0x56, 0xC2, 0x8F, 0x6C, 0xA8, 0x48,
+    0x99, 0x08, 0x65, 0x8A, 0x04, 0xBE, 0x11, 0x56, 0xC2, 0xC7, 0x2C, 0x22,
+    0x93, 0x8A, 0x22, 0x12, 0x8A, 0x6C, 0x24, 0x09, 0x11, 0x05, 0xBF, 0x0F,
+    0x56, 0xC2, 0x97, 0x50, 0x0E, 0x13, 0xCA, 0x14, 0x45, 0x24, 0x09, 0x05,
+    0x00, 0xC0, 0x0E, 0x56, 0xC2, 0x8F, 0x54, 0x0E, 0x93, 0x51, 0x44, 0xA4,
+    0xC3, 0x88, 0x24, 0xC1, 0x0E, 0x56, 0xC2, 0x9F, 0x3A, 0x4C, 0x46, 0x11,
+    0x91, 0x0E, 0x23, 0x92, 0x00, 0xC2, 0x0F, 0x56, 0xC2, 0xD7, 0x48, 0x22,
+    0x87, 0xC8, 0x28, 0x22, 0xD2, 0x61, 0x44, 0x12, 0xC3, 0x0F, 0x56, 0xC2,
+    0x97, 0x24, 0x45, 0x0E, 0x92, 0x51, 0x44, 0xA4, 0xC3, 0x88, 0x24, 0xC4,
+    0x0F, 0x56, 0xC2, 0x87, 0x88, 0x24, 0x87, 0xC8, 0x28, 0x22, 0xD2, 0x61,
+    0x44, 0x12, 0xC5, 0x0F, 0x56, 0xC2, 0x0F, 0x29, 0x89, 0x26, 0xA3, 0x88,
+    0x48, 0x87, 0x11, 0x49, 0x00, 0xC6, 0x0C, 0x4E, 0xC2, 0xCF, 0x61, 0xA2,
+    0x97, 0x43, 0x44, 0x2F, 0x03, 0xC7, 0x0C, 0x5E, 0xBA, 0x0F, 0x45, 0x44,
+    0xD4, 0x93, 0x84, 0xA6, 0x06, 0xC8, 0x0E, 0x56, 0xC2, 0x8F, 0x54, 0x0E,
+    0x39, 0x04, 0x85, 0x24, 0xA1, 0xD0, 0x00, 0xC9, 0x0D, 0x56, 0xC2, 0x9F,
+    0x3A, 0xE4, 0x10, 0x14, 0x92, 0x84, 0x42, 0x03, 0xCA, 0x0E, 0x56, 0xC2,
+    0xD7, 0x48, 0x22, 0x3E, 0x04, 0x85, 0x24, 0xA1, 0xD0, 0x00, 0xCB, 0x0E,
+    0x56, 0xC2, 0x87, 0x88, 0x24, 0x3E, 0x04, 0x85, 0x24, 0xA1, 0xD0, 0x00,
+    0xCC, 0x0B, 0x56, 0xC2, 0x8F, 0x54, 0x0E, 0x31, 0x09, 0x75, 0x32, 0xCD,
+    0x0B, 0x56, 0xC2, 0x9F, 0x3A, 0xC4, 0x24, 0xD4, 0xC9, 0x00, 0xCE, 0x0B,
+    0x56, 0xC2, 0xD7, 0x48, 0x22, 0x36, 0x09, 0x75, 0x32, 0xCF, 0x0B, 0x56,
+    0xC2, 0x87, 0x88, 0x24, 0x36, 0x09, 0x75, 0x32, 0xD0, 0x0C, 0x4E, 0xC2,
+    0x47, 0x49, 0xA2, 0x4B, 0x45, 0x5F, 0x2E, 0x00, 0xD1, 0x0F, 0x56, 0xC2,
+    0x97, 0x24, 0x45, 0x0E, 0x10, 0x91, 0x2A, 0x87, 0x49, 0x89, 0x24, 0xD2,
+    0x0D, 0x56, 0xC2, 0x8F, 0x54, 0x0E, 0xA2, 0x88, 0x78, 0x92, 0x50, 0x00,
+    0xD3, 0x0C, 0x56, 0xC2, 0x9F, 0x3A, 0x88, 0x22, 0xE2, 0x49, 0x42, 0x01,
+    0xD4, 0x0E, 0x56, 0xC2, 0xD7, 0x48, 0x22, 0x07, 0x50, 0x44, 0x3C, 0x49,
+    0x28, 0x00, 0xD5, 0x0E, 0x56, 0xC2, 0x97, 0x24, 0x45, 0x0E, 0xA1, 0x88,
+    0x78, 0x92, 0x50, 0x00, 0xD6, 0x0E, 0x56, 0xC2, 0x87, 0x88, 0x24, 0x07,
+    0x50, 0x44, 0x3C, 0x49, 0x28, 0x00, 0xD7, 0x0B, 0x2E, 0xC6, 0x87, 0x48,
+    0x42, 0x93, 0x51, 0x44, 0x02, 0xD8, 0x0E, 0x56, 0xBE, 0x6F, 0x84, 0x22,
+    0x69, 0xB1, 0xB4, 0x48, 0x28, 0x51, 0x00, 0xD9, 0x0C, 0x56, 0xC2, 0x8F,
+    0x54, 0x0E, 0x11, 0xF1, 0x49, 0x42, 0x01, 0xDA, 0x0C, 0x56, 0xC2, 0x9F,
+    0x3A, 0x44, 0xC4, 0x27, 0x09, 0x05, 0x00, 0xDB, 0x0C, 0x56, 0xC2, 0xD7,
+    0x48, 0x22, 0x16, 0xF1, 0x49, 0x42, 0x01, 0xDC, 0x0C, 0x56, 0xC2, 0x87,
+    0x88, 0x24, 0x16, 0xF1, 0x49, 0x42, 0x01, 0xDD, 0x0E, 0x56, 0xC2, 0x9F,
+    0x3A, 0x44, 0x24, 0x09, 0x85, 0x68, 0x42, 0x4D, 0x00, 0xDE, 0x0C, 0x4E,
+    0xC2, 0x87, 0xB0, 0x22, 0x62, 0xBA, 0x08, 0x15, 0x01, 0xDF, 0x0C, 0x4E,
+    0xC2, 0x0F, 0x45, 0xC4, 0xA2, 0x13, 0x17, 0x09, 0x00, 0xE0, 0x0D, 0x4E,
+    0xC2, 0x97, 0x54, 0x0E, 0xA1, 0x4A, 0x4E, 0x94, 0x49, 0x01, 0xE1, 0x0C,
+    0x4E, 0xC2, 0x9F, 0x3A, 0x88, 0x2A, 0x39, 0x51, 0x26, 0x05, 0xE2, 0x0E,
+    0x4E, 0xC2, 0xD7, 0x48, 0x22, 0x07, 0x50, 0x25, 0x27, 0xCA, 0xA4, 0x00,
+    0xE3, 0x0E, 0x4E, 0xC2, 0x97, 0x24, 0x45, 0x0E, 0xA1, 0x4A, 0x4E, 0x94,
+    0x49, 0x01, 0xE4, 0x0C, 0x4E, 0xC2, 0x8F, 0xEE, 0x00, 0xAA, 0xE4, 0x44,
+    0x99, 0x14, 0xE5, 0x0E, 0x56, 0xC2, 0xD7, 0x2C, 0x12, 0x9B, 0x43, 0xA8,
+    0x92, 0x13, 0x65, 0x52, 0xE6, 0x0E, 0x36, 0xC2, 0x0F, 0x4D, 0x12, 0xB1,
+    0x88, 0x22, 0x92, 0x88, 0x24, 0x02, 0xE7, 0x0C, 0x46, 0xBA, 0x0F, 0x45,
+    0x44, 0x54, 0x92, 0xD0, 0xD4, 0x00, 0xE8, 0x0E, 0x4E, 0xC2, 0x97, 0x54,
+    0x0E, 0xA1, 0x88, 0x0E, 0x43, 0x91, 0x84, 0x02, 0xE9, 0x0E, 0x4E, 0xC2,
+    0x9F, 0x3A, 0x88, 0x22, 0x3A, 0x0C, 0x45, 0x12, 0x0A, 0x00, 0xEA, 0x0F,
+    0x4E, 0xC2, 0xD7, 0x48, 0x22, 0x07, 0x50, 0x44, 0x87, 0xA1, 0x48, 0x42,
+    0x01, 0xEB, 0x0E, 0x4E, 0xC2, 0x8F, 0xEE, 0x00, 0x8A, 0xE8, 0x30, 0x14,
+    0x49, 0x28, 0x00, 0xEC, 0x0A, 0xCC, 0xC2, 0x87, 0x4C, 0x3A, 0xD2, 0x85,
+    0x00, 0xED, 0x0A, 0xCC, 0xC2, 0x97, 0x44, 0x3A, 0xD2, 0x85, 0x00, 0xEE,
+    0x0A, 0x4D, 0xC2, 0xCF, 0x44, 0x79, 0xA6, 0x13, 0x01, 0xEF, 0x0B, 0xCD,
+    0xC2, 0x87, 0x84, 0x22, 0x9D, 0xE9, 0x44, 0x01, 0xF0, 0x0E, 0x56, 0xC2,
+    0x8F, 0x24, 0x26, 0xA3, 0x4A, 0x4E, 0x9C, 0x24, 0x14, 0x00, 0xF1, 0x0D,
+    0x4E, 0xC2, 0x97, 0x24, 0x45, 0x0E, 0xA8, 0x4C, 0x48, 0x9C, 0x04, 0xF2,
+    0x0D, 0x4E, 0xC2, 0x8F, 0x54, 0x0E, 0xA2, 0x88, 0x38, 0x49, 0x28, 0x00,
+    0xF3, 0x0C, 0x4E, 0xC2, 0x9F, 0x3A, 0x88, 0x22, 0xE2, 0x24, 0xA1, 0x00,
+    0xF4, 0x0E, 0x4E, 0xC2, 0xD7, 0x48, 0x22, 0x07, 0x50, 0x44, 0x9C, 0x24,
+    0x14, 0x00, 0xF5, 0x0E, 0x4E, 0xC2, 0x97, 0x24, 0x45, 0x0E, 0xA1, 0x88,
+    0x38, 0x49, 0x28, 0x00, 0xF6, 0x0C, 0x4E, 0xC2, 0x8F, 0xEE, 0x00, 0x8A,
+    0x88, 0x93, 0x84, 0x02, 0xF7, 0x0C, 0x3E, 0xC6, 0x97, 0x50, 0x0E, 0xB1,
+    0x43, 0x84, 0x22, 0x00, 0xF8, 0x0E, 0x4E, 0xBE, 0x6F, 0x84, 0x22, 0xA2,
+    0x94, 0x2A, 0x24, 0x09, 0x25, 0x0A, 0xF9, 0x0B, 0x4E, 0xC2, 0x8F, 0x54,
+    0x0E, 0x11, 0xF1, 0x32, 0x29, 0xFA, 0x0B, 0x4E, 0xC2, 0x9F, 0x3A, 0x44,
+    0xC4, 0xCB, 0xA4, 0x00, 0xFB, 0x0B, 0x4E, 0xC2, 0xD7, 0x48, 0x22, 0x16,
+    0xF1, 0x32, 0x29, 0xFC, 0x0A, 0x4E, 0xC2, 0x8F, 0xCE, 0x22, 0x5E, 0x26,
+    0x05, 0xFD, 0x0E, 0x5E, 0xBA, 0x9F, 0x3A, 0x44, 0xC4, 0x65, 0x52, 0x24,
+    0x49, 0x28, 0x00, 0xFE, 0x0F, 0x56, 0xBA, 0x87, 0x50, 0x45, 0x32, 0x21,
+    0x91, 0x2A, 0x14, 0x45, 0x21, 0x00, 0xFF, 0x0D, 0x5E, 0xBA, 0x8F, 0xCE,
+    0x22, 0x2E, 0x13, 0x45, 0x92, 0x84, 0x02, 0x00, 0x00
+};
+
+/* END FILE */
@@ -0,0 +1,889 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Host build, model of I2C1 master and its bus. Bytes take
+ *              9 bit times of the clock given to I2C_Init, flags of SR1
+ *              are raised as on target and the EV/ER/DMA1 stream 0
+ *              handlers of the module under test are called from them.
+ *              ADDR is cleared when the EV handler returns, in place of
+ *              the read of SR2. SDA is reflected on PB9, clocks of the
+ *              bus recovery are counted on PB8
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <string.h>
+#include "host.h"
+#include "host_i2c.h"
+#include "core_cmFunc.h"
+#include "stm32f401re_gpio.h"
+#include "stm32f401re_i2c.h"
+#include "stm32f401re_dma.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define HOST_I2C_BITS_BYTE                  9u
+#define HOST_I2C_DMA_STREAM                 DMA1_Stream0
+#define HOST_I2C_PIN_SCL                    GPIO_Pin_8
+#define HOST_I2C_PIN_SDA                    GPIO_Pin_9
+#define HOST_I2C_SDA_NEVER                  0xFFu
+
+#define HOST_I2C_EV_FLAGS                   (I2C_SR1_SB | I2C_SR1_ADDR | I2C_SR1_BTF)
+#define HOST_I2C_BUF_FLAGS                  (I2C_SR1_TXE | I2C_SR1_RXNE)
+#define HOST_I2C_ERR_FLAGS                  (I2C_SR1_AF | I2C_SR1_ARLO | I2C_SR1_BERR | I2C_SR1_OVR)
+
+/* Handlers of module under test, not every test links them */
+extern void I2C1_EV_IRQHandler(void) __attribute__((weak));
+extern void I2C1_ER_IRQHandler(void) __attribute__((weak));
+extern void DMA1_Stream0_IRQHandler(void) __attribute__((weak));
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+static host_i2c_slave_p g_ppSlave[HOST_I2C_SLAVE_MAX];
+static uint8_t g_bySlaveCount;
+static host_i2c_slave_p g_pTarget;      /* Slave which ACKed its address */
+
+static uint32_t g_dwBitUs;
+static uint8_t g_bOwned;                /* START done, no STOP yet */
+static uint8_t g_bRead;                 /* Master receiver */
+static uint8_t g_bByteBusy;             /* Byte on the wire */
+static uint8_t g_byShift;               /* Byte on the wire */
+static uint8_t g_bDrFull;               /* Transmitter: next byte in DR */
+static uint8_t g_bRxNack;               /* Receiver: byte on the wire is NACKed */
+static uint8_t g_bRxWait;               /* Receiver: next byte waits DR read */
+static uint64_t g_qwStartUs;
+
+static uint8_t g_byNack;
+static uint8_t g_byArlo;
+static uint8_t g_byBusError;
+static uint8_t g_bSdaLow;
+static uint8_t g_bySdaClocks;
+static uint8_t g_bSclHeld;
+
+static host_i2c_stat_t g_stat;
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static void Host_I2cStartDone(void *pData);
+static void Host_I2cAddressDone(void *pData);
+static void Host_I2cTxDone(void *pData);
+static void Host_I2cRxDone(void *pData);
+static void Host_I2cRxNext(void);
+static void Host_I2cBusError(void);
+static void Host_I2cPendingStop(void);
+static void Host_I2cRelease(void);
+static void Host_I2cAbort(void);
+static void Host_I2cUpdateBusy(void);
+static void Host_I2cGpioHook(GPIO_TypeDef *pGpio, uint16_t wOld);
+static uint8_t Host_I2cEvPending(void);
+static uint8_t Host_I2cErPending(void);
+static uint8_t Host_I2cDmaPending(void);
+static void Host_I2cEvHandler(void);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func   Host_I2cReset
+ * @brief  Bus idle, no slave, no fault, handlers of module registered
+ * @param  None
+ * @retval None
+ */
+void
+Host_I2cReset(void)
+{
+    Host_I2cAbort();
+    memset(&g_hostI2C1, 0, sizeof(g_hostI2C1));
+
+    g_bySlaveCount = 0;
+    g_dwBitUs = 10;
+    g_byNack = 0;
+    g_byArlo = 0;
+    g_byBusError = 0;
+    g_bSdaLow = 0;
+    g_bySdaClocks = 0;
+    g_bSclHeld = 0;
+    memset(&g_stat, 0, sizeof(g_stat));
+
+    Host_GpioSetInput(GPIOB, HOST_I2C_PIN_SCL | HOST_I2C_PIN_SDA, 1);
+    Host_GpioSetHook(Host_I2cGpioHook);
+
+    /* Priority as NVIC: lower IRQ number first */
+    if (DMA1_Stream0_IRQHandler != NULL) {
+        Host_RegisterIrq(Host_I2cDmaPending, DMA1_Stream0_IRQHandler);
+    }
+    if (I2C1_EV_IRQHandler != NULL) {
+        Host_RegisterIrq(Host_I2cEvPending, Host_I2cEvHandler);
+    }
+    if (I2C1_ER_IRQHandler != NULL) {
+        Host_RegisterIrq(Host_I2cErPending, I2C1_ER_IRQHandler);
+    }
+}
+
+/**
+ * @func   Host_I2cAttach
+ * @brief  Put a slave on the bus
+ * @param  pSlave: slave
+ * @retval None
+ */
+void
+Host_I2cAttach(
+    host_i2c_slave_p pSlave
+) {
+    if (g_bySlaveCount < HOST_I2C_SLAVE_MAX) {
+        g_ppSlave[g_bySlaveCount++] = pSlave;
+    }
+}
+
+/**
+ * @func   Host_I2cGetStat
+ * @brief  Bus usage since Host_I2cReset, a transfer on the wire counts
+ *         until now
+ * @param  pStat: usage
+ * @retval None
+ */
+void
+Host_I2cGetStat(
+    host_i2c_stat_p pStat
+) {
+    *pStat = g_stat;
+
+    if (g_bOwned) {
+        pStat->qwBusyUs += Host_GetUs() - g_qwStartUs;
+    }
+}
+
+/**
+ * @func   Host_I2cIsBusy
+ * @brief  Check a transfer is on the wire
+ * @param  None
+ * @retval 1 between START and STOP
+ */
+uint8_t
+Host_I2cIsBusy(void)
+{
+    return g_bOwned;
+}
+
+/**
+ * @func   Host_I2cInjectNack
+ * @brief  Next addresses are NACKed
+ * @param  byCount: number of addresses
+ * @retval None
+ */
+void
+Host_I2cInjectNack(
+    uint8_t byCount
+) {
+    g_byNack = byCount;
+}
+
+/**
+ * @func   Host_I2cInjectArlo
+ * @brief  Arbitration is lost at next STARTs
+ * @param  byCount: number of STARTs
+ * @retval None
+ */
+void
+Host_I2cInjectArlo(
+    uint8_t byCount
+) {
+    g_byArlo = byCount;
+}
+
+/**
+ * @func   Host_I2cInjectBusError
+ * @brief  Misplaced STOP in next bytes: BERR, slave released
+ * @param  byCount: number of bytes
+ * @retval None
+ */
+void
+Host_I2cInjectBusError(
+    uint8_t byCount
+) {
+    g_byBusError = byCount;
+}
+
+/**
+ * @func   Host_I2cHoldSda
+ * @brief  A slave holds SDA low until SCL is clocked by the bus recovery
+ * @param  byClocks: clocks to release, 0 releases now, 0xFF never
+ * @retval None
+ */
+void
+Host_I2cHoldSda(
+    uint8_t byClocks
+) {
+    g_bSdaLow = (byClocks != 0);
+    g_bySdaClocks = byClocks;
+    Host_GpioSetInput(GPIOB, HOST_I2C_PIN_SDA, !g_bSdaLow);
+    Host_I2cUpdateBusy();
+}
+
+/**
+ * @func   Host_I2cHoldScl
+ * @brief  A slave stretches SCL: nothing moves on the bus until released
+ * @param  bHold: 1 to hold; 0 to release
+ * @retval None
+ */
+void
+Host_I2cHoldScl(
+    uint8_t bHold
+) {
+    g_bSclHeld = bHold;
+    Host_I2cUpdateBusy();
+    Host_I2cPendingStop();
+}
+
+/**
+ * @func   Host_I2cSdaClocks
+ * @brief  Clocks left before held SDA is released
+ * @param  None
+ * @retval Clocks, 0 if SDA is free
+ */
+uint8_t
+Host_I2cSdaClocks(void)
+{
+    return g_bSdaLow ? g_bySdaClocks : 0;
+}
+
+/* StdPeriph I2C ------------------------------------------------------------*/
+
+void
+I2C_DeInit(
+    I2C_TypeDef *I2Cx
+) {
+    Host_I2cAbort();
+    memset(I2Cx, 0, sizeof(I2C_TypeDef));
+    Host_I2cUpdateBusy();
+}
+
+void
+I2C_Init(
+    I2C_TypeDef *I2Cx,
+    I2C_InitTypeDef *I2C_InitStruct
+) {
+    g_dwBitUs = (I2C_InitStruct->I2C_ClockSpeed != 0) ?
+                (1000000u / I2C_InitStruct->I2C_ClockSpeed) : 10u;
+    if (g_dwBitUs == 0) {
+        g_dwBitUs = 1;
+    }
+
+    I2Cx->CR1 = (I2Cx->CR1 & ~I2C_CR1_ACK) | I2C_InitStruct->I2C_Ack;
+    I2Cx->OAR1 = I2C_InitStruct->I2C_AcknowledgedAddress | I2C_InitStruct->I2C_OwnAddress1;
+}
+
+void
+I2C_Cmd(
+    I2C_TypeDef *I2Cx,
+    FunctionalState NewState
+) {
+    if (NewState != DISABLE) {
+        I2Cx->CR1 |= I2C_CR1_PE;
+    } else {
+        Host_I2cAbort();
+        I2Cx->CR1 &= ~I2C_CR1_PE;
+    }
+}
+
+void
+I2C_SoftwareResetCmd(
+    I2C_TypeDef *I2Cx,
+    FunctionalState NewState
+) {
+    if (NewState != DISABLE) {
+        Host_I2cAbort();
+        I2Cx->CR1 = I2C_CR1_SWRST;
+        I2Cx->CR2 = 0;
+    } else {
+        I2Cx->CR1 &= ~I2C_CR1_SWRST;
+    }
+}
+
+void
+I2C_GenerateSTART(
+    I2C_TypeDef *I2Cx,
+    FunctionalState NewState
+) {
+    if (NewState == DISABLE) {
+        I2Cx->CR1 &= ~I2C_CR1_START;
+        return;
+    }
+
+    I2Cx->CR1 |= I2C_CR1_START;
+    I2Cx->SR1 &= ~(I2C_SR1_BTF | I2C_SR1_TXE);
+
+    if (I2Cx->CR1 & I2C_CR1_PE) {
+        Host_Cancel(Host_I2cStartDone);
+        Host_Schedule(g_dwBitUs, Host_I2cStartDone, NULL);
+    }
+}
+
+void
+I2C_GenerateSTOP(
+    I2C_TypeDef *I2Cx,
+    FunctionalState NewState
+) {
+    if (NewState == DISABLE) {
+        I2Cx->CR1 &= ~I2C_CR1_STOP;
+        return;
+    }
+
+    I2Cx->CR1 |= I2C_CR1_STOP;
+    I2Cx->SR1 &= ~(I2C_SR1_BTF | I2C_SR1_TXE);
+    Host_I2cPendingStop();
+}
+
+void
+I2C_Send7bitAddress(
+    I2C_TypeDef *I2Cx,
+    uint8_t Address,
+    uint8_t I2C_Direction
+) {
+    g_bRead = (I2C_Direction == I2C_Direction_Receiver);
+    g_byShift = g_bRead ? (Address | 0x01u) : (Address & 0xFEu);
+    I2Cx->DR = g_byShift;
+    I2Cx->SR1 &= ~I2C_SR1_SB;
+
+    g_bByteBusy = 1;
+    Host_Schedule(HOST_I2C_BITS_BYTE * g_dwBitUs, Host_I2cAddressDone, NULL);
+}
+
+void
+I2C_SendData(
+    I2C_TypeDef *I2Cx,
+    uint8_t Data
+) {
+    I2Cx->DR = Data;
+    I2Cx->SR1 &= ~I2C_SR1_BTF;
+
+    if (!g_bByteBusy && g_bOwned && !g_bRead && !(I2Cx->SR1 & I2C_SR1_ADDR)) {
+        /* Shift register empty: DR moves at once, TXE stays set */
+        g_byShift = Data;
+        g_bByteBusy = 1;
+        I2Cx->SR1 |= I2C_SR1_TXE;
+        Host_Schedule(HOST_I2C_BITS_BYTE * g_dwBitUs, Host_I2cTxDone, NULL);
+    } else {
+        g_bDrFull = 1;
+        I2Cx->SR1 &= ~I2C_SR1_TXE;
+    }
+}
+
+uint8_t
+I2C_ReceiveData(
+    I2C_TypeDef *I2Cx
+) {
+    uint8_t byData = (uint8_t)I2Cx->DR;
+
+    I2Cx->SR1 &= ~(I2C_SR1_RXNE | I2C_SR1_BTF);
+
+    if (g_bRxWait) {
+        g_bRxWait = 0;
+        Host_I2cRxNext();
+    }
+
+    return byData;
+}
+
+void
+I2C_AcknowledgeConfig(
+    I2C_TypeDef *I2Cx,
+    FunctionalState NewState
+) {
+    if (NewState != DISABLE) {
+        I2Cx->CR1 |= I2C_CR1_ACK;
+    } else {
+        I2Cx->CR1 &= ~I2C_CR1_ACK;
+    }
+}
+
+void
+I2C_DMACmd(
+    I2C_TypeDef *I2Cx,
+    FunctionalState NewState
+) {
+    if (NewState != DISABLE) {
+        I2Cx->CR2 |= I2C_CR2_DMAEN;
+    } else {
+        I2Cx->CR2 &= ~I2C_CR2_DMAEN;
+    }
+}
+
+void
+I2C_DMALastTransferCmd(
+    I2C_TypeDef *I2Cx,
+    FunctionalState NewState
+) {
+    if (NewState != DISABLE) {
+        I2Cx->CR2 |= I2C_CR2_LAST;
+    } else {
+        I2Cx->CR2 &= ~I2C_CR2_LAST;
+    }
+}
+
+void
+I2C_ITConfig(
+    I2C_TypeDef *I2Cx,
+    uint16_t I2C_IT,
+    FunctionalState NewState
+) {
+    if (NewState != DISABLE) {
+        I2Cx->CR2 |= I2C_IT;
+    } else {
+        I2Cx->CR2 &= (uint16_t)~I2C_IT;
+    }
+}
+
+FlagStatus
+I2C_GetFlagStatus(
+    I2C_TypeDef *I2Cx,
+    uint32_t I2C_FLAG
+) {
+    uint32_t dwStatus = ((uint32_t)I2Cx->SR2 << 16) | I2Cx->SR1;
+
+    return (dwStatus & I2C_FLAG & 0x00FFFFFFu) ? SET : RESET;
+}
+
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+/**
+ * @func   Host_I2cStartDone
+ * @brief  START on the wire once the bus is free, or arbitration lost
+ * @param  pData: unused
+ * @retval None
+ */
+static void
+Host_I2cStartDone(
+    void *pData
+) {
+    (void)pData;
+
+    if (!(I2C1->CR1 & I2C_CR1_START)) {
+        return;
+    }
+
+    if (g_bSclHeld || g_bSdaLow || g_bByteBusy || (I2C1->CR1 & I2C_CR1_STOP)) {
+        /* Lines low or STOP not yet sent: START waits */
+        Host_Schedule(g_dwBitUs, Host_I2cStartDone, NULL);
+        return;
+    }
+
+    I2C1->CR1 &= ~I2C_CR1_START;
+    g_stat.dwStart++;
+
+    if (g_byArlo != 0) {
+        g_byArlo--;
+        I2C1->SR1 |= I2C_SR1_ARLO;
+        Host_I2cRelease();
+        return;
+    }
+
+    if (!g_bOwned) {
+        g_bOwned = 1;
+        g_qwStartUs = Host_GetUs();
+    }
+
+    g_pTarget = NULL;
+    g_bDrFull = 0;
+    g_bRxWait = 0;
+    I2C1->SR1 |= I2C_SR1_SB;
+    I2C1->SR2 |= I2C_SR2_MSL;
+    Host_I2cUpdateBusy();
+}
+
+/**
+ * @func   Host_I2cAddressDone
+ * @brief  Address shifted out, ACK of slave sampled
+ * @param  pData: unused
+ * @retval None
+ */
+static void
+Host_I2cAddressDone(
+    void *pData
+) {
+    host_i2c_slave_p pSlave = NULL;
+    uint8_t bAck;
+    uint8_t i;
+
+    (void)pData;
+
+    if (g_bSclHeld) {
+        Host_Schedule(g_dwBitUs, Host_I2cAddressDone, NULL);
+        return;
+    }
+
+    g_bByteBusy = 0;
+    g_stat.dwByte++;
+
+    if (g_byBusError != 0) {
+        g_byBusError--;
+        Host_I2cBusError();
+        return;
+    }
+
+    for (i = 0; i < g_bySlaveCount; i++) {
+        if (g_ppSlave[i]->byAddress == (g_byShift >> 1)) {
+            pSlave = g_ppSlave[i];
+        }
+    }
+
+    bAck = (pSlave != NULL) &&
+           ((pSlave->start == NULL) || pSlave->start(pSlave->pSlave, g_bRead));
+
+    if (g_byNack != 0) {
+        g_byNack--;
+        bAck = 0;
+    }
+
+    if (!bAck) {
+        g_stat.dwNack++;
+        I2C1->SR1 |= I2C_SR1_AF;
+        Host_I2cPendingStop();
+        return;
+    }
+
+    g_pTarget = pSlave;
+    I2C1->SR1 |= I2C_SR1_ADDR;
+    if (g_bRead) {
+        I2C1->SR2 &= ~I2C_SR2_TRA;
+    } else {
+        I2C1->SR2 |= I2C_SR2_TRA;
+    }
+}
+
+/**
+ * @func   Host_I2cTxDone
+ * @brief  Data byte shifted out, next one taken from DR
+ * @param  pData: unused
+ * @retval None
+ */
+static void
+Host_I2cTxDone(
+    void *pData
+) {
+    uint8_t bAck;
+
+    (void)pData;
+
+    if (g_bSclHeld) {
+        Host_Schedule(g_dwBitUs, Host_I2cTxDone, NULL);
+        return;
+    }
+
+    g_bByteBusy = 0;
+    g_stat.dwByte++;
+
+    if (g_byBusError != 0) {
+        g_byBusError--;
+        Host_I2cBusError();
+        return;
+    }
+
+    bAck = (g_pTarget != NULL) &&
+           ((g_pTarget->write == NULL) || g_pTarget->write(g_pTarget->pSlave, g_byShift));
+
+    if (!bAck) {
+        g_stat.dwNack++;
+        g_bDrFull = 0;
+        I2C1->SR1 |= I2C_SR1_AF;
+        Host_I2cPendingStop();
+        return;
+    }
+
+    if (I2C1->CR1 & I2C_CR1_STOP) {
+        Host_I2cPendingStop();
+    } else if (g_bDrFull) {
+        g_bDrFull = 0;
+        g_byShift = (uint8_t)I2C1->DR;
+        g_bByteBusy = 1;
+        I2C1->SR1 |= I2C_SR1_TXE;
+        Host_Schedule(HOST_I2C_BITS_BYTE * g_dwBitUs, Host_I2cTxDone, NULL);
+    } else {
+        I2C1->SR1 |= I2C_SR1_BTF;
+    }
+}
+
+/**
+ * @func   Host_I2cRxDone
+ * @brief  Data byte shifted in, to DMA or DR
+ * @param  pData: unused
+ * @retval None
+ */
+static void
+Host_I2cRxDone(
+    void *pData
+) {
+    (void)pData;
+
+    if (g_bSclHeld) {
+        Host_Schedule(g_dwBitUs, Host_I2cRxDone, NULL);
+        return;
+    }
+
+    g_bByteBusy = 0;
+    g_stat.dwByte++;
+
+    if (g_byBusError != 0) {
+        g_byBusError--;
+        Host_I2cBusError();
+        return;
+    }
+
+    if ((I2C1->CR2 & I2C_CR2_DMAEN) && (HOST_I2C_DMA_STREAM->CR & DMA_SxCR_EN)) {
+        Host_DmaWrite(HOST_I2C_DMA_STREAM, g_byShift);
+    } else {
+        if (I2C1->SR1 & I2C_SR1_RXNE) {
+            I2C1->SR1 |= I2C_SR1_BTF;
+        }
+        I2C1->DR = g_byShift;
+        I2C1->SR1 |= I2C_SR1_RXNE;
+    }
+
+    if ((I2C1->CR1 & I2C_CR1_STOP) || g_bRxNack) {
+        /* After a NACK, master holds SCL until STOP */
+        Host_I2cPendingStop();
+    } else if (I2C1->CR2 & I2C_CR2_DMAEN) {
+        Host_I2cRxNext();
+    } else {
+        g_bRxWait = 1;
+    }
+}
+
+/**
+ * @func   Host_I2cRxNext
+ * @brief  Shift in next byte, slave may stretch SCL before it. Byte is
+ *         NACKed if ACK is off or DMA is at its last byte with LAST set
+ * @param  None
+ * @retval None
+ */
+static void
+Host_I2cRxNext(void)
+{
+    uint32_t dwStretchUs = 0;
+
+    if (g_bByteBusy || !g_bOwned) {
+        return;
+    }
+
+    g_bRxNack = !(I2C1->CR1 & I2C_CR1_ACK) ||
+                ((I2C1->CR2 & I2C_CR2_DMAEN) && (I2C1->CR2 & I2C_CR2_LAST) &&
+                 (HOST_I2C_DMA_STREAM->NDTR <= 1));
+
+    g_byShift = 0xFF;
+    if ((g_pTarget != NULL) && (g_pTarget->read != NULL)) {
+        g_byShift = g_pTarget->read(g_pTarget->pSlave, &dwStretchUs);
+    }
+
+    g_bByteBusy = 1;
+    Host_Schedule(dwStretchUs + HOST_I2C_BITS_BYTE * g_dwBitUs, Host_I2cRxDone, NULL);
+}
+
+/**
+ * @func   Host_I2cBusError
+ * @brief  Misplaced STOP: BERR, slave and bus released
+ * @param  None
+ * @retval None
+ */
+static void
+Host_I2cBusError(void)
+{
+    I2C1->SR1 |= I2C_SR1_BERR;
+    g_bDrFull = 0;
+    Host_I2cRelease();
+}
+
+/**
+ * @func   Host_I2cPendingStop
+ * @brief  Send STOP asked by CR1 once no byte is on the wire. In receiver
+ *         mode STOP asked with ADDR set follows the first byte
+ * @param  None
+ * @retval None
+ */
+static void
+Host_I2cPendingStop(void)
+{
+    if (!(I2C1->CR1 & I2C_CR1_STOP) || g_bByteBusy || g_bSclHeld ||
+        (g_bRead && (I2C1->SR1 & I2C_SR1_ADDR))) {
+        return;
+    }
+
+    I2C1->CR1 &= ~I2C_CR1_STOP;
+
+    if (g_bOwned) {
+        g_stat.dwStop++;
+    }
+
+    Host_I2cRelease();
+}
+
+/**
+ * @func   Host_I2cRelease
+ * @brief  Bus free: slave sees STOP, master back to slave mode. Data and
+ *         error flags stay for the handlers
+ * @param  None
+ * @retval None
+ */
+static void
+Host_I2cRelease(void)
+{
+    if (g_bOwned) {
+        g_stat.qwBusyUs += Host_GetUs() - g_qwStartUs;
+        g_bOwned = 0;
+    }
+
+    if ((g_pTarget != NULL) && (g_pTarget->stop != NULL)) {
+        g_pTarget->stop(g_pTarget->pSlave);
+    }
+
+    g_pTarget = NULL;
+    g_bRxWait = 0;
+    g_bDrFull = 0;
+    I2C1->SR1 &= ~(I2C_SR1_SB | I2C_SR1_ADDR | I2C_SR1_BTF | I2C_SR1_TXE);
+    I2C1->SR2 &= ~(I2C_SR2_MSL | I2C_SR2_TRA);
+    Host_I2cUpdateBusy();
+}
+
+/**
+ * @func   Host_I2cAbort
+ * @brief  Peripheral disabled or reset: nothing more on the wire
+ * @param  None
+ * @retval None
+ */
+static void
+Host_I2cAbort(void)
+{
+    Host_Cancel(Host_I2cStartDone);
+    Host_Cancel(Host_I2cAddressDone);
+    Host_Cancel(Host_I2cTxDone);
+    Host_Cancel(Host_I2cRxDone);
+
+    g_bByteBusy = 0;
+    Host_I2cRelease();
+
+    I2C1->CR1 &= ~(I2C_CR1_START | I2C_CR1_STOP);
+    I2C1->SR1 = 0;
+    I2C1->SR2 = 0;
+    Host_I2cUpdateBusy();
+}
+
+/**
+ * @func   Host_I2cUpdateBusy
+ * @brief  BUSY of SR2: transfer on the wire or a line held low
+ * @param  None
+ * @retval None
+ */
+static void
+Host_I2cUpdateBusy(void)
+{
+    if (g_bOwned || g_bSdaLow || g_bSclHeld) {
+        I2C1->SR2 |= I2C_SR2_BUSY;
+    } else {
+        I2C1->SR2 &= ~I2C_SR2_BUSY;
+    }
+}
+
+/**
+ * @func   Host_I2cGpioHook
+ * @brief  Clocks of bus recovery: SCL driven as GPIO output, each rising
+ *         edge shifts one bit out of the slave holding SDA
+ * @param  pGpio: port changed
+ * @param  wOld: outputs before change
+ * @retval None
+ */
+static void
+Host_I2cGpioHook(
+    GPIO_TypeDef *pGpio,
+    uint16_t wOld
+) {
+    if ((pGpio != GPIOB) ||
+        (((pGpio->MODER >> (2 * 8)) & 3u) != GPIO_Mode_OUT) ||
+        (wOld & HOST_I2C_PIN_SCL) || !(pGpio->ODR & HOST_I2C_PIN_SCL)) {
+        return;
+    }
+
+    g_stat.dwRecoveryClock++;
+    if (Host_InIrq() || __get_PRIMASK()) {
+        g_stat.dwClockMasked++;
+    }
+
+    if (g_bSdaLow && (g_bySdaClocks != HOST_I2C_SDA_NEVER) && (--g_bySdaClocks == 0)) {
+        Host_I2cHoldSda(0);
+    }
+}
+
+/**
+ * @func   Host_I2cEvPending
+ * @brief  Event interrupt line
+ * @param  None
+ * @retval 1 if pending
+ */
+static uint8_t
+Host_I2cEvPending(void)
+{
+    return (I2C1->CR2 & I2C_CR2_ITEVTEN) &&
+           ((I2C1->SR1 & HOST_I2C_EV_FLAGS) ||
+            ((I2C1->CR2 & I2C_CR2_ITBUFEN) && (I2C1->SR1 & HOST_I2C_BUF_FLAGS)));
+}
+
+/**
+ * @func   Host_I2cErPending
+ * @brief  Error interrupt line
+ * @param  None
+ * @retval 1 if pending
+ */
+static uint8_t
+Host_I2cErPending(void)
+{
+    return (I2C1->CR2 & I2C_CR2_ITERREN) && (I2C1->SR1 & HOST_I2C_ERR_FLAGS);
+}
+
+/**
+ * @func   Host_I2cDmaPending
+ * @brief  Interrupt line of DMA stream of reception
+ * @param  None
+ * @retval 1 if pending
+ */
+static uint8_t
+Host_I2cDmaPending(void)
+{
+    return Host_DmaIrqPending(HOST_I2C_DMA_STREAM);
+}
+
+/**
+ * @func   Host_I2cEvHandler
+ * @brief  Event handler of module, ADDR cleared as by its read of SR2:
+ *         transmitter gets TXE, receiver starts the first byte
+ * @param  None
+ * @retval None
+ */
+static void
+Host_I2cEvHandler(void)
+{
+    uint16_t wSR1 = I2C1->SR1;
+
+    I2C1_EV_IRQHandler();
+
+    if ((wSR1 & I2C_SR1_ADDR) && (I2C1->SR1 & I2C_SR1_ADDR)) {
+        I2C1->SR1 &= ~I2C_SR1_ADDR;
+        if (g_bRead) {
+            Host_I2cRxNext();
+        } else {
+            I2C1->SR1 |= I2C_SR1_TXE;
+        }
+    }
+}
+
+/* END FILE */
@@ -0,0 +1,68 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Host build, model of I2C1 master and its bus: slaves are
+ *              C callbacks, faults (NACK, arbitration lost, bus error, SDA
+ *              held low, SCL stretched) are injected by tests
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+#ifndef _HOST_I2C_H_
+#define _HOST_I2C_H_
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <stdint.h>
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define HOST_I2C_SLAVE_MAX                  4u
+
+/*! @brief Slave on the bus, callbacks may be NULL */
+typedef struct {
+    uint8_t byAddress;                                  /*< 7-bit address */
+    uint8_t (*start)(void *pSlave, uint8_t bRead);      /*< 1 to ACK address */
+    uint8_t (*write)(void *pSlave, uint8_t byData);     /*< 1 to ACK byte */
+    uint8_t (*read)(void *pSlave, uint32_t *pdwStretchUs); /*< Byte, SCL held before it */
+    void (*stop)(void *pSlave);
+    void *pSlave;
+} host_i2c_slave_t, *host_i2c_slave_p;
+
+/*! @brief Bus usage since Host_I2cReset */
+typedef struct {
+    uint32_t dwStart;        /*< START and repeated START */
+    uint32_t dwStop;
+    uint32_t dwByte;         /*< Address and data bytes */
+    uint32_t dwNack;
+    uint64_t qwBusyUs;       /*< START to STOP */
+    uint32_t dwRecoveryClock;  /*< SCL clocked as GPIO */
+    uint32_t dwClockMasked;    /*< Of them, in an interrupt or with interrupts masked */
+} host_i2c_stat_t, *host_i2c_stat_p;
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+void Host_I2cReset(void);
+void Host_I2cAttach(host_i2c_slave_p pSlave);
+void Host_I2cGetStat(host_i2c_stat_p pStat);
+uint8_t Host_I2cIsBusy(void);
+
+/* Faults, each one is used once per count */
+void Host_I2cInjectNack(uint8_t byCount);       /* Address NACKed */
+void Host_I2cInjectArlo(uint8_t byCount);       /* Arbitration lost at START */
+void Host_I2cInjectBusError(uint8_t byCount);   /* Misplaced START/STOP in a byte */
+void Host_I2cHoldSda(uint8_t byClocks);         /* SDA low, released after clocks, 0xFF never */
+void Host_I2cHoldScl(uint8_t bHold);            /* SCL stretched until released */
+uint8_t Host_I2cSdaClocks(void);                /* Clocks left before SDA is released */
+
+#endif
+
+/* END FILE */
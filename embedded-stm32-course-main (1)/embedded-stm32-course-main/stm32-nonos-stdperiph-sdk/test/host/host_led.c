@@ -0,0 +1,318 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Host build, LedControl_* of the prebuilt library on the TIM
+ *              model: PWM of kit 0 on TIM1 CH1N/CH4/CH3, kit 1 on TIM2
+ *              CH2/CH1 and TIM3 CH3 at 17.57 kHz. Levels are set in percent
+ *              of period, blink toggles colors from a software timer in the
+ *              main loop as in the library
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include "host.h"
+#include "stm32f401re_tim.h"
+#include "system_stm32f4xx.h"
+#include "timer.h"
+#include "led.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define HOST_LED_KITS                       2u
+#define HOST_LED_BLINK_LEVEL                100u
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+static volatile uint32_t * const g_pHostLedCcr[HOST_LED_KITS][NUM_OF_COLOR] = {
+    { &TIM1->CCR1, &TIM1->CCR4, &TIM1->CCR3 },
+    { &TIM2->CCR2, &TIM2->CCR1, &TIM3->CCR3 },
+};
+
+static TIM_TypeDef * const g_pHostLedTim[HOST_LED_KITS][NUM_OF_COLOR] = {
+    { TIM1, TIM1, TIM1 },
+    { TIM2, TIM2, TIM3 },
+};
+
+/* Blink of the library: one software timer, toggles of on and off */
+static uint8_t g_byBlinkTimer = NO_TIMER;
+static uint8_t g_byBlinkLed;
+static led_color_t g_blinkColor;
+static uint16_t g_wBlinkToggles;
+static uint8_t g_byBlinkLast;
+static uint8_t g_bBlinkOn;
+static uint32_t g_dwBlinkTicks;
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static void Host_LedPwm(TIM_TypeDef *pTim, uint16_t wChannels);
+static void Host_LedSet(uint8_t byKit, led_color_t color, uint8_t byLevel);
+static void Host_LedBlink(void *pData);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func   LedControl_Init
+ * @brief  PWM of kits, all off. Blink is stopped
+ * @param  None
+ * @retval None
+ */
+void
+LedControl_Init(void)
+{
+    Host_LedPwm(TIM1, 0x0D);
+    Host_LedPwm(TIM2, 0x03);
+    Host_LedPwm(TIM3, 0x04);
+    TIM_CtrlPWMOutputs(TIM1, ENABLE);
+
+    g_byBlinkTimer = NO_TIMER;
+    g_dwBlinkTicks = 0;
+}
+
+/**
+ * @func   LedControl_SetColorIndividual
+ * @brief  Level of one color of a led, others are kept
+ * @param  led_id: LED_KIT_ID0, LED_KIT_ID1 or LED_ALL_ID
+ * @param  led_color: LED_COLOR_RED, LED_COLOR_GREEN or LED_COLOR_BLUE
+ * @param  led_level: level (0 - 100%)
+ * @retval None
+ */
+void
+LedControl_SetColorIndividual(
+    uint8_t led_id,
+    led_color_t led_color,
+    uint8_t led_level
+) {
+    uint8_t i;
+
+    if (!isTypeLED(led_color)) {
+        return;
+    }
+
+    for (i = 0; i < HOST_LED_KITS; i++) {
+        if ((led_id == LED_ALL_ID) || (led_id == LED_KIT_ID0 + i)) {
+            *g_pHostLedCcr[i][led_color] = (uint32_t)led_level *
+                                           (g_pHostLedTim[i][led_color]->ARR + 1) / 100u;
+        }
+    }
+}
+
+/**
+ * @func   LedControl_SetColorGeneral
+ * @brief  Color of a led, colors not in it are off
+ * @param  led_id: LED_KIT_ID0, LED_KIT_ID1 or LED_ALL_ID
+ * @param  led_color: color
+ * @param  led_level: level (0 - 100%)
+ * @retval None
+ */
+void
+LedControl_SetColorGeneral(
+    uint8_t led_id,
+    led_color_t led_color,
+    uint8_t led_level
+) {
+    uint8_t i;
+
+    for (i = 0; i < HOST_LED_KITS; i++) {
+        if ((led_id == LED_ALL_ID) || (led_id == LED_KIT_ID0 + i)) {
+            Host_LedSet(i, led_color, led_level);
+        }
+    }
+}
+
+/**
+ * @func   LedControl_SetAllColor
+ * @brief  Color of all leds
+ * @param  led_color: color
+ * @param  led_level: level (0 - 100%)
+ * @retval None
+ */
+void
+LedControl_SetAllColor(
+    uint8_t led_color,
+    uint8_t led_level
+) {
+    LedControl_SetColorGeneral(LED_ALL_ID, (led_color_t)led_color, led_level);
+}
+
+/**
+ * @func   LedControl_BlinkStart
+ * @brief  Blink a color, on and off for an interval each
+ * @param  led_id: LED_KIT_ID0, LED_KIT_ID1 or LED_ALL_ID
+ * @param  led_blink: color of blink
+ * @param  led_numRepeat: number of blinks, BLINK_FOREVER to run until next
+ *         blink
+ * @param  led_interval: time on and time off (ms)
+ * @param  led_lastState: level after last blink (0 - 100%)
+ * @retval None
+ */
+void
+LedControl_BlinkStart(
+    uint8_t led_id,
+    led_blink_type_t led_blink,
+    uint8_t led_numRepeat,
+    uint16_t led_interval,
+    uint8_t led_lastState
+) {
+    static const led_color_t pColor[BLINK_COLOR_MAX] = {
+        LED_COLOR_RED, LED_COLOR_BLUE, LED_COLOR_GREEN, LED_COLOR_WHITE
+    };
+
+    if (g_byBlinkTimer != NO_TIMER) {
+        TimerStop(g_byBlinkTimer);
+        g_byBlinkTimer = NO_TIMER;
+    }
+
+    if ((led_blink >= BLINK_COLOR_MAX) || (led_numRepeat == 0)) {
+        return;
+    }
+
+    g_byBlinkLed = led_id;
+    g_blinkColor = pColor[led_blink];
+    g_wBlinkToggles = (led_numRepeat == BLINK_FOREVER) ? 0 : (uint16_t)(2u * led_numRepeat);
+    g_byBlinkLast = led_lastState;
+
+    g_bBlinkOn = 1;
+    LedControl_SetColorGeneral(led_id, g_blinkColor, HOST_LED_BLINK_LEVEL);
+    g_byBlinkTimer = TimerStart("led_blink", led_interval, TIMER_REPEAT_FOREVER,
+                                Host_LedBlink, NULL);
+}
+
+/**
+ * @func   LedControl_SendPacketRespond
+ * @brief  Not used on host
+ * @param  led_id, led_color, led_level: status
+ * @retval None
+ */
+void
+LedControl_SendPacketRespond(
+    uint8_t led_id,
+    uint8_t led_color,
+    uint8_t led_level
+) {
+    (void)led_id;
+    (void)led_color;
+    (void)led_level;
+}
+
+/**
+ * @func   Host_LedBlinkTicks
+ * @brief  Number of blink callbacks run by the main loop since
+ *         LedControl_Init
+ * @param  None
+ * @retval Number of callbacks
+ */
+uint32_t
+Host_LedBlinkTicks(void)
+{
+    return g_dwBlinkTicks;
+}
+
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+/**
+ * @func   Host_LedPwm
+ * @brief  PWM mode 1 at 17.57 kHz on channels of a timer, compare values
+ *         written directly
+ * @param  pTim: timer
+ * @param  wChannels: bit n for channel n + 1
+ * @retval None
+ */
+static void
+Host_LedPwm(
+    TIM_TypeDef *pTim,
+    uint16_t wChannels
+) {
+    TIM_TimeBaseInitTypeDef TIM_TimeBaseStructure;
+    TIM_OCInitTypeDef TIM_OCInitStructure;
+
+    TIM_TimeBaseStructure.TIM_Prescaler = 0;
+    TIM_TimeBaseStructure.TIM_Period = LED_TIMER_PERIOD;
+    TIM_TimeBaseStructure.TIM_ClockDivision = 0;
+    TIM_TimeBaseStructure.TIM_CounterMode = TIM_CounterMode_Up;
+    TIM_TimeBaseStructure.TIM_RepetitionCounter = 0;
+    TIM_TimeBaseInit(pTim, &TIM_TimeBaseStructure);
+
+    TIM_OCStructInit(&TIM_OCInitStructure);
+    TIM_OCInitStructure.TIM_OCMode = TIM_OCMode_PWM1;
+    TIM_OCInitStructure.TIM_OutputState = TIM_OutputState_Enable;
+    TIM_OCInitStructure.TIM_Pulse = 0;
+
+    if (wChannels & 0x01) {
+        TIM_OC1Init(pTim, &TIM_OCInitStructure);
+    }
+    if (wChannels & 0x02) {
+        TIM_OC2Init(pTim, &TIM_OCInitStructure);
+    }
+    if (wChannels & 0x04) {
+        TIM_OC3Init(pTim, &TIM_OCInitStructure);
+    }
+    if (wChannels & 0x08) {
+        TIM_OC4Init(pTim, &TIM_OCInitStructure);
+    }
+
+    TIM_Cmd(pTim, ENABLE);
+}
+
+/**
+ * @func   Host_LedSet
+ * @brief  Colors of a kit at a level, others off
+ * @param  byKit: 0 or 1
+ * @param  color: color
+ * @param  byLevel: level (0 - 100%)
+ * @retval None
+ */
+static void
+Host_LedSet(
+    uint8_t byKit,
+    led_color_t color,
+    uint8_t byLevel
+) {
+    /* Colors of led_color_t: bit 0 red, bit 1 green, bit 2 blue */
+    static const uint8_t pbyMask[] = { 0x01, 0x02, 0x04, 0x07, 0x00, 0x03 };
+    uint8_t byMask = (color < sizeof(pbyMask)) ? pbyMask[color] : 0;
+    uint8_t i;
+
+    for (i = 0; i < NUM_OF_COLOR; i++) {
+        *g_pHostLedCcr[byKit][i] = (byMask & (1u << i)) ?
+                                   (uint32_t)byLevel * (g_pHostLedTim[byKit][i]->ARR + 1) / 100u : 0;
+    }
+}
+
+/**
+ * @func   Host_LedBlink
+ * @brief  Timer callback, toggle led. After last toggle it keeps last state
+ * @param  pData: not used
+ * @retval None
+ */
+static void
+Host_LedBlink(
+    void *pData
+) {
+    (void)pData;
+
+    g_dwBlinkTicks++;
+    g_bBlinkOn = !g_bBlinkOn;
+    LedControl_SetColorGeneral(g_byBlinkLed, g_blinkColor, g_bBlinkOn ? HOST_LED_BLINK_LEVEL : 0);
+
+    if ((g_wBlinkToggles != 0) && (--g_wBlinkToggles == 0)) {
+        TimerStop(g_byBlinkTimer);
+        g_byBlinkTimer = NO_TIMER;
+        LedControl_SetColorGeneral(g_byBlinkLed, g_blinkColor, g_byBlinkLast);
+    }
+}
+
+/* END FILE */
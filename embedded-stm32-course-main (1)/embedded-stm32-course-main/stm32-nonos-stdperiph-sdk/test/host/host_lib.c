@@ -0,0 +1,138 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Host build, functions of the prebuilt library used by Middle
+ *              modules: utilities.h and Serial_SendPacket, whose frames are
+ *              kept for checks
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <string.h>
+#include "host.h"
+#include "utilities.h"
+#include "timer.h"
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+static host_frame_t g_pFrame[HOST_FRAME_MAX];
+static uint8_t g_byFrameCount;
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func   memcpyl
+ * @brief  Copy memory
+ * @param  dst, src, size: as memcpy
+ * @retval None
+ */
+void
+memcpyl(
+    uint8_t *dst,
+    uint8_t *src,
+    uint16_t size
+) {
+    memcpy(dst, src, size);
+}
+
+/**
+ * @func   memsetl
+ * @brief  Fill memory
+ * @param  dst, value, size: as memset
+ * @retval None
+ */
+void
+memsetl(
+    uint8_t *dst,
+    uint8_t value,
+    uint16_t size
+) {
+    memset(dst, value, size);
+}
+
+/**
+ * @func   Serial_SendPacket
+ * @brief  Keep a frame, the oldest is dropped when full
+ * @param  byOption: unused
+ * @param  byCmdId, byType, pPayload, byLengthPayload: frame
+ * @retval None
+ */
+void
+Serial_SendPacket(
+    uint8_t byOption,
+    uint8_t byCmdId,
+    uint8_t byType,
+    uint8_t *pPayload,
+    uint8_t byLengthPayload
+) {
+    host_frame_p pFrame;
+
+    (void)byOption;
+
+    if (g_byFrameCount >= HOST_FRAME_MAX) {
+        memmove(&g_pFrame[0], &g_pFrame[1], sizeof(host_frame_t) * (HOST_FRAME_MAX - 1));
+        g_byFrameCount--;
+    }
+
+    if (byLengthPayload > CMD_LENGTH_MAX) {
+        byLengthPayload = CMD_LENGTH_MAX;
+    }
+
+    pFrame = &g_pFrame[g_byFrameCount++];
+    pFrame->byCmdId = byCmdId;
+    pFrame->byType = byType;
+    pFrame->byLength = byLengthPayload;
+    memcpy(pFrame->pbyPayload, pPayload, byLengthPayload);
+    pFrame->dwTick = GetMilSecTick();
+}
+
+/**
+ * @func   Host_SerialReset
+ * @brief  Drop frames
+ * @param  None
+ * @retval None
+ */
+void
+Host_SerialReset(void)
+{
+    g_byFrameCount = 0;
+}
+
+/**
+ * @func   Host_SerialCount
+ * @brief  Frames sent since Host_SerialReset
+ * @param  None
+ * @retval Number of frames
+ */
+uint8_t
+Host_SerialCount(void)
+{
+    return g_byFrameCount;
+}
+
+/**
+ * @func   Host_SerialFrame
+ * @brief  Get a frame
+ * @param  byIndex: 0 for oldest
+ * @retval Frame, NULL if none
+ */
+host_frame_p
+Host_SerialFrame(
+    uint8_t byIndex
+) {
+    return (byIndex < g_byFrameCount) ? &g_pFrame[byIndex] : NULL;
+}
+
+/* END FILE */
@@ -0,0 +1,623 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Host build, StdPeriph functions of RCC, NVIC, GPIO, EXTI,
+ *              SYSCFG and DMA on the RAM registers of stm32f401re.h (host).
+ *              Pins read the level set by the test, an output driven low
+ *              pulls it down. An edge on a pin mapped to an EXTI line sets
+ *              its pending bit
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <string.h>
+#include "host.h"
+#include "stm32f401re_rcc.h"
+#include "stm32f401re_gpio.h"
+#include "stm32f401re_exti.h"
+#include "stm32f401re_syscfg.h"
+#include "stm32f401re_dma.h"
+#include "misc.h"
+#include "system_stm32f4xx.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define HOST_DMA_FLAG_MASK                  0x0F7D0F7Du
+#define HOST_DMA_STREAM_FLAGS               0x3Du   /* Flags of stream 0 */
+#define HOST_DMA_CR_IT_MASK                 (DMA_IT_TC | DMA_IT_HT | DMA_IT_TE | DMA_IT_DME)
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+static uint16_t g_pwInput[HOST_GPIO_PORTS];
+static void (*g_gpioHook)(GPIO_TypeDef *pGpio, uint16_t wOld);
+static void (*g_dmaHook)(DMA_Stream_TypeDef *pStream);
+static uint16_t g_pwDmaLength[2 * HOST_DMA_STREAMS];
+
+/* Bit of flags of a stream in LISR/HISR */
+static const uint8_t g_pbyDmaShift[4] = { 0, 6, 16, 22 };
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+uint32_t SystemCoreClock = 84000000u;
+
+GPIO_TypeDef g_pHostGpio[HOST_GPIO_PORTS];
+TIM_TypeDef g_pHostTim[HOST_TIMERS];
+I2C_TypeDef g_hostI2C1;
+SPI_TypeDef g_hostSpi1;
+EXTI_TypeDef g_hostExti;
+SYSCFG_TypeDef g_hostSyscfg;
+ADC_TypeDef g_hostAdc1;
+DMA_TypeDef g_pHostDma[2];
+DMA_Stream_TypeDef g_pHostDma1Stream[HOST_DMA_STREAMS];
+DMA_Stream_TypeDef g_pHostDma2Stream[HOST_DMA_STREAMS];
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static void Host_GpioUpdate(GPIO_TypeDef *pGpio, uint16_t wOld);
+static __IO uint32_t *Host_DmaIsr(DMA_Stream_TypeDef *pStream);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func   Host_PeriphReset
+ * @brief  Registers to reset value, all pins high (pull-up)
+ * @param  None
+ * @retval None
+ */
+void
+Host_PeriphReset(void)
+{
+    uint8_t i;
+
+    memset(g_pHostGpio, 0, sizeof(g_pHostGpio));
+    memset(g_pHostTim, 0, sizeof(g_pHostTim));
+    memset(&g_hostI2C1, 0, sizeof(g_hostI2C1));
+    memset(&g_hostSpi1, 0, sizeof(g_hostSpi1));
+    memset(&g_hostExti, 0, sizeof(g_hostExti));
+    memset(&g_hostSyscfg, 0, sizeof(g_hostSyscfg));
+    memset(&g_hostAdc1, 0, sizeof(g_hostAdc1));
+    memset(g_pHostDma, 0, sizeof(g_pHostDma));
+    memset(g_pHostDma1Stream, 0, sizeof(g_pHostDma1Stream));
+    memset(g_pHostDma2Stream, 0, sizeof(g_pHostDma2Stream));
+
+    for (i = 0; i < HOST_GPIO_PORTS; i++) {
+        g_pwInput[i] = 0xFFFF;
+        g_pHostGpio[i].IDR = 0xFFFF;
+    }
+
+    g_gpioHook = NULL;
+    g_dmaHook = NULL;
+}
+
+/* RCC, NVIC -----------------------------------------------------------------*/
+
+void
+RCC_AHB1PeriphClockCmd(
+    uint32_t RCC_AHB1Periph,
+    FunctionalState NewState
+) {
+    (void)RCC_AHB1Periph;
+    (void)NewState;
+}
+
+void
+RCC_APB1PeriphClockCmd(
+    uint32_t RCC_APB1Periph,
+    FunctionalState NewState
+) {
+    (void)RCC_APB1Periph;
+    (void)NewState;
+}
+
+void
+RCC_APB2PeriphClockCmd(
+    uint32_t RCC_APB2Periph,
+    FunctionalState NewState
+) {
+    (void)RCC_APB2Periph;
+    (void)NewState;
+}
+
+void
+NVIC_Init(
+    NVIC_InitTypeDef *NVIC_InitStruct
+) {
+    (void)NVIC_InitStruct;
+}
+
+/* GPIO ----------------------------------------------------------------------*/
+
+void
+GPIO_Init(
+    GPIO_TypeDef *GPIOx,
+    GPIO_InitTypeDef *GPIO_InitStruct
+) {
+    uint16_t wOld = (uint16_t)GPIOx->ODR;
+    uint8_t i;
+
+    for (i = 0; i < 16; i++) {
+        if (GPIO_InitStruct->GPIO_Pin & (1u << i)) {
+            GPIOx->MODER = (GPIOx->MODER & ~(3u << (2 * i))) |
+                           ((uint32_t)GPIO_InitStruct->GPIO_Mode << (2 * i));
+            GPIOx->PUPDR = (GPIOx->PUPDR & ~(3u << (2 * i))) |
+                           ((uint32_t)GPIO_InitStruct->GPIO_PuPd << (2 * i));
+            GPIOx->OTYPER = (GPIOx->OTYPER & ~(1u << i)) |
+                            ((uint32_t)GPIO_InitStruct->GPIO_OType << i);
+        }
+    }
+
+    Host_GpioUpdate(GPIOx, wOld);
+}
+
+void
+GPIO_PinAFConfig(
+    GPIO_TypeDef *GPIOx,
+    uint16_t GPIO_PinSource,
+    uint8_t GPIO_AF
+) {
+    uint8_t byShift = (uint8_t)((GPIO_PinSource & 7u) * 4);
+
+    GPIOx->AFR[GPIO_PinSource >> 3] = (GPIOx->AFR[GPIO_PinSource >> 3] & ~(0xFu << byShift)) |
+                                      ((uint32_t)GPIO_AF << byShift);
+}
+
+uint8_t
+GPIO_ReadInputDataBit(
+    GPIO_TypeDef *GPIOx,
+    uint16_t GPIO_Pin
+) {
+    return (GPIOx->IDR & GPIO_Pin) ? Bit_SET : Bit_RESET;
+}
+
+uint16_t
+GPIO_ReadInputData(
+    GPIO_TypeDef *GPIOx
+) {
+    return (uint16_t)GPIOx->IDR;
+}
+
+uint8_t
+GPIO_ReadOutputDataBit(
+    GPIO_TypeDef *GPIOx,
+    uint16_t GPIO_Pin
+) {
+    return (GPIOx->ODR & GPIO_Pin) ? Bit_SET : Bit_RESET;
+}
+
+void
+GPIO_SetBits(
+    GPIO_TypeDef *GPIOx,
+    uint16_t GPIO_Pin
+) {
+    uint16_t wOld = (uint16_t)GPIOx->ODR;
+
+    GPIOx->ODR |= GPIO_Pin;
+    Host_GpioUpdate(GPIOx, wOld);
+}
+
+void
+GPIO_ResetBits(
+    GPIO_TypeDef *GPIOx,
+    uint16_t GPIO_Pin
+) {
+    uint16_t wOld = (uint16_t)GPIOx->ODR;
+
+    GPIOx->ODR &= ~(uint32_t)GPIO_Pin;
+    Host_GpioUpdate(GPIOx, wOld);
+}
+
+void
+GPIO_WriteBit(
+    GPIO_TypeDef *GPIOx,
+    uint16_t GPIO_Pin,
+    BitAction BitVal
+) {
+    if (BitVal != Bit_RESET) {
+        GPIO_SetBits(GPIOx, GPIO_Pin);
+    } else {
+        GPIO_ResetBits(GPIOx, GPIO_Pin);
+    }
+}
+
+void
+GPIO_ToggleBits(
+    GPIO_TypeDef *GPIOx,
+    uint16_t GPIO_Pin
+) {
+    uint16_t wOld = (uint16_t)GPIOx->ODR;
+
+    GPIOx->ODR ^= GPIO_Pin;
+    Host_GpioUpdate(GPIOx, wOld);
+}
+
+/**
+ * @func   Host_GpioSetInput
+ * @brief  Level driven on pins from outside
+ * @param  pGpio: port
+ * @param  wPin: pins
+ * @param  bHigh: 1 high; 0 low
+ * @retval None
+ */
+void
+Host_GpioSetInput(
+    GPIO_TypeDef *pGpio,
+    uint16_t wPin,
+    uint8_t bHigh
+) {
+    uint8_t byPort = (uint8_t)(pGpio - g_pHostGpio);
+
+    if (bHigh) {
+        g_pwInput[byPort] |= wPin;
+    } else {
+        g_pwInput[byPort] &= ~wPin;
+    }
+
+    Host_GpioUpdate(pGpio, (uint16_t)pGpio->ODR);
+}
+
+/**
+ * @func   Host_GpioSetHook
+ * @brief  Called after each change of outputs or input levels
+ * @param  hook: model of a device on pins, NULL to remove
+ * @retval None
+ */
+void
+Host_GpioSetHook(
+    void (*hook)(GPIO_TypeDef *pGpio, uint16_t wOld)
+) {
+    g_gpioHook = hook;
+}
+
+/* EXTI, SYSCFG --------------------------------------------------------------*/
+
+void
+SYSCFG_EXTILineConfig(
+    uint8_t EXTI_PortSourceGPIOx,
+    uint8_t EXTI_PinSourcex
+) {
+    uint8_t byShift = (uint8_t)((EXTI_PinSourcex & 3u) * 4);
+
+    SYSCFG->EXTICR[EXTI_PinSourcex >> 2] = (SYSCFG->EXTICR[EXTI_PinSourcex >> 2] & ~(0xFu << byShift)) |
+                                           ((uint32_t)EXTI_PortSourceGPIOx << byShift);
+}
+
+void
+EXTI_Init(
+    EXTI_InitTypeDef *EXTI_InitStruct
+) {
+    uint32_t dwLine = EXTI_InitStruct->EXTI_Line;
+
+    EXTI->IMR &= ~dwLine;
+    EXTI->EMR &= ~dwLine;
+    EXTI->RTSR &= ~dwLine;
+    EXTI->FTSR &= ~dwLine;
+
+    if (EXTI_InitStruct->EXTI_LineCmd == DISABLE) {
+        return;
+    }
+
+    if (EXTI_InitStruct->EXTI_Mode == EXTI_Mode_Interrupt) {
+        EXTI->IMR |= dwLine;
+    } else {
+        EXTI->EMR |= dwLine;
+    }
+
+    if (EXTI_InitStruct->EXTI_Trigger != EXTI_Trigger_Falling) {
+        EXTI->RTSR |= dwLine;
+    }
+    if (EXTI_InitStruct->EXTI_Trigger != EXTI_Trigger_Rising) {
+        EXTI->FTSR |= dwLine;
+    }
+}
+
+ITStatus
+EXTI_GetITStatus(
+    uint32_t EXTI_Line
+) {
+    return ((EXTI->PR & EXTI_Line) && (EXTI->IMR & EXTI_Line)) ? SET : RESET;
+}
+
+void
+EXTI_ClearITPendingBit(
+    uint32_t EXTI_Line
+) {
+    EXTI->PR &= ~EXTI_Line;
+}
+
+/* DMA -----------------------------------------------------------------------*/
+
+void
+DMA_DeInit(
+    DMA_Stream_TypeDef *DMAy_Streamx
+) {
+    memset((void *)DMAy_Streamx, 0, sizeof(DMA_Stream_TypeDef));
+    *Host_DmaIsr(DMAy_Streamx) &= ~(HOST_DMA_STREAM_FLAGS << g_pbyDmaShift[Host_DmaIndex(DMAy_Streamx) & 3u]);
+}
+
+void
+DMA_Init(
+    DMA_Stream_TypeDef *DMAy_Streamx,
+    DMA_InitTypeDef *DMA_InitStruct
+) {
+    DMAy_Streamx->CR = DMA_InitStruct->DMA_Channel | DMA_InitStruct->DMA_DIR |
+                       DMA_InitStruct->DMA_PeripheralInc | DMA_InitStruct->DMA_MemoryInc |
+                       DMA_InitStruct->DMA_PeripheralDataSize |
+                       DMA_InitStruct->DMA_MemoryDataSize | DMA_InitStruct->DMA_Mode |
+                       DMA_InitStruct->DMA_Priority | DMA_InitStruct->DMA_MemoryBurst |
+                       DMA_InitStruct->DMA_PeripheralBurst;
+    DMAy_Streamx->FCR = DMA_InitStruct->DMA_FIFOMode | DMA_InitStruct->DMA_FIFOThreshold;
+    DMAy_Streamx->NDTR = DMA_InitStruct->DMA_BufferSize;
+    DMAy_Streamx->PAR = DMA_InitStruct->DMA_PeripheralBaseAddr;
+    DMAy_Streamx->M0AR = DMA_InitStruct->DMA_Memory0BaseAddr;
+}
+
+void
+DMA_Cmd(
+    DMA_Stream_TypeDef *DMAy_Streamx,
+    FunctionalState NewState
+) {
+    if (NewState != DISABLE) {
+        DMAy_Streamx->CR |= DMA_SxCR_EN;
+        g_pwDmaLength[Host_DmaIndex(DMAy_Streamx)] = (uint16_t)DMAy_Streamx->NDTR;
+        if (g_dmaHook != NULL) {
+            g_dmaHook(DMAy_Streamx);
+        }
+    } else {
+        DMAy_Streamx->CR &= ~DMA_SxCR_EN;
+    }
+}
+
+void
+DMA_SetCurrDataCounter(
+    DMA_Stream_TypeDef *DMAy_Streamx,
+    uint16_t Counter
+) {
+    DMAy_Streamx->NDTR = Counter;
+}
+
+uint16_t
+DMA_GetCurrDataCounter(
+    DMA_Stream_TypeDef *DMAy_Streamx
+) {
+    Host_Spin();
+    return (uint16_t)DMAy_Streamx->NDTR;
+}
+
+FunctionalState
+DMA_GetCmdStatus(
+    DMA_Stream_TypeDef *DMAy_Streamx
+) {
+    Host_Spin();
+    return (DMAy_Streamx->CR & DMA_SxCR_EN) ? ENABLE : DISABLE;
+}
+
+FlagStatus
+DMA_GetFlagStatus(
+    DMA_Stream_TypeDef *DMAy_Streamx,
+    uint32_t DMA_FLAG
+) {
+    Host_Spin();
+    return (*Host_DmaIsr(DMAy_Streamx) & DMA_FLAG & HOST_DMA_FLAG_MASK) ? SET : RESET;
+}
+
+void
+DMA_ClearFlag(
+    DMA_Stream_TypeDef *DMAy_Streamx,
+    uint32_t DMA_FLAG
+) {
+    *Host_DmaIsr(DMAy_Streamx) &= ~(DMA_FLAG & HOST_DMA_FLAG_MASK);
+}
+
+void
+DMA_ITConfig(
+    DMA_Stream_TypeDef *DMAy_Streamx,
+    uint32_t DMA_IT,
+    FunctionalState NewState
+) {
+    uint32_t dwMask = DMA_IT & HOST_DMA_CR_IT_MASK;
+
+    if (NewState != DISABLE) {
+        DMAy_Streamx->CR |= dwMask;
+    } else {
+        DMAy_Streamx->CR &= ~dwMask;
+    }
+}
+
+ITStatus
+DMA_GetITStatus(
+    DMA_Stream_TypeDef *DMAy_Streamx,
+    uint32_t DMA_IT
+) {
+    return (*Host_DmaIsr(DMAy_Streamx) & DMA_IT & HOST_DMA_FLAG_MASK) ? SET : RESET;
+}
+
+void
+DMA_ClearITPendingBit(
+    DMA_Stream_TypeDef *DMAy_Streamx,
+    uint32_t DMA_IT
+) {
+    DMA_ClearFlag(DMAy_Streamx, DMA_IT);
+}
+
+/**
+ * @func   Host_DmaIndex
+ * @brief  Index of a stream: 0 - 7 DMA1, 8 - 15 DMA2
+ * @param  pStream: stream
+ * @retval Index
+ */
+uint8_t
+Host_DmaIndex(
+    DMA_Stream_TypeDef *pStream
+) {
+    if ((pStream >= g_pHostDma1Stream) && (pStream < &g_pHostDma1Stream[HOST_DMA_STREAMS])) {
+        return (uint8_t)(pStream - g_pHostDma1Stream);
+    }
+
+    return (uint8_t)(HOST_DMA_STREAMS + (pStream - g_pHostDma2Stream));
+}
+
+/**
+ * @func   Host_DmaSetHook
+ * @brief  Called when a stream is enabled, for peripherals which request
+ *         data on their own (memory to peripheral)
+ * @param  hook: model of the peripheral, NULL to remove
+ * @retval None
+ */
+void
+Host_DmaSetHook(
+    void (*hook)(DMA_Stream_TypeDef *pStream)
+) {
+    g_dmaHook = hook;
+}
+
+/**
+ * @func   Host_DmaLength
+ * @brief  Number of data of the transfer started last on a stream
+ * @param  pStream: stream
+ * @retval Number of data
+ */
+uint16_t
+Host_DmaLength(
+    DMA_Stream_TypeDef *pStream
+) {
+    return g_pwDmaLength[Host_DmaIndex(pStream)];
+}
+
+/**
+ * @func   Host_DmaSetFlag
+ * @brief  Set flags of a stream
+ * @param  pStream: stream
+ * @param  dwFlag: DMA_FLAG_xxIF0, moved to the bits of stream
+ * @retval None
+ */
+void
+Host_DmaSetFlag(
+    DMA_Stream_TypeDef *pStream,
+    uint32_t dwFlag
+) {
+    *Host_DmaIsr(pStream) |= (dwFlag & HOST_DMA_STREAM_FLAGS) << g_pbyDmaShift[Host_DmaIndex(pStream) & 3u];
+}
+
+/**
+ * @func   Host_DmaWrite
+ * @brief  Peripheral to memory transfer of one byte, TC at the last one
+ * @param  pStream: stream
+ * @param  byData: byte from peripheral
+ * @retval 1 if it was the last byte; 0 otherwise or stream disabled
+ */
+uint8_t
+Host_DmaWrite(
+    DMA_Stream_TypeDef *pStream,
+    uint8_t byData
+) {
+    uint16_t wLength = g_pwDmaLength[Host_DmaIndex(pStream)];
+    uint8_t *pbyMemory = (uint8_t *)(uintptr_t)pStream->M0AR;
+
+    if (!(pStream->CR & DMA_SxCR_EN) || (pStream->NDTR == 0)) {
+        return 0;
+    }
+
+    pbyMemory[(pStream->CR & DMA_SxCR_MINC) ? (wLength - pStream->NDTR) : 0] = byData;
+    pStream->NDTR--;
+
+    if (pStream->NDTR == 0) {
+        pStream->CR &= ~DMA_SxCR_EN;
+        Host_DmaSetFlag(pStream, DMA_FLAG_TCIF0);
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @func   Host_DmaIrqPending
+ * @brief  Check a stream interrupt is pending
+ * @param  pStream: stream
+ * @retval 1 if pending
+ */
+uint8_t
+Host_DmaIrqPending(
+    DMA_Stream_TypeDef *pStream
+) {
+    uint32_t dwFlag = *Host_DmaIsr(pStream) >> g_pbyDmaShift[Host_DmaIndex(pStream) & 3u];
+
+    return ((pStream->CR & DMA_IT_TC) && (dwFlag & DMA_FLAG_TCIF0 & HOST_DMA_STREAM_FLAGS)) ||
+           ((pStream->CR & DMA_IT_HT) && (dwFlag & DMA_FLAG_HTIF0 & HOST_DMA_STREAM_FLAGS)) ||
+           ((pStream->CR & DMA_IT_TE) && (dwFlag & DMA_FLAG_TEIF0 & HOST_DMA_STREAM_FLAGS));
+}
+
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+/**
+ * @func   Host_GpioUpdate
+ * @brief  Level of pins: input level, pulled low by an output driven low.
+ *         An edge of a pin mapped by SYSCFG sets pending bit of its line
+ * @param  pGpio: port
+ * @param  wOld: outputs before change
+ * @retval None
+ */
+static void
+Host_GpioUpdate(
+    GPIO_TypeDef *pGpio,
+    uint16_t wOld
+) {
+    uint8_t byPort = (uint8_t)(pGpio - g_pHostGpio);
+    uint16_t wInput = g_pwInput[byPort];
+    uint16_t wLevel = (uint16_t)pGpio->IDR;
+    uint16_t wDrivenLow = 0;
+    uint32_t dwEdge;
+    uint8_t i;
+
+    for (i = 0; i < 16; i++) {
+        if ((((pGpio->MODER >> (2 * i)) & 3u) == GPIO_Mode_OUT) && !(pGpio->ODR & (1u << i))) {
+            wDrivenLow |= (uint16_t)(1u << i);
+        }
+    }
+
+    pGpio->IDR = wInput & ~wDrivenLow;
+
+    for (i = 0; i < 16; i++) {
+        if ((((SYSCFG->EXTICR[i >> 2] >> ((i & 3u) * 4)) & 0xFu) != byPort) ||
+            !((pGpio->IDR ^ wLevel) & (1u << i))) {
+            continue;
+        }
+        dwEdge = (pGpio->IDR & (1u << i)) ? EXTI->RTSR : EXTI->FTSR;
+        EXTI->PR |= dwEdge & (1u << i);
+    }
+
+    if (g_gpioHook != NULL) {
+        g_gpioHook(pGpio, wOld);
+    }
+}
+
+/**
+ * @func   Host_DmaIsr
+ * @brief  Status register of a stream, LISR or HISR
+ * @param  pStream: stream
+ * @retval Register
+ */
+static __IO uint32_t *
+Host_DmaIsr(
+    DMA_Stream_TypeDef *pStream
+) {
+    uint8_t byIndex = Host_DmaIndex(pStream);
+    DMA_TypeDef *pDma = &g_pHostDma[byIndex / HOST_DMA_STREAMS];
+
+    return ((byIndex & 7u) >= 4) ? &pDma->HISR : &pDma->LISR;
+}
+
+/* END FILE */
@@ -0,0 +1,330 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Host build, Si7020 on the simulated I2C bus
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <string.h>
+#include "host.h"
+#include "host_si7020.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define HOST_SI7020_ADDR                    0x40u
+
+#define HOST_SI7020_MEASURE_RH_HOLD         0xE5u
+#define HOST_SI7020_MEASURE_RH_NOHOLD       0xF5u
+#define HOST_SI7020_MEASURE_T_HOLD          0xE3u
+#define HOST_SI7020_MEASURE_T_NOHOLD        0xF3u
+#define HOST_SI7020_READ_TEMP_PREVIOUS      0xE0u
+#define HOST_SI7020_WRITE_USER_REG          0xE6u
+#define HOST_SI7020_READ_USER_REG           0xE7u
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+/* Max conversion time (us) by resolution RES1:RES0, datasheet table 2 */
+static const uint32_t g_pdwTimeRh[4] = { 12000, 3100, 4500, 7000 };
+static const uint32_t g_pdwTimeTemp[4] = { 10800, 3800, 6200, 2400 };
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static uint8_t Host_Si7020Start(void *pData, uint8_t bRead);
+static uint8_t Host_Si7020Write(void *pData, uint8_t byData);
+static uint8_t Host_Si7020Read(void *pData, uint32_t *pdwStretchUs);
+static void Host_Si7020Stop(void *pData);
+static void Host_Si7020Convert(host_si7020_p pSensor, uint8_t bHumi);
+static void Host_Si7020Output(host_si7020_p pSensor, uint16_t wCode, uint8_t bCrc);
+static uint8_t Host_Si7020Crc8(uint8_t *pbyData, uint8_t byLength);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func   Host_Si7020Attach
+ * @brief  Put sensor on the bus at 0x40, user register at reset value.
+ *         Codes and fault counters set by caller are kept
+ * @param  pSensor: sensor
+ * @retval None
+ */
+void
+Host_Si7020Attach(
+    host_si7020_p pSensor
+) {
+    pSensor->byUserReg = HOST_SI7020_USER_REG_RESET;
+    pSensor->dwConversion = 0;
+    pSensor->dwNackRead = 0;
+    pSensor->byCommand = 0;
+    pSensor->byWriteCount = 0;
+    pSensor->bConverting = 0;
+    pSensor->byOutLength = 0;
+
+    pSensor->slave.byAddress = HOST_SI7020_ADDR;
+    pSensor->slave.start = Host_Si7020Start;
+    pSensor->slave.write = Host_Si7020Write;
+    pSensor->slave.read = Host_Si7020Read;
+    pSensor->slave.stop = Host_Si7020Stop;
+    pSensor->slave.pSlave = pSensor;
+
+    Host_I2cAttach(&pSensor->slave);
+}
+
+/**
+ * @func   Host_Si7020TempCode
+ * @brief  Raw code converted back exactly by Si7020_ConvertTemp
+ * @param  iTemp: 0.01 Celsius degree
+ * @retval Code
+ */
+uint16_t
+Host_Si7020TempCode(
+    int16_t iTemp
+) {
+    return (uint16_t)((((uint32_t)(iTemp + 4685) << 16) + 17571u) / 17572u);
+}
+
+/**
+ * @func   Host_Si7020HumiCode
+ * @brief  Raw code converted back exactly by Si7020_ConvertHumi
+ * @param  iHumi: 0.01 %RH
+ * @retval Code
+ */
+uint16_t
+Host_Si7020HumiCode(
+    int16_t iHumi
+) {
+    return (uint16_t)((((uint32_t)(iHumi + 600) << 16) + 12499u) / 12500u);
+}
+
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+/**
+ * @func   Host_Si7020Start
+ * @brief  Address phase: a read during a no hold conversion is NACKed
+ * @param  pData: sensor
+ * @param  bRead: direction
+ * @retval 1 to ACK
+ */
+static uint8_t
+Host_Si7020Start(
+    void *pData,
+    uint8_t bRead
+) {
+    host_si7020_p pSensor = (host_si7020_p)pData;
+
+    if (!bRead) {
+        pSensor->byWriteCount = 0;
+        return 1;
+    }
+
+    if (pSensor->bConverting && !pSensor->bHold && (Host_GetUs() < pSensor->qwReadyUs)) {
+        pSensor->dwNackRead++;
+        return 0;
+    }
+
+    pSensor->byOutIndex = 0;
+
+    return 1;
+}
+
+/**
+ * @func   Host_Si7020Write
+ * @brief  Command byte, then data of user register
+ * @param  pData: sensor
+ * @param  byData: byte written by master
+ * @retval 1 to ACK
+ */
+static uint8_t
+Host_Si7020Write(
+    void *pData,
+    uint8_t byData
+) {
+    host_si7020_p pSensor = (host_si7020_p)pData;
+
+    if (pSensor->byWriteCount++ != 0) {
+        if (pSensor->byCommand == HOST_SI7020_WRITE_USER_REG) {
+            pSensor->byUserReg = byData;
+        }
+        return 1;
+    }
+
+    pSensor->byCommand = byData;
+    pSensor->byOutLength = 0;
+    pSensor->byOutIndex = 0;
+
+    switch (byData) {
+    case HOST_SI7020_MEASURE_RH_HOLD:
+    case HOST_SI7020_MEASURE_RH_NOHOLD:
+        Host_Si7020Convert(pSensor, 1);
+        pSensor->bHold = (byData == HOST_SI7020_MEASURE_RH_HOLD);
+        break;
+
+    case HOST_SI7020_MEASURE_T_HOLD:
+    case HOST_SI7020_MEASURE_T_NOHOLD:
+        Host_Si7020Convert(pSensor, 0);
+        pSensor->bHold = (byData == HOST_SI7020_MEASURE_T_HOLD);
+        break;
+
+    case HOST_SI7020_READ_TEMP_PREVIOUS:
+        /* No checksum on read back */
+        Host_Si7020Output(pSensor, pSensor->wTempLast, 0);
+        break;
+
+    case HOST_SI7020_READ_USER_REG:
+        pSensor->pbyOut[0] = pSensor->byUserReg;
+        pSensor->byOutLength = 1;
+        break;
+
+    case HOST_SI7020_WRITE_USER_REG:
+        break;
+
+    default:
+        return 0;
+    }
+
+    return 1;
+}
+
+/**
+ * @func   Host_Si7020Read
+ * @brief  Byte to master, hold master conversion stretches SCL before
+ *         the first byte
+ * @param  pData: sensor
+ * @param  pdwStretchUs: SCL held low before byte (us)
+ * @retval Byte
+ */
+static uint8_t
+Host_Si7020Read(
+    void *pData,
+    uint32_t *pdwStretchUs
+) {
+    host_si7020_p pSensor = (host_si7020_p)pData;
+    uint64_t qwNow = Host_GetUs();
+
+    if (pSensor->bConverting) {
+        if (pSensor->bHold && (qwNow < pSensor->qwReadyUs)) {
+            *pdwStretchUs = (uint32_t)(pSensor->qwReadyUs - qwNow);
+        }
+        pSensor->bConverting = 0;
+        pSensor->byOutIndex = 0;
+        if ((pSensor->byCommand == HOST_SI7020_MEASURE_RH_HOLD) ||
+            (pSensor->byCommand == HOST_SI7020_MEASURE_RH_NOHOLD)) {
+            Host_Si7020Output(pSensor, pSensor->wHumiCode, 1);
+        } else {
+            Host_Si7020Output(pSensor, pSensor->wTempCode, 1);
+        }
+    }
+
+    if (pSensor->byOutIndex >= pSensor->byOutLength) {
+        return 0xFF;
+    }
+
+    return pSensor->pbyOut[pSensor->byOutIndex++];
+}
+
+/**
+ * @func   Host_Si7020Stop
+ * @brief  STOP: a pending conversion goes on
+ * @param  pData: sensor
+ * @retval None
+ */
+static void
+Host_Si7020Stop(
+    void *pData
+) {
+    ((host_si7020_p)pData)->byWriteCount = 0;
+}
+
+/**
+ * @func   Host_Si7020Convert
+ * @brief  Start a conversion at resolution of user register, RH one also
+ *         converts temperature for 0xE0
+ * @param  pSensor: sensor
+ * @param  bHumi: 1 for RH, 0 for temperature
+ * @retval None
+ */
+static void
+Host_Si7020Convert(
+    host_si7020_p pSensor,
+    uint8_t bHumi
+) {
+    uint8_t byRes = ((pSensor->byUserReg >> 6) & 0x02u) | (pSensor->byUserReg & 0x01u);
+    uint32_t dwTime = g_pdwTimeTemp[byRes];
+
+    if (bHumi) {
+        dwTime += g_pdwTimeRh[byRes];
+        pSensor->wTempLast = pSensor->wTempCode;
+    }
+
+    pSensor->dwConversion++;
+    pSensor->bConverting = 1;
+    pSensor->qwReadyUs = Host_GetUs() + dwTime;
+}
+
+/**
+ * @func   Host_Si7020Output
+ * @brief  Value to be read: MSB, LSB then CRC
+ * @param  pSensor: sensor
+ * @param  wCode: value
+ * @param  bCrc: 1 to append CRC
+ * @retval None
+ */
+static void
+Host_Si7020Output(
+    host_si7020_p pSensor,
+    uint16_t wCode,
+    uint8_t bCrc
+) {
+    pSensor->pbyOut[0] = (uint8_t)(wCode >> 8);
+    pSensor->pbyOut[1] = (uint8_t)wCode;
+    pSensor->byOutLength = 2;
+
+    if (bCrc) {
+        pSensor->pbyOut[2] = Host_Si7020Crc8(pSensor->pbyOut, 2);
+        if (pSensor->byBadCrc != 0) {
+            pSensor->byBadCrc--;
+            pSensor->pbyOut[2] ^= 0xFFu;
+        }
+        pSensor->byOutLength = 3;
+    }
+}
+
+/**
+ * @func   Host_Si7020Crc8
+ * @brief  CRC-8 of sensor, polynomial 0x31, init 0x00
+ * @param  pbyData: data
+ * @param  byLength: length of data
+ * @retval CRC
+ */
+static uint8_t
+Host_Si7020Crc8(
+    uint8_t *pbyData,
+    uint8_t byLength
+) {
+    uint8_t byCrc = 0x00;
+    uint8_t i, j;
+
+    for (i = 0; i < byLength; i++) {
+        byCrc ^= pbyData[i];
+        for (j = 0; j < 8; j++) {
+            byCrc = (byCrc & 0x80) ? (uint8_t)((byCrc << 1) ^ 0x31u) : (uint8_t)(byCrc << 1);
+        }
+    }
+
+    return byCrc;
+}
+
+/* END FILE */
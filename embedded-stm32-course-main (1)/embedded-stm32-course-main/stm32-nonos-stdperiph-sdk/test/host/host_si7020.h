@@ -0,0 +1,62 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Host build, Si7020 on the simulated I2C bus: conversion
+ *              times of the datasheet, no hold master (read NACKed until
+ *              ready), hold master (SCL stretched), 0xE0 read back of
+ *              temperature, user register and CRC-8 of each value
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+#ifndef _HOST_SI7020_H_
+#define _HOST_SI7020_H_
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <stdint.h>
+#include "host_i2c.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define HOST_SI7020_USER_REG_RESET          0x3Au
+
+/*! @brief Simulated sensor, values are raw codes returned by measurements */
+typedef struct {
+    uint16_t wTempCode;
+    uint16_t wHumiCode;
+    uint8_t byUserReg;
+    uint8_t byBadCrc;            /*< Next values sent with a wrong CRC */
+    uint32_t dwConversion;       /*< Conversions started */
+    uint32_t dwNackRead;         /*< Reads NACKed, conversion not finished */
+
+    /* Internal */
+    host_i2c_slave_t slave;
+    uint8_t byCommand;
+    uint8_t byWriteCount;
+    uint8_t bHold;
+    uint8_t bConverting;
+    uint64_t qwReadyUs;
+    uint16_t wTempLast;          /*< Temperature of last RH conversion */
+    uint8_t pbyOut[3];
+    uint8_t byOutLength;
+    uint8_t byOutIndex;
+} host_si7020_t, *host_si7020_p;
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+void Host_Si7020Attach(host_si7020_p pSensor);
+uint16_t Host_Si7020TempCode(int16_t iTemp);   /* 0.01 Celsius degree */
+uint16_t Host_Si7020HumiCode(int16_t iHumi);   /* 0.01 %RH */
+
+#endif
+
+/* END FILE */
@@ -0,0 +1,339 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Host build, SPI1 + DMA2 stream 3 to the ST7735 model
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <string.h>
+#include "host.h"
+#include "host_spi.h"
+#include "stm32f401re_gpio.h"
+#include "stm32f401re_spi.h"
+#include "stm32f401re_dma.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+/* LCD of the kit */
+#define HOST_LCD_CD_PORT                    GPIOA
+#define HOST_LCD_CD_PIN                     GPIO_Pin_9
+#define HOST_LCD_CS_PORT                    GPIOB
+#define HOST_LCD_CS_PIN                     GPIO_Pin_6
+#define HOST_LCD_RST_PORT                   GPIOC
+#define HOST_LCD_RST_PIN                    GPIO_Pin_7
+
+#define HOST_SPI_DMA_STREAM                 DMA2_Stream3
+#define HOST_SPI_DMA_CHANNEL                DMA_Channel_3
+
+#define HOST_SPI_APB2_HZ                    84000000ull
+#define HOST_SPI_CR1_BR_SHIFT               3u
+#define HOST_SPI_CR1_BR_MASK                (7u << HOST_SPI_CR1_BR_SHIFT)
+#define HOST_PS_PER_US                      1000000ull
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+static uint64_t g_qwBytePs;             /* Time of a byte on the wire */
+static uint64_t g_qwTxEmptyPs;          /* DR moved to shift register */
+static uint64_t g_qwIdlePs;             /* Last bit out */
+static host_spi_stat_t g_stat;
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static uint64_t Host_SpiNowPs(void);
+static uint8_t Host_SpiIsBusy(void);
+static uint64_t Host_SpiQueue(uint32_t dwBytes);
+static void Host_SpiDmaHook(DMA_Stream_TypeDef *pStream);
+static void Host_SpiDmaDone(void *pData);
+static void Host_SpiGpioHook(GPIO_TypeDef *pGpio, uint16_t wOld);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func   Host_SpiReset
+ * @brief  Idle wire, hooks of GPIO and DMA installed, ST7735 at power on
+ * @param  None
+ * @retval None
+ */
+void
+Host_SpiReset(void)
+{
+    Host_Cancel(Host_SpiDmaDone);
+    memset(&g_stat, 0, sizeof(g_stat));
+    g_qwTxEmptyPs = 0;
+    g_qwIdlePs = 0;
+    g_qwBytePs = 0;
+
+    Host_St7735Reset();
+    Host_GpioSetHook(Host_SpiGpioHook);
+    Host_DmaSetHook(Host_SpiDmaHook);
+}
+
+/**
+ * @func   Host_SpiGetStat
+ * @brief  Wire usage since reset
+ * @param  pStat: output
+ * @retval None
+ */
+void
+Host_SpiGetStat(
+    host_spi_stat_p pStat
+) {
+    *pStat = g_stat;
+}
+
+/**
+ * @func   Host_SpiResetStat
+ * @brief  Clear counters
+ * @param  None
+ * @retval None
+ */
+void
+Host_SpiResetStat(void)
+{
+    memset(&g_stat, 0, sizeof(g_stat));
+}
+
+/* StdPeriph SPI -------------------------------------------------------------*/
+
+void
+SPI_I2S_DeInit(
+    SPI_TypeDef *SPIx
+) {
+    memset((void *)SPIx, 0, sizeof(SPI_TypeDef));
+}
+
+void
+SPI_Init(
+    SPI_TypeDef *SPIx,
+    SPI_InitTypeDef *SPI_InitStruct
+) {
+    SPIx->CR1 = SPI_InitStruct->SPI_Direction | SPI_InitStruct->SPI_Mode |
+                SPI_InitStruct->SPI_DataSize | SPI_InitStruct->SPI_CPOL |
+                SPI_InitStruct->SPI_CPHA | SPI_InitStruct->SPI_NSS |
+                SPI_InitStruct->SPI_BaudRatePrescaler | SPI_InitStruct->SPI_FirstBit;
+    SPIx->CRCPR = SPI_InitStruct->SPI_CRCPolynomial;
+}
+
+void
+SPI_Cmd(
+    SPI_TypeDef *SPIx,
+    FunctionalState NewState
+) {
+    uint32_t dwPrescaler = 2u << ((SPIx->CR1 & HOST_SPI_CR1_BR_MASK) >> HOST_SPI_CR1_BR_SHIFT);
+
+    if (NewState != DISABLE) {
+        SPIx->CR1 |= SPI_CR1_SPE;
+        g_qwBytePs = 8u * dwPrescaler * 1000000000000ull / HOST_SPI_APB2_HZ;
+    } else {
+        SPIx->CR1 &= ~SPI_CR1_SPE;
+    }
+}
+
+void
+SPI_I2S_DMACmd(
+    SPI_TypeDef *SPIx,
+    uint16_t SPI_I2S_DMAReq,
+    FunctionalState NewState
+) {
+    if (NewState != DISABLE) {
+        SPIx->CR2 |= SPI_I2S_DMAReq;
+    } else {
+        SPIx->CR2 &= (uint16_t)~SPI_I2S_DMAReq;
+    }
+}
+
+void
+SPI_I2S_SendData(
+    SPI_TypeDef *SPIx,
+    uint16_t Data
+) {
+    if (!(SPIx->CR1 & SPI_CR1_SPE)) {
+        return;
+    }
+
+    if (Host_SpiNowPs() < g_qwTxEmptyPs) {
+        g_stat.dwOverrun++;
+    }
+
+    Host_SpiQueue(1);
+    g_stat.dwCpuBytes++;
+    g_stat.dwBytes++;
+    Host_St7735Write((HOST_LCD_CD_PORT->ODR & HOST_LCD_CD_PIN) != 0, (uint8_t)Data);
+}
+
+FlagStatus
+SPI_I2S_GetFlagStatus(
+    SPI_TypeDef *SPIx,
+    uint16_t SPI_I2S_FLAG
+) {
+    uint64_t qwNowPs;
+    uint16_t wStatus = 0;
+
+    Host_Spin();
+    qwNowPs = Host_SpiNowPs();
+
+    if (!(SPIx->CR1 & SPI_CR1_SPE) || (qwNowPs >= g_qwTxEmptyPs)) {
+        wStatus |= SPI_I2S_FLAG_TXE;
+    }
+    if ((SPIx->CR1 & SPI_CR1_SPE) && (qwNowPs < g_qwIdlePs)) {
+        wStatus |= SPI_I2S_FLAG_BSY;
+    }
+    SPIx->SR = wStatus;
+
+    return (wStatus & SPI_I2S_FLAG) ? SET : RESET;
+}
+
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+/**
+ * @func   Host_SpiNowPs
+ * @brief  Simulated time
+ * @param  None
+ * @retval Time (ps)
+ */
+static uint64_t
+Host_SpiNowPs(void)
+{
+    return Host_GetUs() * HOST_PS_PER_US;
+}
+
+/**
+ * @func   Host_SpiIsBusy
+ * @brief  Check a byte is on the wire or DMA still has bytes to send
+ * @param  None
+ * @retval 1 if busy
+ */
+static uint8_t
+Host_SpiIsBusy(void)
+{
+    return (Host_SpiNowPs() < g_qwIdlePs) || (HOST_SPI_DMA_STREAM->CR & DMA_SxCR_EN);
+}
+
+/**
+ * @func   Host_SpiQueue
+ * @brief  Put bytes on the wire after those already on it
+ * @param  dwBytes: number of bytes
+ * @retval End of last byte (ps)
+ */
+static uint64_t
+Host_SpiQueue(
+    uint32_t dwBytes
+) {
+    uint64_t qwStartPs = Host_SpiNowPs();
+
+    if (qwStartPs < g_qwIdlePs) {
+        qwStartPs = g_qwIdlePs;
+    }
+
+    g_qwIdlePs = qwStartPs + dwBytes * g_qwBytePs;
+    g_qwTxEmptyPs = g_qwIdlePs - g_qwBytePs;
+    g_stat.qwWireNs += dwBytes * g_qwBytePs / 1000u;
+
+    return g_qwIdlePs;
+}
+
+/**
+ * @func   Host_SpiDmaHook
+ * @brief  Stream enabled: SPI requests bytes at wire speed, transfer ends
+ *         with its last byte
+ * @param  pStream: stream
+ * @retval None
+ */
+static void
+Host_SpiDmaHook(
+    DMA_Stream_TypeDef *pStream
+) {
+    uint64_t qwEndPs;
+    uint64_t qwNowPs;
+
+    if ((pStream != HOST_SPI_DMA_STREAM) ||
+        ((pStream->CR & DMA_SxCR_CHSEL) != HOST_SPI_DMA_CHANNEL) ||
+        !(SPI1->CR2 & SPI_I2S_DMAReq_Tx) || !(SPI1->CR1 & SPI_CR1_SPE) ||
+        (pStream->NDTR == 0)) {
+        return;
+    }
+
+    qwNowPs = Host_SpiNowPs();
+    qwEndPs = Host_SpiQueue(pStream->NDTR);
+    g_stat.dwDmaTransfers++;
+    Host_Schedule((uint32_t)((qwEndPs - qwNowPs + HOST_PS_PER_US - 1) / HOST_PS_PER_US),
+                  Host_SpiDmaDone, NULL);
+}
+
+/**
+ * @func   Host_SpiDmaDone
+ * @brief  End of transfer: bytes are read from memory now and shifted into
+ *         the ST7735, stream disabled with TC flag
+ * @param  pData: not used
+ * @retval None
+ */
+static void
+Host_SpiDmaDone(
+    void *pData
+) {
+    DMA_Stream_TypeDef *pStream = HOST_SPI_DMA_STREAM;
+    uint8_t *pbyMemory = (uint8_t *)(uintptr_t)pStream->M0AR;
+    uint16_t wLength = Host_DmaLength(pStream);
+    uint8_t bCd = (HOST_LCD_CD_PORT->ODR & HOST_LCD_CD_PIN) != 0;
+    uint16_t i;
+
+    (void)pData;
+
+    for (i = 0; i < wLength; i++) {
+        Host_St7735Write(bCd, pbyMemory[(pStream->CR & DMA_SxCR_MINC) ? i : 0]);
+    }
+    g_stat.dwBytes += wLength;
+
+    pStream->NDTR = 0;
+    pStream->CR &= ~DMA_SxCR_EN;
+    Host_DmaSetFlag(pStream, DMA_FLAG_TCIF0);
+}
+
+/**
+ * @func   Host_SpiGpioHook
+ * @brief  LCD lines to the ST7735, a change under a byte is counted
+ * @param  pGpio: port
+ * @param  wOld: outputs before change
+ * @retval None
+ */
+static void
+Host_SpiGpioHook(
+    GPIO_TypeDef *pGpio,
+    uint16_t wOld
+) {
+    uint16_t wChanged = (uint16_t)(wOld ^ pGpio->ODR);
+
+    if (((pGpio == HOST_LCD_CD_PORT) && (wChanged & HOST_LCD_CD_PIN)) ||
+        ((pGpio == HOST_LCD_CS_PORT) && (wChanged & HOST_LCD_CS_PIN)) ||
+        ((pGpio == HOST_LCD_RST_PORT) && (wChanged & HOST_LCD_RST_PIN))) {
+        if (Host_SpiIsBusy()) {
+            g_stat.dwLineChange++;
+        }
+    }
+
+    if ((pGpio == HOST_LCD_CS_PORT) && (wChanged & HOST_LCD_CS_PIN)) {
+        Host_St7735Select(!(pGpio->ODR & HOST_LCD_CS_PIN));
+    }
+
+    if ((pGpio == HOST_LCD_RST_PORT) && (wChanged & HOST_LCD_RST_PIN) &&
+        !(pGpio->ODR & HOST_LCD_RST_PIN)) {
+        Host_St7735HwReset();
+    }
+}
+
+/* END FILE */
@@ -0,0 +1,50 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Host build, model of SPI1 transmitter and of DMA2 stream 3
+ *              feeding it, wired to the ST7735 model (host_st7735.c) with
+ *              the LCD pins of the kit. A byte takes 8 SPI clocks of APB2
+ *              (84 MHz) over the prescaler. DMA reads memory when its
+ *              transfer ends, so a buffer reused under a transfer shows on
+ *              the screen
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+#ifndef _HOST_SPI_H_
+#define _HOST_SPI_H_
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <stdint.h>
+#include "host_st7735.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+/*! @brief Wire usage since Host_SpiReset */
+typedef struct {
+    uint32_t dwBytes;            /*< Bytes shifted out */
+    uint32_t dwCpuBytes;         /*< Of them written to DR by CPU */
+    uint32_t dwDmaTransfers;
+    uint64_t qwWireNs;           /*< Time with a byte on the wire */
+    uint32_t dwLineChange;       /*< CS, CD or RST changed under a byte */
+    uint32_t dwOverrun;          /*< DR written while TXE is low */
+} host_spi_stat_t, *host_spi_stat_p;
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+void Host_SpiReset(void);       /* After Host_PeriphReset, resets the ST7735 */
+void Host_SpiGetStat(host_spi_stat_p pStat);
+void Host_SpiResetStat(void);
+
+#endif
+
+/* END FILE */
@@ -0,0 +1,474 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Host build, ST7735 of the kit LCD
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <string.h>
+#include "host.h"
+#include "host_st7735.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define HOST_ST7735_SWRESET                 0x01u
+#define HOST_ST7735_CASET                   0x2Au
+#define HOST_ST7735_RASET                   0x2Bu
+#define HOST_ST7735_RAMWR                   0x2Cu
+#define HOST_ST7735_VSCRDEF                 0x33u
+#define HOST_ST7735_MADCTL                  0x36u
+#define HOST_ST7735_VSCRSADD                0x37u
+#define HOST_ST7735_COLMOD                  0x3Au
+
+#define HOST_ST7735_COLMOD_16BIT            0x05u
+#define HOST_ST7735_COLMOD_18BIT            0x06u
+#define HOST_ST7735_MADCTL_MY               0x80u
+#define HOST_ST7735_MADCTL_MX               0x40u
+#define HOST_ST7735_MADCTL_MV               0x20u
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+static uint16_t g_ppwRam[HOST_ST7735_ROWS][HOST_ST7735_COLUMNS];
+
+static uint8_t g_bSelected;
+static uint8_t g_byCommand;
+static uint8_t g_pbyParam[8];
+static uint8_t g_byParamCount;
+static uint8_t g_byMadctl;
+static uint8_t g_byColmod;
+static uint16_t g_pwWindow[4];          /* Column start, end, row start, end */
+static uint16_t g_wColumn;
+static uint16_t g_wRow;
+static uint8_t g_pbyPixel[3];
+static uint8_t g_byPixelBytes;
+static uint16_t g_pwScroll[3];          /* Top fixed, scroll area, bottom fixed */
+static uint16_t g_wScrollStart;
+
+/* Lines driven by Host_St7735Com */
+static uint8_t g_bComCd;
+
+static host_st7735_stat_t g_stat;
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static void Host_St7735Init(void);
+static void Host_St7735Command(uint8_t byCommand);
+static void Host_St7735Param(uint8_t byParam);
+static void Host_St7735Pixel(void);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func   Host_St7735Reset
+ * @brief  Power on: RAM black, registers at reset value, not selected
+ * @param  None
+ * @retval None
+ */
+void
+Host_St7735Reset(void)
+{
+    memset(g_ppwRam, 0, sizeof(g_ppwRam));
+    memset(&g_stat, 0, sizeof(g_stat));
+    g_bSelected = 0;
+    g_bComCd = 1;
+    Host_St7735Init();
+}
+
+/**
+ * @func   Host_St7735HwReset
+ * @brief  Pulse on RST: registers to reset value, RAM is kept
+ * @param  None
+ * @retval None
+ */
+void
+Host_St7735HwReset(void)
+{
+    Host_St7735Init();
+}
+
+/**
+ * @func   Host_St7735Select
+ * @brief  Level of CS, a frame restarts when selected
+ * @param  bSelected: 1 when CS is low
+ * @retval None
+ */
+void
+Host_St7735Select(
+    uint8_t bSelected
+) {
+    g_bSelected = bSelected;
+}
+
+/**
+ * @func   Host_St7735Write
+ * @brief  A byte shifted in: command when CD is low, else parameter or pixel
+ * @param  bData: level of CD
+ * @param  byByte: byte
+ * @retval None
+ */
+void
+Host_St7735Write(
+    uint8_t bData,
+    uint8_t byByte
+) {
+    if (!g_bSelected) {
+        g_stat.dwLost++;
+        return;
+    }
+
+    if (!bData) {
+        g_stat.dwCmdBytes++;
+        Host_St7735Command(byByte);
+        return;
+    }
+
+    g_stat.dwDataBytes++;
+
+    if (g_byCommand != HOST_ST7735_RAMWR) {
+        Host_St7735Param(byByte);
+        return;
+    }
+
+    g_pbyPixel[g_byPixelBytes++] = byByte;
+    if (g_byPixelBytes == ((g_byColmod == HOST_ST7735_COLMOD_16BIT) ? 2u : 3u)) {
+        Host_St7735Pixel();
+        g_byPixelBytes = 0;
+    }
+}
+
+/**
+ * @func   Host_St7735GetStat
+ * @brief  Bytes received since reset
+ * @param  pStat: output
+ * @retval None
+ */
+void
+Host_St7735GetStat(
+    host_st7735_stat_p pStat
+) {
+    *pStat = g_stat;
+}
+
+/**
+ * @func   Host_St7735ResetStat
+ * @brief  Clear counters, RAM is kept
+ * @param  None
+ * @retval None
+ */
+void
+Host_St7735ResetStat(void)
+{
+    memset(&g_stat, 0, sizeof(g_stat));
+}
+
+/**
+ * @func   Host_St7735GetPixel
+ * @brief  Pixel on the glass, rows of the scroll area are read from the
+ *         scroll start address. Areas of VSCRDEF not adding up to the RAM
+ *         rows do not scroll
+ * @param  x: glass column 0 - 127
+ * @param  y: glass row 0 - 127
+ * @retval RGB565
+ */
+uint16_t
+Host_St7735GetPixel(
+    uint8_t x,
+    uint8_t y
+) {
+    uint16_t wTop = g_pwScroll[0];
+    uint16_t wHeight = g_pwScroll[1];
+    uint16_t wRow = (uint16_t)(y + HOST_ST7735_GLASS_Y);
+
+    if ((g_pwScroll[0] + g_pwScroll[1] + g_pwScroll[2] == HOST_ST7735_ROWS) && (wHeight > 0) &&
+        (wRow >= wTop) && (wRow < wTop + wHeight) && (g_wScrollStart >= wTop)) {
+        wRow = (uint16_t)(wTop + (wRow - wTop + g_wScrollStart - wTop) % wHeight);
+    }
+
+    return g_ppwRam[wRow % HOST_ST7735_ROWS][(x + HOST_ST7735_GLASS_X) % HOST_ST7735_COLUMNS];
+}
+
+/**
+ * @func   Host_St7735Snapshot
+ * @brief  Copy the glass
+ * @param  pwScreen: 128 x 128 RGB565, row by row
+ * @retval None
+ */
+void
+Host_St7735Snapshot(
+    uint16_t *pwScreen
+) {
+    uint8_t x, y;
+
+    for (y = 0; y < HOST_ST7735_GLASS; y++) {
+        for (x = 0; x < HOST_ST7735_GLASS; x++) {
+            *pwScreen++ = Host_St7735GetPixel(x, y);
+        }
+    }
+}
+
+/**
+ * @func   Host_St7735Diff
+ * @brief  Compare two snapshots
+ * @param  pwScreen, pwOther: 128 x 128 RGB565
+ * @retval Number of different pixels
+ */
+uint32_t
+Host_St7735Diff(
+    const uint16_t *pwScreen,
+    const uint16_t *pwOther
+) {
+    uint32_t dwDiff = 0;
+    uint32_t i;
+
+    for (i = 0; i < HOST_ST7735_GLASS * HOST_ST7735_GLASS; i++) {
+        if (pwScreen[i] != pwOther[i]) {
+            dwDiff++;
+        }
+    }
+
+    return dwDiff;
+}
+
+/**
+ * @func   Host_St7735Com
+ * @brief  com_cb of ucglib writing to the model without SPI and in no time
+ * @param  ucg: ucg object
+ * @param  msg: UCG_COM_MSG_xxx
+ * @param  arg: argument of message
+ * @param  data: data of message
+ * @retval 1
+ */
+int16_t
+Host_St7735Com(
+    ucg_t *ucg,
+    int16_t msg,
+    uint16_t arg,
+    uint8_t *data
+) {
+    uint32_t i;
+
+    (void)ucg;
+
+    switch (msg) {
+    case UCG_COM_MSG_CHANGE_RESET_LINE:
+        if (!arg) {
+            Host_St7735HwReset();
+        }
+        break;
+
+    case UCG_COM_MSG_CHANGE_CS_LINE:
+        Host_St7735Select(!arg);
+        break;
+
+    case UCG_COM_MSG_CHANGE_CD_LINE:
+        g_bComCd = (uint8_t)(arg != 0);
+        break;
+
+    case UCG_COM_MSG_SEND_BYTE:
+        Host_St7735Write(g_bComCd, (uint8_t)arg);
+        break;
+
+    case UCG_COM_MSG_REPEAT_1_BYTE:
+    case UCG_COM_MSG_REPEAT_2_BYTES:
+    case UCG_COM_MSG_REPEAT_3_BYTES:
+        for (i = 0; i < (uint32_t)arg * (msg - UCG_COM_MSG_REPEAT_1_BYTE + 1); i++) {
+            Host_St7735Write(g_bComCd, data[i % (msg - UCG_COM_MSG_REPEAT_1_BYTE + 1)]);
+        }
+        break;
+
+    case UCG_COM_MSG_SEND_STR:
+        for (i = 0; i < arg; i++) {
+            Host_St7735Write(g_bComCd, data[i]);
+        }
+        break;
+
+    case UCG_COM_MSG_SEND_CD_DATA_SEQUENCE:
+        for (i = 0; i < arg; i++) {
+            if (data[2 * i] != 0) {
+                g_bComCd = (uint8_t)(data[2 * i] != 1);
+            }
+            Host_St7735Write(g_bComCd, data[2 * i + 1]);
+        }
+        break;
+
+    default:
+        break;
+    }
+
+    return 1;
+}
+
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+/**
+ * @func   Host_St7735Init
+ * @brief  Registers at reset value, RAM is kept
+ * @param  None
+ * @retval None
+ */
+static void
+Host_St7735Init(void)
+{
+    g_byCommand = 0;
+    g_byParamCount = 0;
+    g_byPixelBytes = 0;
+    g_byMadctl = 0;
+    g_byColmod = HOST_ST7735_COLMOD_18BIT;
+    g_pwWindow[0] = 0;
+    g_pwWindow[1] = HOST_ST7735_COLUMNS - 1;
+    g_pwWindow[2] = 0;
+    g_pwWindow[3] = HOST_ST7735_ROWS - 1;
+    g_pwScroll[0] = 0;
+    g_pwScroll[1] = HOST_ST7735_ROWS;
+    g_pwScroll[2] = 0;
+    g_wScrollStart = 0;
+}
+
+/**
+ * @func   Host_St7735Command
+ * @brief  Command byte, ends the previous command
+ * @param  byCommand: command
+ * @retval None
+ */
+static void
+Host_St7735Command(
+    uint8_t byCommand
+) {
+    g_byCommand = byCommand;
+    g_byParamCount = 0;
+    g_byPixelBytes = 0;
+
+    switch (byCommand) {
+    case HOST_ST7735_SWRESET:
+        Host_St7735Init();
+        break;
+
+    case HOST_ST7735_RAMWR:
+        g_stat.dwWindows++;
+        g_wColumn = g_pwWindow[0];
+        g_wRow = g_pwWindow[2];
+        break;
+
+    default:
+        break;
+    }
+}
+
+/**
+ * @func   Host_St7735Param
+ * @brief  Parameter of current command
+ * @param  byParam: parameter
+ * @retval None
+ */
+static void
+Host_St7735Param(
+    uint8_t byParam
+) {
+    uint8_t i;
+
+    if (g_byParamCount < sizeof(g_pbyParam)) {
+        g_pbyParam[g_byParamCount++] = byParam;
+    }
+
+    switch (g_byCommand) {
+    case HOST_ST7735_CASET:
+    case HOST_ST7735_RASET:
+        if (g_byParamCount == 4) {
+            i = (g_byCommand == HOST_ST7735_CASET) ? 0 : 2;
+            g_pwWindow[i] = (uint16_t)((g_pbyParam[0] << 8) | g_pbyParam[1]);
+            g_pwWindow[i + 1] = (uint16_t)((g_pbyParam[2] << 8) | g_pbyParam[3]);
+        }
+        break;
+
+    case HOST_ST7735_MADCTL:
+        g_byMadctl = byParam;
+        break;
+
+    case HOST_ST7735_COLMOD:
+        g_byColmod = byParam & 0x07u;
+        break;
+
+    case HOST_ST7735_VSCRDEF:
+        if ((g_byParamCount & 1) == 0) {
+            i = (uint8_t)(g_byParamCount / 2 - 1);
+            if (i < 3) {
+                g_pwScroll[i] = (uint16_t)((g_pbyParam[i * 2] << 8) | g_pbyParam[i * 2 + 1]);
+            }
+        }
+        break;
+
+    case HOST_ST7735_VSCRSADD:
+        if (g_byParamCount == 2) {
+            g_wScrollStart = (uint16_t)((g_pbyParam[0] << 8) | g_pbyParam[1]);
+            g_stat.dwScrolls++;
+        }
+        break;
+
+    default:
+        break;
+    }
+}
+
+/**
+ * @func   Host_St7735Pixel
+ * @brief  Store a pixel at the address counter mapped by MADCTL, then
+ *         advance the counter in the address window
+ * @param  None
+ * @retval None
+ */
+static void
+Host_St7735Pixel(void)
+{
+    uint16_t wColumn = g_wColumn;
+    uint16_t wRow = g_wRow;
+    uint16_t wTemp;
+
+    if (g_byMadctl & HOST_ST7735_MADCTL_MV) {
+        wTemp = wColumn;
+        wColumn = wRow;
+        wRow = wTemp;
+    }
+    if (g_byMadctl & HOST_ST7735_MADCTL_MX) {
+        wColumn = (uint16_t)(HOST_ST7735_COLUMNS - 1 - wColumn);
+    }
+    if (g_byMadctl & HOST_ST7735_MADCTL_MY) {
+        wRow = (uint16_t)(HOST_ST7735_ROWS - 1 - wRow);
+    }
+
+    /* Out of RAM when the window is past 131 x 161 */
+    if ((wColumn < HOST_ST7735_COLUMNS) && (wRow < HOST_ST7735_ROWS)) {
+        if (g_byColmod == HOST_ST7735_COLMOD_16BIT) {
+            g_ppwRam[wRow][wColumn] = (uint16_t)((g_pbyPixel[0] << 8) | g_pbyPixel[1]);
+        } else {
+            g_ppwRam[wRow][wColumn] = (uint16_t)(((g_pbyPixel[0] & 0xF8u) << 8) |
+                                                 ((g_pbyPixel[1] & 0xFCu) << 3) |
+                                                 (g_pbyPixel[2] >> 3));
+        }
+        g_stat.dwPixels++;
+    }
+
+    if (g_wColumn < g_pwWindow[1]) {
+        g_wColumn++;
+        return;
+    }
+
+    g_wColumn = g_pwWindow[0];
+    g_wRow = (g_wRow < g_pwWindow[3]) ? (uint16_t)(g_wRow + 1) : g_pwWindow[2];
+}
+
+/* END FILE */
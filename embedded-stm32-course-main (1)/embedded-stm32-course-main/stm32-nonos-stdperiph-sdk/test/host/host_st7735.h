@@ -0,0 +1,67 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Host build, ST7735 of the kit LCD: RAM of 132 x 162 pixels,
+ *              address window, MADCTL, 16/18-bit COLMOD and vertical scroll.
+ *              The glass shows columns 2 - 129 and rows 1 - 128, the
+ *              display_offset set by ucg_dev_ic_st7735_18. Bytes come from
+ *              the SPI model (host_spi.c) or straight from the com_cb
+ *              Host_St7735Com
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+#ifndef _HOST_ST7735_H_
+#define _HOST_ST7735_H_
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <stdint.h>
+#include "ucg.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define HOST_ST7735_COLUMNS                 132u
+#define HOST_ST7735_ROWS                    162u
+#define HOST_ST7735_GLASS                   128u    /* Rows and columns shown */
+#define HOST_ST7735_GLASS_X                 2u      /* RAM column of glass column 0 */
+#define HOST_ST7735_GLASS_Y                 1u      /* RAM row of glass row 0 */
+
+/*! @brief Bytes received since Host_St7735Reset */
+typedef struct {
+    uint32_t dwCmdBytes;
+    uint32_t dwDataBytes;        /*< Parameters and pixels */
+    uint32_t dwPixels;           /*< Pixels written to RAM */
+    uint32_t dwWindows;          /*< RAMWR commands */
+    uint32_t dwScrolls;          /*< VSCRSADD commands */
+    uint32_t dwLost;             /*< Bytes received with CS high */
+} host_st7735_stat_t, *host_st7735_stat_p;
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+void Host_St7735Reset(void);
+void Host_St7735HwReset(void);                          /* RST pulse, RAM kept */
+void Host_St7735Select(uint8_t bSelected);
+void Host_St7735Write(uint8_t bData, uint8_t byByte);   /* bData: level of CD */
+void Host_St7735GetStat(host_st7735_stat_p pStat);
+void Host_St7735ResetStat(void);
+
+/* Glass pixel as RGB565, the precision kept by both COLMOD */
+uint16_t Host_St7735GetPixel(uint8_t x, uint8_t y);
+void Host_St7735Snapshot(uint16_t *pwScreen);           /* 128 x 128 */
+uint32_t Host_St7735Diff(const uint16_t *pwScreen, const uint16_t *pwOther);
+
+/* com_cb without SPI, reference for com_cb and devices under test */
+int16_t Host_St7735Com(ucg_t *ucg, int16_t msg, uint16_t arg, uint8_t *data);
+
+#endif
+
+/* END FILE */
@@ -0,0 +1,841 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Host build, StdPeriph functions of TIM1 - TIM5 on the RAM
+ *              registers of stm32f401re.h (host). A running timer reloads
+ *              its counter in simulated time: at an update event preloaded
+ *              PSC, ARR, RCR and CCRx are taken and UIF is set, then DMA
+ *              requests of update and compare events move data of the
+ *              streams mapped to them. Compare events of a period are taken
+ *              at its first tick. Reloads are counted in timer clock, so
+ *              they never drift from the register values
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <string.h>
+#include "host.h"
+#include "stm32f401re_tim.h"
+#include "stm32f401re_dma.h"
+#include "system_stm32f4xx.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define HOST_TIM_CHANNELS                   4u
+#define HOST_TIM_CLK_PER_US                 (SystemCoreClock / 1000000u)
+
+typedef struct {
+    uint64_t qwStart;                       /* Clock of last counter reload */
+    uint64_t qwNext;                        /* Clock of next counter reload */
+    uint32_t dwPsc;                         /* Taken at last update event */
+    uint32_t dwArr;
+    uint32_t pdwCcr[HOST_TIM_CHANNELS];
+    uint16_t wRepeat;                       /* Reloads before update event */
+    uint32_t dwUpdates;
+} host_tim_t;
+
+/* DMA request of a timer event, served by a stream on a channel */
+typedef struct {
+    TIM_TypeDef *pTim;
+    uint16_t wRequest;
+    DMA_Stream_TypeDef *pStream;
+    uint32_t dwChannel;
+} host_tim_dma_t;
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+static host_tim_t g_pTimState[HOST_TIMERS];
+static void (*g_timHook)(TIM_TypeDef *pTim);
+
+/* Requests used by Middle modules, DMA1 / DMA2 request mapping of RM0368 */
+static const host_tim_dma_t g_pTimDma[] = {
+    { TIM1, TIM_DMA_Update, DMA2_Stream5, DMA_Channel_6 },
+    { TIM5, TIM_DMA_CC1, DMA1_Stream2, DMA_Channel_6 },
+    { TIM5, TIM_DMA_CC2, DMA1_Stream4, DMA_Channel_6 },
+    { TIM5, TIM_DMA_CC4, DMA1_Stream1, DMA_Channel_6 },
+};
+
+/* Preload enable of CCR1 - CCR4 in CCMR1 / CCMR2 */
+static const uint16_t g_pwOcPreload[HOST_TIM_CHANNELS] = {
+    TIM_CCMR1_OC1PE, TIM_CCMR1_OC2PE, TIM_CCMR2_OC3PE, TIM_CCMR2_OC4PE
+};
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static uint8_t Host_TimIndex(TIM_TypeDef *pTim);
+static uint64_t Host_TimNow(void);
+static uint32_t Host_TimArr(TIM_TypeDef *pTim);
+static uint64_t Host_TimCycles(TIM_TypeDef *pTim);
+static __IO uint32_t *Host_TimCcrReg(TIM_TypeDef *pTim, uint8_t byChannel);
+static void Host_TimUpdate(TIM_TypeDef *pTim);
+static void Host_TimReload(TIM_TypeDef *pTim);
+static void Host_TimRequest(TIM_TypeDef *pTim, uint16_t wRequest);
+static void Host_TimDma(TIM_TypeDef *pTim, DMA_Stream_TypeDef *pStream);
+static void Host_TimRestart(TIM_TypeDef *pTim, uint32_t dwCounter);
+static void Host_TimSchedule(TIM_TypeDef *pTim);
+static void Host_TimEvent(void *pData);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func   Host_TimReset
+ * @brief  Timers stopped, state of the model and hook cleared. Registers
+ *         are cleared by Host_PeriphReset
+ * @param  None
+ * @retval None
+ */
+void
+Host_TimReset(void)
+{
+    uint8_t i;
+
+    for (i = 0; i < HOST_TIMERS; i++) {
+        Host_CancelData(Host_TimEvent, (void *)(uintptr_t)i);
+    }
+
+    memset(g_pTimState, 0, sizeof(g_pTimState));
+    g_timHook = NULL;
+}
+
+/**
+ * @func   Host_TimSetHook
+ * @brief  Called after each update event, when the new preloaded values
+ *         are taken and before DMA requests of the event
+ * @param  hook: model of a device on timer outputs, NULL to remove
+ * @retval None
+ */
+void
+Host_TimSetHook(
+    void (*hook)(TIM_TypeDef *pTim)
+) {
+    g_timHook = hook;
+}
+
+/**
+ * @func   Host_TimCompare
+ * @brief  Compare value seen by an output: value taken at last update event
+ *         if preloaded, register otherwise
+ * @param  pTim: timer
+ * @param  byChannel: 1 - 4
+ * @retval Compare value
+ */
+uint32_t
+Host_TimCompare(
+    TIM_TypeDef *pTim,
+    uint8_t byChannel
+) {
+    uint8_t byIndex = (uint8_t)(byChannel - 1);
+    uint16_t wCcmr = (byIndex < 2) ? pTim->CCMR1 : pTim->CCMR2;
+
+    if (wCcmr & g_pwOcPreload[byIndex]) {
+        return g_pTimState[Host_TimIndex(pTim)].pdwCcr[byIndex];
+    }
+
+    return *Host_TimCcrReg(pTim, byIndex);
+}
+
+/**
+ * @func   Host_TimPeriod
+ * @brief  Length of a counter period from values in use
+ * @param  pTim: timer
+ * @retval Cycles of timer clock (SystemCoreClock)
+ */
+uint64_t
+Host_TimPeriod(
+    TIM_TypeDef *pTim
+) {
+    return Host_TimCycles(pTim);
+}
+
+/**
+ * @func   Host_TimPrescaler
+ * @brief  Prescaler in use, taken at last update event
+ * @param  pTim: timer
+ * @retval PSC
+ */
+uint32_t
+Host_TimPrescaler(
+    TIM_TypeDef *pTim
+) {
+    return g_pTimState[Host_TimIndex(pTim)].dwPsc;
+}
+
+/**
+ * @func   Host_TimUpdates
+ * @brief  Number of update events since Host_TimReset
+ * @param  pTim: timer
+ * @retval Number of events
+ */
+uint32_t
+Host_TimUpdates(
+    TIM_TypeDef *pTim
+) {
+    return g_pTimState[Host_TimIndex(pTim)].dwUpdates;
+}
+
+/**
+ * @func   Host_TimIrqPending
+ * @brief  Check an enabled interrupt of a timer is pending
+ * @param  pTim: timer
+ * @retval 1 if pending
+ */
+uint8_t
+Host_TimIrqPending(
+    TIM_TypeDef *pTim
+) {
+    return (pTim->SR & pTim->DIER & (TIM_IT_Update | TIM_IT_CC1 | TIM_IT_CC2 |
+                                     TIM_IT_CC3 | TIM_IT_CC4)) != 0;
+}
+
+/* Time base -----------------------------------------------------------------*/
+
+void
+TIM_TimeBaseInit(
+    TIM_TypeDef *TIMx,
+    TIM_TimeBaseInitTypeDef *TIM_TimeBaseInitStruct
+) {
+    TIMx->CR1 = (uint16_t)((TIMx->CR1 & ~(TIM_CR1_DIR | TIM_CR1_CMS | TIM_CR1_CKD)) |
+                           TIM_TimeBaseInitStruct->TIM_CounterMode |
+                           TIM_TimeBaseInitStruct->TIM_ClockDivision);
+    TIMx->ARR = TIM_TimeBaseInitStruct->TIM_Period;
+    TIMx->PSC = TIM_TimeBaseInitStruct->TIM_Prescaler;
+    if (TIMx == TIM1) {
+        TIMx->RCR = TIM_TimeBaseInitStruct->TIM_RepetitionCounter;
+    }
+
+    /* Prescaler is taken now, UIF is set as on target */
+    TIM_GenerateEvent(TIMx, TIM_EventSource_Update);
+}
+
+void
+TIM_Cmd(
+    TIM_TypeDef *TIMx,
+    FunctionalState NewState
+) {
+    uint32_t dwCounter;
+
+    if (NewState != DISABLE) {
+        if (!(TIMx->CR1 & TIM_CR1_CEN)) {
+            TIMx->CR1 |= TIM_CR1_CEN;
+            Host_TimRestart(TIMx, TIMx->CNT);
+        }
+    } else if (TIMx->CR1 & TIM_CR1_CEN) {
+        dwCounter = TIM_GetCounter(TIMx);
+        TIMx->CR1 &= (uint16_t)~TIM_CR1_CEN;
+        TIMx->CNT = dwCounter;
+        Host_TimSchedule(TIMx);
+    }
+}
+
+void
+TIM_SetCounter(
+    TIM_TypeDef *TIMx,
+    uint32_t Counter
+) {
+    TIMx->CNT = Counter;
+    if (TIMx->CR1 & TIM_CR1_CEN) {
+        Host_TimRestart(TIMx, Counter);
+    }
+}
+
+uint32_t
+TIM_GetCounter(
+    TIM_TypeDef *TIMx
+) {
+    host_tim_t *pState = &g_pTimState[Host_TimIndex(TIMx)];
+
+    if (!(TIMx->CR1 & TIM_CR1_CEN)) {
+        return TIMx->CNT;
+    }
+
+    return (uint32_t)((Host_TimNow() - pState->qwStart) / (pState->dwPsc + 1));
+}
+
+void
+TIM_SetAutoreload(
+    TIM_TypeDef *TIMx,
+    uint32_t Autoreload
+) {
+    host_tim_t *pState = &g_pTimState[Host_TimIndex(TIMx)];
+
+    TIMx->ARR = Autoreload;
+
+    /* Not preloaded: running period ends at the new value */
+    if ((TIMx->CR1 & TIM_CR1_CEN) && !(TIMx->CR1 & TIM_CR1_ARPE)) {
+        pState->qwNext = pState->qwStart + Host_TimCycles(TIMx);
+        Host_TimSchedule(TIMx);
+    }
+}
+
+void
+TIM_ARRPreloadConfig(
+    TIM_TypeDef *TIMx,
+    FunctionalState NewState
+) {
+    if (NewState != DISABLE) {
+        TIMx->CR1 |= TIM_CR1_ARPE;
+    } else {
+        TIMx->CR1 &= (uint16_t)~TIM_CR1_ARPE;
+    }
+}
+
+void
+TIM_UpdateDisableConfig(
+    TIM_TypeDef *TIMx,
+    FunctionalState NewState
+) {
+    if (NewState != DISABLE) {
+        TIMx->CR1 |= TIM_CR1_UDIS;
+    } else {
+        TIMx->CR1 &= (uint16_t)~TIM_CR1_UDIS;
+    }
+}
+
+void
+TIM_GenerateEvent(
+    TIM_TypeDef *TIMx,
+    uint16_t TIM_EventSource
+) {
+    TIMx->EGR = TIM_EventSource;
+
+    if (!(TIM_EventSource & TIM_EventSource_Update)) {
+        return;
+    }
+
+    /* Counter restarts, registers are taken unless update is disabled */
+    g_pTimState[Host_TimIndex(TIMx)].wRepeat = 0;
+    if (!(TIMx->CR1 & TIM_CR1_UDIS)) {
+        Host_TimUpdate(TIMx);
+    }
+    Host_TimRestart(TIMx, 0);
+}
+
+/* Output compare ------------------------------------------------------------*/
+
+void
+TIM_OCStructInit(
+    TIM_OCInitTypeDef *TIM_OCInitStruct
+) {
+    TIM_OCInitStruct->TIM_OCMode = TIM_OCMode_Timing;
+    TIM_OCInitStruct->TIM_OutputState = TIM_OutputState_Disable;
+    TIM_OCInitStruct->TIM_OutputNState = TIM_OutputNState_Disable;
+    TIM_OCInitStruct->TIM_Pulse = 0x00000000;
+    TIM_OCInitStruct->TIM_OCPolarity = TIM_OCPolarity_High;
+    TIM_OCInitStruct->TIM_OCNPolarity = TIM_OCPolarity_High;
+    TIM_OCInitStruct->TIM_OCIdleState = TIM_OCIdleState_Reset;
+    TIM_OCInitStruct->TIM_OCNIdleState = TIM_OCNIdleState_Reset;
+}
+
+void
+TIM_OC1Init(
+    TIM_TypeDef *TIMx,
+    TIM_OCInitTypeDef *TIM_OCInitStruct
+) {
+    TIMx->CCMR1 = (uint16_t)((TIMx->CCMR1 & ~(TIM_CCMR1_OC1M | TIM_CCMR1_CC1S)) |
+                             TIM_OCInitStruct->TIM_OCMode);
+    TIMx->CCER = (uint16_t)((TIMx->CCER & ~(TIM_CCER_CC1E | TIM_CCER_CC1P)) |
+                            TIM_OCInitStruct->TIM_OutputState |
+                            TIM_OCInitStruct->TIM_OCPolarity);
+    TIMx->CCR1 = TIM_OCInitStruct->TIM_Pulse;
+}
+
+void
+TIM_OC2Init(
+    TIM_TypeDef *TIMx,
+    TIM_OCInitTypeDef *TIM_OCInitStruct
+) {
+    TIMx->CCMR1 = (uint16_t)((TIMx->CCMR1 & ~(TIM_CCMR1_OC2M | TIM_CCMR1_CC2S)) |
+                             (TIM_OCInitStruct->TIM_OCMode << 8));
+    TIMx->CCER = (uint16_t)((TIMx->CCER & ~(TIM_CCER_CC2E | TIM_CCER_CC2P)) |
+                            ((TIM_OCInitStruct->TIM_OutputState |
+                              TIM_OCInitStruct->TIM_OCPolarity) << 4));
+    TIMx->CCR2 = TIM_OCInitStruct->TIM_Pulse;
+}
+
+void
+TIM_OC3Init(
+    TIM_TypeDef *TIMx,
+    TIM_OCInitTypeDef *TIM_OCInitStruct
+) {
+    TIMx->CCMR2 = (uint16_t)((TIMx->CCMR2 & ~(TIM_CCMR2_OC3M | TIM_CCMR2_CC3S)) |
+                             TIM_OCInitStruct->TIM_OCMode);
+    TIMx->CCER = (uint16_t)((TIMx->CCER & ~(TIM_CCER_CC3E | TIM_CCER_CC3P)) |
+                            ((TIM_OCInitStruct->TIM_OutputState |
+                              TIM_OCInitStruct->TIM_OCPolarity) << 8));
+    TIMx->CCR3 = TIM_OCInitStruct->TIM_Pulse;
+}
+
+void
+TIM_OC4Init(
+    TIM_TypeDef *TIMx,
+    TIM_OCInitTypeDef *TIM_OCInitStruct
+) {
+    TIMx->CCMR2 = (uint16_t)((TIMx->CCMR2 & ~(TIM_CCMR2_OC4M | TIM_CCMR2_CC4S)) |
+                             (TIM_OCInitStruct->TIM_OCMode << 8));
+    TIMx->CCER = (uint16_t)((TIMx->CCER & ~(TIM_CCER_CC4E | TIM_CCER_CC4P)) |
+                            ((TIM_OCInitStruct->TIM_OutputState |
+                              TIM_OCInitStruct->TIM_OCPolarity) << 12));
+    TIMx->CCR4 = TIM_OCInitStruct->TIM_Pulse;
+}
+
+void
+TIM_OC1PreloadConfig(
+    TIM_TypeDef *TIMx,
+    uint16_t TIM_OCPreload
+) {
+    TIMx->CCMR1 = (uint16_t)((TIMx->CCMR1 & ~TIM_CCMR1_OC1PE) | TIM_OCPreload);
+}
+
+void
+TIM_OC2PreloadConfig(
+    TIM_TypeDef *TIMx,
+    uint16_t TIM_OCPreload
+) {
+    TIMx->CCMR1 = (uint16_t)((TIMx->CCMR1 & ~TIM_CCMR1_OC2PE) | (TIM_OCPreload << 8));
+}
+
+void
+TIM_OC3PreloadConfig(
+    TIM_TypeDef *TIMx,
+    uint16_t TIM_OCPreload
+) {
+    TIMx->CCMR2 = (uint16_t)((TIMx->CCMR2 & ~TIM_CCMR2_OC3PE) | TIM_OCPreload);
+}
+
+void
+TIM_OC4PreloadConfig(
+    TIM_TypeDef *TIMx,
+    uint16_t TIM_OCPreload
+) {
+    TIMx->CCMR2 = (uint16_t)((TIMx->CCMR2 & ~TIM_CCMR2_OC4PE) | (TIM_OCPreload << 8));
+}
+
+void
+TIM_SetCompare1(
+    TIM_TypeDef *TIMx,
+    uint32_t Compare1
+) {
+    TIMx->CCR1 = Compare1;
+}
+
+void
+TIM_SetCompare2(
+    TIM_TypeDef *TIMx,
+    uint32_t Compare2
+) {
+    TIMx->CCR2 = Compare2;
+}
+
+void
+TIM_SetCompare3(
+    TIM_TypeDef *TIMx,
+    uint32_t Compare3
+) {
+    TIMx->CCR3 = Compare3;
+}
+
+void
+TIM_SetCompare4(
+    TIM_TypeDef *TIMx,
+    uint32_t Compare4
+) {
+    TIMx->CCR4 = Compare4;
+}
+
+void
+TIM_CtrlPWMOutputs(
+    TIM_TypeDef *TIMx,
+    FunctionalState NewState
+) {
+    if (NewState != DISABLE) {
+        TIMx->BDTR |= TIM_BDTR_MOE;
+    } else {
+        TIMx->BDTR &= (uint16_t)~TIM_BDTR_MOE;
+    }
+}
+
+/* Interrupts, DMA and flags -------------------------------------------------*/
+
+void
+TIM_ITConfig(
+    TIM_TypeDef *TIMx,
+    uint16_t TIM_IT,
+    FunctionalState NewState
+) {
+    if (NewState != DISABLE) {
+        TIMx->DIER |= TIM_IT;
+    } else {
+        TIMx->DIER &= (uint16_t)~TIM_IT;
+    }
+}
+
+void
+TIM_DMAConfig(
+    TIM_TypeDef *TIMx,
+    uint16_t TIM_DMABase,
+    uint16_t TIM_DMABurstLength
+) {
+    TIMx->DCR = TIM_DMABase | TIM_DMABurstLength;
+}
+
+void
+TIM_DMACmd(
+    TIM_TypeDef *TIMx,
+    uint16_t TIM_DMASource,
+    FunctionalState NewState
+) {
+    if (NewState != DISABLE) {
+        TIMx->DIER |= TIM_DMASource;
+    } else {
+        TIMx->DIER &= (uint16_t)~TIM_DMASource;
+    }
+}
+
+FlagStatus
+TIM_GetFlagStatus(
+    TIM_TypeDef *TIMx,
+    uint16_t TIM_FLAG
+) {
+    return (TIMx->SR & TIM_FLAG) ? SET : RESET;
+}
+
+void
+TIM_ClearFlag(
+    TIM_TypeDef *TIMx,
+    uint16_t TIM_FLAG
+) {
+    TIMx->SR &= (uint16_t)~TIM_FLAG;
+}
+
+ITStatus
+TIM_GetITStatus(
+    TIM_TypeDef *TIMx,
+    uint16_t TIM_IT
+) {
+    return ((TIMx->SR & TIM_IT) && (TIMx->DIER & TIM_IT)) ? SET : RESET;
+}
+
+void
+TIM_ClearITPendingBit(
+    TIM_TypeDef *TIMx,
+    uint16_t TIM_IT
+) {
+    TIMx->SR &= (uint16_t)~TIM_IT;
+}
+
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+/**
+ * @func   Host_TimIndex
+ * @brief  Index of a timer: 0 TIM1 - 4 TIM5
+ * @param  pTim: timer
+ * @retval Index
+ */
+static uint8_t
+Host_TimIndex(
+    TIM_TypeDef *pTim
+) {
+    return (uint8_t)(pTim - g_pHostTim);
+}
+
+/**
+ * @func   Host_TimNow
+ * @brief  Simulated time in timer clock, timers of APB1 and APB2 run at
+ *         SystemCoreClock
+ * @param  None
+ * @retval Cycles
+ */
+static uint64_t
+Host_TimNow(void)
+{
+    return Host_GetUs() * HOST_TIM_CLK_PER_US;
+}
+
+/**
+ * @func   Host_TimArr
+ * @brief  Auto-reload in use: taken at last update event if preloaded
+ * @param  pTim: timer
+ * @retval ARR
+ */
+static uint32_t
+Host_TimArr(
+    TIM_TypeDef *pTim
+) {
+    if (pTim->CR1 & TIM_CR1_ARPE) {
+        return g_pTimState[Host_TimIndex(pTim)].dwArr;
+    }
+
+    return pTim->ARR;
+}
+
+/**
+ * @func   Host_TimCycles
+ * @brief  Length of a counter period from values in use
+ * @param  pTim: timer
+ * @retval Cycles of timer clock
+ */
+static uint64_t
+Host_TimCycles(
+    TIM_TypeDef *pTim
+) {
+    return (uint64_t)(g_pTimState[Host_TimIndex(pTim)].dwPsc + 1) *
+           ((uint64_t)Host_TimArr(pTim) + 1);
+}
+
+/**
+ * @func   Host_TimCcrReg
+ * @brief  Compare register of a channel
+ * @param  pTim: timer
+ * @param  byIndex: 0 - 3
+ * @retval Register
+ */
+static __IO uint32_t *
+Host_TimCcrReg(
+    TIM_TypeDef *pTim,
+    uint8_t byIndex
+) {
+    return &(&pTim->CCR1)[byIndex];
+}
+
+/**
+ * @func   Host_TimUpdate
+ * @brief  Update event: preloaded registers are taken, UIF is set and the
+ *         update DMA request is served
+ * @param  pTim: timer
+ * @retval None
+ */
+static void
+Host_TimUpdate(
+    TIM_TypeDef *pTim
+) {
+    host_tim_t *pState = &g_pTimState[Host_TimIndex(pTim)];
+    uint8_t i;
+
+    pState->dwPsc = pTim->PSC;
+    pState->dwArr = pTim->ARR;
+    pState->wRepeat = (pTim == TIM1) ? pTim->RCR : 0;
+    for (i = 0; i < HOST_TIM_CHANNELS; i++) {
+        pState->pdwCcr[i] = *Host_TimCcrReg(pTim, i);
+    }
+    pState->dwUpdates++;
+
+    if (!(pTim->CR1 & TIM_CR1_URS) || !(pTim->EGR & TIM_EGR_UG)) {
+        pTim->SR |= TIM_SR_UIF;
+    }
+    pTim->EGR = 0;
+
+    if (g_timHook != NULL) {
+        g_timHook(pTim);
+    }
+
+    if (pTim->DIER & TIM_DMA_Update) {
+        Host_TimRequest(pTim, TIM_DMA_Update);
+    }
+}
+
+/**
+ * @func   Host_TimReload
+ * @brief  Counter reloads: update event when repetition counter is down,
+ *         then compare events of the new period
+ * @param  pTim: timer
+ * @retval None
+ */
+static void
+Host_TimReload(
+    TIM_TypeDef *pTim
+) {
+    host_tim_t *pState = &g_pTimState[Host_TimIndex(pTim)];
+    uint32_t dwArr;
+    uint8_t i;
+
+    pState->qwStart = pState->qwNext;
+
+    if (pState->wRepeat != 0) {
+        pState->wRepeat--;
+    } else if (!(pTim->CR1 & TIM_CR1_UDIS)) {
+        Host_TimUpdate(pTim);
+    }
+
+    dwArr = Host_TimArr(pTim);
+    for (i = 0; i < HOST_TIM_CHANNELS; i++) {
+        if (Host_TimCompare(pTim, (uint8_t)(i + 1)) <= dwArr) {
+            pTim->SR |= (uint16_t)(TIM_SR_CC1IF << i);
+            if (pTim->DIER & (TIM_DMA_CC1 << i)) {
+                Host_TimRequest(pTim, (uint16_t)(TIM_DMA_CC1 << i));
+            }
+        }
+    }
+
+    pState->qwNext = pState->qwStart + Host_TimCycles(pTim);
+}
+
+/**
+ * @func   Host_TimRequest
+ * @brief  DMA request of a timer event, served by the streams mapped to it
+ * @param  pTim: timer
+ * @param  wRequest: TIM_DMA_xxx
+ * @retval None
+ */
+static void
+Host_TimRequest(
+    TIM_TypeDef *pTim,
+    uint16_t wRequest
+) {
+    uint8_t i;
+
+    for (i = 0; i < sizeof(g_pTimDma) / sizeof(g_pTimDma[0]); i++) {
+        if ((g_pTimDma[i].pTim == pTim) && (g_pTimDma[i].wRequest == wRequest) &&
+            ((g_pTimDma[i].pStream->CR & DMA_SxCR_CHSEL) == g_pTimDma[i].dwChannel)) {
+            Host_TimDma(pTim, g_pTimDma[i].pStream);
+        }
+    }
+}
+
+/**
+ * @func   Host_TimDma
+ * @brief  Memory to peripheral transfer of a request: one data, or a burst
+ *         of DCR when the peripheral is DMAR. HT and TC flags are set, a
+ *         circular stream starts again at the end
+ * @param  pTim: timer of request
+ * @param  pStream: stream
+ * @retval None
+ */
+static void
+Host_TimDma(
+    TIM_TypeDef *pTim,
+    DMA_Stream_TypeDef *pStream
+) {
+    uint16_t wLength = Host_DmaLength(pStream);
+    uint8_t bBurst = (pStream->PAR == (uint32_t)(uintptr_t)&pTim->DMAR);
+    uint8_t byCount = bBurst ? (uint8_t)(((pTim->DCR >> 8) & 0x1Fu) + 1) : 1;
+    uint8_t bySize = (uint8_t)(1u << ((pStream->CR & DMA_SxCR_MSIZE) >> 13));
+    uint8_t *pbyMemory;
+    __IO uint32_t *pdwRegister;
+    uint32_t dwData;
+    uint8_t i;
+
+    for (i = 0; i < byCount; i++) {
+        if (!(pStream->CR & DMA_SxCR_EN) || (pStream->NDTR == 0)) {
+            return;
+        }
+
+        pbyMemory = (uint8_t *)(uintptr_t)pStream->M0AR;
+        if (pStream->CR & DMA_SxCR_MINC) {
+            pbyMemory += (uint32_t)(wLength - pStream->NDTR) * bySize;
+        }
+        dwData = 0;
+        memcpy(&dwData, pbyMemory, bySize);
+
+        /* Registers of a timer are 32 bits apart */
+        if (bBurst) {
+            pdwRegister = (__IO uint32_t *)((uint8_t *)pTim + 4u * ((pTim->DCR & 0x1Fu) + i));
+        } else {
+            pdwRegister = (__IO uint32_t *)(uintptr_t)pStream->PAR;
+        }
+        *pdwRegister = dwData;
+
+        pStream->NDTR--;
+        if (pStream->NDTR == wLength / 2u) {
+            Host_DmaSetFlag(pStream, DMA_FLAG_HTIF0);
+        }
+        if (pStream->NDTR == 0) {
+            Host_DmaSetFlag(pStream, DMA_FLAG_TCIF0);
+            if (pStream->CR & DMA_SxCR_CIRC) {
+                pStream->NDTR = wLength;
+            } else {
+                pStream->CR &= ~DMA_SxCR_EN;
+            }
+        }
+    }
+}
+
+/**
+ * @func   Host_TimRestart
+ * @brief  Counter is set while running, next reload from it
+ * @param  pTim: timer
+ * @param  dwCounter: counter
+ * @retval None
+ */
+static void
+Host_TimRestart(
+    TIM_TypeDef *pTim,
+    uint32_t dwCounter
+) {
+    host_tim_t *pState = &g_pTimState[Host_TimIndex(pTim)];
+
+    pState->qwStart = Host_TimNow() - (uint64_t)dwCounter * (pState->dwPsc + 1);
+    pState->qwNext = pState->qwStart + Host_TimCycles(pTim);
+    Host_TimSchedule(pTim);
+}
+
+/**
+ * @func   Host_TimSchedule
+ * @brief  Event at next reload of a running timer, in the first us after it
+ * @param  pTim: timer
+ * @retval None
+ */
+static void
+Host_TimSchedule(
+    TIM_TypeDef *pTim
+) {
+    uint8_t byIndex = Host_TimIndex(pTim);
+    uint64_t qwNow = Host_TimNow();
+    uint64_t qwNext = g_pTimState[byIndex].qwNext;
+    uint32_t dwDelay = 0;
+
+    Host_CancelData(Host_TimEvent, (void *)(uintptr_t)byIndex);
+
+    if (!(pTim->CR1 & TIM_CR1_CEN)) {
+        return;
+    }
+
+    if (qwNext > qwNow) {
+        dwDelay = (uint32_t)((qwNext - qwNow + HOST_TIM_CLK_PER_US - 1) / HOST_TIM_CLK_PER_US);
+    }
+    Host_Schedule(dwDelay, Host_TimEvent, (void *)(uintptr_t)byIndex);
+}
+
+/**
+ * @func   Host_TimEvent
+ * @brief  Reloads of a timer due now. ARR written directly without preload
+ *         moves the end of the running period
+ * @param  pData: index of timer
+ * @retval None
+ */
+static void
+Host_TimEvent(
+    void *pData
+) {
+    TIM_TypeDef *pTim = &g_pHostTim[(uintptr_t)pData];
+    host_tim_t *pState = &g_pTimState[(uintptr_t)pData];
+    uint64_t qwNow = Host_TimNow();
+
+    if (!(pTim->CR1 & TIM_CR1_ARPE)) {
+        pState->qwNext = pState->qwStart + Host_TimCycles(pTim);
+    }
+
+    while ((pTim->CR1 & TIM_CR1_CEN) && (pState->qwNext <= qwNow)) {
+        Host_TimReload(pTim);
+    }
+
+    Host_TimSchedule(pTim);
+}
+
+/* END FILE */
@@ -0,0 +1,230 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Host build, software timers of timer.h on simulated time.
+ *              Callbacks run from processTimerScheduler, as on target
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include "host.h"
+#include "timer.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+typedef struct {
+    uint8_t bUsed;
+    uint8_t byRepeats;
+    uint32_t dwPeriod;
+    uint32_t dwDue;
+    void (*callback)(void *);
+    void *pData;
+} host_timer_t, *host_timer_p;
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+static host_timer_t g_pTimer[MAX_TIMER];
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func   TimerInit
+ * @brief  Stop all timers
+ * @param  None
+ * @retval None
+ */
+void
+TimerInit(void)
+{
+    Host_TimerReset();
+}
+
+/**
+ * @func   TimerStart
+ * @brief  Start a timer: TIMER_REPEAT_ONE_TIME runs once,
+ *         TIMER_REPEAT_FOREVER until stopped, other counts n + 1 times
+ * @param  name: unused
+ * @param  dwMilSecTick: period (ms)
+ * @param  byRepeats: repeats
+ * @param  callback, pcallbackData: called when due
+ * @retval Id of timer or NO_TIMER
+ */
+uint8_t
+TimerStart(
+    char *name,
+    uint32_t dwMilSecTick,
+    uint8_t byRepeats,
+    void (*callback)(void *),
+    void *pcallbackData
+) {
+    uint8_t i;
+
+    (void)name;
+
+    for (i = 0; i < MAX_TIMER; i++) {
+        if (!g_pTimer[i].bUsed) {
+            g_pTimer[i].bUsed = 1;
+            g_pTimer[i].byRepeats = byRepeats;
+            g_pTimer[i].dwPeriod = dwMilSecTick;
+            g_pTimer[i].dwDue = GetMilSecTick() + dwMilSecTick;
+            g_pTimer[i].callback = callback;
+            g_pTimer[i].pData = pcallbackData;
+            return i;
+        }
+    }
+
+    return NO_TIMER;
+}
+
+/**
+ * @func   TimerChangePeriod
+ * @brief  Change period, next run one period from now
+ * @param  byTimerId: id of timer
+ * @param  dwPeriodTicks: period (ms)
+ * @retval None
+ */
+void
+TimerChangePeriod(
+    uint8_t byTimerId,
+    uint32_t dwPeriodTicks
+) {
+    if ((byTimerId < MAX_TIMER) && g_pTimer[byTimerId].bUsed) {
+        g_pTimer[byTimerId].dwPeriod = dwPeriodTicks;
+        g_pTimer[byTimerId].dwDue = GetMilSecTick() + dwPeriodTicks;
+    }
+}
+
+/**
+ * @func   TimerRestart
+ * @brief  Start a running timer again
+ * @param  byTimerId: id of timer
+ * @param  dwMilSecTick: period (ms)
+ * @param  byRepeats: repeats
+ * @retval 1 if restarted
+ */
+uint8_t
+TimerRestart(
+    uint8_t byTimerId,
+    uint32_t dwMilSecTick,
+    uint8_t byRepeats
+) {
+    if ((byTimerId >= MAX_TIMER) || !g_pTimer[byTimerId].bUsed) {
+        return 0;
+    }
+
+    g_pTimer[byTimerId].byRepeats = byRepeats;
+    TimerChangePeriod(byTimerId, dwMilSecTick);
+
+    return 1;
+}
+
+/**
+ * @func   TimerStop
+ * @brief  Stop a timer
+ * @param  byTimerId: id of timer
+ * @retval 1 if stopped
+ */
+uint8_t
+TimerStop(
+    uint8_t byTimerId
+) {
+    if ((byTimerId >= MAX_TIMER) || !g_pTimer[byTimerId].bUsed) {
+        return 0;
+    }
+
+    g_pTimer[byTimerId].bUsed = 0;
+
+    return 1;
+}
+
+/**
+ * @func   GetMilSecTick
+ * @brief  Simulated time in ms
+ * @param  None
+ * @retval Tick (ms)
+ */
+uint32_t
+GetMilSecTick(void)
+{
+    return (uint32_t)(Host_GetUs() / 1000u);
+}
+
+/**
+ * @func   processTimerScheduler
+ * @brief  Run callbacks of timers due
+ * @param  None
+ * @retval None
+ */
+void
+processTimerScheduler(void)
+{
+    host_timer_p pTimer;
+    uint8_t i;
+
+    for (i = 0; i < MAX_TIMER; i++) {
+        pTimer = &g_pTimer[i];
+        if (!pTimer->bUsed || ((int32_t)(GetMilSecTick() - pTimer->dwDue) < 0)) {
+            continue;
+        }
+
+        if (pTimer->byRepeats == TIMER_REPEAT_ONE_TIME) {
+            pTimer->bUsed = 0;
+        } else {
+            if (pTimer->byRepeats != TIMER_REPEAT_FOREVER) {
+                pTimer->byRepeats--;
+            }
+            pTimer->dwDue += (pTimer->dwPeriod != 0) ? pTimer->dwPeriod : 1u;
+        }
+
+        pTimer->callback(pTimer->pData);
+    }
+}
+
+/**
+ * @func   Host_TimerReset
+ * @brief  Stop all timers
+ * @param  None
+ * @retval None
+ */
+void
+Host_TimerReset(void)
+{
+    uint8_t i;
+
+    for (i = 0; i < MAX_TIMER; i++) {
+        g_pTimer[i].bUsed = 0;
+    }
+}
+
+/**
+ * @func   Host_TimerCount
+ * @brief  Timers running
+ * @param  None
+ * @retval Number of timers
+ */
+uint8_t
+Host_TimerCount(void)
+{
+    uint8_t byCount = 0;
+    uint8_t i;
+
+    for (i = 0; i < MAX_TIMER; i++) {
+        byCount += g_pTimer[i].bUsed;
+    }
+
+    return byCount;
+}
+
+/* END FILE */
@@ -0,0 +1,1942 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Host build, the part of ucglib in the prebuilt library used by
+ *              the Middle modules: com and device messages, clipping, color
+ *              sliders, lines, boxes, discs, rotation, fonts and the ST7735
+ *              128x128 device. Same bytes to com_cb as the library, its
+ *              quirks kept: windows of lines of dir 2 and 3 are mirrored
+ *              around 127 and a division by zero gives 0 as on Cortex-M.
+ *              ucg_DrawString is deferred as in ucg_font.o of the library:
+ *              strings are queued and a 30 ms timer task draws one glyph a
+ *              tick from processTimerScheduler (Host_UcgRunText)
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <stddef.h>
+#include "host.h"
+#include "timer.h"
+#include "ucg.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define HOST_UCG_FONT_HEADER_SIZE           21u
+#define HOST_UCG_ST7735_MIRROR              127     /* Of lines of dir 2 and 3 */
+
+/* Text task of ucg_font.o: 4096 bytes of 12-byte records, 30 ms a glyph */
+#define HOST_UCG_TEXT_QUEUE_SIZE            (4096u / 12u)
+#define HOST_UCG_TEXT_TICK_MS               30u
+#define HOST_UCG_TEXT_TICK_MAX              4096u   /* Of Host_UcgRunText */
+
+/*! @brief Queued string, str is kept as a pointer as by the library */
+typedef struct {
+    ucg_int_t x;
+    ucg_int_t y;
+    uint8_t dir;
+    const char *str;
+} host_ucg_text_t, *host_ucg_text_p;
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+static const ucg_pgm_uint8_t g_pbySt7735InitSeq[] = {
+    UCG_CFG_CD(0, 1),
+    UCG_RST(1),
+    UCG_CS(1),
+    UCG_DLY_MS(5),
+    UCG_RST(0),
+    UCG_DLY_MS(5),
+    UCG_RST(1),
+    UCG_DLY_MS(50),
+    UCG_CS(0),
+    UCG_C10(0x11),                              /* Sleep out */
+    UCG_DLY_MS(10),
+    UCG_C10(0x13),                              /* Normal display */
+    UCG_C10(0x20),                              /* Not inverted */
+    UCG_C11(0x3A, 0x06),                        /* 18 bit */
+    UCG_C10(0x29),                              /* Display on */
+    UCG_C11(0x36, 0x00),
+    UCG_C14(0x2A, 0x00, 0x00, 0x00, 0x7F),
+    UCG_C14(0x2B, 0x00, 0x00, 0x00, 0x9F),
+    UCG_C10(0x2C),
+    UCG_CS(1),
+    UCG_END()
+};
+
+static const ucg_pgm_uint8_t g_pbySt7735PowerDownSeq[] = {
+    UCG_CS(0),
+    UCG_C10(0x10),                              /* Sleep in */
+    UCG_C10(0x28),                              /* Display off */
+    UCG_CS(1),
+    UCG_END()
+};
+
+static const ucg_pgm_uint8_t g_pbySt7735SetPosSeq[] = {
+    UCG_CS(0),
+    UCG_C11(0x36, 0x00),
+    UCG_C10(0x2A), UCG_VARX(0, 0x00, 0), UCG_VARX(0, 0xFF, 0), UCG_A2(0x00, 0x7F),
+    UCG_C10(0x2B), UCG_VARY(0, 0x00, 0), UCG_VARY(0, 0xFF, 0), UCG_A2(0x00, 0x9F),
+    UCG_C10(0x2C),
+    UCG_DATA(),
+    UCG_END()
+};
+
+static const ucg_pgm_uint8_t g_pbySt7735SetPosDir0Seq[] = {
+    UCG_CS(0),
+    UCG_C11(0x36, 0x00),
+    UCG_C10(0x2A), UCG_VARX(0, 0x00, 0), UCG_VARX(0, 0xFF, 0), UCG_A2(0x00, 0x81),
+    UCG_C10(0x2B), UCG_VARY(0, 0x00, 0), UCG_VARY(0, 0xFF, 0), UCG_A2(0x00, 0xA0),
+    UCG_C10(0x2C),
+    UCG_DATA(),
+    UCG_END()
+};
+
+static const ucg_pgm_uint8_t g_pbySt7735SetPosDir1Seq[] = {
+    UCG_CS(0),
+    UCG_C11(0x36, 0x00),
+    UCG_C10(0x2A), UCG_VARX(0, 0x00, 0), UCG_VARX(0, 0xFF, 0),
+                   UCG_VARX(0, 0x00, 0), UCG_VARX(0, 0xFF, 0),
+    UCG_C10(0x2B), UCG_VARY(0, 0x00, 0), UCG_VARY(0, 0xFF, 0), UCG_A2(0x00, 0x9F),
+    UCG_C10(0x2C),
+    UCG_DATA(),
+    UCG_END()
+};
+
+static const ucg_pgm_uint8_t g_pbySt7735SetPosDir2Seq[] = {
+    UCG_CS(0),
+    UCG_C11(0x36, 0x40),
+    UCG_C11(0x36, 0x40),
+    UCG_C10(0x2A), UCG_VARX(0, 0x00, 0), UCG_VARX(0, 0xFF, 0), UCG_A2(0x00, 0x7F),
+    UCG_C10(0x2B), UCG_VARY(8, 0x01, 0), UCG_VARY(0, 0xFF, 0), UCG_A2(0x00, 0x9F),
+    UCG_C10(0x2C),
+    UCG_DATA(),
+    UCG_END()
+};
+
+static const ucg_pgm_uint8_t g_pbySt7735SetPosDir3Seq[] = {
+    UCG_CS(0),
+    UCG_C11(0x36, 0x80),
+    UCG_C11(0x36, 0x80),
+    UCG_C10(0x2A), UCG_VARX(0, 0x00, 0), UCG_VARX(0, 0xFF, 0),
+                   UCG_VARX(0, 0x00, 0), UCG_VARX(0, 0xFF, 0),
+    UCG_C10(0x2B), UCG_VARY(0, 0x00, 0), UCG_VARY(0, 0xFF, 0), UCG_A2(0x00, 0x9F),
+    UCG_C10(0x2C),
+    UCG_DATA(),
+    UCG_END()
+};
+
+static host_ucg_text_t g_pText[HOST_UCG_TEXT_QUEUE_SIZE];
+static host_ucg_text_t g_text;                  /* String being drawn */
+static uint16_t g_wTextHead;
+static uint16_t g_wTextCount;
+static uint8_t g_bTextDrawing;
+static uint8_t g_byTextTimer = NO_TIMER;
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static void Host_UcgTextTask(void *pData);
+static ucg_int_t Host_UcgDiv(ucg_int_t iNum, ucg_int_t iDen);
+static ucg_int_t Host_UcgMod(ucg_int_t iNum, ucg_int_t iDen);
+static ucg_int_t Host_UcgIsXVisible(ucg_t *ucg);
+static ucg_int_t Host_UcgIsYVisible(ucg_t *ucg);
+static ucg_int_t Host_UcgIntersection(ucg_int_t *piA, ucg_int_t *piB, ucg_int_t c, ucg_int_t d);
+static void Host_UcgSendStringP(ucg_t *ucg, uint8_t byCount, const ucg_pgm_uint8_t *pbyData);
+static void Host_UcgSt7735SetPos(ucg_t *ucg);
+static ucg_int_t Host_UcgSt7735L90fx(ucg_t *ucg);
+static ucg_int_t Host_UcgSt7735L90se(ucg_t *ucg);
+static void Host_UcgRotateBox(ucg_t *ucg, uint8_t byTurns, ucg_box_t *pBox);
+static void Host_UcgRotatePos(ucg_t *ucg, uint8_t byTurns);
+static ucg_int_t Host_UcgRotate(ucg_t *ucg, uint8_t byTurns, ucg_int_t msg, void *data);
+static void Host_UcgDiscSection(ucg_t *ucg, ucg_int_t x, ucg_int_t y, ucg_int_t x0, ucg_int_t y0, uint8_t option);
+static uint16_t Host_UcgFontWord(const uint8_t *pbyFont, uint8_t byOffset);
+static uint8_t Host_UcgGetUnsignedBits(ucg_font_decode_t *pDecode, uint8_t byCount);
+static int8_t Host_UcgGetSignedBits(ucg_font_decode_t *pDecode, uint8_t byCount);
+static ucg_int_t Host_UcgAddVectorX(ucg_int_t dx, int8_t x, int8_t y, uint8_t dir);
+static ucg_int_t Host_UcgAddVectorY(ucg_int_t dy, int8_t x, int8_t y, uint8_t dir);
+static void Host_UcgDecodeLen(ucg_t *ucg, uint8_t byLength, uint8_t bForeground);
+static void Host_UcgSetupDecode(ucg_t *ucg, const uint8_t *pbyGlyph);
+static const uint8_t *Host_UcgGlyphData(ucg_t *ucg, uint8_t encoding);
+static ucg_int_t Host_UcgCalcVrefFont(ucg_t *ucg);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/* ucg_com_msg_api.c ---------------------------------------------------------*/
+
+void
+ucg_com_PowerDown(
+    ucg_t *ucg
+) {
+    if ((ucg->com_status & UCG_COM_STATUS_MASK_POWER) != 0) {
+        ucg->com_cb(ucg, UCG_COM_MSG_POWER_DOWN, 0, NULL);
+    }
+    ucg->com_status &= ~UCG_COM_STATUS_MASK_POWER;
+}
+
+int16_t
+ucg_com_PowerUp(
+    ucg_t *ucg,
+    uint16_t serial_clk_speed,
+    uint16_t parallel_clk_speed
+) {
+    ucg_com_info_t info;
+    int16_t r;
+
+    info.serial_clk_speed = serial_clk_speed;
+    info.parallel_clk_speed = parallel_clk_speed;
+
+    ucg_com_PowerDown(ucg);
+    ucg->com_initial_change_sent = 0;
+    r = ucg->com_cb(ucg, UCG_COM_MSG_POWER_UP, 0, (uint8_t *)&info);
+    if (r != 0) {
+        ucg->com_status |= UCG_COM_STATUS_MASK_POWER;
+    }
+
+    return r;
+}
+
+void
+ucg_com_SetLineStatus(
+    ucg_t *ucg,
+    uint8_t level,
+    uint8_t mask,
+    uint8_t msg
+) {
+    uint8_t bSent = (ucg->com_initial_change_sent & mask) != 0;
+    uint8_t bHigh = (ucg->com_status & mask) != 0;
+
+    /* A line is driven on change only, and once after power up */
+    if (bSent && (bHigh == (level != 0))) {
+        return;
+    }
+
+    ucg->com_cb(ucg, msg, level, NULL);
+    if (level == 0) {
+        ucg->com_status &= ~mask;
+    } else {
+        ucg->com_status |= mask;
+    }
+    ucg->com_initial_change_sent |= mask;
+}
+
+void
+ucg_com_SetResetLineStatus(
+    ucg_t *ucg,
+    uint8_t level
+) {
+    ucg_com_SetLineStatus(ucg, level, UCG_COM_STATUS_MASK_RESET, UCG_COM_MSG_CHANGE_RESET_LINE);
+}
+
+void
+ucg_com_SetCSLineStatus(
+    ucg_t *ucg,
+    uint8_t level
+) {
+    ucg_com_SetLineStatus(ucg, level, UCG_COM_STATUS_MASK_CS, UCG_COM_MSG_CHANGE_CS_LINE);
+}
+
+void
+ucg_com_SetCDLineStatus(
+    ucg_t *ucg,
+    uint8_t level
+) {
+    ucg_com_SetLineStatus(ucg, level, UCG_COM_STATUS_MASK_CD, UCG_COM_MSG_CHANGE_CD_LINE);
+}
+
+void
+ucg_com_DelayMicroseconds(
+    ucg_t *ucg,
+    uint16_t delay
+) {
+    ucg->com_cb(ucg, UCG_COM_MSG_DELAY, delay, NULL);
+}
+
+void
+ucg_com_DelayMilliseconds(
+    ucg_t *ucg,
+    uint16_t delay
+) {
+    while (delay > 0) {
+        ucg_com_DelayMicroseconds(ucg, 1000);
+        delay--;
+    }
+}
+
+void
+ucg_com_SendByte(
+    ucg_t *ucg,
+    uint8_t byte
+) {
+    ucg->com_cb(ucg, UCG_COM_MSG_SEND_BYTE, byte, NULL);
+}
+
+void
+ucg_com_SendRepeatByte(
+    ucg_t *ucg,
+    uint16_t cnt,
+    uint8_t byte
+) {
+    ucg->com_cb(ucg, UCG_COM_MSG_REPEAT_1_BYTE, cnt, &byte);
+}
+
+void
+ucg_com_SendRepeat2Bytes(
+    ucg_t *ucg,
+    uint16_t cnt,
+    uint8_t *byte_ptr
+) {
+    ucg->com_cb(ucg, UCG_COM_MSG_REPEAT_2_BYTES, cnt, byte_ptr);
+}
+
+void
+ucg_com_SendString(
+    ucg_t *ucg,
+    uint16_t cnt,
+    const uint8_t *byte_ptr
+) {
+    ucg->com_cb(ucg, UCG_COM_MSG_SEND_STR, cnt, (uint8_t *)byte_ptr);
+}
+
+void
+ucg_com_SendCmdDataSequence(
+    ucg_t *ucg,
+    uint16_t cnt,
+    const uint8_t *byte_ptr,
+    uint8_t cd_line_status_at_end
+) {
+    ucg->com_cb(ucg, UCG_COM_MSG_SEND_CD_DATA_SEQUENCE, cnt, (uint8_t *)byte_ptr);
+    ucg_com_SetCDLineStatus(ucg, cd_line_status_at_end);
+}
+
+void
+ucg_com_SendCmdSeq(
+    ucg_t *ucg,
+    const ucg_pgm_uint8_t *data
+) {
+    uint8_t b, bb, hi, lo;
+    uint16_t wValue;
+
+    for (;;) {
+        b = *data;
+        hi = b >> 4;
+        lo = b & 0x0F;
+
+        switch (hi) {
+        case 0:
+            return;
+
+        case 1:
+        case 2:
+            ucg_com_SetCDLineStatus(ucg, (ucg->com_cfg_cd >> 1) & 1);
+            Host_UcgSendStringP(ucg, hi, data + 1);
+            if (lo > 0) {
+                ucg_com_SetCDLineStatus(ucg, ucg->com_cfg_cd & 1);
+                Host_UcgSendStringP(ucg, lo, data + 1 + hi);
+            }
+            data += 1 + hi + lo;
+            break;
+
+        case 6:
+            ucg_com_SetCDLineStatus(ucg, ucg->com_cfg_cd & 1);
+            Host_UcgSendStringP(ucg, lo, data + 1);
+            data += 1 + lo;
+            break;
+
+        case 7:
+            ucg_com_SetCDLineStatus(ucg, ((ucg->com_cfg_cd >> 1) & 1) ^ 1);
+            if (lo > 0) {
+                Host_UcgSendStringP(ucg, lo, data + 1);
+            }
+            data += 1 + lo;
+            break;
+
+        case 8:
+        case 9:
+            wValue = (uint16_t)((lo << 8) | data[1]);
+            if (hi == 8) {
+                ucg_com_DelayMilliseconds(ucg, wValue);
+            } else {
+                ucg_com_DelayMicroseconds(ucg, wValue);
+            }
+            data += 2;
+            break;
+
+        case 10:
+        case 11:
+            b = data[1];
+            bb = data[2];
+            ucg_com_SetCDLineStatus(ucg, ucg->com_cfg_cd & 1);
+            if (hi == 10) {
+                wValue = (uint16_t)(ucg->arg.pixel.pos.x + ucg->display_offset.x);
+            } else {
+                wValue = (uint16_t)(ucg->arg.pixel.pos.y + ucg->display_offset.y);
+            }
+            ucg_com_SendByte(ucg, (uint8_t)((((int16_t)wValue >> lo) & b) | bb));
+            data += 3;
+            break;
+
+        case 15:
+            switch (lo >> 2) {
+            case 0:
+                ucg_com_SetResetLineStatus(ucg, lo & 1);
+                break;
+            case 1:
+                ucg_com_SetCSLineStatus(ucg, lo & 1);
+                break;
+            case 3:
+                ucg->com_cfg_cd = lo & 3;
+                break;
+            default:
+                break;
+            }
+            data++;
+            break;
+
+        default:
+            return;
+        }
+    }
+}
+
+/* ucg_dev_msg_api.c ---------------------------------------------------------*/
+
+void
+ucg_PowerDown(
+    ucg_t *ucg
+) {
+    if (ucg->is_power_up) {
+        ucg->device_cb(ucg, UCG_MSG_DEV_POWER_DOWN, NULL);
+        ucg->is_power_up = 0;
+    }
+}
+
+ucg_int_t
+ucg_PowerUp(
+    ucg_t *ucg
+) {
+    ucg_int_t r;
+
+    ucg_PowerDown(ucg);
+    r = ucg->device_cb(ucg, UCG_MSG_DEV_POWER_UP, NULL);
+    if (r != 0) {
+        ucg->is_power_up = 1;
+    }
+
+    return r;
+}
+
+void
+ucg_SetClipBox(
+    ucg_t *ucg,
+    ucg_box_t *clip_box
+) {
+    ucg->device_cb(ucg, UCG_MSG_SET_CLIP_BOX, clip_box);
+}
+
+void
+ucg_SetClipRange(
+    ucg_t *ucg,
+    ucg_int_t x,
+    ucg_int_t y,
+    ucg_int_t w,
+    ucg_int_t h
+) {
+    ucg_box_t box;
+
+    box.ul.x = x;
+    box.ul.y = y;
+    box.size.w = w;
+    box.size.h = h;
+    ucg_SetClipBox(ucg, &box);
+}
+
+void
+ucg_SetMaxClipRange(
+    ucg_t *ucg
+) {
+    ucg_box_t box;
+
+    box.size = ucg->dimension;
+    box.ul.x = 0;
+    box.ul.y = 0;
+    ucg_SetClipBox(ucg, &box);
+}
+
+void
+ucg_GetDimension(
+    ucg_t *ucg
+) {
+    ucg->device_cb(ucg, UCG_MSG_GET_DIMENSION, &ucg->dimension);
+    ucg_SetMaxClipRange(ucg);
+}
+
+void
+ucg_DrawPixelWithArg(
+    ucg_t *ucg
+) {
+    ucg->device_cb(ucg, UCG_MSG_DRAW_PIXEL, NULL);
+}
+
+void
+ucg_DrawL90FXWithArg(
+    ucg_t *ucg
+) {
+    ucg->device_cb(ucg, UCG_MSG_DRAW_L90FX, NULL);
+}
+
+void
+ucg_DrawL90SEWithArg(
+    ucg_t *ucg
+) {
+    ucg->device_cb(ucg, UCG_MSG_DRAW_L90SE, NULL);
+}
+
+/* ucg_init.c ----------------------------------------------------------------*/
+
+ucg_int_t
+ucg_Init(
+    ucg_t *ucg,
+    ucg_dev_fnptr device_cb,
+    ucg_dev_fnptr ext_cb,
+    ucg_com_fnptr com_cb
+) {
+    ucg_int_t r;
+
+    /* Fields not listed keep their value, as in the library */
+    ucg->is_power_up = 0;
+    ucg->rotate_chain_device_cb = NULL;
+    ucg->arg.scale = 1;
+    ucg->font = NULL;
+    ucg->font_decode.is_transparent = 1;
+    ucg->com_initial_change_sent = 0;
+    ucg->com_status = 0;
+    ucg->com_cfg_cd = 0;
+
+    ucg->ext_cb = (ext_cb == NULL) ? ucg_ext_none : ext_cb;
+    ucg->device_cb = device_cb;
+    ucg->com_cb = com_cb;
+    ucg_SetFontPosBaseline(ucg);
+    r = ucg_PowerUp(ucg);
+    ucg_GetDimension(ucg);
+
+    return r;
+}
+
+/* ucg_dev_default_cb.c ------------------------------------------------------*/
+
+ucg_int_t
+ucg_dev_default_cb(
+    ucg_t *ucg,
+    ucg_int_t msg,
+    void *data
+) {
+    switch (msg) {
+    case UCG_MSG_DRAW_L90SE:
+        return ucg->ext_cb(ucg, msg, data);
+
+    case UCG_MSG_SET_CLIP_BOX:
+        ucg->clip_box = *(ucg_box_t *)data;
+        break;
+
+    default:
+        break;
+    }
+
+    return 1;
+}
+
+ucg_int_t
+ucg_ext_none(
+    ucg_t *ucg,
+    ucg_int_t msg,
+    void *data
+) {
+    (void)ucg;
+    (void)msg;
+    (void)data;
+
+    return 1;
+}
+
+/* ucg_clip.c ----------------------------------------------------------------*/
+
+ucg_int_t
+ucg_clip_is_pixel_visible(
+    ucg_t *ucg
+) {
+    return Host_UcgIsXVisible(ucg) && Host_UcgIsYVisible(ucg);
+}
+
+ucg_int_t
+ucg_clip_l90fx(
+    ucg_t *ucg
+) {
+    ucg_int_t a, b;
+    ucg_int_t *piPos;
+    ucg_int_t c, d;
+
+    ucg->arg.offset = 0;
+
+    if (ucg->arg.dir & 1) {
+        if (!Host_UcgIsXVisible(ucg)) {
+            return 0;
+        }
+        piPos = &ucg->arg.pixel.pos.y;
+        c = ucg->clip_box.ul.y;
+        d = (ucg_int_t)(c + ucg->clip_box.size.h);
+    } else {
+        if (!Host_UcgIsYVisible(ucg)) {
+            return 0;
+        }
+        piPos = &ucg->arg.pixel.pos.x;
+        c = ucg->clip_box.ul.x;
+        d = (ucg_int_t)(c + ucg->clip_box.size.w);
+    }
+
+    if (ucg->arg.dir < 2) {
+        a = *piPos;
+        b = (ucg_int_t)(a + ucg->arg.len);
+        if (!Host_UcgIntersection(&a, &b, c, d)) {
+            return 0;
+        }
+        ucg->arg.offset = (ucg_int_t)(a - *piPos);
+        *piPos = a;
+        ucg->arg.len = (ucg_int_t)(b - a);
+    } else {
+        b = (ucg_int_t)(*piPos + 1);
+        a = (ucg_int_t)(b - ucg->arg.len);
+        if (!Host_UcgIntersection(&a, &b, c, d)) {
+            return 0;
+        }
+        ucg->arg.len = (ucg_int_t)(b - a);
+        b--;
+        ucg->arg.offset = (ucg_int_t)(*piPos - b);
+        *piPos = b;
+    }
+
+    return 1;
+}
+
+ucg_int_t
+ucg_clip_l90se(
+    ucg_t *ucg
+) {
+    uint8_t i;
+
+    if (!ucg_clip_l90fx(ucg)) {
+        return 0;
+    }
+
+    for (i = 0; i < 3; i++) {
+        ucg_ccs_seek(&ucg->arg.ccs_line[i], ucg->arg.offset);
+    }
+
+    return 1;
+}
+
+/* ucg_ccs.c -----------------------------------------------------------------*/
+
+void
+ucg_ccs_init(
+    ucg_ccs_t *ccs,
+    uint8_t start,
+    uint8_t end,
+    ucg_int_t steps
+) {
+    ccs->start = start;
+    ccs->num = (ucg_int_t)(end - start);
+    ccs->den = (ucg_int_t)(steps - 1);
+    ccs->dir = 1;
+
+    ccs->quot = Host_UcgDiv(ccs->num, ccs->den);
+    if (ccs->num < 0) {
+        ccs->num = (ucg_int_t)-ccs->num;
+        ccs->dir = -1;
+    }
+    ccs->rem = Host_UcgMod(ccs->num, ccs->den);
+
+    ccs->frac = (ucg_int_t)(ccs->den / 2);
+    ccs->current = start;
+}
+
+void
+ucg_ccs_step(
+    ucg_ccs_t *ccs
+) {
+    ccs->current = (uint8_t)(ccs->current + ccs->quot);
+    ccs->frac = (ucg_int_t)(ccs->frac + ccs->rem);
+    if (ccs->frac >= ccs->den) {
+        ccs->current = (uint8_t)(ccs->current + ccs->dir);
+        ccs->frac = (ucg_int_t)(ccs->frac - ccs->den);
+    }
+}
+
+void
+ucg_ccs_seek(
+    ucg_ccs_t *ccs,
+    ucg_int_t pos
+) {
+    ucg_int_t p;
+
+    ccs->current = (uint8_t)(ccs->quot * pos);
+    p = (ucg_int_t)(ccs->rem * pos + ccs->den / 2);
+    if (ccs->dir >= 0) {
+        ccs->current = (uint8_t)(ccs->current + Host_UcgDiv(p, ccs->den));
+    } else {
+        ccs->current = (uint8_t)(ccs->current - Host_UcgDiv(p, ccs->den));
+    }
+    ccs->frac = Host_UcgMod(p, ccs->den);
+    ccs->current = (uint8_t)(ccs->current + ccs->start);
+}
+
+/* ucg_pixel.c, ucg_line.c, ucg_box.c, ucg_circle.c --------------------------*/
+
+void
+ucg_SetColor(
+    ucg_t *ucg,
+    uint8_t idx,
+    uint8_t r,
+    uint8_t g,
+    uint8_t b
+) {
+    ucg->arg.rgb[idx].color[0] = r;
+    ucg->arg.rgb[idx].color[1] = g;
+    ucg->arg.rgb[idx].color[2] = b;
+}
+
+void
+ucg_DrawPixel(
+    ucg_t *ucg,
+    ucg_int_t x,
+    ucg_int_t y
+) {
+    ucg->arg.pixel.rgb = ucg->arg.rgb[0];
+    ucg->arg.pixel.pos.x = x;
+    ucg->arg.pixel.pos.y = y;
+    ucg_DrawPixelWithArg(ucg);
+}
+
+void
+ucg_Draw90Line(
+    ucg_t *ucg,
+    ucg_int_t x,
+    ucg_int_t y,
+    ucg_int_t len,
+    ucg_int_t dir,
+    ucg_int_t col_idx
+) {
+    ucg->arg.pixel.rgb = ucg->arg.rgb[col_idx];
+    ucg->arg.pixel.pos.x = x;
+    ucg->arg.pixel.pos.y = y;
+    ucg->arg.len = len;
+    ucg->arg.dir = dir;
+    ucg_DrawL90FXWithArg(ucg);
+}
+
+void
+ucg_DrawHLine(
+    ucg_t *ucg,
+    ucg_int_t x,
+    ucg_int_t y,
+    ucg_int_t len
+) {
+    ucg_Draw90Line(ucg, x, y, len, 0, 0);
+}
+
+void
+ucg_DrawVLine(
+    ucg_t *ucg,
+    ucg_int_t x,
+    ucg_int_t y,
+    ucg_int_t len
+) {
+    ucg_Draw90Line(ucg, x, y, len, 1, 0);
+}
+
+void
+ucg_DrawGradientLine(
+    ucg_t *ucg,
+    ucg_int_t x,
+    ucg_int_t y,
+    ucg_int_t len,
+    ucg_int_t dir
+) {
+    ucg->arg.pixel.pos.x = x;
+    ucg->arg.pixel.pos.y = y;
+    ucg->arg.len = len;
+    ucg->arg.dir = dir;
+    ucg_DrawL90SEWithArg(ucg);
+}
+
+void
+ucg_DrawBox(
+    ucg_t *ucg,
+    ucg_int_t x,
+    ucg_int_t y,
+    ucg_int_t w,
+    ucg_int_t h
+) {
+    while (h > 0) {
+        ucg_DrawHLine(ucg, x, y, w);
+        h--;
+        y++;
+    }
+}
+
+void
+ucg_ClearScreen(
+    ucg_t *ucg
+) {
+    ucg_SetColor(ucg, 0, 0, 0, 0);
+    ucg_SetMaxClipRange(ucg);
+    ucg_DrawBox(ucg, 0, 0, ucg_GetWidth(ucg), ucg_GetHeight(ucg));
+}
+
+void
+ucg_DrawFrame(
+    ucg_t *ucg,
+    ucg_int_t x,
+    ucg_int_t y,
+    ucg_int_t w,
+    ucg_int_t h
+) {
+    ucg_DrawHLine(ucg, x, y, w);
+    ucg_DrawVLine(ucg, x, y, h);
+    ucg_DrawVLine(ucg, (ucg_int_t)(x + w - 1), y, h);
+    ucg_DrawHLine(ucg, x, (ucg_int_t)(y + h - 1), w);
+}
+
+void
+ucg_DrawRBox(
+    ucg_t *ucg,
+    ucg_int_t x,
+    ucg_int_t y,
+    ucg_int_t w,
+    ucg_int_t h,
+    ucg_int_t r
+) {
+    ucg_int_t xl = (ucg_int_t)(x + r);
+    ucg_int_t yu = (ucg_int_t)(y + r);
+    ucg_int_t xr = (ucg_int_t)(x + w - r - 1);
+    ucg_int_t yl = (ucg_int_t)(y + h - r - 1);
+    ucg_int_t ww = (ucg_int_t)(w - r - r - 2);
+    ucg_int_t hh = (ucg_int_t)(h - r - r - 2);
+
+    ucg_DrawDisc(ucg, xl, yu, r, UCG_DRAW_UPPER_LEFT);
+    ucg_DrawDisc(ucg, xr, yu, r, UCG_DRAW_UPPER_RIGHT);
+    ucg_DrawDisc(ucg, xl, yl, r, UCG_DRAW_LOWER_LEFT);
+    ucg_DrawDisc(ucg, xr, yl, r, UCG_DRAW_LOWER_RIGHT);
+
+    xl++;
+    yu++;
+
+    if (ww >= 0) {
+        ucg_DrawBox(ucg, xl, y, ww, (ucg_int_t)(r + 1));
+        ucg_DrawBox(ucg, xl, yl, ww, (ucg_int_t)(r + 1));
+    }
+    if (hh >= 0) {
+        ucg_DrawBox(ucg, x, yu, w, hh);
+    }
+}
+
+void
+ucg_DrawGradientBox(
+    ucg_t *ucg,
+    ucg_int_t x,
+    ucg_int_t y,
+    ucg_int_t w,
+    ucg_int_t h
+) {
+    ucg_ccs_t pLeft[3];
+    ucg_ccs_t pRight[3];
+    uint8_t i;
+
+    for (i = 0; i < 3; i++) {
+        ucg_ccs_init(&pLeft[i], ucg->arg.rgb[0].color[i], ucg->arg.rgb[2].color[i], h);
+        ucg_ccs_init(&pRight[i], ucg->arg.rgb[1].color[i], ucg->arg.rgb[3].color[i], h);
+    }
+
+    while (h > 0) {
+        for (i = 0; i < 3; i++) {
+            ucg->arg.rgb[0].color[i] = pLeft[i].current;
+            ucg->arg.rgb[1].color[i] = pRight[i].current;
+        }
+        ucg->arg.pixel.pos.x = x;
+        ucg->arg.pixel.pos.y = y;
+        ucg->arg.len = w;
+        ucg->arg.dir = 0;
+        ucg_DrawL90SEWithArg(ucg);
+        for (i = 0; i < 3; i++) {
+            ucg_ccs_step(&pLeft[i]);
+            ucg_ccs_step(&pRight[i]);
+        }
+        h--;
+        y++;
+    }
+}
+
+void
+ucg_DrawDisc(
+    ucg_t *ucg,
+    ucg_int_t x0,
+    ucg_int_t y0,
+    ucg_int_t rad,
+    uint8_t option
+) {
+    ucg_int_t f = (ucg_int_t)(1 - rad);
+    ucg_int_t ddF_x = 1;
+    ucg_int_t ddF_y = (ucg_int_t)(-2 * rad);
+    ucg_int_t x = 0;
+    ucg_int_t y = rad;
+
+    Host_UcgDiscSection(ucg, x, y, x0, y0, option);
+
+    while (x < y) {
+        if (f >= 0) {
+            y--;
+            ddF_y += 2;
+            f += ddF_y;
+        }
+        x++;
+        ddF_x += 2;
+        f += ddF_x;
+
+        Host_UcgDiscSection(ucg, x, y, x0, y0, option);
+    }
+}
+
+/* ucg_rotate.c --------------------------------------------------------------*/
+
+ucg_int_t
+ucg_dev_rotate90(
+    ucg_t *ucg,
+    ucg_int_t msg,
+    void *data
+) {
+    return Host_UcgRotate(ucg, 1, msg, data);
+}
+
+ucg_int_t
+ucg_dev_rotate180(
+    ucg_t *ucg,
+    ucg_int_t msg,
+    void *data
+) {
+    return Host_UcgRotate(ucg, 2, msg, data);
+}
+
+ucg_int_t
+ucg_dev_rotate270(
+    ucg_t *ucg,
+    ucg_int_t msg,
+    void *data
+) {
+    return Host_UcgRotate(ucg, 3, msg, data);
+}
+
+void
+ucg_UndoRotate(
+    ucg_t *ucg
+) {
+    if (ucg->rotate_chain_device_cb != NULL) {
+        ucg->device_cb = ucg->rotate_chain_device_cb;
+        ucg->rotate_chain_device_cb = NULL;
+    }
+    ucg_GetDimension(ucg);
+    ucg_SetMaxClipRange(ucg);
+}
+
+void
+ucg_SetRotate90(
+    ucg_t *ucg
+) {
+    ucg_UndoRotate(ucg);
+    ucg->rotate_chain_device_cb = ucg->device_cb;
+    ucg->device_cb = ucg_dev_rotate90;
+    ucg_GetDimension(ucg);
+    ucg_SetMaxClipRange(ucg);
+}
+
+void
+ucg_SetRotate180(
+    ucg_t *ucg
+) {
+    ucg_UndoRotate(ucg);
+    ucg->rotate_chain_device_cb = ucg->device_cb;
+    ucg->device_cb = ucg_dev_rotate180;
+    ucg_GetDimension(ucg);
+    ucg_SetMaxClipRange(ucg);
+}
+
+void
+ucg_SetRotate270(
+    ucg_t *ucg
+) {
+    ucg_UndoRotate(ucg);
+    ucg->rotate_chain_device_cb = ucg->device_cb;
+    ucg->device_cb = ucg_dev_rotate270;
+    ucg_GetDimension(ucg);
+    ucg_SetMaxClipRange(ucg);
+}
+
+/* ucg_font.c ----------------------------------------------------------------*/
+
+void
+ucg_SetFontPosBaseline(
+    ucg_t *ucg
+) {
+    ucg->font_calc_vref = Host_UcgCalcVrefFont;
+}
+
+void
+ucg_SetFontMode(
+    ucg_t *ucg,
+    uint8_t is_transparent
+) {
+    ucg->font_decode.is_transparent = is_transparent;
+}
+
+void
+ucg_SetFont(
+    ucg_t *ucg,
+    const ucg_fntpgm_uint8_t *font
+) {
+    ucg_font_info_t *pInfo = &ucg->font_info;
+
+    if (ucg->font == font) {
+        return;
+    }
+
+    ucg->font = font;
+    pInfo->glyph_cnt = font[0];
+    pInfo->bbx_mode = font[1];
+    pInfo->bits_per_0 = font[2];
+    pInfo->bits_per_1 = font[3];
+    pInfo->bits_per_char_width = font[4];
+    pInfo->bits_per_char_height = font[5];
+    pInfo->bits_per_char_x = font[6];
+    pInfo->bits_per_char_y = font[7];
+    pInfo->bits_per_delta_x = font[8];
+    pInfo->max_char_width = (int8_t)font[9];
+    pInfo->max_char_height = (int8_t)font[10];
+    pInfo->x_offset = (int8_t)font[11];
+    pInfo->y_offset = (int8_t)font[12];
+    pInfo->ascent_A = (int8_t)font[13];
+    pInfo->descent_g = (int8_t)font[14];
+    pInfo->ascent_para = (int8_t)font[15];
+    pInfo->descent_para = (int8_t)font[16];
+    pInfo->start_pos_upper_A = Host_UcgFontWord(font, 17);
+    pInfo->start_pos_lower_a = Host_UcgFontWord(font, 19);
+
+    /* Height mode text */
+    ucg->font_ref_ascent = pInfo->ascent_A;
+    ucg->font_ref_descent = pInfo->descent_g;
+
+    /* Queue of ucg_DrawString is emptied, the string being drawn is kept */
+    g_wTextHead = 0;
+    g_wTextCount = 0;
+}
+
+int8_t
+ucg_GetGlyphWidth(
+    ucg_t *ucg,
+    uint8_t requested_encoding
+) {
+    const uint8_t *pbyGlyph = Host_UcgGlyphData(ucg, requested_encoding);
+
+    if (pbyGlyph == NULL) {
+        return 0;
+    }
+
+    Host_UcgSetupDecode(ucg, pbyGlyph);
+    Host_UcgGetSignedBits(&ucg->font_decode, ucg->font_info.bits_per_char_x);
+    Host_UcgGetSignedBits(&ucg->font_decode, ucg->font_info.bits_per_char_y);
+
+    return Host_UcgGetSignedBits(&ucg->font_decode, ucg->font_info.bits_per_delta_x);
+}
+
+ucg_int_t
+ucg_GetStrWidth(
+    ucg_t *ucg,
+    const char *s
+) {
+    ucg_int_t w = 0;
+
+    while (*s != '\0') {
+        w = (ucg_int_t)(w + ucg_GetGlyphWidth(ucg, (uint8_t)*s));
+        s++;
+    }
+
+    return w;
+}
+
+ucg_int_t
+ucg_DrawGlyph(
+    ucg_t *ucg,
+    ucg_int_t x,
+    ucg_int_t y,
+    uint8_t dir,
+    uint8_t encoding
+) {
+    ucg_font_decode_t *pDecode = &ucg->font_decode;
+    const uint8_t *pbyGlyph;
+    int8_t byX, byY, byDelta, byHeight;
+    uint8_t a, b;
+
+    switch (dir) {
+    case 0:
+        y = (ucg_int_t)(y + ucg->font_calc_vref(ucg));
+        break;
+    case 1:
+        x = (ucg_int_t)(x - ucg->font_calc_vref(ucg));
+        break;
+    case 2:
+        y = (ucg_int_t)(y - ucg->font_calc_vref(ucg));
+        break;
+    default:
+        x = (ucg_int_t)(x + ucg->font_calc_vref(ucg));
+        break;
+    }
+
+    pDecode->target_x = x;
+    pDecode->target_y = y;
+    pDecode->dir = dir;
+
+    pbyGlyph = Host_UcgGlyphData(ucg, encoding);
+    if (pbyGlyph == NULL) {
+        return 0;
+    }
+
+    Host_UcgSetupDecode(ucg, pbyGlyph);
+    byHeight = pDecode->glyph_height;
+    byX = Host_UcgGetSignedBits(pDecode, ucg->font_info.bits_per_char_x);
+    byY = Host_UcgGetSignedBits(pDecode, ucg->font_info.bits_per_char_y);
+    byDelta = Host_UcgGetSignedBits(pDecode, ucg->font_info.bits_per_delta_x);
+
+    if (pDecode->glyph_width > 0) {
+        pDecode->target_x = Host_UcgAddVectorX(pDecode->target_x, byX, (int8_t)-(byHeight + byY), dir);
+        pDecode->target_y = Host_UcgAddVectorY(pDecode->target_y, byX, (int8_t)-(byHeight + byY), dir);
+        pDecode->x = 0;
+        pDecode->y = 0;
+
+        for (;;) {
+            a = Host_UcgGetUnsignedBits(pDecode, ucg->font_info.bits_per_0);
+            b = Host_UcgGetUnsignedBits(pDecode, ucg->font_info.bits_per_1);
+            do {
+                Host_UcgDecodeLen(ucg, a, 0);
+                Host_UcgDecodeLen(ucg, b, 1);
+            } while (Host_UcgGetUnsignedBits(pDecode, 1) != 0);
+
+            if (pDecode->y >= byHeight) {
+                break;
+            }
+        }
+    }
+
+    return byDelta;
+}
+
+ucg_int_t
+ucg_DrawString(
+    ucg_t *ucg,
+    ucg_int_t x,
+    ucg_int_t y,
+    uint8_t dir,
+    const char *str
+) {
+    host_ucg_text_p pText;
+
+    /* Full queue: string is dropped */
+    if (g_wTextCount < HOST_UCG_TEXT_QUEUE_SIZE) {
+        pText = &g_pText[(g_wTextHead + g_wTextCount) % HOST_UCG_TEXT_QUEUE_SIZE];
+        pText->x = x;
+        pText->y = y;
+        pText->dir = dir;
+        pText->str = str;
+        g_wTextCount++;
+    }
+
+    if (g_byTextTimer == NO_TIMER) {
+        g_byTextTimer = TimerStart("ucg_str", HOST_UCG_TEXT_TICK_MS, TIMER_REPEAT_FOREVER,
+                                   Host_UcgTextTask, ucg);
+    }
+
+    /* Width is not known yet */
+    return 0;
+}
+
+/**
+ * @func   Host_UcgTextPending
+ * @brief  Strings of ucg_DrawString not drawn yet
+ * @param  None
+ * @retval Queued strings and the one being drawn
+ */
+uint16_t
+Host_UcgTextPending(void)
+{
+    return (uint16_t)(g_wTextCount + (g_bTextDrawing ? 1u : 0u));
+}
+
+/**
+ * @func   Host_UcgRunText
+ * @brief  Let time pass tick by tick until the text task is idle
+ * @param  None
+ * @retval None
+ */
+void
+Host_UcgRunText(void)
+{
+    uint32_t dwTick;
+
+    for (dwTick = 0; (dwTick < HOST_UCG_TEXT_TICK_MAX) && (g_byTextTimer != NO_TIMER); dwTick++) {
+        Host_Advance(HOST_UCG_TEXT_TICK_MS * 1000u);
+        processTimerScheduler();
+    }
+}
+
+/* ucg_dev_ic_st7735.c, ucg_dev_tft_128x128_st7735.c -------------------------*/
+
+ucg_int_t
+ucg_dev_ic_st7735_18(
+    ucg_t *ucg,
+    ucg_int_t msg,
+    void *data
+) {
+    switch (msg) {
+    case UCG_MSG_DEV_POWER_UP:
+        ucg->display_offset.x = 2;
+        ucg->display_offset.y = 1;
+        return ucg_com_PowerUp(ucg, 100, 66);
+
+    case UCG_MSG_DEV_POWER_DOWN:
+        ucg_com_SendCmdSeq(ucg, g_pbySt7735PowerDownSeq);
+        return 1;
+
+    case UCG_MSG_GET_DIMENSION:
+        ((ucg_wh_t *)data)->w = 128;
+        ((ucg_wh_t *)data)->h = 128;
+        return 1;
+
+    case UCG_MSG_DRAW_PIXEL:
+        if (ucg_clip_is_pixel_visible(ucg)) {
+            Host_UcgSt7735SetPos(ucg);
+        }
+        return 1;
+
+    case UCG_MSG_DRAW_L90FX:
+        Host_UcgSt7735L90fx(ucg);
+        return 1;
+
+    default:
+        return ucg_dev_default_cb(ucg, msg, data);
+    }
+}
+
+ucg_int_t
+ucg_ext_st7735_18(
+    ucg_t *ucg,
+    ucg_int_t msg,
+    void *data
+) {
+    (void)data;
+
+    if (msg == UCG_MSG_DRAW_L90SE) {
+        return Host_UcgSt7735L90se(ucg);
+    }
+
+    return 1;
+}
+
+ucg_int_t
+ucg_dev_st7735_18x128x128(
+    ucg_t *ucg,
+    ucg_int_t msg,
+    void *data
+) {
+    if (msg == UCG_MSG_DEV_POWER_UP) {
+        if (ucg_dev_ic_st7735_18(ucg, msg, data) == 0) {
+            return 0;
+        }
+        ucg_com_SendCmdSeq(ucg, g_pbySt7735InitSeq);
+        return 1;
+    }
+
+    return ucg_dev_ic_st7735_18(ucg, msg, data);
+}
+
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+/**
+ * @func   Host_UcgTextTask
+ * @brief  Text task of ucg_font.o: takes a string from queue or draws one
+ *         glyph of it a tick, timer stopped when queue is empty
+ * @param  pData: ucg
+ * @retval None
+ */
+static void
+Host_UcgTextTask(
+    void *pData
+) {
+    ucg_t *ucg = (ucg_t *)pData;
+    ucg_int_t delta;
+
+    if (!g_bTextDrawing) {
+        if (g_wTextCount == 0) {
+            TimerStop(g_byTextTimer);
+            g_byTextTimer = NO_TIMER;
+            return;
+        }
+        g_text = g_pText[g_wTextHead];
+        g_wTextHead = (uint16_t)((g_wTextHead + 1u) % HOST_UCG_TEXT_QUEUE_SIZE);
+        g_wTextCount--;
+        g_bTextDrawing = 1;
+        return;
+    }
+
+    if (*g_text.str == '\0') {
+        g_bTextDrawing = 0;
+        return;
+    }
+
+    delta = ucg_DrawGlyph(ucg, g_text.x, g_text.y, g_text.dir, (uint8_t)*g_text.str);
+    switch (g_text.dir) {
+    case 0:
+        g_text.x = (ucg_int_t)(g_text.x + delta);
+        break;
+    case 1:
+        g_text.y = (ucg_int_t)(g_text.y + delta);
+        break;
+    case 2:
+        g_text.x = (ucg_int_t)(g_text.x - delta);
+        break;
+    default:
+        g_text.y = (ucg_int_t)(g_text.y - delta);
+        break;
+    }
+    g_text.str++;
+}
+
+/**
+ * @func   Host_UcgDiv
+ * @brief  Signed division of Cortex-M, no trap on zero
+ * @param  iNum: numerator
+ * @param  iDen: denominator
+ * @retval Quotient, 0 if iDen is 0
+ */
+static ucg_int_t
+Host_UcgDiv(
+    ucg_int_t iNum,
+    ucg_int_t iDen
+) {
+    return (iDen == 0) ? 0 : (ucg_int_t)(iNum / iDen);
+}
+
+/**
+ * @func   Host_UcgMod
+ * @brief  Remainder as SDIV + MLS of Cortex-M
+ * @param  iNum: numerator
+ * @param  iDen: denominator
+ * @retval Remainder, iNum if iDen is 0
+ */
+static ucg_int_t
+Host_UcgMod(
+    ucg_int_t iNum,
+    ucg_int_t iDen
+) {
+    return (iDen == 0) ? iNum : (ucg_int_t)(iNum % iDen);
+}
+
+/**
+ * @func   Host_UcgIsXVisible
+ * @brief  Column of arg in the clip box
+ * @param  ucg: ucg
+ * @retval 1 if visible
+ */
+static ucg_int_t
+Host_UcgIsXVisible(
+    ucg_t *ucg
+) {
+    ucg_int_t t = (ucg_int_t)(ucg->arg.pixel.pos.x - ucg->clip_box.ul.x);
+
+    return (t >= 0) && (t < ucg->clip_box.size.w);
+}
+
+/**
+ * @func   Host_UcgIsYVisible
+ * @brief  Row of arg in the clip box
+ * @param  ucg: ucg
+ * @retval 1 if visible
+ */
+static ucg_int_t
+Host_UcgIsYVisible(
+    ucg_t *ucg
+) {
+    ucg_int_t t = (ucg_int_t)(ucg->arg.pixel.pos.y - ucg->clip_box.ul.y);
+
+    return (t >= 0) && (t < ucg->clip_box.size.h);
+}
+
+/**
+ * @func   Host_UcgIntersection
+ * @brief  Clip [a, b) to [c, d)
+ * @param  piA, piB: range, clipped on return
+ * @param  c, d: clip range
+ * @retval 0 if nothing is left
+ */
+static ucg_int_t
+Host_UcgIntersection(
+    ucg_int_t *piA,
+    ucg_int_t *piB,
+    ucg_int_t c,
+    ucg_int_t d
+) {
+    if (*piA >= d) {
+        return 0;
+    }
+    if (*piB <= c) {
+        return 0;
+    }
+    if (*piA < c) {
+        *piA = c;
+    }
+    if (*piB > d) {
+        *piB = d;
+    }
+
+    return 1;
+}
+
+/**
+ * @func   Host_UcgSendStringP
+ * @brief  Bytes of a command sequence, one SEND_BYTE each
+ * @param  ucg: ucg
+ * @param  byCount: number of bytes
+ * @param  pbyData: bytes
+ * @retval None
+ */
+static void
+Host_UcgSendStringP(
+    ucg_t *ucg,
+    uint8_t byCount,
+    const ucg_pgm_uint8_t *pbyData
+) {
+    while (byCount-- != 0) {
+        ucg_com_SendByte(ucg, *pbyData++);
+    }
+}
+
+/**
+ * @func   Host_UcgSt7735SetPos
+ * @brief  Pixel of arg
+ * @param  ucg: ucg
+ * @retval None
+ */
+static void
+Host_UcgSt7735SetPos(
+    ucg_t *ucg
+) {
+    uint8_t pbyColor[3];
+
+    ucg_com_SendCmdSeq(ucg, g_pbySt7735SetPosSeq);
+    pbyColor[0] = ucg->arg.pixel.rgb.color[0];
+    pbyColor[1] = ucg->arg.pixel.rgb.color[1];
+    pbyColor[2] = ucg->arg.pixel.rgb.color[2];
+    ucg_com_SendRepeat3Bytes(ucg, 1, pbyColor);
+    ucg_com_SetCSLineStatus(ucg, 1);
+}
+
+/**
+ * @func   Host_UcgSt7735Window
+ * @brief  Address window of a clipped line of arg, mirrored by MADCTL for
+ *         dir 2 and 3
+ * @param  ucg: ucg
+ * @retval None
+ */
+static void
+Host_UcgSt7735Window(
+    ucg_t *ucg
+) {
+    ucg_int_t iSaved;
+
+    switch (ucg->arg.dir) {
+    case 0:
+        ucg_com_SendCmdSeq(ucg, g_pbySt7735SetPosDir0Seq);
+        break;
+
+    case 1:
+        ucg_com_SendCmdSeq(ucg, g_pbySt7735SetPosDir1Seq);
+        break;
+
+    case 2:
+        iSaved = ucg->arg.pixel.pos.x;
+        ucg->arg.pixel.pos.x = (ucg_int_t)(HOST_UCG_ST7735_MIRROR - iSaved);
+        ucg_com_SendCmdSeq(ucg, g_pbySt7735SetPosDir2Seq);
+        ucg->arg.pixel.pos.x = iSaved;
+        break;
+
+    default:
+        iSaved = ucg->arg.pixel.pos.y;
+        ucg->arg.pixel.pos.y = (ucg_int_t)(HOST_UCG_ST7735_MIRROR - iSaved);
+        ucg_com_SendCmdSeq(ucg, g_pbySt7735SetPosDir3Seq);
+        ucg->arg.pixel.pos.y = iSaved;
+        break;
+    }
+}
+
+/**
+ * @func   Host_UcgSt7735L90fx
+ * @brief  Line of one color
+ * @param  ucg: ucg
+ * @retval 1 if drawn
+ */
+static ucg_int_t
+Host_UcgSt7735L90fx(
+    ucg_t *ucg
+) {
+    uint8_t pbyColor[3];
+
+    if (!ucg_clip_l90fx(ucg)) {
+        return 0;
+    }
+
+    Host_UcgSt7735Window(ucg);
+    pbyColor[0] = ucg->arg.pixel.rgb.color[0];
+    pbyColor[1] = ucg->arg.pixel.rgb.color[1];
+    pbyColor[2] = ucg->arg.pixel.rgb.color[2];
+    ucg_com_SendRepeat3Bytes(ucg, ucg->arg.len, pbyColor);
+    ucg_com_SetCSLineStatus(ucg, 1);
+
+    return 1;
+}
+
+/**
+ * @func   Host_UcgSt7735L90se
+ * @brief  Line from rgb[0] to rgb[1], a pixel per message
+ * @param  ucg: ucg
+ * @retval 1 if drawn
+ */
+static ucg_int_t
+Host_UcgSt7735L90se(
+    ucg_t *ucg
+) {
+    uint8_t pbyColor[3];
+    ucg_int_t i;
+    uint8_t j;
+
+    for (j = 0; j < 3; j++) {
+        ucg_ccs_init(&ucg->arg.ccs_line[j], ucg->arg.rgb[0].color[j],
+                     ucg->arg.rgb[1].color[j], ucg->arg.len);
+    }
+
+    if (!ucg_clip_l90se(ucg)) {
+        return 0;
+    }
+
+    Host_UcgSt7735Window(ucg);
+    for (i = 0; i < ucg->arg.len; i++) {
+        for (j = 0; j < 3; j++) {
+            pbyColor[j] = ucg->arg.ccs_line[j].current;
+        }
+        ucg_com_SendRepeat3Bytes(ucg, 1, pbyColor);
+        for (j = 0; j < 3; j++) {
+            ucg_ccs_step(&ucg->arg.ccs_line[j]);
+        }
+    }
+    ucg_com_SetCSLineStatus(ucg, 1);
+
+    return 1;
+}
+
+/**
+ * @func   Host_UcgRotateBox
+ * @brief  Clip box to device coordinates
+ * @param  ucg: ucg, rotate_dimension is the device size
+ * @param  byTurns: quarter turns clockwise
+ * @param  pBox: box, rotated on return
+ * @retval None
+ */
+static void
+Host_UcgRotateBox(
+    ucg_t *ucg,
+    uint8_t byTurns,
+    ucg_box_t *pBox
+) {
+    ucg_box_t box = *pBox;
+
+    switch (byTurns) {
+    case 1:
+        pBox->ul.x = (ucg_int_t)(ucg->rotate_dimension.w - box.ul.y - box.size.h);
+        pBox->ul.y = box.ul.x;
+        pBox->size.w = box.size.h;
+        pBox->size.h = box.size.w;
+        break;
+
+    case 2:
+        pBox->ul.x = (ucg_int_t)(ucg->rotate_dimension.w - box.ul.x - box.size.w);
+        pBox->ul.y = (ucg_int_t)(ucg->rotate_dimension.h - box.ul.y - box.size.h);
+        break;
+
+    default:
+        pBox->ul.x = box.ul.y;
+        pBox->ul.y = (ucg_int_t)(ucg->rotate_dimension.h - box.ul.x - box.size.w);
+        pBox->size.w = box.size.h;
+        pBox->size.h = box.size.w;
+        break;
+    }
+}
+
+/**
+ * @func   Host_UcgRotatePos
+ * @brief  Position and direction of arg to device coordinates
+ * @param  ucg: ucg
+ * @param  byTurns: quarter turns clockwise
+ * @retval None
+ */
+static void
+Host_UcgRotatePos(
+    ucg_t *ucg,
+    uint8_t byTurns
+) {
+    ucg_xy_t pos = ucg->arg.pixel.pos;
+
+    switch (byTurns) {
+    case 1:
+        ucg->arg.pixel.pos.x = (ucg_int_t)(ucg->rotate_dimension.w - 1 - pos.y);
+        ucg->arg.pixel.pos.y = pos.x;
+        break;
+
+    case 2:
+        ucg->arg.pixel.pos.x = (ucg_int_t)(ucg->rotate_dimension.w - 1 - pos.x);
+        ucg->arg.pixel.pos.y = (ucg_int_t)(ucg->rotate_dimension.h - 1 - pos.y);
+        break;
+
+    default:
+        ucg->arg.pixel.pos.x = pos.y;
+        ucg->arg.pixel.pos.y = (ucg_int_t)(ucg->rotate_dimension.h - 1 - pos.x);
+        break;
+    }
+
+    ucg->arg.dir = (ucg_int_t)((ucg->arg.dir + byTurns) & 3);
+}
+
+/**
+ * @func   Host_UcgRotate
+ * @brief  Device of ucg_SetRotate90/180/270, chained to the device
+ * @param  ucg: ucg
+ * @param  byTurns: quarter turns clockwise
+ * @param  msg: UCG_MSG_xxx
+ * @param  data: data of message
+ * @retval Result of device
+ */
+static ucg_int_t
+Host_UcgRotate(
+    ucg_t *ucg,
+    uint8_t byTurns,
+    ucg_int_t msg,
+    void *data
+) {
+    ucg_box_t box;
+
+    switch (msg) {
+    case UCG_MSG_GET_DIMENSION:
+        ucg->rotate_chain_device_cb(ucg, msg, &ucg->rotate_dimension);
+        if (byTurns & 1) {
+            ((ucg_wh_t *)data)->w = ucg->rotate_dimension.h;
+            ((ucg_wh_t *)data)->h = ucg->rotate_dimension.w;
+        } else {
+            *(ucg_wh_t *)data = ucg->rotate_dimension;
+        }
+        return 1;
+
+    case UCG_MSG_SET_CLIP_BOX:
+        box = *(ucg_box_t *)data;
+        Host_UcgRotateBox(ucg, byTurns, &box);
+        return ucg->rotate_chain_device_cb(ucg, msg, &box);
+
+    case UCG_MSG_DRAW_PIXEL:
+    case UCG_MSG_DRAW_L90FX:
+    case UCG_MSG_DRAW_L90SE:
+        Host_UcgRotatePos(ucg, byTurns);
+        break;
+
+    default:
+        break;
+    }
+
+    return ucg->rotate_chain_device_cb(ucg, msg, data);
+}
+
+/**
+ * @func   Host_UcgDiscSection
+ * @brief  Vertical lines of the quadrants of a disc for a midpoint step
+ * @param  ucg: ucg
+ * @param  x, y: midpoint step
+ * @param  x0, y0: center
+ * @param  option: UCG_DRAW_xxx
+ * @retval None
+ */
+static void
+Host_UcgDiscSection(
+    ucg_t *ucg,
+    ucg_int_t x,
+    ucg_int_t y,
+    ucg_int_t x0,
+    ucg_int_t y0,
+    uint8_t option
+) {
+    if (option & UCG_DRAW_UPPER_RIGHT) {
+        ucg_DrawVLine(ucg, (ucg_int_t)(x0 + x), (ucg_int_t)(y0 - y), (ucg_int_t)(y + 1));
+        ucg_DrawVLine(ucg, (ucg_int_t)(x0 + y), (ucg_int_t)(y0 - x), (ucg_int_t)(x + 1));
+    }
+    if (option & UCG_DRAW_UPPER_LEFT) {
+        ucg_DrawVLine(ucg, (ucg_int_t)(x0 - x), (ucg_int_t)(y0 - y), (ucg_int_t)(y + 1));
+        ucg_DrawVLine(ucg, (ucg_int_t)(x0 - y), (ucg_int_t)(y0 - x), (ucg_int_t)(x + 1));
+    }
+    if (option & UCG_DRAW_LOWER_RIGHT) {
+        ucg_DrawVLine(ucg, (ucg_int_t)(x0 + x), y0, (ucg_int_t)(y + 1));
+        ucg_DrawVLine(ucg, (ucg_int_t)(x0 + y), y0, (ucg_int_t)(x + 1));
+    }
+    if (option & UCG_DRAW_LOWER_LEFT) {
+        ucg_DrawVLine(ucg, (ucg_int_t)(x0 - x), y0, (ucg_int_t)(y + 1));
+        ucg_DrawVLine(ucg, (ucg_int_t)(x0 - y), y0, (ucg_int_t)(x + 1));
+    }
+}
+
+/**
+ * @func   Host_UcgFontWord
+ * @brief  Big endian word of font header
+ * @param  pbyFont: font
+ * @param  byOffset: offset in header
+ * @retval Word
+ */
+static uint16_t
+Host_UcgFontWord(
+    const uint8_t *pbyFont,
+    uint8_t byOffset
+) {
+    return (uint16_t)((pbyFont[byOffset] << 8) | pbyFont[byOffset + 1]);
+}
+
+/**
+ * @func   Host_UcgGetUnsignedBits
+ * @brief  Next bits of glyph data, LSB first
+ * @param  pDecode: decoder
+ * @param  byCount: number of bits, 1 - 8
+ * @retval Bits
+ */
+static uint8_t
+Host_UcgGetUnsignedBits(
+    ucg_font_decode_t *pDecode,
+    uint8_t byCount
+) {
+    uint8_t byBitPos = pDecode->decode_bit_pos;
+    uint8_t byEnd = (uint8_t)(byBitPos + byCount);
+    uint16_t wValue = (uint16_t)(*pDecode->decode_ptr >> byBitPos);
+
+    if (byEnd >= 8) {
+        pDecode->decode_ptr++;
+        wValue |= (uint16_t)(*pDecode->decode_ptr << (8 - byBitPos));
+        byEnd -= 8;
+    }
+    pDecode->decode_bit_pos = byEnd;
+
+    return (uint8_t)(wValue & ((1u << byCount) - 1u));
+}
+
+/**
+ * @func   Host_UcgGetSignedBits
+ * @brief  Next bits of glyph data, offset by half of their range
+ * @param  pDecode: decoder
+ * @param  byCount: number of bits, 1 - 8
+ * @retval Value
+ */
+static int8_t
+Host_UcgGetSignedBits(
+    ucg_font_decode_t *pDecode,
+    uint8_t byCount
+) {
+    int8_t iValue = (int8_t)Host_UcgGetUnsignedBits(pDecode, byCount);
+
+    return (int8_t)(iValue - (1 << (byCount - 1)));
+}
+
+/**
+ * @func   Host_UcgAddVectorX
+ * @brief  Column of a glyph point in direction of text
+ * @param  dx: origin
+ * @param  x, y: point in glyph
+ * @param  dir: direction of text
+ * @retval Column
+ */
+static ucg_int_t
+Host_UcgAddVectorX(
+    ucg_int_t dx,
+    int8_t x,
+    int8_t y,
+    uint8_t dir
+) {
+    switch (dir) {
+    case 0:
+        return (ucg_int_t)(dx + x);
+    case 1:
+        return (ucg_int_t)(dx - y);
+    case 2:
+        return (ucg_int_t)(dx - x);
+    default:
+        return (ucg_int_t)(dx + y);
+    }
+}
+
+/**
+ * @func   Host_UcgAddVectorY
+ * @brief  Row of a glyph point in direction of text
+ * @param  dy: origin
+ * @param  x, y: point in glyph
+ * @param  dir: direction of text
+ * @retval Row
+ */
+static ucg_int_t
+Host_UcgAddVectorY(
+    ucg_int_t dy,
+    int8_t x,
+    int8_t y,
+    uint8_t dir
+) {
+    switch (dir) {
+    case 0:
+        return (ucg_int_t)(dy + y);
+    case 1:
+        return (ucg_int_t)(dy + x);
+    case 2:
+        return (ucg_int_t)(dy - y);
+    default:
+        return (ucg_int_t)(dy - x);
+    }
+}
+
+/**
+ * @func   Host_UcgDecodeLen
+ * @brief  Run of pixels of a glyph, wrapped at glyph width
+ * @param  ucg: ucg
+ * @param  byLength: pixels of the run
+ * @param  bForeground: 1 for color 0; 0 for background color 1
+ * @retval None
+ */
+static void
+Host_UcgDecodeLen(
+    ucg_t *ucg,
+    uint8_t byLength,
+    uint8_t bForeground
+) {
+    ucg_font_decode_t *pDecode = &ucg->font_decode;
+    uint8_t byCount = byLength;
+    uint8_t lx = (uint8_t)pDecode->x;
+    uint8_t ly = (uint8_t)pDecode->y;
+    uint8_t byRemain, byCurrent;
+    ucg_int_t x, y;
+
+    for (;;) {
+        byRemain = (uint8_t)(pDecode->glyph_width - lx);
+        byCurrent = (byCount < byRemain) ? byCount : byRemain;
+
+        x = Host_UcgAddVectorX(pDecode->target_x, (int8_t)lx, (int8_t)ly, pDecode->dir);
+        y = Host_UcgAddVectorY(pDecode->target_y, (int8_t)lx, (int8_t)ly, pDecode->dir);
+
+        if (bForeground) {
+            ucg_Draw90Line(ucg, x, y, byCurrent, pDecode->dir, 0);
+        } else if (pDecode->is_transparent == 0) {
+            ucg_Draw90Line(ucg, x, y, byCurrent, pDecode->dir, 1);
+        }
+
+        if (byCount < byRemain) {
+            break;
+        }
+        byCount = (uint8_t)(byCount - byRemain);
+        lx = 0;
+        ly++;
+    }
+    lx = (uint8_t)(lx + byCount);
+
+    pDecode->x = (int8_t)lx;
+    pDecode->y = (int8_t)ly;
+}
+
+/**
+ * @func   Host_UcgSetupDecode
+ * @brief  Start decoding a glyph, width and height are read
+ * @param  ucg: ucg
+ * @param  pbyGlyph: glyph data after encoding and size
+ * @retval None
+ */
+static void
+Host_UcgSetupDecode(
+    ucg_t *ucg,
+    const uint8_t *pbyGlyph
+) {
+    ucg_font_decode_t *pDecode = &ucg->font_decode;
+
+    pDecode->decode_ptr = pbyGlyph;
+    pDecode->decode_bit_pos = 0;
+    pDecode->glyph_width = (int8_t)Host_UcgGetUnsignedBits(pDecode, ucg->font_info.bits_per_char_width);
+    pDecode->glyph_height = (int8_t)Host_UcgGetUnsignedBits(pDecode, ucg->font_info.bits_per_char_height);
+}
+
+/**
+ * @func   Host_UcgGlyphData
+ * @brief  Find a glyph of the current font
+ * @param  ucg: ucg
+ * @param  encoding: character
+ * @retval Glyph data after encoding and size; NULL if not in font
+ */
+static const uint8_t *
+Host_UcgGlyphData(
+    ucg_t *ucg,
+    uint8_t encoding
+) {
+    const uint8_t *pbyFont = ucg->font + HOST_UCG_FONT_HEADER_SIZE;
+
+    if (encoding >= 'a') {
+        pbyFont += ucg->font_info.start_pos_lower_a;
+    } else if (encoding >= 'A') {
+        pbyFont += ucg->font_info.start_pos_upper_A;
+    }
+
+    while (pbyFont[1] != 0) {
+        if (pbyFont[0] == encoding) {
+            return pbyFont + 2;
+        }
+        pbyFont += pbyFont[1];
+    }
+
+    return NULL;
+}
+
+/**
+ * @func   Host_UcgCalcVrefFont
+ * @brief  Reference of ucg_SetFontPosBaseline
+ * @param  ucg: ucg
+ * @retval 0
+ */
+static ucg_int_t
+Host_UcgCalcVrefFont(
+    ucg_t *ucg
+) {
+    (void)ucg;
+
+    return 0;
+}
+
+/* END FILE */
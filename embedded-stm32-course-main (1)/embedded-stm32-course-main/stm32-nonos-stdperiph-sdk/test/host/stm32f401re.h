@@ -0,0 +1,113 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Host build, device header of CMSIS with the peripherals
+ *              used by Middle modules moved to RAM (host_periph.c), so the
+ *              modules build unchanged and models can drive the registers
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+#ifndef _HOST_STM32F401RE_H_
+#define _HOST_STM32F401RE_H_
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include "../../shared/Drivers/CMSIS/Include/stm32f401re.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define HOST_GPIO_PORTS                     3u      /* GPIOA - GPIOC */
+#define HOST_TIMERS                         5u      /* TIM1 - TIM5 */
+#define HOST_DMA_STREAMS                    8u
+
+#undef GPIOA
+#undef GPIOB
+#undef GPIOC
+#define GPIOA                               (&g_pHostGpio[0])
+#define GPIOB                               (&g_pHostGpio[1])
+#define GPIOC                               (&g_pHostGpio[2])
+
+#undef TIM1
+#undef TIM2
+#undef TIM3
+#undef TIM4
+#undef TIM5
+#define TIM1                                (&g_pHostTim[0])
+#define TIM2                                (&g_pHostTim[1])
+#define TIM3                                (&g_pHostTim[2])
+#define TIM4                                (&g_pHostTim[3])
+#define TIM5                                (&g_pHostTim[4])
+
+#undef I2C1
+#undef SPI1
+#undef EXTI
+#undef SYSCFG
+#undef ADC1
+#define I2C1                                (&g_hostI2C1)
+#define SPI1                                (&g_hostSpi1)
+#define EXTI                                (&g_hostExti)
+#define SYSCFG                              (&g_hostSyscfg)
+#define ADC1                                (&g_hostAdc1)
+
+#undef DMA1
+#undef DMA2
+#define DMA1                                (&g_pHostDma[0])
+#define DMA2                                (&g_pHostDma[1])
+#undef DMA1_Stream0
+#undef DMA1_Stream1
+#undef DMA1_Stream2
+#undef DMA1_Stream3
+#undef DMA1_Stream4
+#undef DMA1_Stream5
+#undef DMA1_Stream6
+#undef DMA1_Stream7
+#undef DMA2_Stream0
+#undef DMA2_Stream1
+#undef DMA2_Stream2
+#undef DMA2_Stream3
+#undef DMA2_Stream4
+#undef DMA2_Stream5
+#undef DMA2_Stream6
+#undef DMA2_Stream7
+#define DMA1_Stream0                        (&g_pHostDma1Stream[0])
+#define DMA1_Stream1                        (&g_pHostDma1Stream[1])
+#define DMA1_Stream2                        (&g_pHostDma1Stream[2])
+#define DMA1_Stream3                        (&g_pHostDma1Stream[3])
+#define DMA1_Stream4                        (&g_pHostDma1Stream[4])
+#define DMA1_Stream5                        (&g_pHostDma1Stream[5])
+#define DMA1_Stream6                        (&g_pHostDma1Stream[6])
+#define DMA1_Stream7                        (&g_pHostDma1Stream[7])
+#define DMA2_Stream0                        (&g_pHostDma2Stream[0])
+#define DMA2_Stream1                        (&g_pHostDma2Stream[1])
+#define DMA2_Stream2                        (&g_pHostDma2Stream[2])
+#define DMA2_Stream3                        (&g_pHostDma2Stream[3])
+#define DMA2_Stream4                        (&g_pHostDma2Stream[4])
+#define DMA2_Stream5                        (&g_pHostDma2Stream[5])
+#define DMA2_Stream6                        (&g_pHostDma2Stream[6])
+#define DMA2_Stream7                        (&g_pHostDma2Stream[7])
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+extern GPIO_TypeDef g_pHostGpio[HOST_GPIO_PORTS];
+extern TIM_TypeDef g_pHostTim[HOST_TIMERS];
+extern I2C_TypeDef g_hostI2C1;
+extern SPI_TypeDef g_hostSpi1;
+extern EXTI_TypeDef g_hostExti;
+extern SYSCFG_TypeDef g_hostSyscfg;
+extern ADC_TypeDef g_hostAdc1;
+extern DMA_TypeDef g_pHostDma[2];
+extern DMA_Stream_TypeDef g_pHostDma1Stream[HOST_DMA_STREAMS];
+extern DMA_Stream_TypeDef g_pHostDma2Stream[HOST_DMA_STREAMS];
+
+#endif
+
+/* END FILE */
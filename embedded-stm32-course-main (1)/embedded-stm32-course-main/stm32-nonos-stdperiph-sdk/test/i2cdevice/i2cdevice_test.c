@@ -0,0 +1,296 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Host test of I2C device helpers (Middle/i2c/i2cdevice.c) on
+ *              the I2C engine: register maps of 8 and 16-bit address,
+ *              blocking helpers used outside the main loop, batches of
+ *              interleaved devices and the bus utilisation they reach.
+ *              Built and run by ../run_host_tests.sh
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <string.h>
+#include "host.h"
+#include "host_i2c.h"
+#include "timer.h"
+#include "i2cengine.h"
+#include "i2cdevice.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define TEST_LOOP_US                        100u    /* Idle time of one main loop */
+#define TEST_WAIT_MAX_US                    200000u
+#define TEST_DEVICE_COUNT                   3u
+#define TEST_REG_SIZE                       64u
+#define TEST_BLOCKING_COUNT                 (3u * I2C_ENGINE_QUEUE_SIZE)
+#define TEST_READ_LENGTH                    6u      /* As an IMU sample */
+#define TEST_ROUNDS                         20u
+
+/*! @brief Register file slave, register address of byRegSize bytes */
+typedef struct {
+    uint8_t byRegSize;
+    uint8_t byAddressed;            /* Bytes of register address received */
+    uint16_t wPointer;
+    uint8_t pbyReg[TEST_REG_SIZE];
+} test_slave_t, *test_slave_p;
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+static test_slave_t g_pSlave[TEST_DEVICE_COUNT];
+static host_i2c_slave_t g_pBus[TEST_DEVICE_COUNT];
+static i2c_device_t g_pDevice[TEST_DEVICE_COUNT];
+
+static i2c_device_req_t g_pReq[2 * TEST_DEVICE_COUNT];
+static uint8_t g_ppbyRx[2 * TEST_DEVICE_COUNT][TEST_READ_LENGTH];
+static uint8_t g_byCallback;
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+static uint8_t
+Test_SlaveStart(
+    void *pData,
+    uint8_t bRead
+) {
+    test_slave_p pSlave = (test_slave_p)pData;
+
+    if (!bRead) {
+        pSlave->byAddressed = 0;
+        pSlave->wPointer = 0;
+    }
+
+    return 1;
+}
+
+static uint8_t
+Test_SlaveWrite(
+    void *pData,
+    uint8_t byData
+) {
+    test_slave_p pSlave = (test_slave_p)pData;
+
+    if (pSlave->byAddressed < pSlave->byRegSize) {
+        pSlave->wPointer = (uint16_t)((pSlave->wPointer << 8) | byData);
+        pSlave->byAddressed++;
+    } else {
+        pSlave->pbyReg[pSlave->wPointer++ % TEST_REG_SIZE] = byData;
+    }
+
+    return 1;
+}
+
+static uint8_t
+Test_SlaveRead(
+    void *pData,
+    uint32_t *pdwStretchUs
+) {
+    test_slave_p pSlave = (test_slave_p)pData;
+
+    *pdwStretchUs = 0;
+
+    return pSlave->pbyReg[pSlave->wPointer++ % TEST_REG_SIZE];
+}
+
+/* Device 0 and 1: 8-bit register address, device 2: 16-bit */
+static void
+Test_Setup(void)
+{
+    uint8_t i, j;
+
+    Host_Reset();
+    Host_PeriphReset();
+    Host_TimerReset();
+    Host_I2cReset();
+
+    memset(g_pSlave, 0, sizeof(g_pSlave));
+    memset(g_pBus, 0, sizeof(g_pBus));
+    for (i = 0; i < TEST_DEVICE_COUNT; i++) {
+        g_pSlave[i].byRegSize = (i == 2) ? I2C_DEVICE_REG_16BIT : I2C_DEVICE_REG_8BIT;
+        for (j = 0; j < TEST_REG_SIZE; j++) {
+            g_pSlave[i].pbyReg[j] = (uint8_t)(0x10 * i + j);
+        }
+        g_pBus[i].byAddress = (uint8_t)(0x50 + i);
+        g_pBus[i].start = Test_SlaveStart;
+        g_pBus[i].write = Test_SlaveWrite;
+        g_pBus[i].read = Test_SlaveRead;
+        g_pBus[i].pSlave = &g_pSlave[i];
+        Host_I2cAttach(&g_pBus[i]);
+
+        I2CDevice_Init(&g_pDevice[i], g_pBus[i].byAddress, g_pSlave[i].byRegSize);
+    }
+
+    I2CEngine_Init();
+    g_byCallback = 0;
+}
+
+static void
+Test_Callback(
+    void *pData,
+    uint8_t byStatus
+) {
+    (void)pData;
+
+    if (byStatus == I2C_XFER_DONE) {
+        g_byCallback++;
+    }
+}
+
+/* Main loop until byCount callbacks, returns time taken (us) */
+static uint32_t
+Test_RunUntil(
+    uint8_t byCount
+) {
+    uint64_t qwStart = Host_GetUs();
+
+    while ((g_byCallback < byCount) && ((Host_GetUs() - qwStart) < TEST_WAIT_MAX_US)) {
+        processI2CEngine();
+        Host_Advance(TEST_LOOP_US);
+    }
+
+    return (uint32_t)(Host_GetUs() - qwStart);
+}
+
+static void
+Test_RegisterMap(void)
+{
+    static uint8_t pbyData[4];      /* DMA buffer: static address */
+    uint8_t pbyWrite[3] = { 0xA1, 0xB2, 0xC3 };
+
+    Test_Setup();
+
+    HOST_CHECK(I2CDevice_ReadReg(&g_pDevice[0], 0x04, pbyData, 2) == I2C_DEVICE_OK);
+    HOST_CHECK((pbyData[0] == 0x04) && (pbyData[1] == 0x05));
+
+    HOST_CHECK(I2CDevice_WriteReg(&g_pDevice[2], 0x0120, pbyWrite, 3) == I2C_DEVICE_OK);
+    HOST_CHECK(g_pSlave[2].pbyReg[0x20] == 0xA1);
+    HOST_CHECK(g_pSlave[2].pbyReg[0x22] == 0xC3);
+    HOST_CHECK(I2CDevice_ReadReg(&g_pDevice[2], 0x0121, pbyData, 1) == I2C_DEVICE_OK);
+    HOST_CHECK(pbyData[0] == 0xB2);
+
+    HOST_CHECK(I2CDevice_UpdateReg(&g_pDevice[1], 0x03, 0xF0, 0x50) == I2C_DEVICE_OK);
+    HOST_CHECK(g_pSlave[1].pbyReg[3] == 0x53);
+
+    HOST_CHECK(I2CDevice_Probe(&g_pDevice[1]) == I2C_DEVICE_OK);
+    g_pDevice[1].byAddress = 0x60;
+    HOST_CHECK(I2CDevice_Probe(&g_pDevice[1]) == I2C_DEVICE_ERR_NACK);
+}
+
+static void
+Test_BlockingOutsideMainLoop(void)
+{
+    static uint8_t byData;
+    uint8_t byOk = 0;
+    uint8_t i;
+
+    /* processI2CEngine never runs: slots are freed by the engine */
+    Test_Setup();
+    for (i = 0; i < TEST_BLOCKING_COUNT; i++) {
+        byData = 0;
+        if ((I2CDevice_ReadReg(&g_pDevice[i % TEST_DEVICE_COUNT], i % 8u, &byData, 1) == I2C_DEVICE_OK) &&
+            (byData == (uint8_t)(0x10 * (i % TEST_DEVICE_COUNT) + i % 8u))) {
+            byOk++;
+        }
+    }
+    HOST_CHECK(byOk == TEST_BLOCKING_COUNT);
+
+    /* A callback still due keeps its slot and the ones after it */
+    HOST_CHECK(I2CDevice_ReadRegAsync(&g_pDevice[0], &g_pReq[0], 0, g_ppbyRx[0], 2,
+                                      Test_Callback, NULL) == I2C_DEVICE_OK);
+    byOk = 0;
+    for (i = 0; i < I2C_ENGINE_QUEUE_SIZE; i++) {
+        if (I2CDevice_ReadReg(&g_pDevice[1], 0, &byData, 1) == I2C_DEVICE_OK) {
+            byOk++;
+        }
+    }
+    HOST_CHECK(byOk == I2C_ENGINE_QUEUE_SIZE - 1);
+    HOST_CHECK(g_byCallback == 0);
+
+    processI2CEngine();
+    HOST_CHECK(g_byCallback == 1);
+    HOST_CHECK(I2CDevice_ReadReg(&g_pDevice[1], 0, &byData, 1) == I2C_DEVICE_OK);
+}
+
+/* One burst read per device per main loop pass, or all of them in a batch */
+static uint32_t
+Test_Workload(
+    uint8_t bBatch,
+    uint64_t *pqwBusyUs
+) {
+    i2c_device_req_p ppReq[2 * TEST_DEVICE_COUNT];
+    host_i2c_stat_t bus;
+    uint64_t qwStart = Host_GetUs();
+    uint8_t byRound, i;
+
+    for (byRound = 0; byRound < TEST_ROUNDS; byRound++) {
+        g_byCallback = 0;
+        for (i = 0; i < 2 * TEST_DEVICE_COUNT; i++) {
+            ppReq[i] = &g_pReq[i];
+            I2CDevice_PrepareRead(&g_pDevice[i % TEST_DEVICE_COUNT], ppReq[i], 0x08,
+                                  g_ppbyRx[i], TEST_READ_LENGTH);
+            ppReq[i]->xfer.callback = Test_Callback;
+
+            if (!bBatch) {
+                HOST_CHECK(I2CDevice_SubmitBatch(&ppReq[i], 1) == I2C_DEVICE_OK);
+                Test_RunUntil(i + 1);
+            }
+        }
+        if (bBatch) {
+            HOST_CHECK(I2CDevice_SubmitBatch(ppReq, 2 * TEST_DEVICE_COUNT) == I2C_DEVICE_OK);
+            Test_RunUntil(2 * TEST_DEVICE_COUNT);
+        }
+        HOST_CHECK(g_byCallback == 2 * TEST_DEVICE_COUNT);
+        HOST_CHECK((g_ppbyRx[5][0] == 0x28) && (g_ppbyRx[5][5] == 0x2D));
+    }
+
+    Host_I2cGetStat(&bus);
+    *pqwBusyUs = bus.qwBusyUs;
+
+    return (uint32_t)(Host_GetUs() - qwStart);
+}
+
+static void
+Test_Utilisation(void)
+{
+    uint64_t qwBusySingle, qwBusyBatch;
+    uint32_t dwSingle, dwBatch;
+
+    Test_Setup();
+    dwSingle = Test_Workload(0, &qwBusySingle);
+    Test_Setup();
+    dwBatch = Test_Workload(1, &qwBusyBatch);
+
+    /* Same bytes on the wire, batch has no main loop gap between transfers */
+    HOST_CHECK(qwBusySingle == qwBusyBatch);
+    HOST_CHECK(dwBatch < dwSingle);
+    HOST_CHECK(qwBusyBatch * 100u >= (uint64_t)dwBatch * 90u);
+    printf("  utilisation: one by one %u%% (%u us), batch %u%% (%u us)\n",
+           (uint32_t)(qwBusySingle * 100u / dwSingle), dwSingle,
+           (uint32_t)(qwBusyBatch * 100u / dwBatch), dwBatch);
+}
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+int
+main(void)
+{
+    Test_RegisterMap();
+    Test_BlockingOutsideMainLoop();
+    Test_Utilisation();
+
+    return Host_Result("i2cdevice");
+}
+
+/* END FILE */
@@ -0,0 +1,422 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Host test of I2C engine (Middle/i2c/i2cengine.c) under
+ *              injected faults: NACK, arbitration lost, bus error, SDA held
+ *              low and SCL stretched. Checks retries, counters, bounded
+ *              latency, bus recovery done from the main loop only and the
+ *              CMD_ID_I2C_DIAG frames. Built and run by ../run_host_tests.sh
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <string.h>
+#include "host.h"
+#include "host_i2c.h"
+#include "timer.h"
+#include "serial.h"
+#include "i2cengine.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define TEST_LOOP_US                        100u    /* Idle time of one main loop */
+#define TEST_WAIT_MAX_US                    200000u
+#define TEST_ADDRESS                        0x50u
+#define TEST_REG_SIZE                       16u
+#define TEST_TIMEOUT_MS                     2u
+
+/*! @brief Register file slave: first byte written is the register pointer */
+typedef struct {
+    uint8_t byPointer;
+    uint8_t bFirst;
+    uint8_t pbyReg[TEST_REG_SIZE];
+} test_slave_t, *test_slave_p;
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+static test_slave_t g_slave;
+static host_i2c_slave_t g_bus;
+
+static uint8_t g_pbyTx[3];
+static uint8_t g_pbyRx[4];
+static i2c_xfer_t g_xfer;
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+static uint8_t
+Test_SlaveStart(
+    void *pData,
+    uint8_t bRead
+) {
+    test_slave_p pSlave = (test_slave_p)pData;
+
+    pSlave->bFirst = !bRead;
+
+    return 1;
+}
+
+static uint8_t
+Test_SlaveWrite(
+    void *pData,
+    uint8_t byData
+) {
+    test_slave_p pSlave = (test_slave_p)pData;
+
+    if (pSlave->bFirst) {
+        pSlave->bFirst = 0;
+        pSlave->byPointer = byData;
+    } else {
+        pSlave->pbyReg[pSlave->byPointer++ % TEST_REG_SIZE] = byData;
+    }
+
+    return 1;
+}
+
+static uint8_t
+Test_SlaveRead(
+    void *pData,
+    uint32_t *pdwStretchUs
+) {
+    test_slave_p pSlave = (test_slave_p)pData;
+
+    *pdwStretchUs = 0;
+
+    return pSlave->pbyReg[pSlave->byPointer++ % TEST_REG_SIZE];
+}
+
+static void
+Test_Setup(void)
+{
+    Host_Reset();
+    Host_PeriphReset();
+    Host_TimerReset();
+    Host_SerialReset();
+    Host_I2cReset();
+
+    memset(&g_slave, 0, sizeof(g_slave));
+    memset(&g_bus, 0, sizeof(g_bus));
+    g_bus.byAddress = TEST_ADDRESS;
+    g_bus.start = Test_SlaveStart;
+    g_bus.write = Test_SlaveWrite;
+    g_bus.read = Test_SlaveRead;
+    g_bus.pSlave = &g_slave;
+    Host_I2cAttach(&g_bus);
+
+    I2CEngine_Init();
+    I2CEngine_ResetStatistic();
+}
+
+/* Transfer: write byTx bytes from g_pbyTx then read byRx into g_pbyRx */
+static i2c_xfer_p
+Test_Xfer(
+    uint8_t byTx,
+    uint8_t byRx,
+    uint8_t byRetry
+) {
+    memset(&g_xfer, 0, sizeof(g_xfer));
+    g_xfer.byAddress = TEST_ADDRESS;
+    g_xfer.pTxData = g_pbyTx;
+    g_xfer.byTxLength = byTx;
+    g_xfer.pRxData = g_pbyRx;
+    g_xfer.byRxLength = byRx;
+    g_xfer.byTimeout = TEST_TIMEOUT_MS;
+    g_xfer.byRetry = byRetry;
+
+    return &g_xfer;
+}
+
+static uint8_t
+Test_IsFinished(
+    i2c_xfer_p pXfer
+) {
+    return (pXfer->byStatus != I2C_XFER_PENDING) && (pXfer->byStatus != I2C_XFER_ACTIVE);
+}
+
+/* Submit then run main loop until finished, returns time taken (us) */
+static uint32_t
+Test_Run(
+    i2c_xfer_p pXfer
+) {
+    uint64_t qwStart = Host_GetUs();
+
+    HOST_CHECK(I2CEngine_Submit(pXfer) == I2C_ENGINE_OK);
+
+    while (!Test_IsFinished(pXfer) && ((Host_GetUs() - qwStart) < TEST_WAIT_MAX_US)) {
+        processI2CEngine();
+        Host_Advance(TEST_LOOP_US);
+    }
+    processI2CEngine();
+
+    return (uint32_t)(Host_GetUs() - qwStart);
+}
+
+static void
+Test_HoldScl(
+    void *pData
+) {
+    (void)pData;
+
+    Host_I2cHoldScl(1);
+}
+
+static void
+Test_NoFault(void)
+{
+    host_i2c_stat_t bus;
+    i2c_stat_t stat;
+
+    Test_Setup();
+
+    g_pbyTx[0] = 0x02;
+    g_pbyTx[1] = 0xA5;
+    g_pbyTx[2] = 0x5A;
+    Test_Run(Test_Xfer(3, 0, 0));
+    HOST_CHECK(g_xfer.byStatus == I2C_XFER_DONE);
+    HOST_CHECK((g_slave.pbyReg[2] == 0xA5) && (g_slave.pbyReg[3] == 0x5A));
+
+    /* DMA read, then single byte read */
+    Test_Run(Test_Xfer(1, 2, 0));
+    HOST_CHECK(g_xfer.byStatus == I2C_XFER_DONE);
+    HOST_CHECK((g_pbyRx[0] == 0xA5) && (g_pbyRx[1] == 0x5A));
+    g_pbyTx[0] = 0x03;
+    Test_Run(Test_Xfer(1, 1, 0));
+    HOST_CHECK((g_xfer.byStatus == I2C_XFER_DONE) && (g_pbyRx[0] == 0x5A));
+
+    /* Probe */
+    Test_Run(Test_Xfer(0, 0, 0));
+    HOST_CHECK(g_xfer.byStatus == I2C_XFER_DONE);
+
+    I2CEngine_GetStatistic(&stat);
+    Host_I2cGetStat(&bus);
+    HOST_CHECK(stat.dwTransfer == 4);
+    HOST_CHECK((stat.dwNack | stat.dwArlo | stat.dwBusError | stat.dwTimeout) == 0);
+    HOST_CHECK((stat.dwRetry == 0) && (stat.dwRecovery == 0));
+    HOST_CHECK((bus.dwStart == 6) && (bus.dwStop == 4));
+    HOST_CHECK(bus.dwRecoveryClock == 0);
+}
+
+static void
+Test_Nack(void)
+{
+    i2c_stat_t stat;
+    uint32_t dwUs;
+
+    /* Retried with backoff 1 ms then 2 ms */
+    Test_Setup();
+    Host_I2cInjectNack(2);
+    g_pbyTx[0] = 0x00;
+    dwUs = Test_Run(Test_Xfer(1, 2, 3));
+    I2CEngine_GetStatistic(&stat);
+    HOST_CHECK(g_xfer.byStatus == I2C_XFER_DONE);
+    HOST_CHECK((stat.dwNack == 2) && (stat.dwRetry == 2) && (stat.dwTransfer == 1));
+    HOST_CHECK(dwUs >= 3000u);
+    HOST_CHECK(dwUs <= 5000u);
+
+    /* Given up after byRetry, within (byRetry + 1) * timeout + backoff */
+    Test_Setup();
+    Host_I2cInjectNack(4);
+    dwUs = Test_Run(Test_Xfer(1, 2, 3));
+    I2CEngine_GetStatistic(&stat);
+    HOST_CHECK(g_xfer.byStatus == I2C_XFER_ERR_NACK);
+    HOST_CHECK((stat.dwNack == 4) && (stat.dwRetry == 3));
+    HOST_CHECK(dwUs <= (4u * TEST_TIMEOUT_MS + 1u + 2u + 4u) * 1000u);
+    HOST_CHECK(stat.dwMaxLatency <= 4u * TEST_TIMEOUT_MS + 1u + 2u + 4u);
+    HOST_CHECK(stat.dwRecovery == 0);
+    printf("  nack: given up after %u us\n", dwUs);
+}
+
+static void
+Test_Arlo(void)
+{
+    i2c_stat_t stat;
+
+    Test_Setup();
+    Host_I2cInjectArlo(1);
+    g_pbyTx[0] = 0x00;
+    Test_Run(Test_Xfer(1, 0, 1));
+    I2CEngine_GetStatistic(&stat);
+    HOST_CHECK(g_xfer.byStatus == I2C_XFER_DONE);
+    HOST_CHECK((stat.dwArlo == 1) && (stat.dwRetry == 1) && (stat.dwRecovery == 0));
+
+    /* No retry left */
+    Test_Setup();
+    Host_I2cInjectArlo(1);
+    Test_Run(Test_Xfer(1, 0, 0));
+    HOST_CHECK(g_xfer.byStatus == I2C_XFER_ERR_ARLO);
+}
+
+static void
+Test_BusError(void)
+{
+    host_i2c_stat_t bus;
+    i2c_stat_t stat;
+    uint64_t qwStart;
+
+    /* Error interrupt only asks recovery, the main loop does it */
+    Test_Setup();
+    Host_I2cInjectBusError(1);
+    g_pbyTx[0] = 0x00;
+    HOST_CHECK(I2CEngine_Submit(Test_Xfer(1, 2, 2)) == I2C_ENGINE_OK);
+    qwStart = Host_GetUs();
+    while ((Host_GetUs() - qwStart) < 5000u) {
+        Host_Advance(TEST_LOOP_US);
+    }
+    I2CEngine_GetStatistic(&stat);
+    Host_I2cGetStat(&bus);
+    HOST_CHECK(stat.dwBusError == 1);
+    HOST_CHECK((stat.dwRecovery == 0) && (bus.dwRecoveryClock == 0));
+    HOST_CHECK(!Test_IsFinished(&g_xfer));
+
+    while (!Test_IsFinished(&g_xfer) && ((Host_GetUs() - qwStart) < TEST_WAIT_MAX_US)) {
+        processI2CEngine();
+        Host_Advance(TEST_LOOP_US);
+    }
+    I2CEngine_GetStatistic(&stat);
+    Host_I2cGetStat(&bus);
+    HOST_CHECK(g_xfer.byStatus == I2C_XFER_DONE);
+    HOST_CHECK((stat.dwRecovery == 1) && (stat.dwRetry == 1));
+    HOST_CHECK(bus.dwRecoveryClock != 0);
+    HOST_CHECK(bus.dwClockMasked == 0);
+}
+
+static void
+Test_StuckSda(void)
+{
+    host_i2c_stat_t bus;
+    i2c_stat_t stat;
+    uint32_t dwUs;
+
+    /* Slave left in the middle of a byte: freed by 5 clocks */
+    Test_Setup();
+    Host_I2cHoldSda(5);
+    g_pbyTx[0] = 0x00;
+    dwUs = Test_Run(Test_Xfer(1, 2, 0));
+    I2CEngine_GetStatistic(&stat);
+    Host_I2cGetStat(&bus);
+    HOST_CHECK(g_xfer.byStatus == I2C_XFER_DONE);
+    HOST_CHECK(Host_I2cSdaClocks() == 0);
+    HOST_CHECK((stat.dwRecovery == 1) && (stat.dwRetry == 0));
+    HOST_CHECK(bus.dwRecoveryClock >= 5);
+    HOST_CHECK(bus.dwClockMasked == 0);
+    HOST_CHECK(dwUs <= 1000u);
+
+    /* Never freed: one recovery per attempt, then given up */
+    Test_Setup();
+    Host_I2cHoldSda(0xFF);
+    dwUs = Test_Run(Test_Xfer(1, 2, 2));
+    I2CEngine_GetStatistic(&stat);
+    Host_I2cGetStat(&bus);
+    HOST_CHECK(g_xfer.byStatus == I2C_XFER_ERR_BUS);
+    HOST_CHECK((stat.dwRecovery == 3) && (stat.dwBusError == 3) && (stat.dwRetry == 2));
+    HOST_CHECK(bus.dwStart == 0);
+    HOST_CHECK(bus.dwClockMasked == 0);
+    HOST_CHECK(dwUs <= (1u + 2u + 1u) * 1000u);
+    printf("  stuck SDA: given up after %u us\n", dwUs);
+
+    /* Released: engine works again */
+    Host_I2cHoldSda(0);
+    Test_Run(Test_Xfer(1, 2, 0));
+    HOST_CHECK(g_xfer.byStatus == I2C_XFER_DONE);
+}
+
+static void
+Test_HeldScl(void)
+{
+    host_i2c_stat_t bus;
+    i2c_stat_t stat;
+    uint32_t dwUs;
+
+    /* Stretched in the middle of a read: timeout, retry fails on a busy bus */
+    Test_Setup();
+    g_pbyTx[0] = 0x00;
+    Host_Schedule(250, Test_HoldScl, NULL);
+    dwUs = Test_Run(Test_Xfer(1, 4, 1));
+    I2CEngine_GetStatistic(&stat);
+    Host_I2cGetStat(&bus);
+    HOST_CHECK((g_xfer.byStatus == I2C_XFER_ERR_TIMEOUT) || (g_xfer.byStatus == I2C_XFER_ERR_BUS));
+    HOST_CHECK((stat.dwTimeout == 1) && (stat.dwRetry == 1));
+    HOST_CHECK(stat.dwRecovery >= 1);
+    HOST_CHECK(bus.dwClockMasked == 0);
+    HOST_CHECK(dwUs <= (2u * (TEST_TIMEOUT_MS + 1u) + 1u + 1u) * 1000u);
+    printf("  held SCL: given up after %u us\n", dwUs);
+
+    /* Released: engine works again */
+    Host_I2cHoldScl(0);
+    Test_Run(Test_Xfer(1, 4, 0));
+    HOST_CHECK(g_xfer.byStatus == I2C_XFER_DONE);
+}
+
+static void
+Test_Diag(void)
+{
+    cmd_receive_t cmd;
+    host_frame_p pFrame;
+    i2c_stat_t stat;
+
+    Test_Setup();
+    Host_I2cInjectNack(2);
+    g_pbyTx[0] = 0x00;
+    Test_Run(Test_Xfer(1, 0, 3));
+
+    memset(&cmd, 0, sizeof(cmd));
+    cmd.cmdCommon.cmdid = CMD_ID_I2C_DIAG;
+    cmd.cmdCommon.type = CMD_TYPE_GET;
+    I2CEngine_SerialHandle(&cmd);
+    HOST_CHECK(Host_SerialCount() == 1);
+    pFrame = Host_SerialFrame(0);
+    HOST_CHECK((pFrame != NULL) && (pFrame->byCmdId == CMD_ID_I2C_DIAG));
+    HOST_CHECK((pFrame != NULL) && (pFrame->byType == CMD_TYPE_RES));
+    HOST_CHECK((pFrame != NULL) && (pFrame->byLength == CMD_SIZE_OF_PAYLOAD_I2C_DIAG));
+    HOST_CHECK((pFrame != NULL) && (pFrame->pbyPayload[1] == 1));      /* Transfer */
+    HOST_CHECK((pFrame != NULL) && (pFrame->pbyPayload[3] == 2));      /* Nack */
+    HOST_CHECK((pFrame != NULL) && (pFrame->pbyPayload[11] == 2));     /* Retry */
+
+    /* SET clears then responds */
+    cmd.cmdCommon.type = CMD_TYPE_SET;
+    I2CEngine_SerialHandle(&cmd);
+    I2CEngine_GetStatistic(&stat);
+    HOST_CHECK(Host_SerialCount() == 2);
+    pFrame = Host_SerialFrame(1);
+    HOST_CHECK((pFrame != NULL) && (pFrame->pbyPayload[1] == 0) && (pFrame->pbyPayload[3] == 0));
+    HOST_CHECK((stat.dwTransfer == 0) && (stat.dwNack == 0) && (stat.dwRetry == 0));
+
+    /* Other frames are left to other handlers */
+    cmd.cmdCommon.type = CMD_TYPE_RES;
+    I2CEngine_SerialHandle(&cmd);
+    cmd.cmdCommon.cmdid = CMD_ID_TEMP_SENSOR;
+    cmd.cmdCommon.type = CMD_TYPE_GET;
+    I2CEngine_SerialHandle(&cmd);
+    I2CEngine_SerialHandle(NULL);
+    HOST_CHECK(Host_SerialCount() == 2);
+}
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+int
+main(void)
+{
+    Test_NoFault();
+    Test_Nack();
+    Test_Arlo();
+    Test_BusError();
+    Test_StuckSda();
+    Test_HeldScl();
+    Test_Diag();
+
+    return Host_Result("i2cengine");
+}
+
+/* END FILE */
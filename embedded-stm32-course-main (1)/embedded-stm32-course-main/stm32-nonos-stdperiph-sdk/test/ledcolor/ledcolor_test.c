@@ -0,0 +1,336 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Host test of led colors (Middle/led/ledcolor.c) on the TIM
+ *              model: gamma table of ledgamma.c is the one of tools/
+ *              led_gamma, compare values seen by the outputs for RGB and
+ *              HSV colors and calibration, preloaded values taken at update
+ *              event and a batch committed with update disabled. Built and
+ *              run by ../run_host_tests.sh
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <stdlib.h>
+#include <math.h>
+#include "host.h"
+#include "stm32f401re_tim.h"
+#include "led.h"
+#include "ledcolor.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define TEST_KITS                           2u
+#define TEST_CHANNELS                       (TEST_KITS * NUM_OF_COLOR)
+#define TEST_GAMMA_ONE                      65535u
+#define TEST_BUZZER_ARR                     999u
+
+/* More than a PWM period of led timers (56.9 us) */
+#define TEST_PERIOD_US                      60u
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+/* Table of ledgamma.c and the one printed by tools/led_gamma */
+extern const uint16_t g_pwLedGamma[256];
+extern const uint16_t g_pwToolGamma[256];
+
+/* Outputs: kit 0 red, green, blue then kit 1 */
+static TIM_TypeDef * const g_pTim[TEST_CHANNELS] = {
+    TIM1, TIM1, TIM1, TIM2, TIM2, TIM3,
+};
+
+static const uint8_t g_pbyChannel[TEST_CHANNELS] = {
+    1, 4, 3, 2, 1, 3,
+};
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+static void
+Test_Setup(void)
+{
+    Host_Reset();
+    Host_PeriphReset();
+    Host_TimReset();
+    Host_TimerReset();
+
+    LedControl_Init();
+    LedColor_Init();
+}
+
+/* Compare values seen by the six outputs */
+static void
+Test_Read(
+    uint32_t *pdwCcr
+) {
+    uint8_t i;
+
+    for (i = 0; i < TEST_CHANNELS; i++) {
+        pdwCcr[i] = Host_TimCompare(g_pTim[i], g_pbyChannel[i]);
+    }
+}
+
+/* Expected compare value from the table of the tool */
+static uint32_t
+Test_Duty(
+    TIM_TypeDef *pTim,
+    uint8_t byValue,
+    uint8_t byCalib
+) {
+    uint32_t dwLight = (uint32_t)g_pwToolGamma[byValue] * byCalib / LED_CALIB_FULL;
+    uint32_t dwDuty = (dwLight * (pTim->ARR + 1) + TEST_GAMMA_ONE / 2) / TEST_GAMMA_ONE;
+
+    if ((dwDuty == 0) && (byValue != 0) && (byCalib != 0)) {
+        dwDuty = 1;
+    }
+
+    return dwDuty;
+}
+
+/* Number of outputs not at the compare values of a color per kit */
+static uint8_t
+Test_Mismatch(
+    const uint32_t *pdwRgb,
+    const uint8_t pbyCalib[TEST_KITS][NUM_OF_COLOR]
+) {
+    uint32_t pdwCcr[TEST_CHANNELS];
+    uint8_t byMismatch = 0;
+    uint8_t byValue;
+    uint8_t i;
+
+    Test_Read(pdwCcr);
+    for (i = 0; i < TEST_CHANNELS; i++) {
+        byValue = (uint8_t)(pdwRgb[i / NUM_OF_COLOR] >> (16 - 8 * (i % NUM_OF_COLOR)));
+        if (pdwCcr[i] != Test_Duty(g_pTim[i], byValue, pbyCalib[i / NUM_OF_COLOR][i % NUM_OF_COLOR])) {
+            byMismatch++;
+        }
+    }
+
+    return byMismatch;
+}
+
+static void
+Test_Gamma(void)
+{
+    uint16_t wBad = 0;
+    uint16_t i;
+
+    for (i = 0; i < 256; i++) {
+        wBad += (g_pwLedGamma[i] != g_pwToolGamma[i]);
+    }
+    HOST_CHECK(wBad == 0);
+    HOST_CHECK((g_pwLedGamma[0] == 0) && (g_pwLedGamma[255] == TEST_GAMMA_ONE));
+
+    /* Gamma 2.2: half input is a fifth of light */
+    HOST_CHECK(g_pwLedGamma[128] == 14386);
+}
+
+static void
+Test_Rgb(void)
+{
+    static const uint8_t pbyFull[TEST_KITS][NUM_OF_COLOR] = {
+        { LED_CALIB_FULL, LED_CALIB_FULL, LED_CALIB_FULL },
+        { LED_CALIB_FULL, LED_CALIB_FULL, LED_CALIB_FULL },
+    };
+    static const uint32_t pdwColor[] = {
+        LED_RGB_WHITE, LED_RGB(255, 128, 1), LED_RGB(3, 64, 200), LED_RGB_BLACK,
+    };
+    uint32_t pdwRgb[TEST_KITS];
+    uint32_t pdwCcr[TEST_CHANNELS];
+    uint8_t i;
+
+    Test_Setup();
+
+    /* Preloaded: outputs change at update event, not on write */
+    LedColor_SetRgb(LED_ALL_ID, LED_RGB_WHITE);
+    Test_Read(pdwCcr);
+    HOST_CHECK((pdwCcr[0] == 0) && (pdwCcr[5] == 0));
+    Host_Advance(TEST_PERIOD_US);
+    Test_Read(pdwCcr);
+    HOST_CHECK((pdwCcr[0] == LED_TIMER_PERIOD + 1) && (pdwCcr[5] == LED_TIMER_PERIOD + 1));
+
+    /* Buzzer plays a note: blue of kit 1 is scaled to TIM3 */
+    TIM_SetAutoreload(TIM3, TEST_BUZZER_ARR);
+    for (i = 0; i < sizeof(pdwColor) / sizeof(pdwColor[0]); i++) {
+        pdwRgb[0] = pdwColor[i];
+        pdwRgb[1] = pdwColor[(i + 1) % (sizeof(pdwColor) / sizeof(pdwColor[0]))];
+        LedColor_SetRgb(LED_KIT_ID0, pdwRgb[0]);
+        LedColor_SetRgb(LED_KIT_ID1, pdwRgb[1]);
+        Host_Advance(TEST_PERIOD_US);
+        HOST_CHECK(Test_Mismatch(pdwRgb, pbyFull) == 0);
+    }
+
+    /* Lowest component is never off */
+    LedColor_SetRgb(LED_ALL_ID, LED_RGB(1, 1, 1));
+    Host_Advance(TEST_PERIOD_US);
+    Test_Read(pdwCcr);
+    HOST_CHECK((pdwCcr[0] == 1) && (pdwCcr[4] == 1) && (pdwCcr[5] == 1));
+}
+
+static void
+Test_Hsv(void)
+{
+    static const uint8_t pbyFull[TEST_KITS][NUM_OF_COLOR] = {
+        { LED_CALIB_FULL, LED_CALIB_FULL, LED_CALIB_FULL },
+        { LED_CALIB_FULL, LED_CALIB_FULL, LED_CALIB_FULL },
+    };
+    /* Component at value and component rising or falling in each sector */
+    static const uint8_t pbyMax[6] = { 0, 1, 1, 2, 2, 0 };
+    static const uint8_t pbyMid[6] = { 1, 0, 2, 1, 0, 2 };
+    uint32_t pdwRgb[TEST_KITS];
+    uint32_t dwRgb;
+    double fC;
+    double fX;
+    double pfRef[NUM_OF_COLOR];
+    int iError;
+    int iErrorMax = 0;
+    uint16_t wHue;
+    uint8_t i;
+
+    HOST_CHECK(LedColor_HsvToRgb(0, 255, 255) == LED_RGB(255, 0, 0));
+    HOST_CHECK(LedColor_HsvToRgb(60, 255, 255) == LED_RGB_YELLOW);
+    HOST_CHECK(LedColor_HsvToRgb(120, 255, 255) == LED_RGB(0, 255, 0));
+    HOST_CHECK(LedColor_HsvToRgb(240, 255, 255) == LED_RGB(0, 0, 255));
+    HOST_CHECK(LedColor_HsvToRgb(480, 255, 255) == LED_RGB(0, 255, 0));
+    HOST_CHECK(LedColor_HsvToRgb(77, 0, 90) == LED_RGB(90, 90, 90));
+
+    /* Hue sweep against HSV in floating point */
+    for (wHue = 0; wHue < 360; wHue++) {
+        dwRgb = LedColor_HsvToRgb(wHue, 200, 230);
+
+        fC = 230.0 * 200.0 / 255.0;
+        fX = fC * (1.0 - fabs(fmod(wHue / 60.0, 2.0) - 1.0));
+        pfRef[0] = pfRef[1] = pfRef[2] = 230.0 - fC;
+        pfRef[pbyMax[wHue / 60]] += fC;
+        pfRef[pbyMid[wHue / 60]] += fX;
+
+        for (i = 0; i < NUM_OF_COLOR; i++) {
+            iError = abs((int)((dwRgb >> (16 - 8 * i)) & 0xFFu) - (int)lround(pfRef[i]));
+            if (iError > iErrorMax) {
+                iErrorMax = iError;
+            }
+        }
+    }
+    HOST_CHECK(iErrorMax <= 2);
+
+    /* Compare values of HSV are the ones of its RGB */
+    Test_Setup();
+    LedColor_SetHsv(LED_KIT_ID0, 30, 255, 255);
+    LedColor_SetHsv(LED_KIT_ID1, 300, 128, 200);
+    pdwRgb[0] = LedColor_HsvToRgb(30, 255, 255);
+    pdwRgb[1] = LedColor_HsvToRgb(300, 128, 200);
+    Host_Advance(TEST_PERIOD_US);
+    HOST_CHECK(Test_Mismatch(pdwRgb, pbyFull) == 0);
+
+    printf("  hue sweep at saturation 200, value 230: max error %d of 255 against floating point\n",
+           iErrorMax);
+}
+
+static void
+Test_Calibration(void)
+{
+    static const uint8_t pbyCalib[TEST_KITS][NUM_OF_COLOR] = {
+        { LED_CALIB_FULL, LED_CALIB_FULL, LED_CALIB_FULL },
+        { 255, 180, 0 },
+    };
+    uint32_t pdwRgb[TEST_KITS] = { LED_RGB(200, 100, 50), LED_RGB(200, 100, 50) };
+    uint32_t pdwCcr[TEST_CHANNELS];
+
+    Test_Setup();
+    LedColor_SetCalibration(LED_KIT_ID1, 255, 180, 0);
+    LedColor_SetRgb(LED_ALL_ID, pdwRgb[0]);
+    Host_Advance(TEST_PERIOD_US);
+    HOST_CHECK(Test_Mismatch(pdwRgb, pbyCalib) == 0);
+
+    /* Scaled green, blue of calibration 0 is off */
+    Test_Read(pdwCcr);
+    HOST_CHECK(pdwCcr[4] < pdwCcr[1]);
+    HOST_CHECK(pdwCcr[5] == 0);
+
+    /* White point: half calibration gives half duty */
+    LedColor_SetCalibration(LED_KIT_ID0, 128, 128, 128);
+    LedColor_SetRgb(LED_KIT_ID0, LED_RGB_WHITE);
+    Host_Advance(TEST_PERIOD_US);
+    Test_Read(pdwCcr);
+    HOST_CHECK(pdwCcr[0] == 2399);
+}
+
+static void
+Test_Batch(void)
+{
+    uint32_t pdwBefore[TEST_CHANNELS];
+    uint32_t pdwCcr[TEST_CHANNELS];
+    uint32_t dwUpdates;
+    uint8_t bSame = 1;
+    uint8_t i;
+
+    Test_Setup();
+    LedColor_SetRgb(LED_ALL_ID, LED_RGB(10, 20, 30));
+    Host_Advance(TEST_PERIOD_US);
+    Test_Read(pdwBefore);
+
+    /* Colors of a batch are held while timers run */
+    LedColor_Begin();
+    LedColor_SetRgb(LED_KIT_ID0, LED_RGB(255, 0, 0));
+    Host_Advance(5u * TEST_PERIOD_US);
+    LedColor_SetHsv(LED_KIT_ID1, 240, 255, 255);
+    Host_Advance(5u * TEST_PERIOD_US);
+    Test_Read(pdwCcr);
+    for (i = 0; i < TEST_CHANNELS; i++) {
+        bSame &= (pdwCcr[i] == pdwBefore[i]);
+    }
+    HOST_CHECK(bSame);
+
+    /* Registers are written with update disabled, no update event takes a
+     * half written color */
+    dwUpdates = Host_TimUpdates(TIM1);
+    TIM_UpdateDisableConfig(TIM1, ENABLE);
+    TIM1->CCR1 = 0;
+    Host_Advance(5u * TEST_PERIOD_US);
+    HOST_CHECK(Host_TimUpdates(TIM1) == dwUpdates);
+    HOST_CHECK(Host_TimCompare(TIM1, 1) == pdwBefore[0]);
+    TIM_UpdateDisableConfig(TIM1, DISABLE);
+
+    /* Commit: all six outputs change at the next period */
+    LedColor_Commit();
+    HOST_CHECK(!(TIM1->CR1 & TIM_CR1_UDIS) && !(TIM2->CR1 & TIM_CR1_UDIS) &&
+               !(TIM3->CR1 & TIM_CR1_UDIS));
+    Host_Advance(TEST_PERIOD_US);
+    Test_Read(pdwCcr);
+    HOST_CHECK(pdwCcr[0] == LED_TIMER_PERIOD + 1);
+    HOST_CHECK((pdwCcr[1] == 0) && (pdwCcr[2] == 0) && (pdwCcr[3] == 0) && (pdwCcr[4] == 0));
+    HOST_CHECK(pdwCcr[5] == LED_TIMER_PERIOD + 1);
+
+    /* Out of batch again: applied at once */
+    LedColor_SetRgb(LED_KIT_ID1, LED_RGB_BLACK);
+    Host_Advance(TEST_PERIOD_US);
+    HOST_CHECK(Host_TimCompare(TIM3, 3) == 0);
+}
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+int
+main(void)
+{
+    Test_Gamma();
+    Test_Rgb();
+    Test_Hsv();
+    Test_Calibration();
+    Test_Batch();
+
+    return Host_Result("ledcolor");
+}
+
+/* END FILE */
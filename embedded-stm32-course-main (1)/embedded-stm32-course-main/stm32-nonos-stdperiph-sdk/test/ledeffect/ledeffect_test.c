@@ -0,0 +1,373 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Host test of led effects (Middle/led/ledeffect.c) on the TIM
+ *              and DMA models: compare values taken at each step event are
+ *              checked against the effect and dumped to ledeffect_curve.csv
+ *              next to the test, blue of kit 1 follows ARR of TIM3, counted
+ *              repeats end on their last step. CPU of a DMA blink is
+ *              compared with the software blink of LedControl_BlinkStart.
+ *              Built and run by ../run_host_tests.sh
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <string.h>
+#include <time.h>
+#include "host.h"
+#include "stm32f401re_tim.h"
+#include "timer.h"
+#include "led.h"
+#include "ledeffect.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define TEST_KITS                           2u
+#define TEST_STEPS_MAX                      1024u
+#define TEST_PATH_MAX                       512u
+#define TEST_LOOP_US                        1000u
+#define TEST_BUZZER_ARR                     999u
+#define TEST_BENCH_MS                       10000u
+
+/* Compare values of a kit at a step: red, green, blue */
+typedef struct {
+    uint16_t pwCcr[NUM_OF_COLOR];
+} test_step_t;
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+static test_step_t g_pCurve[TEST_KITS][TEST_STEPS_MAX];
+static uint16_t g_pwSteps[TEST_KITS];
+static uint32_t g_pdwIrq[TEST_KITS];
+static clock_t g_irqClock;
+
+static char g_pCurvePath[TEST_PATH_MAX];
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+void DMA2_Stream5_IRQHandler(void);
+void DMA1_Stream2_IRQHandler(void);
+
+static uint8_t
+Test_Kit0Pending(void)
+{
+    return Host_DmaIrqPending(DMA2_Stream5);
+}
+
+static uint8_t
+Test_Kit1Pending(void)
+{
+    return Host_DmaIrqPending(DMA1_Stream2);
+}
+
+static void
+Test_Kit0Irq(void)
+{
+    clock_t start = clock();
+
+    g_pdwIrq[0]++;
+    DMA2_Stream5_IRQHandler();
+    g_irqClock += clock() - start;
+}
+
+static void
+Test_Kit1Irq(void)
+{
+    clock_t start = clock();
+
+    g_pdwIrq[1]++;
+    DMA1_Stream2_IRQHandler();
+    g_irqClock += clock() - start;
+}
+
+/* Compare values seen by leds of a kit */
+static void
+Test_Read(
+    uint8_t byKit,
+    test_step_t *pStep
+) {
+    if (byKit == 0) {
+        pStep->pwCcr[0] = (uint16_t)Host_TimCompare(TIM1, 1);
+        pStep->pwCcr[1] = (uint16_t)Host_TimCompare(TIM1, 4);
+        pStep->pwCcr[2] = (uint16_t)Host_TimCompare(TIM1, 3);
+    } else {
+        pStep->pwCcr[0] = (uint16_t)Host_TimCompare(TIM2, 2);
+        pStep->pwCcr[1] = (uint16_t)Host_TimCompare(TIM2, 1);
+        pStep->pwCcr[2] = (uint16_t)Host_TimCompare(TIM3, 3);
+    }
+}
+
+/* Step event of a kit, before its DMA request: values of previous step */
+static void
+Test_Hook(
+    TIM_TypeDef *pTim
+) {
+    uint8_t byKit;
+
+    if ((pTim == TIM1) && (TIM1->DIER & TIM_DMA_Update)) {
+        byKit = 0;
+    } else if ((pTim == TIM5) && (TIM5->DIER & TIM_DMA_CC1)) {
+        byKit = 1;
+    } else {
+        return;
+    }
+
+    if (g_pwSteps[byKit] < TEST_STEPS_MAX) {
+        Test_Read(byKit, &g_pCurve[byKit][g_pwSteps[byKit]]);
+    }
+    g_pwSteps[byKit]++;
+}
+
+static void
+Test_Setup(void)
+{
+    Host_Reset();
+    Host_PeriphReset();
+    Host_TimReset();
+    Host_TimerReset();
+    Host_RegisterIrq(Test_Kit0Pending, Test_Kit0Irq);
+    Host_RegisterIrq(Test_Kit1Pending, Test_Kit1Irq);
+
+    LedControl_Init();
+    LedEffect_Init();
+
+    memset(g_pwSteps, 0, sizeof(g_pwSteps));
+    memset(g_pdwIrq, 0, sizeof(g_pdwIrq));
+    Host_TimSetHook(Test_Hook);
+}
+
+static void
+Test_Run(
+    uint32_t dwMs
+) {
+    uint32_t i;
+
+    for (i = 0; i < dwMs; i++) {
+        Host_Advance(TEST_LOOP_US);
+        processTimerScheduler();
+    }
+}
+
+/* Step k is seen at step event k + 1 */
+static const test_step_t *
+Test_Step(
+    uint8_t byKit,
+    uint16_t wStep
+) {
+    return &g_pCurve[byKit][wStep + 1];
+}
+
+static uint16_t
+Test_Duty(
+    uint8_t byLevel,
+    TIM_TypeDef *pTim
+) {
+    return (uint16_t)(byLevel * (pTim->ARR + 1) / 100u);
+}
+
+/* Same curve as LedEffect_Breath */
+static uint8_t
+Test_BreathLevel(
+    uint8_t byMax,
+    uint16_t wStep,
+    uint16_t wSteps
+) {
+    uint32_t dwLevel = (uint32_t)wStep * 2 * 1000u / wSteps;
+
+    if (dwLevel > 1000u) {
+        dwLevel = 2 * 1000u - dwLevel;
+    }
+    dwLevel = dwLevel * dwLevel / 1000u;
+
+    return (uint8_t)(byMax * dwLevel / 1000u);
+}
+
+static void
+Test_Dump(
+    uint16_t wSteps
+) {
+    FILE *pFile = fopen(g_pCurvePath, "w");
+    uint16_t i;
+
+    HOST_CHECK(pFile != NULL);
+    if (pFile == NULL) {
+        return;
+    }
+
+    fprintf(pFile, "step,kit0_red,kit0_green,kit0_blue,kit1_red,kit1_green,kit1_blue\n");
+    for (i = 0; i < wSteps; i++) {
+        fprintf(pFile, "%u,%u,%u,%u,%u,%u,%u\n", i,
+                Test_Step(0, i)->pwCcr[0], Test_Step(0, i)->pwCcr[1], Test_Step(0, i)->pwCcr[2],
+                Test_Step(1, i)->pwCcr[0], Test_Step(1, i)->pwCcr[1], Test_Step(1, i)->pwCcr[2]);
+    }
+    fclose(pFile);
+}
+
+static void
+Test_Breath(void)
+{
+    static const led_rgb_t color = { 100, 40, 80 };
+    const uint16_t wSteps = 100;
+    uint16_t wBad = 0;
+    uint16_t i;
+    uint8_t j;
+
+    Test_Setup();
+
+    /* Buzzer plays a note: TIM3 runs at another period than TIM2 */
+    TIM3->ARR = TEST_BUZZER_ARR;
+    HOST_CHECK(LedEffect_Breath(LED_ALL_ID, &color, wSteps * LED_EFFECT_STEP_MS, BLINK_FOREVER) == LED_EFFECT_OK);
+    Test_Run(wSteps * LED_EFFECT_STEP_MS + 50u);
+    Test_Dump(wSteps);
+
+    HOST_CHECK((g_pwSteps[0] > wSteps) && (g_pwSteps[1] > wSteps));
+    for (i = 0; i < wSteps; i++) {
+        for (j = 0; j < TEST_KITS; j++) {
+            wBad += (Test_Step(j, i)->pwCcr[0] != Test_Duty(Test_BreathLevel(color.byRed, i, wSteps),
+                                                             (j == 0) ? TIM1 : TIM2));
+            wBad += (Test_Step(j, i)->pwCcr[1] != Test_Duty(Test_BreathLevel(color.byGreen, i, wSteps),
+                                                             (j == 0) ? TIM1 : TIM2));
+            wBad += (Test_Step(j, i)->pwCcr[2] != Test_Duty(Test_BreathLevel(color.byBlue, i, wSteps),
+                                                             (j == 0) ? TIM1 : TIM3));
+        }
+    }
+    HOST_CHECK(wBad == 0);
+
+    /* Blue of kit 1 at top of breath is 80 % of TIM3 period */
+    HOST_CHECK(Test_Step(1, wSteps / 2)->pwCcr[2] == 800u);
+    HOST_CHECK(LedEffect_IsRunning(LED_KIT_ID0) && LedEffect_IsRunning(LED_KIT_ID1));
+
+    LedEffect_Stop(LED_ALL_ID);
+    HOST_CHECK(!LedEffect_IsRunning(LED_KIT_ID0) && !LedEffect_IsRunning(LED_KIT_ID1));
+    HOST_CHECK(TIM1->RCR == 0);
+}
+
+static void
+Test_Fade(void)
+{
+    static const led_rgb_t from = { 0, 0, 0 };
+    static const led_rgb_t to = { 50, 100, 25 };
+    test_step_t last;
+
+    Test_Setup();
+    HOST_CHECK(LedEffect_Fade(LED_KIT_ID1, &from, &to, 500) == LED_EFFECT_OK);
+    Test_Run(1000);
+
+    /* Single run stops on last step and keeps it */
+    HOST_CHECK(!LedEffect_IsRunning(LED_KIT_ID1));
+    HOST_CHECK(g_pwSteps[1] > 50);
+    Test_Read(1, &last);
+    HOST_CHECK(last.pwCcr[0] == Test_Duty(50, TIM2));
+    HOST_CHECK(last.pwCcr[1] == Test_Duty(100, TIM2));
+    HOST_CHECK(last.pwCcr[2] == Test_Duty(25, TIM3));
+    HOST_CHECK(g_pdwIrq[1] == 0);
+}
+
+static void
+Test_Repeat(void)
+{
+    const uint16_t wSteps = 20;
+    const uint8_t byRepeat = 7;
+    test_step_t last;
+    uint16_t wOn = 0;
+    uint16_t i;
+    uint8_t j;
+
+    /* Blink of 10 on and 10 off steps, 7 times on both kits. Step of kit 0
+     * is 175 PWM periods (9.96 ms), a timer of wall time would add steps */
+    Test_Setup();
+    HOST_CHECK(LedEffect_Blink(LED_ALL_ID, BLINK_GREEN, byRepeat, 100) == LED_EFFECT_OK);
+    Test_Run((uint32_t)wSteps * LED_EFFECT_STEP_MS * (byRepeat + 2u));
+
+    for (j = 0; j < TEST_KITS; j++) {
+        /* Last step event is the one of transfer complete */
+        HOST_CHECK(g_pwSteps[j] == wSteps * byRepeat);
+        HOST_CHECK(g_pdwIrq[j] == byRepeat);
+        HOST_CHECK(!LedEffect_IsRunning((j == 0) ? LED_KIT_ID0 : LED_KIT_ID1));
+
+        Test_Read(j, &last);
+        HOST_CHECK((last.pwCcr[0] == 0) && (last.pwCcr[1] == 0) && (last.pwCcr[2] == 0));
+    }
+
+    for (i = 0; i + 1u < wSteps * byRepeat; i++) {
+        wOn += (Test_Step(1, i)->pwCcr[1] != 0);
+    }
+    HOST_CHECK(wOn == (wSteps / 2u) * byRepeat);
+}
+
+static void
+Test_Benchmark(void)
+{
+    uint32_t dwTicks;
+    clock_t start;
+    clock_t soft = 0;
+    clock_t dma;
+    uint32_t i;
+
+    /* Software blink: a callback of main loop every 100 ms */
+    Test_Setup();
+    LedControl_BlinkStart(LED_KIT_ID0, BLINK_RED, BLINK_FOREVER, 100, 0);
+    for (i = 0; i < TEST_BENCH_MS; i++) {
+        Host_Advance(TEST_LOOP_US);
+        start = clock();
+        processTimerScheduler();
+        soft += clock() - start;
+    }
+    dwTicks = Host_LedBlinkTicks();
+    HOST_CHECK(dwTicks == TEST_BENCH_MS / 100u);
+
+    /* DMA blink: counted, one interrupt per blink */
+    Test_Setup();
+    g_irqClock = 0;
+    start = clock();
+    HOST_CHECK(LedEffect_Blink(LED_KIT_ID0, BLINK_RED, TEST_BENCH_MS / 200u, 100) == LED_EFFECT_OK);
+    dma = clock() - start;
+    for (i = 0; i < TEST_BENCH_MS; i++) {
+        Host_Advance(TEST_LOOP_US);
+    }
+    HOST_CHECK(g_pdwIrq[0] == TEST_BENCH_MS / 200u);
+    HOST_CHECK(g_pwSteps[0] == TEST_BENCH_MS / LED_EFFECT_STEP_MS);
+
+    printf("  %u s blink of 100 ms: software %u callbacks, %u CCR writes, host %.0f us; "
+           "DMA %u interrupts, %u CCR writes by DMA, host start %.0f us + interrupts %.0f us\n",
+           TEST_BENCH_MS / 1000u, dwTicks, dwTicks * NUM_OF_COLOR,
+           soft * 1e6 / CLOCKS_PER_SEC, g_pdwIrq[0], g_pwSteps[0] * NUM_OF_COLOR,
+           dma * 1e6 / CLOCKS_PER_SEC, g_irqClock * 1e6 / CLOCKS_PER_SEC);
+}
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+int
+main(
+    int argc,
+    char **argv
+) {
+    const char *pSlash = strrchr(argv[0], '/');
+
+    (void)argc;
+
+    snprintf(g_pCurvePath, sizeof(g_pCurvePath), "%.*s/ledeffect_curve.csv",
+             (pSlash != NULL) ? (int)(pSlash - argv[0]) : 1,
+             (pSlash != NULL) ? argv[0] : ".");
+
+    Test_Breath();
+    Test_Fade();
+    Test_Repeat();
+    Test_Benchmark();
+
+    return Host_Result("ledeffect");
+}
+
+/* END FILE */
@@ -0,0 +1,115 @@
+#!/bin/sh
+#
+# Build and run host tests of Middle modules: peripherals, timer service
+# and serial of the prebuilt library are replaced by models in host/.
+#
+#   ./run_host_tests.sh [test ...]     all tests if none given
+#
+# Needs gcc. Position dependent executables (-no-pie): DMA registers hold
+# 32-bit addresses of static buffers.
+
+cd "$(dirname "$0")" || exit 1
+
+SHARED=../shared
+OUT=${TMPDIR:-/tmp}/stm32_host_tests
+CFLAGS="-std=gnu99 -Wall -Wextra -Wno-unused-parameter -Wno-pointer-to-int-cast -g -no-pie"
+INCLUDES="-Ihost $(find $SHARED -type d | sed 's/^/-I/' | tr '\n' ' ')"
+HOST="host/host.c host/host_timer.c host/host_lib.c host/host_periph.c host/host_i2c.c host/host_si7020.c host/host_tim.c"
+
+I2C="$SHARED/Middle/i2c/i2cengine.c $SHARED/Middle/i2c/i2cdevice.c"
+# ucglib of the prebuilt library is host/host_ucg.c, LCD is the ST7735 model.
+# Ucglib_st7735.c: commands and address window of all ucglib backends
+UCGLIB=$SHARED/Middle/ucglib
+UCG="host/host_ucg.c host/host_font.c host/host_spi.c host/host_st7735.c $UCGLIB/Ucglib_st7735.c"
+# LedControl_* and BuzzerControl_Init of the prebuilt library, PWM on the
+# TIM model
+LED="host/host_led.c"
+BUZZER="host/host_buzzer.c"
+
+sources() {
+    case $1 in
+    i2cengine)   echo "$I2C" ;;
+    i2cdevice)   echo "$I2C" ;;
+    si7020)      echo "$I2C $SHARED/Middle/sensor/si7020.c" ;;
+    sensorservice) echo "$I2C $SHARED/Middle/sensor/si7020.c $SHARED/Middle/sensor/sensorservice.c" ;;
+    temhummeasure) echo "$I2C $SHARED/Middle/sensor/si7020.c $SHARED/Middle/sensor/temhummeasure.c" ;;
+    displaytask) echo "$SHARED/Middle/display/displaytask.c" ;;
+    buttonexti)  echo "$SHARED/Middle/button/buttonexti.c" ;;
+    gesture)     echo "$SHARED/Middle/button/buttonexti.c $SHARED/Middle/button/gesture.c" ;;
+    ucglib_hwspi) echo "$UCG $UCGLIB/Ucglib_hwspi.c" ;;
+    ucglib_fb)   echo "$UCG $UCGLIB/Ucglib_fb.c" ;;
+    ucglib_tile) echo "$UCG $UCGLIB/Ucglib_hwspi.c $UCGLIB/Ucglib_tile.c" ;;
+    ucglib_rotate) echo "$UCG $UCGLIB/Ucglib_hwspi.c $UCGLIB/Ucglib_rotate.c" ;;
+    ucglib_glyph) echo "$UCG $UCGLIB/Ucglib_fb.c $UCGLIB/Ucglib_glyph.c" ;;
+    ucglib_solid) echo "$UCG $UCGLIB/Ucglib_hwspi.c $UCGLIB/Ucglib_glyph.c" ;;
+    ucglib_font) echo "$UCG $OUT/ucg_font_7x13B_digits.c" ;;
+    ucglib_image) echo "$UCG $UCGLIB/Ucglib_hwspi.c $UCGLIB/Ucglib_fb.c $UCGLIB/Ucglib_image.c $OUT/thermometer.c $OUT/sun.c" ;;
+    ucglib_span) echo "$UCG $UCGLIB/Ucglib_hwspi.c $UCGLIB/Ucglib_span.c" ;;
+    ucglib_gradient) echo "$UCG $UCGLIB/Ucglib_hwspi.c $UCGLIB/Ucglib_gradient.c" ;;
+    ucglib_chart) echo "$UCG $UCGLIB/Ucglib_rotate.c $UCGLIB/Ucglib_column.c $UCGLIB/Ucglib_chart.c" ;;
+    ucglib_widget) echo "$UCG $UCGLIB/Ucglib_glyph.c $UCGLIB/Ucglib_image.c $UCGLIB/Ucglib_column.c $UCGLIB/Ucglib_widget.c $OUT/thermometer.c $OUT/sun.c" ;;
+    ucglib_trace) echo "$UCG $UCGLIB/Ucglib_glyph.c $UCGLIB/Ucglib_rotate.c $UCGLIB/Ucglib_trace.c" ;;
+    ledeffect)   echo "$LED $SHARED/Middle/led/ledkit.c $SHARED/Middle/led/ledeffect.c" ;;
+    buzzerplayer) echo "$BUZZER $SHARED/Middle/buzzer/buzzerplayer.c $OUT/melody_elise.c" ;;
+    ledcolor)    echo "$LED $SHARED/Middle/led/ledkit.c $SHARED/Middle/led/ledcolor.c $SHARED/Middle/led/ledgamma.c $OUT/ledgamma_tool.c" ;;
+    *)           return 1 ;;
+    esac
+}
+
+# Defines of a test
+defines() {
+    case $1 in
+    ucglib_trace) echo "-DUCG_TRACE_SIZE=65535u" ;;
+    ucglib_glyph) echo "-DUCG_GLYPH_CACHE_SLOT_SIZE=10u" ;;
+    *)  : ;;
+    esac
+}
+
+# Sources made by tools/ before a test is built
+generate() {
+    case $1 in
+    ucglib_font)
+        gcc -o "$OUT/ucg_font_subset" ../tools/ucg_font_subset/ucg_font_subset.c &&
+        "$OUT/ucg_font_subset" ucglib_font/ucg_font_7x13B_tf.bin ucg_font_7x13B_digits \
+            "0-9.:%C Ab" > "$OUT/ucg_font_7x13B_digits.c" ;;
+    ucglib_image|ucglib_widget)
+        gcc -o "$OUT/ucg_image_conv" ../tools/ucg_image_conv/ucg_image_conv.c &&
+        "$OUT/ucg_image_conv" ucglib_image/thermometer.ppm g_pbyThermometer \
+            -t FF00FF > "$OUT/thermometer.c" &&
+        "$OUT/ucg_image_conv" ucglib_image/sun.ppm g_pbySun > "$OUT/sun.c" ;;
+    ucglib_trace)
+        gcc -o "$OUT/ucg_trace_replay" ../tools/ucg_trace_replay/ucg_trace_replay.c ;;
+    buzzerplayer)
+        gcc -o "$OUT/buzzer_rtttl" ../tools/buzzer_rtttl/buzzer_rtttl.c -lm &&
+        "$OUT/buzzer_rtttl" buzzerplayer/elise.txt g_pbyMelodyElise > "$OUT/melody_elise.c" ;;
+    ledcolor)
+        # Table printed by the tool, renamed to be linked next to ledgamma.c
+        gcc -o "$OUT/led_gamma" ../tools/led_gamma/led_gamma.c -lm &&
+        "$OUT/led_gamma" | sed 's/g_pwLedGamma/g_pwToolGamma/' > "$OUT/ledgamma_tool.c" ;;
+    *)  : ;;
+    esac
+}
+
+TESTS=${*:-"i2cengine i2cdevice si7020 temhummeasure sensorservice displaytask buttonexti gesture ucglib_hwspi ucglib_fb ucglib_tile ucglib_rotate ucglib_glyph ucglib_solid ucglib_font ucglib_image ucglib_span ucglib_gradient ucglib_widget ucglib_chart ucglib_trace ledeffect ledcolor buzzerplayer"}
+FAILED=""
+
+mkdir -p "$OUT"
+
+for TEST in $TESTS; do
+    SRC=$(sources "$TEST") || { echo "$TEST: unknown test"; FAILED="$FAILED $TEST"; continue; }
+    # shellcheck disable=SC2086
+    if generate "$TEST" &&
+       gcc $CFLAGS $(defines "$TEST") $INCLUDES -o "$OUT/$TEST" $HOST $SRC "$TEST/${TEST}_test.c" -lm &&
+       "$OUT/$TEST"; then
+        :
+    else
+        FAILED="$FAILED $TEST"
+    fi
+done
+
+if [ -n "$FAILED" ]; then
+    echo "FAILED:$FAILED"
+    exit 1
+fi
+
+echo "all host tests passed"
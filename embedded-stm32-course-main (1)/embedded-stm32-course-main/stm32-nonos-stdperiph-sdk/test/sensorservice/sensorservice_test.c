@@ -0,0 +1,339 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Host test of sensor service (Middle/sensor/sensorservice.c):
+ *              cadence of each sensor, cache hits, respond frames from
+ *              cache or after a new sample, errors of the sensor and
+ *              statistics. Si7020 is simulated on the I2C bus, the light
+ *              sensor of the prebuilt library is replaced here. Built and
+ *              run by ../run_host_tests.sh
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <string.h>
+#include "host.h"
+#include "host_i2c.h"
+#include "host_si7020.h"
+#include "timer.h"
+#include "i2cengine.h"
+#include "si7020.h"
+#include "lightsensor.h"
+#include "temhumsensor.h"
+#include "sensorservice.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define TEST_LOOP_US                        100u
+#define TEST_RESPOND_NONE                   0xFFu
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+static host_si7020_t g_sensor;
+static uint16_t g_wLight;
+static uint32_t g_dwLightRead;
+static uint8_t g_byRespondId;
+static uint16_t g_wRespondValue;
+static uint8_t g_byRespondCount;
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/* Light sensor and respond frames of the prebuilt library ------------------*/
+
+uint16_t
+LightSensor_MeasureUseDMAMode(void)
+{
+    g_dwLightRead++;
+
+    return g_wLight;
+}
+
+static void
+Test_Respond(
+    uint8_t byId,
+    uint16_t wValue
+) {
+    g_byRespondId = byId;
+    g_wRespondValue = wValue;
+    g_byRespondCount++;
+}
+
+void
+LightSensor_SendPacketRespond(
+    uint16_t value
+) {
+    Test_Respond(SENSOR_ID_LIGHT, value);
+}
+
+void
+TempSensor_SendPacketRespond(
+    uint16_t value
+) {
+    Test_Respond(SENSOR_ID_TEMP, value);
+}
+
+void
+HumiSensor_SendPacketRespond(
+    uint16_t value
+) {
+    Test_Respond(SENSOR_ID_HUMI, value);
+}
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+static void
+Test_Setup(
+    uint8_t bSampling
+) {
+    uint8_t i;
+
+    Host_Reset();
+    Host_PeriphReset();
+    Host_TimerReset();
+    Host_I2cReset();
+
+    memset(&g_sensor, 0, sizeof(g_sensor));
+    g_sensor.wTempCode = Host_Si7020TempCode(2150);
+    g_sensor.wHumiCode = Host_Si7020HumiCode(5500);
+    Host_Si7020Attach(&g_sensor);
+
+    g_wLight = 1234;
+    g_dwLightRead = 0;
+    g_byRespondId = TEST_RESPOND_NONE;
+    g_byRespondCount = 0;
+
+    I2CEngine_Init();
+    Si7020_Init();
+    SensorService_Init();
+
+    if (!bSampling) {
+        for (i = 0; i < SENSOR_ID_COUNT; i++) {
+            SensorService_SetPeriod(i, 0);
+        }
+    }
+}
+
+static void
+Test_Run(
+    uint32_t dwUs
+) {
+    uint64_t qwEnd = Host_GetUs() + dwUs;
+
+    while (Host_GetUs() < qwEnd) {
+        processTimerScheduler();
+        processI2CEngine();
+        Host_Advance(TEST_LOOP_US);
+    }
+}
+
+static void
+Test_Cadence(void)
+{
+    sensor_stat_t stat;
+    int16_t iValue;
+
+    /* 10 s, and time for the last Si7020 conversions */
+    Test_Setup(1);
+    Test_Run(10050000u);
+
+    SensorService_GetStatistic(SENSOR_ID_LIGHT, &stat);
+    HOST_CHECK((stat.dwSample >= 99) && (stat.dwSample <= 100));
+    HOST_CHECK((stat.wSampleRate >= 985) && (stat.wSampleRate <= 1000));
+    HOST_CHECK(g_dwLightRead == stat.dwSample);
+
+    SensorService_GetStatistic(SENSOR_ID_TEMP, &stat);
+    HOST_CHECK((stat.dwSample == 10) && (stat.dwError == 0));
+    HOST_CHECK(stat.wSampleRate == 99);
+    SensorService_GetStatistic(SENSOR_ID_HUMI, &stat);
+    HOST_CHECK((stat.dwSample == 10) && (stat.dwError == 0));
+
+    /* Temperature and humidity due together take one conversion */
+    HOST_CHECK(g_sensor.dwConversion == 10);
+
+    HOST_CHECK(SensorService_Read(SENSOR_ID_TEMP, &iValue, NULL) == SENSOR_OK);
+    HOST_CHECK(iValue == 2150);
+    HOST_CHECK(SensorService_Read(SENSOR_ID_HUMI, &iValue, NULL) == SENSOR_OK);
+    HOST_CHECK(iValue == 5500);
+    HOST_CHECK(SensorService_Read(SENSOR_ID_LIGHT, &iValue, NULL) == SENSOR_OK);
+    HOST_CHECK(iValue == 1234);
+}
+
+static void
+Test_HitRatio(void)
+{
+    sensor_stat_t stat;
+    uint32_t dwTimestamp;
+    int16_t iValue;
+    uint8_t i;
+
+    Test_Setup(1);
+    Test_Run(1500000u);
+
+    /* UI reads at 50 Hz cost no sample */
+    for (i = 0; i < 50; i++) {
+        HOST_CHECK(SensorService_Read(SENSOR_ID_TEMP, &iValue, NULL) == SENSOR_OK);
+        Test_Run(20000u);
+    }
+    SensorService_GetStatistic(SENSOR_ID_TEMP, &stat);
+    HOST_CHECK((stat.dwRead == 50) && (stat.dwHit == 50) && (stat.byHitRatio == 100));
+    HOST_CHECK(stat.dwSample == 2);
+
+    /* Sampling stopped: value gets stale. Humidity samples would bring a
+     * temperature of their conversion */
+    SensorService_SetPeriod(SENSOR_ID_TEMP, 0);
+    SensorService_SetPeriod(SENSOR_ID_HUMI, 0);
+    SensorService_SetMaxAge(SENSOR_ID_TEMP, 500);
+    Test_Run(600000u);
+    HOST_CHECK(SensorService_Read(SENSOR_ID_TEMP, &iValue, &dwTimestamp) == SENSOR_ERR_STALE);
+    HOST_CHECK(iValue == 2150);
+    SensorService_GetStatistic(SENSOR_ID_TEMP, &stat);
+    HOST_CHECK(stat.byHitRatio == 98);
+
+    /* A value exactly max age old is stale */
+    SensorService_SetMaxAge(SENSOR_ID_TEMP, GetMilSecTick() - dwTimestamp);
+    HOST_CHECK(SensorService_Read(SENSOR_ID_TEMP, &iValue, NULL) == SENSOR_ERR_STALE);
+    SensorService_SetMaxAge(SENSOR_ID_TEMP, GetMilSecTick() - dwTimestamp + 1);
+    HOST_CHECK(SensorService_Read(SENSOR_ID_TEMP, &iValue, NULL) == SENSOR_OK);
+
+    HOST_CHECK(SensorService_Read(SENSOR_ID_COUNT, &iValue, NULL) == SENSOR_ERR_PARAM);
+}
+
+static void
+Test_RespondFresh(void)
+{
+    uint32_t dwConversion;
+
+    Test_Setup(1);
+    Test_Run(1500000u);
+    dwConversion = g_sensor.dwConversion;
+
+    HOST_CHECK(SensorService_SendPacketRespond(SENSOR_ID_HUMI) == SENSOR_OK);
+    HOST_CHECK((g_byRespondCount == 1) && (g_byRespondId == SENSOR_ID_HUMI));
+    HOST_CHECK(g_wRespondValue == 5500);
+    HOST_CHECK(g_sensor.dwConversion == dwConversion);
+}
+
+static void
+Test_RespondStale(void)
+{
+    sensor_stat_t stat;
+
+    /* Nothing sampled yet: light is read at once */
+    Test_Setup(0);
+    HOST_CHECK(SensorService_SendPacketRespond(SENSOR_ID_LIGHT) == SENSOR_OK);
+    HOST_CHECK((g_byRespondCount == 1) && (g_byRespondId == SENSOR_ID_LIGHT));
+    HOST_CHECK((g_wRespondValue == 1234) && (g_dwLightRead == 1));
+
+    /* Si7020 answers when its conversion is done */
+    HOST_CHECK(SensorService_SendPacketRespond(SENSOR_ID_TEMP) == SENSOR_PENDING);
+    HOST_CHECK(SensorService_SendPacketRespond(SENSOR_ID_TEMP) == SENSOR_PENDING);
+    HOST_CHECK(g_byRespondCount == 1);
+    Test_Run(50000u);
+    HOST_CHECK((g_byRespondCount == 2) && (g_byRespondId == SENSOR_ID_TEMP));
+    HOST_CHECK(g_wRespondValue == 2150);
+    HOST_CHECK(g_sensor.dwConversion == 1);
+
+    /* Stale value is not sent, a new one is */
+    SensorService_SetMaxAge(SENSOR_ID_TEMP, 100);
+    g_sensor.wTempCode = Host_Si7020TempCode(2275);
+    Test_Run(200000u);
+    HOST_CHECK(SensorService_SendPacketRespond(SENSOR_ID_TEMP) == SENSOR_PENDING);
+    Test_Run(50000u);
+    HOST_CHECK((g_byRespondCount == 3) && (g_wRespondValue == 2275));
+
+    /* Humidity asked while temperature converts: answered by the same
+     * conversion */
+    SensorService_SetMaxAge(SENSOR_ID_HUMI, 100);
+    g_sensor.wTempCode = Host_Si7020TempCode(2300);
+    g_sensor.wHumiCode = Host_Si7020HumiCode(6000);
+    Test_Run(200000u);
+    HOST_CHECK(SensorService_SendPacketRespond(SENSOR_ID_TEMP) == SENSOR_PENDING);
+    HOST_CHECK(SensorService_SendPacketRespond(SENSOR_ID_HUMI) == SENSOR_PENDING);
+    Test_Run(50000u);
+    HOST_CHECK(g_byRespondCount == 5);
+    HOST_CHECK((g_byRespondId == SENSOR_ID_HUMI) && (g_wRespondValue == 6000));
+    HOST_CHECK(g_sensor.dwConversion == 3);
+
+    SensorService_GetStatistic(SENSOR_ID_TEMP, &stat);
+    HOST_CHECK((stat.dwSample == 3) && (stat.dwError == 0));
+    SensorService_GetStatistic(SENSOR_ID_HUMI, &stat);
+    HOST_CHECK((stat.dwSample == 3) && (stat.dwError == 0));
+}
+
+static void
+Test_DeviceError(void)
+{
+    sensor_stat_t stat;
+    int16_t iValue;
+
+    Test_Setup(0);
+    HOST_CHECK(SensorService_SendPacketRespond(SENSOR_ID_HUMI) == SENSOR_PENDING);
+    Test_Run(50000u);
+    HOST_CHECK(g_byRespondCount == 1);
+
+    /* Sample failed: error counted, last value answered */
+    SensorService_SetMaxAge(SENSOR_ID_HUMI, 10);
+    Test_Run(20000u);
+    g_sensor.byBadCrc = 1;
+    HOST_CHECK(SensorService_SendPacketRespond(SENSOR_ID_HUMI) == SENSOR_PENDING);
+    Test_Run(50000u);
+    HOST_CHECK((g_byRespondCount == 2) && (g_wRespondValue == 5500));
+    SensorService_GetStatistic(SENSOR_ID_HUMI, &stat);
+    HOST_CHECK((stat.dwSample == 1) && (stat.dwError == 1));
+    HOST_CHECK(SensorService_Read(SENSOR_ID_HUMI, &iValue, NULL) == SENSOR_ERR_STALE);
+
+    /* Nothing to answer if never sampled */
+    Test_Setup(0);
+    Host_I2cInjectNack(1);
+    HOST_CHECK(SensorService_SendPacketRespond(SENSOR_ID_TEMP) == SENSOR_PENDING);
+    Test_Run(50000u);
+    HOST_CHECK(g_byRespondCount == 0);
+    SensorService_GetStatistic(SENSOR_ID_TEMP, &stat);
+    HOST_CHECK(stat.dwError == 1);
+    HOST_CHECK(SensorService_Read(SENSOR_ID_TEMP, &iValue, NULL) == SENSOR_ERR_NO_DATA);
+}
+
+static void
+Test_SampleRateSaturated(void)
+{
+    sensor_stat_t stat;
+
+    /* 1 kHz is 100000 samples per 100 s */
+    Test_Setup(0);
+    SensorService_SetPeriod(SENSOR_ID_LIGHT, 1);
+    Test_Run(1000000u);
+    SensorService_GetStatistic(SENSOR_ID_LIGHT, &stat);
+    HOST_CHECK(stat.dwSample >= 999);
+    HOST_CHECK(stat.wSampleRate == 0xFFFF);
+}
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+int
+main(void)
+{
+    Test_Cadence();
+    Test_HitRatio();
+    Test_RespondFresh();
+    Test_RespondStale();
+    Test_DeviceError();
+    Test_SampleRateSaturated();
+
+    return Host_Result("sensorservice");
+}
+
+/* END FILE */
@@ -0,0 +1,266 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Host test of Si7020 driver on I2C engine (Middle/sensor/
+ *              si7020.c) with the simulated sensor: values, combined
+ *              humidity + temperature, NACK while converting, CRC and bus
+ *              errors, and stall of the main loop against a wait on a
+ *              hold master conversion. Built and run by ../run_host_tests.sh
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <string.h>
+#include "host.h"
+#include "host_i2c.h"
+#include "host_si7020.h"
+#include "timer.h"
+#include "i2cengine.h"
+#include "si7020.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define TEST_LOOP_US                        100u    /* Idle time of one main loop */
+#define TEST_WAIT_MAX_US                    100000u
+#define TEST_STALL_ASYNC_MAX_US             100u
+#define TEST_CMD_MEASURE_T_HOLD             0xE3u
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+static host_si7020_t g_sensor;
+static uint8_t g_bDone;
+static uint8_t g_byStatus;
+static int16_t g_iValue;
+static int16_t g_iTemp;
+static uint32_t g_dwStallUs;                /* Longest main loop */
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+static void
+Test_Setup(void)
+{
+    Host_Reset();
+    Host_PeriphReset();
+    Host_TimerReset();
+    Host_I2cReset();
+
+    memset(&g_sensor, 0, sizeof(g_sensor));
+    g_sensor.wTempCode = Host_Si7020TempCode(2345);
+    g_sensor.wHumiCode = Host_Si7020HumiCode(4567);
+    Host_Si7020Attach(&g_sensor);
+
+    I2CEngine_Init();
+    Si7020_Init();
+
+    g_bDone = 0;
+    g_dwStallUs = 0;
+}
+
+static void
+Test_Callback(
+    uint8_t byStatus,
+    int16_t iValue
+) {
+    g_bDone = 1;
+    g_byStatus = byStatus;
+    g_iValue = iValue;
+}
+
+static void
+Test_TemHumCallback(
+    uint8_t byStatus,
+    int16_t iHumi,
+    int16_t iTemp
+) {
+    g_bDone = 1;
+    g_byStatus = byStatus;
+    g_iValue = iHumi;
+    g_iTemp = iTemp;
+}
+
+/* Main loop until callback, returns time taken (us) */
+static uint32_t
+Test_RunUntilDone(void)
+{
+    uint64_t qwStart = Host_GetUs();
+    uint64_t qwLoop;
+
+    while (!g_bDone && ((Host_GetUs() - qwStart) < TEST_WAIT_MAX_US)) {
+        qwLoop = Host_GetUs();
+        processTimerScheduler();
+        processI2CEngine();
+        if ((Host_GetUs() - qwLoop) > g_dwStallUs) {
+            g_dwStallUs = (uint32_t)(Host_GetUs() - qwLoop);
+        }
+        Host_Advance(TEST_LOOP_US);
+    }
+
+    return (uint32_t)(Host_GetUs() - qwStart);
+}
+
+static void
+Test_Temperature(void)
+{
+    uint32_t dwUs;
+
+    Test_Setup();
+    HOST_CHECK(Si7020_MeasureTempAsync(Test_Callback) == SI7020_OK);
+    HOST_CHECK(Si7020_IsBusy());
+    HOST_CHECK(Si7020_MeasureHumiAsync(Test_Callback) == SI7020_ERR_BUSY);
+
+    dwUs = Test_RunUntilDone();
+    HOST_CHECK(g_bDone && (g_byStatus == SI7020_OK) && (g_iValue == 2345));
+    HOST_CHECK(!Si7020_IsBusy());
+    HOST_CHECK(g_sensor.dwConversion == 1);
+    HOST_CHECK(g_dwStallUs <= TEST_STALL_ASYNC_MAX_US);
+    printf("  temperature: %u us, longest main loop %u us\n", dwUs, g_dwStallUs);
+}
+
+static void
+Test_Humidity(void)
+{
+    Test_Setup();
+    HOST_CHECK(Si7020_MeasureHumiAsync(Test_Callback) == SI7020_OK);
+    Test_RunUntilDone();
+    HOST_CHECK(g_bDone && (g_byStatus == SI7020_OK) && (g_iValue == 4567));
+}
+
+static void
+Test_Combined(void)
+{
+    /* One RH conversion, its temperature read back by 0xE0 */
+    Test_Setup();
+    HOST_CHECK(Si7020_MeasureAsync(Test_TemHumCallback) == SI7020_OK);
+    HOST_CHECK(Si7020_MeasureTempAsync(Test_Callback) == SI7020_ERR_BUSY);
+    Test_RunUntilDone();
+    HOST_CHECK(g_bDone && (g_byStatus == SI7020_OK));
+    HOST_CHECK((g_iValue == 4567) && (g_iTemp == 2345));
+    HOST_CHECK(g_sensor.dwConversion == 1);
+    HOST_CHECK(!Si7020_IsBusy());
+
+    /* Checksum of humidity */
+    Test_Setup();
+    g_sensor.byBadCrc = 1;
+    HOST_CHECK(Si7020_MeasureAsync(Test_TemHumCallback) == SI7020_OK);
+    Test_RunUntilDone();
+    HOST_CHECK(g_bDone && (g_byStatus == SI7020_ERR_CRC));
+    HOST_CHECK(!Si7020_IsBusy());
+}
+
+static void
+Test_NackWhileConverting(void)
+{
+    uint32_t dwUs;
+
+    /* Sensor is slower than SI7020_TIME_CONV_T: read is NACKed then retried */
+    Test_Setup();
+    HOST_CHECK(Si7020_MeasureTempAsync(Test_Callback) == SI7020_OK);
+    while (g_sensor.dwConversion == 0) {
+        Host_Advance(TEST_LOOP_US);
+    }
+    Host_I2cInjectNack(2);
+
+    dwUs = Test_RunUntilDone();
+    HOST_CHECK(g_bDone && (g_byStatus == SI7020_OK) && (g_iValue == 2345));
+    HOST_CHECK(dwUs >= (SI7020_TIME_CONV_T + 2) * 1000u);
+
+    /* Never ready: given up after SI7020_READ_RETRY */
+    Test_Setup();
+    HOST_CHECK(Si7020_MeasureTempAsync(Test_Callback) == SI7020_OK);
+    while (g_sensor.dwConversion == 0) {
+        Host_Advance(TEST_LOOP_US);
+    }
+    Host_I2cInjectNack(SI7020_READ_RETRY + 1);
+    Test_RunUntilDone();
+    HOST_CHECK(g_bDone && (g_byStatus == SI7020_ERR_BUS));
+    HOST_CHECK(!Si7020_IsBusy());
+}
+
+static void
+Test_Errors(void)
+{
+    /* Command NACKed */
+    Test_Setup();
+    Host_I2cInjectNack(1);
+    HOST_CHECK(Si7020_MeasureTempAsync(Test_Callback) == SI7020_OK);
+    Test_RunUntilDone();
+    HOST_CHECK(g_bDone && (g_byStatus == SI7020_ERR_BUS));
+    HOST_CHECK(g_sensor.dwConversion == 0);
+
+    /* Checksum */
+    Test_Setup();
+    g_sensor.byBadCrc = 1;
+    HOST_CHECK(Si7020_MeasureHumiAsync(Test_Callback) == SI7020_OK);
+    Test_RunUntilDone();
+    HOST_CHECK(g_bDone && (g_byStatus == SI7020_ERR_CRC));
+
+    /* Driver is free again */
+    g_bDone = 0;
+    HOST_CHECK(Si7020_MeasureHumiAsync(Test_Callback) == SI7020_OK);
+    Test_RunUntilDone();
+    HOST_CHECK(g_bDone && (g_byStatus == SI7020_OK) && (g_iValue == 4567));
+}
+
+static void
+Test_StallBlocking(void)
+{
+    static uint8_t pbyRx[3];
+    static uint8_t byCommand = TEST_CMD_MEASURE_T_HOLD;
+    i2c_xfer_t xfer;
+    uint64_t qwStart;
+    uint32_t dwUs;
+
+    /* Reference: hold master conversion waited in the main loop, as the
+     * blocking i2c_* primitives do */
+    Test_Setup();
+    memset(&xfer, 0, sizeof(xfer));
+    xfer.byAddress = 0x40;
+    xfer.pTxData = &byCommand;
+    xfer.byTxLength = 1;
+    xfer.pRxData = pbyRx;
+    xfer.byRxLength = sizeof(pbyRx);
+    xfer.byTimeout = 20;
+
+    qwStart = Host_GetUs();
+    HOST_CHECK(I2CEngine_Submit(&xfer) == I2C_ENGINE_OK);
+    while ((xfer.byStatus == I2C_XFER_PENDING) || (xfer.byStatus == I2C_XFER_ACTIVE)) {
+        I2CEngine_CheckTimeout();
+    }
+    dwUs = (uint32_t)(Host_GetUs() - qwStart);
+    processI2CEngine();
+
+    HOST_CHECK(xfer.byStatus == I2C_XFER_DONE);
+    HOST_CHECK((((uint16_t)pbyRx[0] << 8) | pbyRx[1]) == g_sensor.wTempCode);
+    HOST_CHECK(dwUs > 10000u);
+    printf("  blocking hold master: main loop stalled %u us\n", dwUs);
+}
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+int
+main(void)
+{
+    Test_Temperature();
+    Test_Humidity();
+    Test_Combined();
+    Test_NackWhileConverting();
+    Test_Errors();
+    Test_StallBlocking();
+
+    return Host_Result("si7020");
+}
+
+/* END FILE */
@@ -0,0 +1,232 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Host test of combined measurement (Middle/sensor/
+ *              temhummeasure.c) with the simulated Si7020: one conversion
+ *              gives both values, freshness window of the cache, resolution
+ *              and conversion time. Built and run by ../run_host_tests.sh
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <string.h>
+#include "host.h"
+#include "host_i2c.h"
+#include "host_si7020.h"
+#include "timer.h"
+#include "i2cengine.h"
+#include "temhumsensor.h"
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+static host_si7020_t g_sensor;
+static temhum_stat_t g_statBase;
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+static void
+Test_Setup(void)
+{
+    Host_Reset();
+    Host_PeriphReset();
+    Host_TimerReset();
+    Host_I2cReset();
+
+    memset(&g_sensor, 0, sizeof(g_sensor));
+    g_sensor.wTempCode = Host_Si7020TempCode(2512);
+    g_sensor.wHumiCode = Host_Si7020HumiCode(6034);
+    Host_Si7020Attach(&g_sensor);
+
+    I2CEngine_Init();
+    TemHumSensor_SetMaxAge(TEMHUM_MAX_AGE_DEFAULT);
+    TemHumSensor_GetStatistic(&g_statBase);
+}
+
+/* Measure from the main loop, finished transfers are released after */
+static uint8_t
+Test_Measure(
+    temhum_value_p pValue
+) {
+    uint8_t byStatus = TemHumSensor_Measure(pValue);
+
+    processI2CEngine();
+
+    return byStatus;
+}
+
+static uint32_t
+Test_Conversion(void)
+{
+    temhum_stat_t stat;
+
+    TemHumSensor_GetStatistic(&stat);
+
+    return stat.dwConversion - g_statBase.dwConversion;
+}
+
+static uint32_t
+Test_CacheHit(void)
+{
+    temhum_stat_t stat;
+
+    TemHumSensor_GetStatistic(&stat);
+
+    return stat.dwCacheHit - g_statBase.dwCacheHit;
+}
+
+static void
+Test_Combined(void)
+{
+    temhum_value_t value;
+
+    Test_Setup();
+    HOST_CHECK(Test_Measure(&value) == TEMHUM_OK);
+    HOST_CHECK((value.iTemp == 2512) && (value.iHumi == 6034));
+
+    /* One RH conversion on sensor, temperature read back with 0xE0 */
+    HOST_CHECK(g_sensor.dwConversion == 1);
+    HOST_CHECK(Test_Conversion() == 1);
+    HOST_CHECK(value.dwTimestamp == GetMilSecTick());
+}
+
+static void
+Test_Freshness(void)
+{
+    temhum_value_t value;
+    uint32_t dwTimestamp;
+
+    Test_Setup();
+    HOST_CHECK(Test_Measure(&value) == TEMHUM_OK);
+    dwTimestamp = value.dwTimestamp;
+
+    g_sensor.wTempCode = Host_Si7020TempCode(2600);
+    HOST_CHECK(Test_Measure(&value) == TEMHUM_OK);
+    HOST_CHECK((value.iTemp == 2512) && (value.dwTimestamp == dwTimestamp));
+
+    Host_Advance((uint32_t)((dwTimestamp + TEMHUM_MAX_AGE_DEFAULT - 1) * 1000ull - Host_GetUs()));
+    HOST_CHECK(Test_Measure(&value) == TEMHUM_OK);
+    HOST_CHECK(value.iTemp == 2512);
+    HOST_CHECK((Test_Conversion() == 1) && (Test_CacheHit() == 2));
+    HOST_CHECK(g_sensor.dwConversion == 1);
+
+    /* Value as old as max age is stale */
+    Host_Advance(1000u);
+    HOST_CHECK(GetMilSecTick() - dwTimestamp == TEMHUM_MAX_AGE_DEFAULT);
+    HOST_CHECK(Test_Measure(&value) == TEMHUM_OK);
+    HOST_CHECK(value.iTemp == 2600);
+    HOST_CHECK((Test_Conversion() == 2) && (g_sensor.dwConversion == 2));
+}
+
+static void
+Test_MaxAgeZero(void)
+{
+    temhum_value_t value;
+    uint32_t dwTick;
+
+    /* Max age 0 always measures, also within the same millisecond */
+    Test_Setup();
+    TemHumSensor_SetMaxAge(0);
+    HOST_CHECK(Test_Measure(&value) == TEMHUM_OK);
+    dwTick = GetMilSecTick();
+    Host_Advance(1000u - (uint32_t)(Host_GetUs() % 1000u) - 1u);
+    HOST_CHECK(Test_Measure(&value) == TEMHUM_OK);
+    HOST_CHECK(value.dwTimestamp > dwTick);
+    HOST_CHECK((Test_Conversion() == 2) && (Test_CacheHit() == 0));
+    HOST_CHECK(g_sensor.dwConversion == 2);
+}
+
+static void
+Test_Errors(void)
+{
+    temhum_value_t value;
+    temhum_stat_t stat;
+
+    Test_Setup();
+    g_sensor.byBadCrc = 1;
+    HOST_CHECK(Test_Measure(&value) == TEMHUM_ERR_CRC);
+    TemHumSensor_GetStatistic(&stat);
+    HOST_CHECK(stat.dwError == g_statBase.dwError + 1);
+
+    /* Failed measurement is not cached */
+    HOST_CHECK(Test_Measure(&value) == TEMHUM_OK);
+    HOST_CHECK((value.iTemp == 2512) && (Test_CacheHit() == 0));
+}
+
+static void
+Test_OutsideMainLoop(void)
+{
+    temhum_value_t value;
+    uint8_t byOk = 0;
+    uint8_t i;
+
+    /* Blocking measures never reaching processI2CEngine do not fill the queue */
+    Test_Setup();
+    TemHumSensor_SetMaxAge(0);
+    for (i = 0; i < 2 * I2C_ENGINE_QUEUE_SIZE; i++) {
+        if (TemHumSensor_Measure(&value) == TEMHUM_OK) {
+            byOk++;
+        }
+    }
+    HOST_CHECK(byOk == 2 * I2C_ENGINE_QUEUE_SIZE);
+    HOST_CHECK(Test_Conversion() == 2 * I2C_ENGINE_QUEUE_SIZE);
+}
+
+static void
+Test_Resolution(void)
+{
+    temhum_value_t value;
+    uint64_t qwStart;
+    uint32_t dwUsHigh;
+    uint32_t dwUsLow;
+
+    Test_Setup();
+    TemHumSensor_SetMaxAge(0);
+    TemHumSensor_SetResolution(ADC_RES_RH12_T14);
+    HOST_CHECK(Test_Measure(&value) == TEMHUM_OK);
+    qwStart = Host_GetUs();
+    HOST_CHECK(Test_Measure(&value) == TEMHUM_OK);
+    dwUsHigh = (uint32_t)(Host_GetUs() - qwStart);
+
+    /* User register is written once, then each measure is shorter */
+    TemHumSensor_SetResolution(ADC_RES_RH08_T12);
+    HOST_CHECK(Test_Measure(&value) == TEMHUM_OK);
+    HOST_CHECK((g_sensor.byUserReg & 0x81u) == 0x01u);
+    HOST_CHECK((g_sensor.byUserReg & ~0x81u) == (HOST_SI7020_USER_REG_RESET & ~0x81u));
+    qwStart = Host_GetUs();
+    HOST_CHECK(Test_Measure(&value) == TEMHUM_OK);
+    dwUsLow = (uint32_t)(Host_GetUs() - qwStart);
+
+    HOST_CHECK(dwUsHigh > TemHumSensor_GetTimeConversion(ADC_RES_RH12_T14) * 1000u);
+    HOST_CHECK(dwUsLow < dwUsHigh / 2);
+    printf("  measure: %u us at RH12/T14, %u us at RH8/T12\n", dwUsHigh, dwUsLow);
+}
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+int
+main(void)
+{
+    Test_Combined();
+    Test_Freshness();
+    Test_MaxAgeZero();
+    Test_Errors();
+    Test_OutsideMainLoop();
+    Test_Resolution();
+
+    return Host_Result("temhummeasure");
+}
+
+/* END FILE */
@@ -0,0 +1,230 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Host test of scrolling chart of ucglib (Middle/ucglib/
+ *              Ucglib_chart.c) on the ST7735 model: every frame of random
+ *              samples against the expected chart, scrolled by the
+ *              controller when rotated 90 / 270 and moved in software
+ *              otherwise; pixels sent per sample against a full redraw.
+ *              Built and run by ../run_host_tests.sh
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <string.h>
+#include "host.h"
+#include "host_st7735.h"
+#include "Ucglib.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define TEST_SIZE                           HOST_ST7735_GLASS
+#define TEST_PIXELS                         (TEST_SIZE * TEST_SIZE)
+#define TEST_SAMPLES                        300u
+
+/* Chart of full screen height, band of 112 glass rows when rotated */
+#define TEST_CHART_X                        8
+#define TEST_CHART_W                        112
+
+/* RGB565 of chart colors and of the screen around it */
+#define TEST_COLOR_LINE                     0xFFE0u
+#define TEST_COLOR_CHART                    0x0010u
+#define TEST_COLOR_SCREEN                   0x2124u
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+static ucg_t g_ucg;
+static ucg_chart_t g_chart;
+static int16_t g_piSample[TEST_SAMPLES];
+static uint16_t g_pwExpected[TEST_PIXELS];
+static uint16_t g_pwRotated[TEST_PIXELS];
+static uint16_t g_pwScreen[TEST_PIXELS];
+static uint32_t g_dwSeed;
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+static uint32_t
+Test_Random(
+    uint32_t dwRange
+) {
+    g_dwSeed = g_dwSeed * 1103515245u + 12345u;
+
+    return (g_dwSeed >> 16) % dwRange;
+}
+
+static void
+Test_Setup(
+    uint8_t byRotation
+) {
+    Host_Reset();
+    Host_St7735Reset();
+    memset(&g_ucg, 0, sizeof(g_ucg));
+    ucg_Init(&g_ucg, ucg_dev_st7735_18x128x128, ucg_ext_st7735_18, Host_St7735Com);
+    ucg_SetRotateNative(&g_ucg, byRotation);
+
+    ucg_SetColor(&g_ucg, 0, 32, 36, 32);
+    ucg_DrawBox(&g_ucg, 0, 0, 128, 128);
+
+    ucg_chart_Init(&g_chart, TEST_CHART_X, 0, TEST_CHART_W, TEST_SIZE);
+    ucg_chart_SetRange(&g_chart, -200, 600);
+    ucg_chart_SetColor(&g_chart, 0, 255, 255, 0);
+    ucg_chart_SetColor(&g_chart, 1, 0, 0, 128);
+    ucg_chart_Begin(&g_ucg, &g_chart);
+}
+
+/* Row of a sample from top, same scale as the chart */
+static uint8_t
+Test_Row(
+    int16_t iSample
+) {
+    int32_t iValue = (iSample < -200) ? -200 : (iSample > 600) ? 600 : iSample;
+
+    return (uint8_t)(TEST_SIZE - 1 - ((iValue + 200) * (TEST_SIZE - 1)) / 800);
+}
+
+/* Logical screen after dwCount samples, newest column at right */
+static void
+Test_Expect(
+    uint32_t dwCount
+) {
+    uint32_t dwShown = (dwCount < TEST_CHART_W) ? dwCount : TEST_CHART_W;
+    uint32_t dwFirst = TEST_CHART_W - dwShown;
+    uint8_t byRow, byPrev = 0, byTop, byBottom;
+    uint32_t i, x, y;
+
+    for (y = 0; y < TEST_SIZE; y++) {
+        for (x = 0; x < TEST_SIZE; x++) {
+            g_pwExpected[y * TEST_SIZE + x] =
+                ((x >= TEST_CHART_X) && (x < TEST_CHART_X + TEST_CHART_W)) ?
+                TEST_COLOR_CHART : TEST_COLOR_SCREEN;
+        }
+    }
+
+    for (i = dwFirst; i < TEST_CHART_W; i++) {
+        byRow = Test_Row(g_piSample[dwCount - TEST_CHART_W + i]);
+        if (i == dwFirst) {
+            byPrev = byRow;
+        }
+        byTop = (byRow < byPrev) ? byRow : byPrev;
+        byBottom = (byRow < byPrev) ? byPrev : byRow;
+        for (y = byTop; y <= byBottom; y++) {
+            g_pwExpected[y * TEST_SIZE + TEST_CHART_X + i] = TEST_COLOR_LINE;
+        }
+        byPrev = byRow;
+    }
+}
+
+/* Glass shows logical screen rotated clockwise */
+static void
+Test_Rotate(
+    uint8_t byRotation
+) {
+    uint32_t x, y, dwIndex;
+
+    for (y = 0; y < TEST_SIZE; y++) {
+        for (x = 0; x < TEST_SIZE; x++) {
+            switch (byRotation) {
+            case UCG_ROTATE_90:
+                dwIndex = x * TEST_SIZE + (TEST_SIZE - 1u - y);
+                break;
+
+            case UCG_ROTATE_270:
+                dwIndex = (TEST_SIZE - 1u - x) * TEST_SIZE + y;
+                break;
+
+            default:
+                dwIndex = y * TEST_SIZE + x;
+                break;
+            }
+            g_pwRotated[dwIndex] = g_pwExpected[y * TEST_SIZE + x];
+        }
+    }
+}
+
+/* Samples added one by one, every frame checked, pixels per sample */
+static uint32_t
+Test_Run(
+    uint8_t byRotation
+) {
+    host_st7735_stat_t stat;
+    uint32_t dwFailed = 0;
+    uint32_t dwSent;
+    uint32_t i;
+
+    Test_Setup(byRotation);
+    HOST_CHECK(g_chart.byRotation == ((byRotation == UCG_ROTATE_0) ? UCG_ROTATE_0 : byRotation));
+    dwSent = g_chart.dwPixelSent;
+    Host_St7735ResetStat();
+
+    for (i = 0; i < TEST_SAMPLES; i++) {
+        ucg_chart_AddSample(&g_ucg, &g_chart, g_piSample[i]);
+        Test_Expect(i + 1u);
+        Test_Rotate(byRotation);
+        Host_St7735Snapshot(g_pwScreen);
+        dwFailed += (Host_St7735Diff(g_pwRotated, g_pwScreen) != 0);
+    }
+    HOST_CHECK(dwFailed == 0);
+
+    /* One scroll per sample when the controller scrolls */
+    Host_St7735GetStat(&stat);
+    HOST_CHECK(stat.dwScrolls == ((byRotation == UCG_ROTATE_0) ? 0u : TEST_SAMPLES));
+
+    /* Scroll stops, RAM rows of the chart are shown as they are */
+    ucg_chart_End(&g_ucg, &g_chart);
+    Host_St7735Snapshot(g_pwScreen);
+    HOST_CHECK((byRotation != UCG_ROTATE_0) || (Host_St7735Diff(g_pwRotated, g_pwScreen) == 0));
+    HOST_CHECK(Host_St7735GetPixel(0, 0) == TEST_COLOR_SCREEN);
+
+    return (g_chart.dwPixelSent - dwSent) / TEST_SAMPLES;
+}
+
+static void
+Test_Chart(void)
+{
+    uint32_t pdwPixels[3];
+    uint32_t i;
+
+    g_dwSeed = 7;
+    g_piSample[0] = 200;
+    for (i = 1; i < TEST_SAMPLES; i++) {
+        g_piSample[i] = (int16_t)(g_piSample[i - 1] + (int32_t)Test_Random(81) - 40);
+    }
+    /* Out of range: clamped to top and bottom rows */
+    g_piSample[150] = 900;
+    g_piSample[151] = -900;
+
+    pdwPixels[0] = Test_Run(UCG_ROTATE_0);
+    pdwPixels[1] = Test_Run(UCG_ROTATE_90);
+    pdwPixels[2] = Test_Run(UCG_ROTATE_270);
+
+    HOST_CHECK(pdwPixels[1] < pdwPixels[0]);
+    HOST_CHECK(pdwPixels[2] < pdwPixels[0]);
+    printf("  %u samples, pixels per sample: software %u, scroll 90 %u, scroll 270 %u, "
+           "full redraw %u\n", TEST_SAMPLES, pdwPixels[0], pdwPixels[1], pdwPixels[2],
+           (uint32_t)(TEST_CHART_W * TEST_SIZE));
+}
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+int
+main(void)
+{
+    Test_Chart();
+
+    return Host_Result("ucglib_chart");
+}
+
+/* END FILE */
@@ -0,0 +1,233 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Host test of framebuffer device of ucglib (Middle/ucglib/
+ *              Ucglib_fb.c) on the ST7735 model: screens after ucg_Flush
+ *              against golden screens drawn straight on the panel, rotated
+ *              drawing, dirty regions and bytes on the wire. Built and run
+ *              by ../run_host_tests.sh
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <string.h>
+#include "host.h"
+#include "host_st7735.h"
+#include "Ucglib.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define TEST_SIZE                           HOST_ST7735_GLASS
+#define TEST_PIXELS                         (TEST_SIZE * TEST_SIZE)
+
+/* Value field redrawn as a sensor value changes */
+#define TEST_VALUE_X                        40
+#define TEST_VALUE_Y                        60
+#define TEST_VALUE_W                        48
+#define TEST_VALUE_H                        16
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+static ucg_t g_ucg;
+static uint16_t g_pwGolden[TEST_PIXELS];
+static uint16_t g_pwRotated[TEST_PIXELS];
+static uint16_t g_pwScreen[TEST_PIXELS];
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+static void
+Test_Setup(void)
+{
+    Host_Reset();
+    Host_St7735Reset();
+    memset(&g_ucg, 0, sizeof(g_ucg));
+    ucg_Init(&g_ucg, ucg_dev_st7735_18x128x128, ucg_ext_st7735_18, Host_St7735Com);
+}
+
+/* Bytes received by the panel */
+static uint32_t
+Test_PanelBytes(void)
+{
+    host_st7735_stat_t stat;
+
+    Host_St7735GetStat(&stat);
+
+    return stat.dwCmdBytes + stat.dwDataBytes;
+}
+
+static void
+Test_Draw(
+    ucg_t *ucg
+) {
+    ucg_SetColor(ucg, 0, 20, 40, 60);
+    ucg_DrawBox(ucg, 0, 0, 128, 128);
+
+    ucg_SetColor(ucg, 0, 255, 0, 0);
+    ucg_DrawBox(ucg, 4, 4, 40, 20);
+    ucg_SetColor(ucg, 0, 0, 0, 255);
+    ucg_DrawFrame(ucg, 2, 30, 124, 40);
+    ucg_SetColor(ucg, 0, 255, 255, 0);
+    ucg_DrawDisc(ucg, 30, 50, 12, UCG_DRAW_ALL);
+    ucg_SetColor(ucg, 0, 0, 255, 255);
+    ucg_DrawRBox(ucg, 60, 36, 50, 28, 6);
+    ucg_SetColor(ucg, 0, 250, 128, 6);
+    ucg_DrawPixel(ucg, 0, 127);
+    ucg_DrawPixel(ucg, 127, 0);
+
+    ucg_SetColor(ucg, 0, 255, 0, 0);
+    ucg_SetColor(ucg, 1, 0, 255, 0);
+    ucg_SetColor(ucg, 2, 0, 0, 255);
+    ucg_SetColor(ucg, 3, 255, 255, 255);
+    ucg_DrawGradientBox(ucg, 4, 76, 60, 48);
+    ucg_DrawGradientLine(ucg, 70, 100, 50, 0);
+}
+
+/* Value field: background and a bar of the value */
+static void
+Test_DrawValue(
+    ucg_t *ucg,
+    uint8_t byValue
+) {
+    ucg_SetColor(ucg, 0, 0, 0, 0);
+    ucg_DrawBox(ucg, TEST_VALUE_X, TEST_VALUE_Y, TEST_VALUE_W, TEST_VALUE_H);
+    ucg_SetColor(ucg, 0, 0, 255, 0);
+    ucg_DrawBox(ucg, TEST_VALUE_X + 2, TEST_VALUE_Y + 4, byValue, TEST_VALUE_H - 8);
+}
+
+static void
+Test_Golden(void)
+{
+    uint32_t dwDiff;
+
+    Test_Setup();
+    Test_Draw(&g_ucg);
+    Host_St7735Snapshot(g_pwGolden);
+
+    /* Whole screen is dirty after attach, old panel content is replaced */
+    Test_Setup();
+    ucg_SetColor(&g_ucg, 0, 255, 255, 255);
+    ucg_DrawBox(&g_ucg, 0, 0, 128, 128);
+    ucg_fb_Attach(&g_ucg);
+    Test_Draw(&g_ucg);
+    HOST_CHECK(Host_St7735GetPixel(4, 4) == 0xFFFFu);
+    ucg_Flush(&g_ucg);
+    Host_St7735Snapshot(g_pwScreen);
+
+    dwDiff = Host_St7735Diff(g_pwGolden, g_pwScreen);
+    HOST_CHECK(dwDiff == 0);
+
+    /* Panel back to 18-bit: direct drawing after detach */
+    ucg_fb_Detach(&g_ucg);
+    ucg_SetColor(&g_ucg, 0, 0, 255, 0);
+    ucg_DrawPixel(&g_ucg, 64, 64);
+    HOST_CHECK(Host_St7735GetPixel(64, 64) == 0x07E0u);
+    HOST_CHECK(Host_St7735GetPixel(65, 64) == g_pwGolden[64 * TEST_SIZE + 65]);
+}
+
+static void
+Test_Rotated(void)
+{
+    uint8_t x, y;
+
+    /* Golden of ucg_SetRotate90: glass (127 - y, x) shows logical (x, y) */
+    Test_Setup();
+    Test_Draw(&g_ucg);
+    Host_St7735Snapshot(g_pwGolden);
+    for (y = 0; y < TEST_SIZE; y++) {
+        for (x = 0; x < TEST_SIZE; x++) {
+            g_pwRotated[x * TEST_SIZE + (TEST_SIZE - 1 - y)] = g_pwGolden[y * TEST_SIZE + x];
+        }
+    }
+
+    Test_Setup();
+    ucg_fb_Attach(&g_ucg);
+    ucg_SetRotate90(&g_ucg);
+    Test_Draw(&g_ucg);
+    ucg_Flush(&g_ucg);
+    Host_St7735Snapshot(g_pwScreen);
+    HOST_CHECK(Host_St7735Diff(g_pwRotated, g_pwScreen) == 0);
+}
+
+static void
+Test_DirtyRegions(void)
+{
+    host_st7735_stat_t stat;
+    uint32_t dwDirect, dwFlush;
+    uint8_t byValue;
+
+    /* Value field redrawn on the panel, one window per line */
+    Test_Setup();
+    Test_Draw(&g_ucg);
+    Host_St7735ResetStat();
+    for (byValue = 4; byValue < 44; byValue += 4) {
+        Test_DrawValue(&g_ucg, byValue);
+    }
+    dwDirect = Test_PanelBytes();
+    Host_St7735Snapshot(g_pwGolden);
+
+    /* Same in framebuffer, one window per flush */
+    Test_Setup();
+    ucg_fb_Attach(&g_ucg);
+    Test_Draw(&g_ucg);
+    ucg_Flush(&g_ucg);
+    Host_St7735ResetStat();
+    for (byValue = 4; byValue < 44; byValue += 4) {
+        Test_DrawValue(&g_ucg, byValue);
+        ucg_Flush(&g_ucg);
+    }
+    dwFlush = Test_PanelBytes();
+    Host_St7735Snapshot(g_pwScreen);
+
+    HOST_CHECK(Host_St7735Diff(g_pwGolden, g_pwScreen) == 0);
+    HOST_CHECK(dwFlush < dwDirect);
+    printf("  value field x10: direct %u bytes, framebuffer %u bytes\n", dwDirect, dwFlush);
+
+    /* Nothing drawn: nothing sent */
+    Host_St7735ResetStat();
+    ucg_Flush(&g_ucg);
+    HOST_CHECK(Test_PanelBytes() == 0);
+
+    /* Far apart: two windows; more than the list: merged, still right */
+    Host_St7735ResetStat();
+    ucg_SetColor(&g_ucg, 0, 255, 255, 255);
+    ucg_DrawPixel(&g_ucg, 1, 1);
+    ucg_DrawPixel(&g_ucg, 120, 120);
+    ucg_Flush(&g_ucg);
+    Host_St7735GetStat(&stat);
+    HOST_CHECK(stat.dwWindows == 2);
+    HOST_CHECK(stat.dwPixels == 2);
+    for (byValue = 0; byValue < 8; byValue++) {
+        ucg_DrawPixel(&g_ucg, (ucg_int_t)(byValue * 16), (ucg_int_t)(127 - byValue * 16));
+    }
+    ucg_Flush(&g_ucg);
+    for (byValue = 0; byValue < 8; byValue++) {
+        HOST_CHECK(Host_St7735GetPixel((uint8_t)(byValue * 16), (uint8_t)(127 - byValue * 16)) == 0xFFFFu);
+    }
+}
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+int
+main(void)
+{
+    Test_Golden();
+    Test_Rotated();
+    Test_DirtyRegions();
+
+    return Host_Result("ucglib_fb");
+}
+
+/* END FILE */
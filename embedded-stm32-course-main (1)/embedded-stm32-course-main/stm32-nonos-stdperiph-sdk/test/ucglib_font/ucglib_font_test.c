@@ -0,0 +1,190 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Host test of font subset tool (tools/ucg_font_subset) on
+ *              ucg_font_7x13B_tf of the prebuilt library: subset made by
+ *              ../run_host_tests.sh from ucg_font_7x13B_tf.bin (objcopy of
+ *              section .rodata.ucg_font_7x13B_tf), kept glyphs drawn the same
+ *              as the original font, flash size and host time of glyph decode
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <string.h>
+#include <time.h>
+#include "host.h"
+#include "host_st7735.h"
+#include "Ucglib.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define TEST_PIXELS                         (HOST_ST7735_GLASS * HOST_ST7735_GLASS)
+#define TEST_FONT_HEADER_SIZE               21u
+#define TEST_FONT_SIZE                      2253u   /* .rodata.ucg_font_7x13B_tf */
+#define TEST_SUBSET_GLYPHS                  17u     /* "0-9.:%C Ab" */
+#define TEST_BENCH_LOOPS                    5000u
+
+/* Status line of characters kept by the subset */
+#define TEST_STATUS                         "25.4C 61% 10:32 Ab"
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+extern const ucg_fntpgm_uint8_t ucg_font_7x13B_digits[];
+
+static ucg_t g_ucg;
+static uint16_t g_pwGolden[TEST_PIXELS];
+static uint16_t g_pwScreen[TEST_PIXELS];
+
+/* Panel device behind Test_NullDevice */
+static ucg_dev_fnptr g_pPanelCb;
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+static void
+Test_Setup(
+    const ucg_fntpgm_uint8_t *pbyFont
+) {
+    Host_Reset();
+    Host_St7735Reset();
+    memset(&g_ucg, 0, sizeof(g_ucg));
+    ucg_Init(&g_ucg, ucg_dev_st7735_18x128x128, ucg_ext_st7735_18, Host_St7735Com);
+    ucg_SetFont(&g_ucg, pbyFont);
+    ucg_SetColor(&g_ucg, 0, 255, 255, 255);
+    ucg_SetColor(&g_ucg, 1, 0, 0, 0);
+}
+
+/* Size of font data: header, glyphs, end of table */
+static uint32_t
+Test_FontSize(
+    const ucg_fntpgm_uint8_t *pbyFont
+) {
+    uint32_t dwSize = TEST_FONT_HEADER_SIZE;
+
+    while (pbyFont[dwSize + 1] != 0) {
+        dwSize += pbyFont[dwSize + 1];
+    }
+
+    return dwSize + 2u;
+}
+
+/* Drawing is dropped: CPU time of glyph lookup and decode */
+static ucg_int_t
+Test_NullDevice(
+    ucg_t *ucg,
+    ucg_int_t msg,
+    void *data
+) {
+    switch (msg) {
+    case UCG_MSG_DRAW_PIXEL:
+    case UCG_MSG_DRAW_L90FX:
+    case UCG_MSG_DRAW_L90SE:
+        return 1;
+
+    default:
+        break;
+    }
+
+    return g_pPanelCb(ucg, msg, data);
+}
+
+static void
+Test_DrawStatus(
+    ucg_t *ucg
+) {
+    ucg_DrawString(ucg, 2, 20, 0, TEST_STATUS);
+    ucg_DrawString(ucg, 2, 40, 0, "0123456789");
+    /* Font mode is read by the text task, glyph by glyph */
+    Host_UcgRunText();
+    ucg_SetFontMode(ucg, UCG_FONT_MODE_SOLID);
+    ucg_DrawString(ucg, 2, 60, 0, TEST_STATUS);
+    ucg_DrawString(ucg, 100, 100, 1, "1.5%");
+    Host_UcgRunText();
+    ucg_SetFontMode(ucg, UCG_FONT_MODE_TRANSPARENT);
+}
+
+static void
+Test_Subset(void)
+{
+    Test_Setup(ucg_font_7x13B_tf);
+    Test_DrawStatus(&g_ucg);
+    Host_St7735Snapshot(g_pwGolden);
+
+    Test_Setup(ucg_font_7x13B_digits);
+    Test_DrawStatus(&g_ucg);
+    Host_St7735Snapshot(g_pwScreen);
+
+    HOST_CHECK(Host_St7735Diff(g_pwGolden, g_pwScreen) == 0);
+    HOST_CHECK(ucg_GetStrWidth(&g_ucg, TEST_STATUS) == 18 * 7);
+
+    /* Header of original font, glyphs of the subset only */
+    HOST_CHECK(memcmp(&ucg_font_7x13B_digits[1], &ucg_font_7x13B_tf[1], 16) == 0);
+    HOST_CHECK(ucg_font_7x13B_digits[0] == TEST_SUBSET_GLYPHS);
+    HOST_CHECK(Test_FontSize(ucg_font_7x13B_tf) == TEST_FONT_SIZE);
+
+    /* Queued: nothing drawn by the call, width not known */
+    HOST_CHECK(ucg_DrawString(&g_ucg, 2, 80, 0, "xyzBK") == 0);
+    HOST_CHECK(Host_UcgTextPending() == 1);
+    Host_St7735Snapshot(g_pwScreen);
+    HOST_CHECK(Host_St7735Diff(g_pwGolden, g_pwScreen) == 0);
+
+    /* Dropped glyphs: nothing drawn by the text task either */
+    Host_UcgRunText();
+    HOST_CHECK(Host_UcgTextPending() == 0);
+    Host_St7735Snapshot(g_pwScreen);
+    HOST_CHECK(Host_St7735Diff(g_pwGolden, g_pwScreen) == 0);
+}
+
+static void
+Test_Benchmark(void)
+{
+    const ucg_fntpgm_uint8_t *ppbyFont[2] = { ucg_font_7x13B_tf, ucg_font_7x13B_digits };
+    clock_t pTime[2];
+    uint32_t i;
+    uint8_t byFont;
+
+    for (byFont = 0; byFont < 2; byFont++) {
+        Test_Setup(ppbyFont[byFont]);
+        g_pPanelCb = g_ucg.device_cb;
+        g_ucg.device_cb = Test_NullDevice;
+
+        pTime[byFont] = clock();
+        for (i = 0; i < TEST_BENCH_LOOPS; i++) {
+            ucg_DrawString(&g_ucg, 2, 20, 0, TEST_STATUS);
+            Host_UcgRunText();
+        }
+        pTime[byFont] = clock() - pTime[byFont];
+    }
+
+    HOST_CHECK(Test_FontSize(ucg_font_7x13B_digits) < TEST_FONT_SIZE / 4u);
+    printf("  flash: original %u bytes, subset %u bytes\n",
+           Test_FontSize(ucg_font_7x13B_tf), Test_FontSize(ucg_font_7x13B_digits));
+    printf("  host decode: original %.2f us/glyph, subset %.2f us/glyph\n",
+           pTime[0] * 1e6 / CLOCKS_PER_SEC / (TEST_BENCH_LOOPS * 18.0),
+           pTime[1] * 1e6 / CLOCKS_PER_SEC / (TEST_BENCH_LOOPS * 18.0));
+}
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+int
+main(void)
+{
+    Test_Subset();
+    Test_Benchmark();
+
+    return Host_Result("ucglib_font");
+}
+
+/* END FILE */
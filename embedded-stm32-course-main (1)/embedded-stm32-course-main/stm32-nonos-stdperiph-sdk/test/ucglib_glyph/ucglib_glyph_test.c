@@ -0,0 +1,289 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Host test of glyph cache of ucglib (Middle/ucglib/
+ *              Ucglib_glyph.c): cached strings against ucg_DrawString in all
+ *              directions and font modes, hit / miss / eviction counters,
+ *              glyphs too large for a slot, glyphs per second of host CPU with cold and warm cache. Built
+ *              and run by ../run_host_tests.sh
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <string.h>
+#include <time.h>
+#include "host.h"
+#include "host_st7735.h"
+#include "Ucglib.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define TEST_PIXELS                         (HOST_ST7735_GLASS * HOST_ST7735_GLASS)
+#define TEST_CACHE_ENTRIES                  24u     /* UCG_GLYPH_CACHE_ENTRIES of Ucglib_glyph.c */
+
+/* Built with UCG_GLYPH_CACHE_SLOT_SIZE 10: 'j' of 7x13B (6 x 11) does not
+ * fit a slot, all other glyphs of the tests do */
+#define TEST_LARGE_GLYPH                    'j'
+#define TEST_BENCH_LOOPS                    2000u
+
+/* Status screen line redrawn every second */
+#define TEST_STATUS                         "T 25.4C H 61.2%"
+#define TEST_STATUS_GLYPHS                  15u
+#define TEST_STATUS_DISTINCT                11u
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+static ucg_t g_ucg;
+static uint16_t g_pwGolden[TEST_PIXELS];
+static uint16_t g_pwScreen[TEST_PIXELS];
+
+/* Panel device behind Test_NullDevice */
+static ucg_dev_fnptr g_pPanelCb;
+static uint32_t g_dwLines;
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+static void
+Test_Setup(void)
+{
+    Host_Reset();
+    Host_St7735Reset();
+    memset(&g_ucg, 0, sizeof(g_ucg));
+    ucg_Init(&g_ucg, ucg_dev_st7735_18x128x128, ucg_ext_st7735_18, Host_St7735Com);
+    ucg_SetFont(&g_ucg, ucg_font_7x13B_tf);
+    ucg_glyph_Clear();
+    ucg_glyph_ResetStatistic();
+}
+
+/* Drawing is counted, not sent: CPU time of text without the panel */
+static ucg_int_t
+Test_NullDevice(
+    ucg_t *ucg,
+    ucg_int_t msg,
+    void *data
+) {
+    switch (msg) {
+    case UCG_MSG_DRAW_PIXEL:
+    case UCG_MSG_DRAW_L90FX:
+    case UCG_MSG_DRAW_L90SE:
+        g_dwLines++;
+        return 1;
+
+    default:
+        break;
+    }
+
+    return g_pPanelCb(ucg, msg, data);
+}
+
+/* Strings in all directions, drawn by pfnDraw into framebuffer */
+static void
+Test_DrawStrings(
+    ucg_t *ucg,
+    ucg_int_t (*pfnDraw)(ucg_t *, ucg_int_t, ucg_int_t, uint8_t, const char *)
+) {
+    ucg_SetColor(ucg, 0, 0, 0, 0);
+    ucg_DrawBox(ucg, 0, 0, 128, 128);
+    ucg_SetColor(ucg, 0, 255, 255, 255);
+    ucg_SetColor(ucg, 1, 0, 64, 128);
+
+    pfnDraw(ucg, 4, 4, 0, "Temp 25.4C");
+    pfnDraw(ucg, 120, 20, 1, "Hum 61%");
+    pfnDraw(ucg, 110, 120, 2, "Lux 320");
+    pfnDraw(ucg, 6, 110, 3, "gjpqy@");
+
+    /* ucg_DrawString is drawn later by the text task */
+    Host_UcgRunText();
+}
+
+static void
+Test_Screens(void)
+{
+    uint8_t byMode;
+
+    for (byMode = UCG_FONT_MODE_SOLID; byMode <= UCG_FONT_MODE_TRANSPARENT; byMode++) {
+        Test_Setup();
+        ucg_fb_Attach(&g_ucg);
+        ucg_SetFontMode(&g_ucg, byMode);
+        Test_DrawStrings(&g_ucg, ucg_DrawString);
+        ucg_Flush(&g_ucg);
+        Host_St7735Snapshot(g_pwGolden);
+
+        Test_Setup();
+        ucg_fb_Attach(&g_ucg);
+        ucg_SetFontMode(&g_ucg, byMode);
+        Test_DrawStrings(&g_ucg, ucg_DrawStringCached);
+        ucg_Flush(&g_ucg);
+        Host_St7735Snapshot(g_pwScreen);
+        HOST_CHECK(Host_St7735Diff(g_pwGolden, g_pwScreen) == 0);
+
+        /* Second time from cache only */
+        ucg_glyph_ResetStatistic();
+        Test_DrawStrings(&g_ucg, ucg_DrawStringCached);
+        ucg_Flush(&g_ucg);
+        Host_St7735Snapshot(g_pwScreen);
+        HOST_CHECK(Host_St7735Diff(g_pwGolden, g_pwScreen) == 0);
+    }
+
+    /* Width of string is the advance of ucg_DrawString */
+    HOST_CHECK(ucg_DrawStringCached(&g_ucg, 0, 60, 0, TEST_STATUS) ==
+               ucg_GetStrWidth(&g_ucg, TEST_STATUS));
+
+    /* Not in font: nothing drawn, no advance */
+    HOST_CHECK(ucg_DrawGlyphCached(&g_ucg, 0, 60, 0, 0x01) == 0);
+}
+
+static void
+Test_Statistic(void)
+{
+    ucg_glyph_stat_t stat;
+    char pText[2] = { 0, 0 };
+    uint8_t i;
+
+    Test_Setup();
+
+    /* Distinct glyphs of the line are decoded once */
+    ucg_DrawStringCached(&g_ucg, 0, 20, 0, TEST_STATUS);
+    ucg_glyph_GetStatistic(&stat);
+    HOST_CHECK(stat.dwMiss == TEST_STATUS_DISTINCT);
+    HOST_CHECK(stat.dwHit == TEST_STATUS_GLYPHS - TEST_STATUS_DISTINCT);
+    HOST_CHECK(stat.dwEvict == 0);
+
+    ucg_DrawStringCached(&g_ucg, 0, 20, 0, TEST_STATUS);
+    ucg_glyph_GetStatistic(&stat);
+    HOST_CHECK(stat.dwMiss == TEST_STATUS_DISTINCT);
+    HOST_CHECK(stat.dwHit == 2u * TEST_STATUS_GLYPHS - TEST_STATUS_DISTINCT);
+    HOST_CHECK(stat.byHitRatio == 63u);
+
+    /* More glyphs than entries: least recently used are replaced, latest kept */
+    ucg_glyph_Clear();
+    ucg_glyph_ResetStatistic();
+    for (i = 0; i < TEST_CACHE_ENTRIES + 6u; i++) {
+        pText[0] = (char)('A' + i);
+        ucg_DrawStringCached(&g_ucg, 0, 40, 0, pText);
+    }
+    ucg_glyph_GetStatistic(&stat);
+    HOST_CHECK(stat.dwMiss == TEST_CACHE_ENTRIES + 6u);
+    HOST_CHECK(stat.dwEvict == 6u);
+
+    ucg_glyph_ResetStatistic();
+    ucg_DrawStringCached(&g_ucg, 0, 40, 0, "^]");
+    ucg_DrawStringCached(&g_ucg, 0, 40, 0, "A");
+    ucg_glyph_GetStatistic(&stat);
+    HOST_CHECK(stat.dwHit == 2u);
+    HOST_CHECK(stat.dwMiss == 1u);
+
+    ucg_glyph_ResetStatistic();
+    ucg_glyph_GetStatistic(&stat);
+    HOST_CHECK((stat.dwHit == 0) && (stat.dwMiss == 0) && (stat.byHitRatio == 0));
+}
+
+static void
+Test_Bypass(void)
+{
+    ucg_glyph_stat_t stat;
+    char pText[3] = { 0, TEST_LARGE_GLYPH, 0 };
+    uint8_t i;
+
+    Test_Setup();
+
+    /* Cache full, then each cached glyph drawn next to a glyph too large */
+    for (i = 0; i < TEST_CACHE_ENTRIES; i++) {
+        pText[0] = (char)('A' + i);
+        ucg_DrawStringCached(&g_ucg, 0, 40, 0, pText);
+    }
+    ucg_glyph_GetStatistic(&stat);
+    HOST_CHECK(stat.dwMiss == 2u * TEST_CACHE_ENTRIES);
+    HOST_CHECK(stat.dwBypass == TEST_CACHE_ENTRIES);
+    HOST_CHECK(stat.dwEvict == 0);
+
+    ucg_glyph_ResetStatistic();
+    for (i = 0; i < TEST_CACHE_ENTRIES; i++) {
+        pText[0] = (char)('A' + i);
+        ucg_DrawStringCached(&g_ucg, 0, 40, 0, pText);
+    }
+    ucg_glyph_GetStatistic(&stat);
+    HOST_CHECK(stat.dwHit == TEST_CACHE_ENTRIES);
+    HOST_CHECK(stat.dwBypass == TEST_CACHE_ENTRIES);
+    HOST_CHECK(stat.dwEvict == 0);
+
+    /* Drawn by decoder with its advance */
+    HOST_CHECK(ucg_DrawStringCached(&g_ucg, 0, 60, 0, "jj") == ucg_GetStrWidth(&g_ucg, "jj"));
+}
+
+static void
+Test_Benchmark(void)
+{
+    clock_t cold, warm, decoder;
+    uint32_t dwLinesCached, dwLinesDecoder;
+    uint32_t dwGlyphs = TEST_BENCH_LOOPS * TEST_STATUS_GLYPHS;
+    uint32_t i;
+
+    Test_Setup();
+    g_pPanelCb = g_ucg.device_cb;
+    g_ucg.device_cb = Test_NullDevice;
+
+    /* Decoder: glyphs drawn by the text task, its ticks included */
+    g_dwLines = 0;
+    decoder = clock();
+    for (i = 0; i < TEST_BENCH_LOOPS; i++) {
+        ucg_DrawString(&g_ucg, 0, 20, 0, TEST_STATUS);
+        Host_UcgRunText();
+    }
+    decoder = clock() - decoder;
+    dwLinesDecoder = g_dwLines;
+
+    cold = clock();
+    for (i = 0; i < TEST_BENCH_LOOPS; i++) {
+        ucg_glyph_Clear();
+        ucg_DrawStringCached(&g_ucg, 0, 20, 0, TEST_STATUS);
+    }
+    cold = clock() - cold;
+
+    g_dwLines = 0;
+    warm = clock();
+    for (i = 0; i < TEST_BENCH_LOOPS; i++) {
+        ucg_DrawStringCached(&g_ucg, 0, 20, 0, TEST_STATUS);
+    }
+    warm = clock() - warm;
+    dwLinesCached = g_dwLines;
+
+    /* Runs of a row are merged: never more lines than the decoder */
+    HOST_CHECK(dwLinesCached <= dwLinesDecoder);
+    printf("  lines per string: decoder %u, cache %u\n",
+           dwLinesDecoder / TEST_BENCH_LOOPS, dwLinesCached / TEST_BENCH_LOOPS);
+    printf("  host glyphs/s: decoder %.0f, cold cache %.0f, warm cache %.0f\n",
+           dwGlyphs * (double)CLOCKS_PER_SEC / (decoder + 1),
+           dwGlyphs * (double)CLOCKS_PER_SEC / (cold + 1),
+           dwGlyphs * (double)CLOCKS_PER_SEC / (warm + 1));
+
+    g_ucg.device_cb = g_pPanelCb;
+}
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+int
+main(void)
+{
+    Test_Screens();
+    Test_Statistic();
+    Test_Bypass();
+    Test_Benchmark();
+
+    return Host_Result("ucglib_glyph");
+}
+
+/* END FILE */
@@ -0,0 +1,286 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Host test of RGB565 gradients of ucglib (Middle/ucglib/
+ *              Ucglib_gradient.c) on the ST7735 model: lines of every
+ *              direction and boxes, rising and falling colors, clipped at
+ *              screen edges, against ucg_DrawGradientLine / ucg_DrawGradientBox;
+ *              time on the wire and host CPU of a full screen box. Built and
+ *              run by ../run_host_tests.sh
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <string.h>
+#include <time.h>
+#include "host.h"
+#include "host_spi.h"
+#include "host_st7735.h"
+#include "Ucglib.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define TEST_PIXELS                         (HOST_ST7735_GLASS * HOST_ST7735_GLASS)
+#define TEST_BENCH_LOOPS                    200u
+
+/* RGB565 components may differ by one: 16.16 steps against ucg_ccs rounding */
+#define TEST_TOLERANCE                      1
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+static ucg_t g_ucg;
+static uint16_t g_pwGolden[TEST_PIXELS];
+static uint16_t g_pwScreen[TEST_PIXELS];
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+static void
+Test_Setup(
+    uint8_t bHwSpi
+) {
+    Host_Reset();
+    Host_PeriphReset();
+    Host_TimerReset();
+    Host_SpiReset();
+    memset(&g_ucg, 0, sizeof(g_ucg));
+    if (bHwSpi) {
+        Ucglib4WireHWSPI_begin(&g_ucg, UCG_FONT_MODE_TRANSPARENT);
+    } else {
+        ucg_Init(&g_ucg, ucg_dev_st7735_18x128x128, ucg_ext_st7735_18, Host_St7735Com);
+    }
+
+    ucg_SetColor(&g_ucg, 0, 20, 40, 60);
+    ucg_DrawBox(&g_ucg, 0, 0, 128, 128);
+}
+
+/* Corner colors: every component rises on one edge and falls on another */
+static void
+Test_SetColors(
+    ucg_t *ucg
+) {
+    ucg_SetColor(ucg, 0, 255, 0, 30);
+    ucg_SetColor(ucg, 1, 0, 255, 200);
+    ucg_SetColor(ucg, 2, 10, 128, 255);
+    ucg_SetColor(ucg, 3, 240, 20, 0);
+}
+
+/* Pixels further apart than TEST_TOLERANCE in any component */
+static uint32_t
+Test_Compare(void)
+{
+    uint32_t dwDiff = 0;
+    int32_t iRed, iGreen, iBlue;
+    uint32_t i;
+
+    for (i = 0; i < TEST_PIXELS; i++) {
+        iRed = (int32_t)(g_pwGolden[i] >> 11) - (int32_t)(g_pwScreen[i] >> 11);
+        iGreen = (int32_t)((g_pwGolden[i] >> 5) & 0x3F) - (int32_t)((g_pwScreen[i] >> 5) & 0x3F);
+        iBlue = (int32_t)(g_pwGolden[i] & 0x1F) - (int32_t)(g_pwScreen[i] & 0x1F);
+        if ((iRed > TEST_TOLERANCE) || (iRed < -TEST_TOLERANCE) ||
+            (iGreen > TEST_TOLERANCE) || (iGreen < -TEST_TOLERANCE) ||
+            (iBlue > TEST_TOLERANCE) || (iBlue < -TEST_TOLERANCE)) {
+            dwDiff++;
+        }
+    }
+
+    return dwDiff;
+}
+
+/* Lines of all directions, inside the screen and cut by its edges */
+static void
+Test_DrawLines(
+    ucg_t *ucg,
+    void (*pfnDraw)(ucg_t *, ucg_int_t, ucg_int_t, ucg_int_t, ucg_int_t)
+) {
+    Test_SetColors(ucg);
+    pfnDraw(ucg, 10, 10, 100, 0);
+    pfnDraw(ucg, 20, 12, 100, 1);
+    pfnDraw(ucg, 110, 30, 100, 2);
+    pfnDraw(ucg, 30, 120, 100, 3);
+    pfnDraw(ucg, -20, 40, 90, 0);
+    pfnDraw(ucg, 100, 50, 60, 0);
+    pfnDraw(ucg, 40, -30, 80, 1);
+    pfnDraw(ucg, 50, 140, 50, 3);
+    pfnDraw(ucg, 60, 60, 1, 0);
+}
+
+/*
+ * Colors of ucg_DrawGradientLine, pixel by pixel: lines going up of the
+ * prebuilt ST7735 device land 32 rows low, left lines wrap at column 0
+ */
+static void
+Test_GradientLine(
+    ucg_t *ucg,
+    ucg_int_t x,
+    ucg_int_t y,
+    ucg_int_t len,
+    ucg_int_t dir
+) {
+    ucg_ccs_t pCcs[3];
+    ucg_color_t start = ucg->arg.rgb[0];
+    ucg_color_t end = ucg->arg.rgb[1];
+    ucg_int_t i;
+    uint8_t j;
+
+    for (j = 0; j < 3; j++) {
+        ucg_ccs_init(&pCcs[j], start.color[j], end.color[j], len);
+    }
+
+    for (i = 0; i < len; i++) {
+        ucg_SetColor(ucg, 0, pCcs[0].current, pCcs[1].current, pCcs[2].current);
+        ucg_DrawPixel(ucg, x, y);
+        for (j = 0; j < 3; j++) {
+            ucg_ccs_step(&pCcs[j]);
+        }
+        switch (dir) {
+        case 0: x++; break;
+        case 1: y++; break;
+        case 2: x--; break;
+        default: y--; break;
+        }
+    }
+
+    ucg->arg.rgb[0] = start;
+}
+
+static void
+Test_Lines(void)
+{
+    uint8_t bHwSpi;
+
+    Test_Setup(0);
+    Test_DrawLines(&g_ucg, Test_GradientLine);
+    Host_St7735Snapshot(g_pwGolden);
+
+    for (bHwSpi = 0; bHwSpi < 2; bHwSpi++) {
+        Test_Setup(bHwSpi);
+        Test_DrawLines(&g_ucg, ucg_DrawGradientLineFast);
+        UcgHwSpi_Wait();
+        Host_St7735Snapshot(g_pwScreen);
+        HOST_CHECK(Test_Compare() == 0);
+    }
+}
+
+/* Boxes inside the screen and cut by its edges */
+static void
+Test_DrawBoxes(
+    ucg_t *ucg,
+    void (*pfnDraw)(ucg_t *, ucg_int_t, ucg_int_t, ucg_int_t, ucg_int_t)
+) {
+    /* ucg_DrawGradientBox leaves the colors of its last row in color 0 and 1 */
+    Test_SetColors(ucg);
+    pfnDraw(ucg, 10, 10, 60, 50);
+    Test_SetColors(ucg);
+    pfnDraw(ucg, -15, 70, 50, 70);
+    Test_SetColors(ucg);
+    pfnDraw(ucg, 90, -10, 60, 40);
+    Test_SetColors(ucg);
+    pfnDraw(ucg, 80, 80, 1, 30);
+}
+
+static void
+Test_Boxes(void)
+{
+    uint8_t bHwSpi;
+
+    Test_Setup(0);
+    Test_DrawBoxes(&g_ucg, ucg_DrawGradientBox);
+    Host_St7735Snapshot(g_pwGolden);
+
+    for (bHwSpi = 0; bHwSpi < 2; bHwSpi++) {
+        Test_Setup(bHwSpi);
+        Test_DrawBoxes(&g_ucg, ucg_DrawGradientBoxFast);
+        UcgHwSpi_Wait();
+        Host_St7735Snapshot(g_pwScreen);
+        HOST_CHECK(Test_Compare() == 0);
+    }
+
+    /* Corners: color 0 upper left, 1 upper right, 2 lower left, 3 lower right */
+    HOST_CHECK(Host_St7735GetPixel(10, 10) == 0xF803);
+    HOST_CHECK(Host_St7735GetPixel(69, 10) == 0x07F9);
+    HOST_CHECK(Host_St7735GetPixel(10, 59) == 0x0C1F);
+    HOST_CHECK(Host_St7735GetPixel(69, 59) == 0xF0A0);
+
+    /* Back to 18 bit color: ucglib boxes after the gradient */
+    ucg_SetColor(&g_ucg, 0, 255, 255, 255);
+    ucg_DrawBox(&g_ucg, 0, 0, 4, 4);
+    UcgHwSpi_Wait();
+    HOST_CHECK(Host_St7735GetPixel(0, 0) == 0xFFFF);
+    HOST_CHECK(Host_St7735GetPixel(4, 4) != 0xFFFF);
+}
+
+static void
+Test_Benchmark(void)
+{
+    host_spi_stat_t wireUcg, wireFast;
+    clock_t cpuUcg, cpuFast;
+    uint32_t i;
+
+    /* Time on the wire */
+    Test_Setup(1);
+    Test_SetColors(&g_ucg);
+    Host_SpiResetStat();
+    ucg_DrawGradientBox(&g_ucg, 0, 0, 128, 128);
+    UcgHwSpi_Wait();
+    Host_SpiGetStat(&wireUcg);
+
+    Test_Setup(1);
+    Test_SetColors(&g_ucg);
+    Host_SpiResetStat();
+    ucg_DrawGradientBoxFast(&g_ucg, 0, 0, 128, 128);
+    UcgHwSpi_Wait();
+    Host_SpiGetStat(&wireFast);
+
+    HOST_CHECK(wireFast.qwWireNs < wireUcg.qwWireNs);
+    HOST_CHECK(wireFast.dwBytes < wireUcg.dwBytes);
+
+    /* Host CPU, both on the reference com and panel model */
+    Test_Setup(0);
+    cpuUcg = clock();
+    for (i = 0; i < TEST_BENCH_LOOPS; i++) {
+        Test_SetColors(&g_ucg);
+        ucg_DrawGradientBox(&g_ucg, 0, 0, 128, 128);
+    }
+    cpuUcg = clock() - cpuUcg;
+
+    cpuFast = clock();
+    for (i = 0; i < TEST_BENCH_LOOPS; i++) {
+        Test_SetColors(&g_ucg);
+        ucg_DrawGradientBoxFast(&g_ucg, 0, 0, 128, 128);
+    }
+    cpuFast = clock() - cpuFast;
+
+    printf("  box 128x128: ucglib %u bytes %u us, fast %u bytes %u us on the wire\n",
+           wireUcg.dwBytes, (uint32_t)(wireUcg.qwWireNs / 1000u),
+           wireFast.dwBytes, (uint32_t)(wireFast.qwWireNs / 1000u));
+    printf("  host with panel model: ucglib %.0f us, fast %.0f us\n",
+           cpuUcg * 1e6 / CLOCKS_PER_SEC / TEST_BENCH_LOOPS,
+           cpuFast * 1e6 / CLOCKS_PER_SEC / TEST_BENCH_LOOPS);
+}
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+int
+main(void)
+{
+    Test_Lines();
+    Test_Boxes();
+    Test_Benchmark();
+
+    return Host_Result("ucglib_gradient");
+}
+
+/* END FILE */
@@ -0,0 +1,262 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Host test of ucglib com on SPI1 + DMA (Middle/ucglib/
+ *              Ucglib_hwspi.c) with the SPI and ST7735 models: same screen
+ *              as the reference com_cb, no CS/CD change under a byte,
+ *              return before the wire is done, buffers of strings and
+ *              patterns. Built and run by ../run_host_tests.sh
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <string.h>
+#include "host.h"
+#include "host_spi.h"
+#include "host_st7735.h"
+#include "Ucglib.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define TEST_PIXELS                         (HOST_ST7735_GLASS * HOST_ST7735_GLASS)
+#define TEST_BLOCK                          20u     /* Side of block of raw pixels */
+#define TEST_BLOCK_BYTES                    (TEST_BLOCK * TEST_BLOCK * 3u)
+#define TEST_RETURN_MAX_US                  50u     /* Call of a DMA transfer */
+#define TEST_HWSPI_BUFFER                   384u    /* UCG_HWSPI_BUFFER_SIZE of Ucglib_hwspi.c */
+
+#define TEST_RGB565(r, g, b)                ((uint16_t)((((r) & 0xF8u) << 8) | (((g) & 0xFCu) << 3) | ((b) >> 3)))
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+static ucg_t g_ucg;
+static uint16_t g_pwReference[TEST_PIXELS];
+static uint16_t g_pwScreen[TEST_PIXELS];
+static uint8_t g_pbyBlock[TEST_BLOCK_BYTES];
+
+/* Window of TEST_BLOCK x TEST_BLOCK at glass (8, 8), then RAMWR */
+static const ucg_pgm_uint8_t g_pbyBlockSeq[] = {
+    UCG_CS(0),
+    UCG_C11(0x36, 0x00),
+    UCG_C14(0x2A, 0x00, 8 + HOST_ST7735_GLASS_X, 0x00, 8 + HOST_ST7735_GLASS_X + TEST_BLOCK - 1),
+    UCG_C14(0x2B, 0x00, 8 + HOST_ST7735_GLASS_Y, 0x00, 8 + HOST_ST7735_GLASS_Y + TEST_BLOCK - 1),
+    UCG_C10(0x2C),
+    UCG_DATA(),
+    UCG_END()
+};
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+static void
+Test_Setup(void)
+{
+    Host_Reset();
+    Host_PeriphReset();
+    Host_TimerReset();
+    Host_SpiReset();
+    memset(&g_ucg, 0, sizeof(g_ucg));
+}
+
+/* Lines, boxes, discs and gradients, uniform and mixed colors, all dir */
+static void
+Test_Draw(
+    ucg_t *ucg
+) {
+    ucg_SetColor(ucg, 0, 0, 0, 0);
+    ucg_DrawBox(ucg, 0, 0, 128, 128);
+
+    ucg_SetColor(ucg, 0, 255, 0, 0);
+    ucg_DrawBox(ucg, 4, 4, 40, 20);
+    ucg_SetColor(ucg, 0, 128, 128, 128);
+    ucg_DrawBox(ucg, 50, 4, 70, 20);
+    ucg_SetColor(ucg, 0, 0, 0, 255);
+    ucg_DrawFrame(ucg, 2, 30, 124, 40);
+    ucg_SetColor(ucg, 0, 255, 255, 0);
+    ucg_DrawDisc(ucg, 30, 50, 12, UCG_DRAW_ALL);
+    ucg_SetColor(ucg, 0, 0, 255, 255);
+    ucg_DrawRBox(ucg, 60, 36, 50, 28, 6);
+    ucg_SetColor(ucg, 0, 17, 34, 51);
+    ucg_DrawPixel(ucg, 0, 0);
+    ucg_DrawPixel(ucg, 127, 127);
+
+    ucg_SetColor(ucg, 0, 255, 0, 0);
+    ucg_SetColor(ucg, 1, 0, 255, 0);
+    ucg_SetColor(ucg, 2, 0, 0, 255);
+    ucg_SetColor(ucg, 3, 255, 255, 255);
+    ucg_DrawGradientBox(ucg, 4, 76, 60, 48);
+
+    ucg_SetColor(ucg, 0, 200, 100, 50);
+    ucg_Draw90Line(ucg, 120, 80, 40, 1, 0);
+    ucg_Draw90Line(ucg, 110, 120, 30, 2, 0);
+    ucg_Draw90Line(ucg, 100, 124, 40, 3, 0);
+}
+
+static void
+Test_Screen(void)
+{
+    host_spi_stat_t stat;
+    uint32_t dwDiff;
+
+    /* Reference: com_cb straight to the panel */
+    Test_Setup();
+    ucg_Init(&g_ucg, ucg_dev_st7735_18x128x128, ucg_ext_st7735_18, Host_St7735Com);
+    Test_Draw(&g_ucg);
+    Host_St7735Snapshot(g_pwReference);
+    HOST_CHECK(Host_St7735GetPixel(4, 4) == TEST_RGB565(255, 0, 0));
+    HOST_CHECK(Host_St7735GetPixel(43, 23) == TEST_RGB565(255, 0, 0));
+    HOST_CHECK(Host_St7735GetPixel(44, 23) == 0);
+    HOST_CHECK(Host_St7735GetPixel(0, 0) == TEST_RGB565(17, 34, 51));
+    HOST_CHECK(Host_St7735GetPixel(127, 127) == TEST_RGB565(17, 34, 51));
+    HOST_CHECK(Host_St7735GetPixel(4, 76) == TEST_RGB565(255, 0, 0));
+
+    /* SPI + DMA */
+    Test_Setup();
+    Ucglib4WireHWSPI_begin(&g_ucg, UCG_FONT_MODE_TRANSPARENT);
+    Host_SpiResetStat();
+    Test_Draw(&g_ucg);
+    UcgHwSpi_Wait();
+    Host_St7735Snapshot(g_pwScreen);
+    Host_SpiGetStat(&stat);
+
+    dwDiff = Host_St7735Diff(g_pwReference, g_pwScreen);
+    HOST_CHECK(dwDiff == 0);
+    HOST_CHECK(stat.dwLineChange == 0);
+    HOST_CHECK(stat.dwOverrun == 0);
+    HOST_CHECK(stat.dwDmaTransfers > 0);
+    printf("  screen: %u pixels differ, %u bytes (%u by CPU, %u DMA transfers)\n",
+           dwDiff, stat.dwBytes, stat.dwCpuBytes, stat.dwDmaTransfers);
+}
+
+static void
+Test_RepeatReturnsEarly(void)
+{
+    static uint8_t pbyBlack[3] = { 0, 0, 0 };
+    static uint8_t pbyMixed[3] = { 0xF8, 0x00, 0x80 };
+    host_spi_stat_t stat;
+    uint64_t qwStart;
+    uint32_t dwCallUs, dwTotalUs;
+
+    Test_Setup();
+    Ucglib4WireHWSPI_begin(&g_ucg, UCG_FONT_MODE_TRANSPARENT);
+    ucg_SetColor(&g_ucg, 0, 255, 255, 255);
+    ucg_DrawBox(&g_ucg, 0, 0, 128, 128);
+    UcgHwSpi_Wait();
+
+    /* Block of one color: one DMA transfer from a single byte */
+    ucg_com_SendCmdSeq(&g_ucg, g_pbyBlockSeq);
+    UcgHwSpi_Wait();
+    Host_SpiResetStat();
+    qwStart = Host_GetUs();
+    ucg_com_SendRepeat3Bytes(&g_ucg, TEST_BLOCK * TEST_BLOCK, pbyBlack);
+    dwCallUs = (uint32_t)(Host_GetUs() - qwStart);
+    HOST_CHECK(UcgHwSpi_IsBusy());
+    UcgHwSpi_Wait();
+    dwTotalUs = (uint32_t)(Host_GetUs() - qwStart);
+    ucg_com_SetCSLineStatus(&g_ucg, 1);
+    Host_SpiGetStat(&stat);
+
+    HOST_CHECK(stat.dwDmaTransfers == 1);
+    HOST_CHECK(stat.dwCpuBytes == 0);
+    HOST_CHECK(dwCallUs <= TEST_RETURN_MAX_US);
+    HOST_CHECK(dwTotalUs >= stat.qwWireNs / 1000u);
+    HOST_CHECK(Host_St7735GetPixel(8, 8) == 0);
+    HOST_CHECK(Host_St7735GetPixel(8 + TEST_BLOCK - 1, 8 + TEST_BLOCK - 1) == 0);
+    HOST_CHECK(Host_St7735GetPixel(8 + TEST_BLOCK, 8) == 0xFFFFu);
+    printf("  uniform %u bytes: call %u us, wire %u us\n",
+           stat.dwBytes, dwCallUs, (uint32_t)(stat.qwWireNs / 1000u));
+
+    /* Mixed pattern: chunks of the pattern buffer */
+    ucg_com_SendCmdSeq(&g_ucg, g_pbyBlockSeq);
+    UcgHwSpi_Wait();
+    Host_SpiResetStat();
+    ucg_com_SendRepeat3Bytes(&g_ucg, TEST_BLOCK * TEST_BLOCK, pbyMixed);
+    UcgHwSpi_Wait();
+    ucg_com_SetCSLineStatus(&g_ucg, 1);
+    Host_SpiGetStat(&stat);
+
+    HOST_CHECK(stat.dwDmaTransfers == (TEST_BLOCK_BYTES + TEST_HWSPI_BUFFER - 1u) / TEST_HWSPI_BUFFER);
+    HOST_CHECK(stat.dwLineChange == 0);
+    HOST_CHECK(Host_St7735GetPixel(8, 8) == TEST_RGB565(0xF8, 0x00, 0x80));
+    HOST_CHECK(Host_St7735GetPixel(8 + TEST_BLOCK - 1, 8 + TEST_BLOCK - 1) == TEST_RGB565(0xF8, 0x00, 0x80));
+
+    /* Short pattern stays on CPU */
+    Host_SpiResetStat();
+    ucg_com_SendCmdSeq(&g_ucg, g_pbyBlockSeq);
+    ucg_com_SendRepeat2Bytes(&g_ucg, 2, pbyMixed);
+    UcgHwSpi_Wait();
+    ucg_com_SetCSLineStatus(&g_ucg, 1);
+    Host_SpiGetStat(&stat);
+    HOST_CHECK(stat.dwDmaTransfers == 0);
+    HOST_CHECK(stat.dwOverrun == 0);
+}
+
+static void
+Test_Strings(void)
+{
+    uint32_t i;
+
+    Test_Setup();
+    Ucglib4WireHWSPI_begin(&g_ucg, UCG_FONT_MODE_TRANSPARENT);
+
+    /* Longer than the buffer: on the wire before return, caller reuses it */
+    for (i = 0; i < TEST_BLOCK_BYTES; i++) {
+        g_pbyBlock[i] = (uint8_t)(i * 7u);
+    }
+    ucg_com_SendCmdSeq(&g_ucg, g_pbyBlockSeq);
+    ucg_com_SendString(&g_ucg, TEST_BLOCK_BYTES, g_pbyBlock);
+    memset(g_pbyBlock, 0xFF, sizeof(g_pbyBlock));
+    UcgHwSpi_Wait();
+    ucg_com_SetCSLineStatus(&g_ucg, 1);
+    HOST_CHECK(Host_St7735GetPixel(8, 8) == TEST_RGB565(0, 7, 14));
+    HOST_CHECK(Host_St7735GetPixel(9, 8) == TEST_RGB565(21, 28, 35));
+
+    /* Shorter: copied, caller buffer is free on return */
+    for (i = 0; i < 3u * TEST_BLOCK; i++) {
+        g_pbyBlock[i] = (uint8_t)(255u - i);
+    }
+    ucg_com_SendCmdSeq(&g_ucg, g_pbyBlockSeq);
+    ucg_com_SendString(&g_ucg, 3u * TEST_BLOCK, g_pbyBlock);
+    HOST_CHECK(UcgHwSpi_IsBusy());
+    memset(g_pbyBlock, 0, sizeof(g_pbyBlock));
+    UcgHwSpi_Wait();
+    ucg_com_SetCSLineStatus(&g_ucg, 1);
+    HOST_CHECK(Host_St7735GetPixel(8, 8) == TEST_RGB565(255, 254, 253));
+    HOST_CHECK(Host_St7735GetPixel(8 + TEST_BLOCK - 1, 8) == TEST_RGB565(198, 197, 196));
+
+    /* Caller buffer on DMA: owned until not busy */
+    for (i = 0; i < TEST_BLOCK_BYTES; i++) {
+        g_pbyBlock[i] = 0x40;
+    }
+    ucg_com_SendCmdSeq(&g_ucg, g_pbyBlockSeq);
+    UcgHwSpi_SendAsync(g_pbyBlock, TEST_BLOCK_BYTES);
+    HOST_CHECK(UcgHwSpi_IsBusy());
+    UcgHwSpi_Wait();
+    ucg_com_SetCSLineStatus(&g_ucg, 1);
+    HOST_CHECK(Host_St7735GetPixel(8 + TEST_BLOCK - 1, 8 + TEST_BLOCK - 1) == TEST_RGB565(0x40, 0x40, 0x40));
+}
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+int
+main(void)
+{
+    Test_Screen();
+    Test_RepeatReturnsEarly();
+    Test_Strings();
+
+    return Host_Result("ucglib_hwspi");
+}
+
+/* END FILE */
@@ -0,0 +1,256 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Host test of palette + run-length images (tools/
+ *              ucg_image_conv, Middle/ucglib/Ucglib_image.c): icons converted
+ *              by ../run_host_tests.sh, drawn on panel and framebuffer
+ *              against the pixels of the PPM, flash size and time on the
+ *              wire against raw RGB565
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <string.h>
+#include <time.h>
+#include "host.h"
+#include "host_spi.h"
+#include "host_st7735.h"
+#include "Ucglib.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define TEST_PIXELS                         (HOST_ST7735_GLASS * HOST_ST7735_GLASS)
+#define TEST_ICON_MAX                       32u     /* Width and height */
+#define TEST_TRANSPARENT                    0xFF00FFu
+#define TEST_BENCH_LOOPS                    2000u
+
+typedef struct {
+    const char *pPath;
+    const uint8_t *pbyImage;
+    uint32_t dwSize;                         /*< Bytes of converted image */
+    uint8_t bTransparent;                    /*< Converted with -t TEST_TRANSPARENT */
+} test_icon_t, *test_icon_p;
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+/* ucg_image_conv output */
+extern const uint8_t g_pbyThermometer[118];
+extern const uint8_t g_pbySun[725];
+
+static const test_icon_t g_pIcon[] = {
+    { "ucglib_image/thermometer.ppm", g_pbyThermometer, sizeof(g_pbyThermometer), 1 },
+    { "ucglib_image/sun.ppm", g_pbySun, sizeof(g_pbySun), 0 },
+};
+
+static ucg_t g_ucg;
+static uint16_t g_pwGolden[TEST_PIXELS];
+static uint16_t g_pwScreen[TEST_PIXELS];
+static uint8_t g_pbyPpm[TEST_ICON_MAX * TEST_ICON_MAX * 3];
+static uint32_t g_dwPpmWidth;
+static uint32_t g_dwPpmHeight;
+
+/* Panel device behind Test_NullDevice */
+static ucg_dev_fnptr g_pPanelCb;
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+static void
+Test_Setup(
+    uint8_t bHwSpi
+) {
+    Host_Reset();
+    Host_PeriphReset();
+    Host_TimerReset();
+    Host_SpiReset();
+    memset(&g_ucg, 0, sizeof(g_ucg));
+    if (bHwSpi) {
+        Ucglib4WireHWSPI_begin(&g_ucg, UCG_FONT_MODE_TRANSPARENT);
+    } else {
+        ucg_Init(&g_ucg, ucg_dev_st7735_18x128x128, ucg_ext_st7735_18, Host_St7735Com);
+    }
+
+    ucg_SetColor(&g_ucg, 0, 20, 40, 60);
+    ucg_DrawBox(&g_ucg, 0, 0, 128, 128);
+}
+
+/* Binary PPM of an icon, one comment line as written by the tests */
+static uint8_t
+Test_ReadPpm(
+    const char *pPath
+) {
+    FILE *pFile = fopen(pPath, "rb");
+    char pLine[64];
+    uint32_t dwMax = 0;
+    uint8_t bOk;
+
+    if (pFile == NULL) {
+        return 0;
+    }
+
+    bOk = (fgets(pLine, sizeof(pLine), pFile) != NULL) && (strncmp(pLine, "P6", 2) == 0) &&
+          (fgets(pLine, sizeof(pLine), pFile) != NULL) && (pLine[0] == '#') &&
+          (fscanf(pFile, "%u %u %u", &g_dwPpmWidth, &g_dwPpmHeight, &dwMax) == 3) &&
+          (fgetc(pFile) == '\n') && (dwMax == 255) &&
+          (g_dwPpmWidth <= TEST_ICON_MAX) && (g_dwPpmHeight <= TEST_ICON_MAX) &&
+          (fread(g_pbyPpm, 3, g_dwPpmWidth * g_dwPpmHeight, pFile) == g_dwPpmWidth * g_dwPpmHeight);
+    fclose(pFile);
+
+    return bOk;
+}
+
+/* Pixels of the PPM one by one, transparent color left out */
+static void
+Test_DrawPpm(
+    ucg_t *ucg,
+    ucg_int_t x,
+    ucg_int_t y,
+    uint8_t bTransparent
+) {
+    const uint8_t *pbyPixel;
+    uint32_t i, j;
+
+    for (j = 0; j < g_dwPpmHeight; j++) {
+        for (i = 0; i < g_dwPpmWidth; i++) {
+            pbyPixel = &g_pbyPpm[(j * g_dwPpmWidth + i) * 3];
+            if (bTransparent && ((((uint32_t)pbyPixel[0] << 16) | ((uint32_t)pbyPixel[1] << 8) |
+                                  pbyPixel[2]) == TEST_TRANSPARENT)) {
+                continue;
+            }
+            ucg_SetColor(ucg, 0, pbyPixel[0], pbyPixel[1], pbyPixel[2]);
+            ucg_DrawPixel(ucg, (ucg_int_t)(x + i), (ucg_int_t)(y + j));
+        }
+    }
+}
+
+/* Drawing is dropped: CPU time of decode */
+static ucg_int_t
+Test_NullDevice(
+    ucg_t *ucg,
+    ucg_int_t msg,
+    void *data
+) {
+    switch (msg) {
+    case UCG_MSG_DRAW_PIXEL:
+    case UCG_MSG_DRAW_L90FX:
+    case UCG_MSG_DRAW_L90SE:
+        return 1;
+
+    default:
+        break;
+    }
+
+    return g_pPanelCb(ucg, msg, data);
+}
+
+static void
+Test_Icons(void)
+{
+    const test_icon_t *pIcon;
+    uint8_t i;
+
+    for (i = 0; i < sizeof(g_pIcon) / sizeof(g_pIcon[0]); i++) {
+        pIcon = &g_pIcon[i];
+        HOST_CHECK(Test_ReadPpm(pIcon->pPath));
+        HOST_CHECK(ucg_GetImageWidth(pIcon->pbyImage) == (ucg_int_t)g_dwPpmWidth);
+        HOST_CHECK(ucg_GetImageHeight(pIcon->pbyImage) == (ucg_int_t)g_dwPpmHeight);
+
+        /* Inside the screen and clipped at its right / bottom edge */
+        Test_Setup(0);
+        Test_DrawPpm(&g_ucg, 10, 20, pIcon->bTransparent);
+        Test_DrawPpm(&g_ucg, 120, 110, pIcon->bTransparent);
+        Host_St7735Snapshot(g_pwGolden);
+
+        Test_Setup(0);
+        ucg_DrawImage(&g_ucg, 10, 20, pIcon->pbyImage);
+        ucg_DrawImage(&g_ucg, 120, 110, pIcon->pbyImage);
+        Host_St7735Snapshot(g_pwScreen);
+        HOST_CHECK(Host_St7735Diff(g_pwGolden, g_pwScreen) == 0);
+
+        /* Framebuffer replaces the whole screen on first flush */
+        Test_Setup(0);
+        ucg_fb_Attach(&g_ucg);
+        ucg_DrawBox(&g_ucg, 0, 0, 128, 128);
+        ucg_DrawImage(&g_ucg, 10, 20, pIcon->pbyImage);
+        ucg_DrawImage(&g_ucg, 120, 110, pIcon->pbyImage);
+        ucg_Flush(&g_ucg);
+        Host_St7735Snapshot(g_pwScreen);
+        HOST_CHECK(Host_St7735Diff(g_pwGolden, g_pwScreen) == 0);
+    }
+}
+
+static void
+Test_Benchmark(void)
+{
+    host_spi_stat_t image, raw;
+    const uint8_t *pbyImage;
+    clock_t decode;
+    uint32_t dwRaw;
+    uint32_t j;
+    uint8_t i;
+
+    for (i = 0; i < sizeof(g_pIcon) / sizeof(g_pIcon[0]); i++) {
+        pbyImage = g_pIcon[i].pbyImage;
+        dwRaw = (uint32_t)(ucg_GetImageWidth(pbyImage) * ucg_GetImageHeight(pbyImage) * 2);
+        HOST_CHECK(g_pIcon[i].dwSize < dwRaw);
+
+        /* Lines of the image */
+        Test_Setup(1);
+        Host_SpiResetStat();
+        ucg_DrawImage(&g_ucg, 10, 20, pbyImage);
+        UcgHwSpi_Wait();
+        Host_SpiGetStat(&image);
+
+        /* Raw RGB565: one window of the icon, as flushed by framebuffer */
+        Test_Setup(1);
+        ucg_fb_Attach(&g_ucg);
+        ucg_Flush(&g_ucg);
+        UcgHwSpi_Wait();
+        Host_SpiResetStat();
+        ucg_DrawImage(&g_ucg, 10, 20, pbyImage);
+        ucg_Flush(&g_ucg);
+        UcgHwSpi_Wait();
+        Host_SpiGetStat(&raw);
+        ucg_fb_Detach(&g_ucg);
+
+        g_pPanelCb = g_ucg.device_cb;
+        g_ucg.device_cb = Test_NullDevice;
+        decode = clock();
+        for (j = 0; j < TEST_BENCH_LOOPS; j++) {
+            ucg_DrawImage(&g_ucg, 10, 20, pbyImage);
+        }
+        decode = clock() - decode;
+        g_ucg.device_cb = g_pPanelCb;
+
+        printf("  %s: flash %u bytes (raw %u), wire %u us (raw window %u us), "
+               "host decode %.1f us\n",
+               g_pIcon[i].pPath, g_pIcon[i].dwSize, dwRaw,
+               (uint32_t)(image.qwWireNs / 1000u), (uint32_t)(raw.qwWireNs / 1000u),
+               decode * 1e6 / CLOCKS_PER_SEC / TEST_BENCH_LOOPS);
+    }
+}
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+int
+main(void)
+{
+    Test_Icons();
+    Test_Benchmark();
+
+    return Host_Result("ucglib_image");
+}
+
+/* END FILE */
@@ -0,0 +1,246 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Host test of rotation by MADCTL of ucglib (Middle/ucglib/
+ *              Ucglib_rotate.c) on the ST7735 model: rotated screens against
+ *              the unrotated screen rotated in software, rotated text and
+ *              boxes through the software rotate chain and by MADCTL over
+ *              SPI + DMA, host CPU time of both. Built and run by
+ *              ../run_host_tests.sh
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <string.h>
+#include <time.h>
+#include "host.h"
+#include "host_spi.h"
+#include "host_st7735.h"
+#include "Ucglib.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define TEST_SIZE                           HOST_ST7735_GLASS
+#define TEST_PIXELS                         (TEST_SIZE * TEST_SIZE)
+#define TEST_TEXT_LINES                     6u
+#define TEST_BENCH_LOOPS                    50u
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+static ucg_t g_ucg;
+static uint16_t g_pwGolden[TEST_PIXELS];
+static uint16_t g_pwRotated[TEST_PIXELS];
+static uint16_t g_pwScreen[TEST_PIXELS];
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+static void
+Test_Setup(void)
+{
+    Host_Reset();
+    Host_PeriphReset();
+    Host_TimerReset();
+    Host_SpiReset();
+    memset(&g_ucg, 0, sizeof(g_ucg));
+}
+
+/* Lines of dir 0 / 1 only: dir 2 / 3 of the panel device are off glass */
+static void
+Test_Draw(
+    ucg_t *ucg
+) {
+    ucg_SetColor(ucg, 0, 20, 40, 60);
+    ucg_DrawBox(ucg, 0, 0, 128, 128);
+
+    ucg_SetColor(ucg, 0, 255, 0, 0);
+    ucg_DrawBox(ucg, 4, 4, 40, 20);
+    ucg_SetColor(ucg, 0, 0, 0, 255);
+    ucg_DrawFrame(ucg, 2, 30, 124, 40);
+    ucg_SetColor(ucg, 0, 0, 255, 255);
+    ucg_DrawRBox(ucg, 60, 36, 50, 28, 6);
+    ucg_SetColor(ucg, 0, 250, 128, 6);
+    ucg_DrawPixel(ucg, 0, 127);
+    ucg_DrawPixel(ucg, 127, 0);
+    ucg_DrawPixel(ucg, 127, 127);
+
+    ucg_SetColor(ucg, 0, 255, 0, 0);
+    ucg_SetColor(ucg, 1, 0, 255, 0);
+    ucg_SetColor(ucg, 2, 0, 0, 255);
+    ucg_SetColor(ucg, 3, 255, 255, 255);
+    ucg_DrawGradientBox(ucg, 4, 76, 60, 48);
+    ucg_DrawGradientLine(ucg, 70, 100, 50, 0);
+    ucg_DrawGradientLine(ucg, 126, 70, 50, 1);
+
+    ucg_SetFont(ucg, ucg_font_7x13B_tf);
+    ucg_SetColor(ucg, 0, 255, 255, 255);
+    ucg_DrawString(ucg, 8, 20, 0, "25.4C");
+    Host_UcgRunText();
+}
+
+/* Text and boxes of a rotated status screen */
+static void
+Test_DrawText(
+    ucg_t *ucg
+) {
+    uint8_t i;
+
+    ucg_SetColor(ucg, 0, 0, 0, 0);
+    ucg_DrawBox(ucg, 0, 0, 128, 128);
+    ucg_SetFont(ucg, ucg_font_7x13B_tf);
+
+    for (i = 0; i < TEST_TEXT_LINES; i++) {
+        ucg_SetColor(ucg, 0, 0, 64, 128);
+        ucg_DrawBox(ucg, 2, (ucg_int_t)(i * 20 + 4), 124, 16);
+        ucg_SetColor(ucg, 0, 255, 255, 255);
+        ucg_DrawString(ucg, 6, (ucg_int_t)(i * 20 + 16), 0, "Temp 25.4C");
+        Host_UcgRunText();
+    }
+}
+
+/* Glass (x', y') of rotation shows logical (x, y), clockwise */
+static void
+Test_Rotate(
+    uint8_t byRotation
+) {
+    uint8_t x, y;
+    uint32_t dwIndex;
+
+    for (y = 0; y < TEST_SIZE; y++) {
+        for (x = 0; x < TEST_SIZE; x++) {
+            switch (byRotation) {
+            case UCG_ROTATE_90:
+                dwIndex = x * TEST_SIZE + (TEST_SIZE - 1u - y);
+                break;
+
+            case UCG_ROTATE_180:
+                dwIndex = (TEST_SIZE - 1u - y) * TEST_SIZE + (TEST_SIZE - 1u - x);
+                break;
+
+            case UCG_ROTATE_270:
+                dwIndex = (TEST_SIZE - 1u - x) * TEST_SIZE + y;
+                break;
+
+            default:
+                dwIndex = y * TEST_SIZE + x;
+                break;
+            }
+            g_pwRotated[dwIndex] = g_pwGolden[y * TEST_SIZE + x];
+        }
+    }
+}
+
+static void
+Test_Native(void)
+{
+    uint8_t byRotation;
+
+    Test_Setup();
+    ucg_Init(&g_ucg, ucg_dev_st7735_18x128x128, ucg_ext_st7735_18, Host_St7735Com);
+    Test_Draw(&g_ucg);
+    Host_St7735Snapshot(g_pwGolden);
+
+    for (byRotation = UCG_ROTATE_0; byRotation <= UCG_ROTATE_270; byRotation++) {
+        Test_Setup();
+        ucg_Init(&g_ucg, ucg_dev_st7735_18x128x128, ucg_ext_st7735_18, Host_St7735Com);
+        ucg_SetRotateNative(&g_ucg, byRotation);
+        HOST_CHECK(ucg_GetRotateNative(&g_ucg) == byRotation);
+        Test_Draw(&g_ucg);
+        Host_St7735Snapshot(g_pwScreen);
+        Test_Rotate(byRotation);
+        HOST_CHECK(Host_St7735Diff(g_pwRotated, g_pwScreen) == 0);
+    }
+
+    /* Back to panel device, unrotated */
+    ucg_SetRotateNative(&g_ucg, UCG_ROTATE_0);
+    HOST_CHECK(g_ucg.device_cb == ucg_dev_st7735_18x128x128);
+    Test_Draw(&g_ucg);
+    Host_St7735Snapshot(g_pwScreen);
+    HOST_CHECK(Host_St7735Diff(g_pwGolden, g_pwScreen) == 0);
+}
+
+static void
+Test_Benchmark(void)
+{
+    host_spi_stat_t soft, native;
+    clock_t cpuSoft, cpuNative;
+    uint32_t i;
+
+    /* Software rotate chain */
+    Test_Setup();
+    Ucglib4WireHWSPI_begin(&g_ucg, UCG_FONT_MODE_TRANSPARENT);
+    ucg_SetRotate90(&g_ucg);
+    Host_SpiResetStat();
+    Test_DrawText(&g_ucg);
+    UcgHwSpi_Wait();
+    Host_SpiGetStat(&soft);
+    Host_St7735Snapshot(g_pwGolden);
+
+    /* MADCTL */
+    Test_Setup();
+    Ucglib4WireHWSPI_begin(&g_ucg, UCG_FONT_MODE_TRANSPARENT);
+    ucg_SetRotateNative(&g_ucg, UCG_ROTATE_90);
+    Host_SpiResetStat();
+    Test_DrawText(&g_ucg);
+    UcgHwSpi_Wait();
+    Host_SpiGetStat(&native);
+    Host_St7735Snapshot(g_pwScreen);
+
+    /* Same windows on the wire, the chain only adds a transform per
+     * message on the CPU */
+    HOST_CHECK(Host_St7735Diff(g_pwGolden, g_pwScreen) == 0);
+    HOST_CHECK(native.dwBytes <= soft.dwBytes);
+    HOST_CHECK(native.dwOverrun == 0);
+
+    /* Host CPU, both on the reference com and panel model */
+    Test_Setup();
+    ucg_Init(&g_ucg, ucg_dev_st7735_18x128x128, ucg_ext_st7735_18, Host_St7735Com);
+    ucg_SetRotate90(&g_ucg);
+    cpuSoft = clock();
+    for (i = 0; i < TEST_BENCH_LOOPS; i++) {
+        Test_DrawText(&g_ucg);
+    }
+    cpuSoft = clock() - cpuSoft;
+
+    Test_Setup();
+    ucg_Init(&g_ucg, ucg_dev_st7735_18x128x128, ucg_ext_st7735_18, Host_St7735Com);
+    ucg_SetRotateNative(&g_ucg, UCG_ROTATE_90);
+    cpuNative = clock();
+    for (i = 0; i < TEST_BENCH_LOOPS; i++) {
+        Test_DrawText(&g_ucg);
+    }
+    cpuNative = clock() - cpuNative;
+
+    printf("  rotated text x%u: chain %u bytes %u us, MADCTL %u bytes %u us\n",
+           TEST_TEXT_LINES,
+           soft.dwBytes, (uint32_t)(soft.qwWireNs / 1000u),
+           native.dwBytes, (uint32_t)(native.qwWireNs / 1000u));
+    printf("  host with panel model: chain %.0f us, MADCTL %.0f us\n",
+           cpuSoft * 1e6 / CLOCKS_PER_SEC / TEST_BENCH_LOOPS,
+           cpuNative * 1e6 / CLOCKS_PER_SEC / TEST_BENCH_LOOPS);
+}
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+int
+main(void)
+{
+    Test_Native();
+    Test_Benchmark();
+
+    return Host_Result("ucglib_rotate");
+}
+
+/* END FILE */
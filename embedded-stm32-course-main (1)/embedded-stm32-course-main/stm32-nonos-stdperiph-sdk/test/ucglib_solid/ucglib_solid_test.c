@@ -0,0 +1,201 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Host test of solid strings of ucglib (ucg_DrawStringSolid of
+ *              Middle/ucglib/Ucglib_glyph.c) on the ST7735 model: string box
+ *              against ucg_DrawString in solid font mode, fallbacks, command
+ *              bytes and wire time of a long string. Built and run by
+ *              ../run_host_tests.sh
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <string.h>
+#include "host.h"
+#include "host_spi.h"
+#include "host_st7735.h"
+#include "Ucglib.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define TEST_PIXELS                         (HOST_ST7735_GLASS * HOST_ST7735_GLASS)
+
+/* Longest line of 7 pixel glyphs on 128 columns */
+#define TEST_TEXT                           "T 25.4C H 61% 320L"
+#define TEST_TEXT_X                         1
+#define TEST_TEXT_Y                         40
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+static ucg_t g_ucg;
+static uint16_t g_pwGolden[TEST_PIXELS];
+static uint16_t g_pwScreen[TEST_PIXELS];
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+static void
+Test_Setup(
+    uint8_t bHwSpi
+) {
+    Host_Reset();
+    Host_PeriphReset();
+    Host_TimerReset();
+    Host_SpiReset();
+    memset(&g_ucg, 0, sizeof(g_ucg));
+    if (bHwSpi) {
+        Ucglib4WireHWSPI_begin(&g_ucg, UCG_FONT_MODE_SOLID);
+    } else {
+        ucg_Init(&g_ucg, ucg_dev_st7735_18x128x128, ucg_ext_st7735_18, Host_St7735Com);
+        ucg_SetFontMode(&g_ucg, UCG_FONT_MODE_SOLID);
+    }
+    ucg_SetFont(&g_ucg, ucg_font_7x13B_tf);
+    ucg_glyph_Clear();
+
+    ucg_SetColor(&g_ucg, 0, 20, 40, 60);
+    ucg_DrawBox(&g_ucg, 0, 0, 128, 128);
+    ucg_SetColor(&g_ucg, 0, 255, 255, 255);
+    ucg_SetColor(&g_ucg, 1, 0, 64, 128);
+}
+
+/* Box of solid string: font height, background where glyphs are not */
+static void
+Test_DrawGolden(
+    ucg_t *ucg,
+    ucg_int_t x,
+    ucg_int_t y,
+    const char *str
+) {
+    ucg_int_t iHeight = ucg->font_info.max_char_height;
+
+    ucg_SetColor(ucg, 0, 0, 64, 128);
+    ucg_DrawBox(ucg, x, y - (iHeight + ucg->font_info.y_offset),
+                ucg_GetStrWidth(ucg, str), iHeight);
+    ucg_SetColor(ucg, 0, 255, 255, 255);
+    ucg_DrawString(ucg, x, y, 0, str);
+    Host_UcgRunText();
+}
+
+static void
+Test_Screen(void)
+{
+    ucg_int_t iWidth;
+
+    Test_Setup(0);
+    Test_DrawGolden(&g_ucg, TEST_TEXT_X, TEST_TEXT_Y, TEST_TEXT);
+    Test_DrawGolden(&g_ucg, 30, 100, "gjpq");
+    Host_St7735Snapshot(g_pwGolden);
+
+    Test_Setup(0);
+    iWidth = ucg_DrawStringSolid(&g_ucg, TEST_TEXT_X, TEST_TEXT_Y, TEST_TEXT);
+    ucg_DrawStringSolid(&g_ucg, 30, 100, "gjpq");
+    Host_St7735Snapshot(g_pwScreen);
+
+    HOST_CHECK(Host_St7735Diff(g_pwGolden, g_pwScreen) == 0);
+    HOST_CHECK(iWidth == ucg_GetStrWidth(&g_ucg, TEST_TEXT));
+
+    /* Same over SPI + DMA */
+    Test_Setup(1);
+    ucg_DrawStringSolid(&g_ucg, TEST_TEXT_X, TEST_TEXT_Y, TEST_TEXT);
+    ucg_DrawStringSolid(&g_ucg, 30, 100, "gjpq");
+    UcgHwSpi_Wait();
+    Host_St7735Snapshot(g_pwScreen);
+    HOST_CHECK(Host_St7735Diff(g_pwGolden, g_pwScreen) == 0);
+}
+
+static void
+Test_Fallback(void)
+{
+    /* Transparent: glyph by glyph, background kept */
+    Test_Setup(0);
+    ucg_SetFontMode(&g_ucg, UCG_FONT_MODE_TRANSPARENT);
+    ucg_DrawString(&g_ucg, 10, 20, 0, "Lux");
+    Host_UcgRunText();
+    Host_St7735Snapshot(g_pwGolden);
+
+    Test_Setup(0);
+    ucg_SetFontMode(&g_ucg, UCG_FONT_MODE_TRANSPARENT);
+    ucg_DrawStringSolid(&g_ucg, 10, 20, "Lux");
+    Host_St7735Snapshot(g_pwScreen);
+    HOST_CHECK(Host_St7735Diff(g_pwGolden, g_pwScreen) == 0);
+
+    /* Box out of clip box: glyph by glyph, clipped */
+    Test_Setup(0);
+    ucg_DrawString(&g_ucg, 110, 20, 0, "Hum");
+    Host_UcgRunText();
+    Host_St7735Snapshot(g_pwGolden);
+
+    Test_Setup(0);
+    ucg_DrawStringSolid(&g_ucg, 110, 20, "Hum");
+    Host_St7735Snapshot(g_pwScreen);
+    HOST_CHECK(Host_St7735Diff(g_pwGolden, g_pwScreen) == 0);
+}
+
+static void
+Test_Benchmark(void)
+{
+    host_st7735_stat_t glyph, solid;
+    host_spi_stat_t wireGlyph, wireSolid;
+
+    /* Command bytes on the panel */
+    Test_Setup(0);
+    Host_St7735ResetStat();
+    ucg_DrawString(&g_ucg, TEST_TEXT_X, TEST_TEXT_Y, 0, TEST_TEXT);
+    Host_UcgRunText();
+    Host_St7735GetStat(&glyph);
+
+    Test_Setup(0);
+    Host_St7735ResetStat();
+    ucg_DrawStringSolid(&g_ucg, TEST_TEXT_X, TEST_TEXT_Y, TEST_TEXT);
+    Host_St7735GetStat(&solid);
+
+    HOST_CHECK(solid.dwWindows == 1);
+    HOST_CHECK(solid.dwCmdBytes < glyph.dwCmdBytes);
+
+    /* Time on the wire */
+    Test_Setup(1);
+    Host_SpiResetStat();
+    ucg_DrawString(&g_ucg, TEST_TEXT_X, TEST_TEXT_Y, 0, TEST_TEXT);
+    Host_UcgRunText();
+    UcgHwSpi_Wait();
+    Host_SpiGetStat(&wireGlyph);
+
+    Test_Setup(1);
+    Host_SpiResetStat();
+    ucg_DrawStringSolid(&g_ucg, TEST_TEXT_X, TEST_TEXT_Y, TEST_TEXT);
+    UcgHwSpi_Wait();
+    Host_SpiGetStat(&wireSolid);
+
+    HOST_CHECK(wireSolid.qwWireNs < wireGlyph.qwWireNs);
+    printf("  %u characters: glyphs %u command bytes %u windows %u us, "
+           "solid %u command bytes %u windows %u us\n",
+           (uint32_t)strlen(TEST_TEXT),
+           glyph.dwCmdBytes, glyph.dwWindows, (uint32_t)(wireGlyph.qwWireNs / 1000u),
+           solid.dwCmdBytes, solid.dwWindows, (uint32_t)(wireSolid.qwWireNs / 1000u));
+}
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+int
+main(void)
+{
+    Test_Screen();
+    Test_Fallback();
+    Test_Benchmark();
+
+    return Host_Result("ucglib_solid");
+}
+
+/* END FILE */
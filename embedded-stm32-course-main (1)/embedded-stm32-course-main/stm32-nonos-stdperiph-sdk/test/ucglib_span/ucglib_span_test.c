@@ -0,0 +1,280 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Host test of span rasterisers of ucglib (Middle/ucglib/
+ *              Ucglib_span.c): pixels of discs and rounded boxes against
+ *              ucg_DrawDisc / ucg_DrawRBox on a canvas device, every radius
+ *              and quarter, clipped at screen edges; lines, time on the wire
+ *              and primitives per second on the ST7735 model. Built and run
+ *              by ../run_host_tests.sh
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <string.h>
+#include "host.h"
+#include "host_spi.h"
+#include "host_st7735.h"
+#include "Ucglib.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define TEST_SIZE                           HOST_ST7735_GLASS
+#define TEST_PIXELS                         (TEST_SIZE * TEST_SIZE)
+#define TEST_RADIUS_MAX                     127     /* UCG_SPAN_RADIUS_MAX of Ucglib_span.c */
+#define TEST_BENCH_COUNT                    20u
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+static ucg_t g_ucg;
+
+/* Canvas of Test_CanvasDevice: number of times each pixel is drawn */
+static uint8_t g_pbyCanvas[TEST_PIXELS];
+static uint8_t g_pbyGolden[TEST_PIXELS];
+static uint32_t g_dwLines;
+static ucg_dev_fnptr g_pPanelCb;
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+static void
+Test_Setup(
+    uint8_t bHwSpi
+) {
+    Host_Reset();
+    Host_PeriphReset();
+    Host_TimerReset();
+    Host_SpiReset();
+    memset(&g_ucg, 0, sizeof(g_ucg));
+    if (bHwSpi) {
+        Ucglib4WireHWSPI_begin(&g_ucg, UCG_FONT_MODE_TRANSPARENT);
+    } else {
+        ucg_Init(&g_ucg, ucg_dev_st7735_18x128x128, ucg_ext_st7735_18, Host_St7735Com);
+    }
+    ucg_SetColor(&g_ucg, 0, 255, 255, 0);
+}
+
+/* Clipped lines of any direction painted on canvas, other messages to panel */
+static ucg_int_t
+Test_CanvasDevice(
+    ucg_t *ucg,
+    ucg_int_t msg,
+    void *data
+) {
+    ucg_int_t x, y, i;
+
+    switch (msg) {
+    case UCG_MSG_DRAW_PIXEL:
+        ucg->arg.len = 1;
+        ucg->arg.dir = 0;
+        /* fall through */
+
+    case UCG_MSG_DRAW_L90FX:
+        if (ucg_clip_l90fx(ucg) != 0) {
+            x = ucg->arg.pixel.pos.x;
+            y = ucg->arg.pixel.pos.y;
+            for (i = 0; i < ucg->arg.len; i++) {
+                g_pbyCanvas[y * TEST_SIZE + x]++;
+                switch (ucg->arg.dir) {
+                case 0: x++; break;
+                case 1: y++; break;
+                case 2: x--; break;
+                default: y--; break;
+                }
+            }
+        }
+        g_dwLines++;
+        return 1;
+
+    default:
+        break;
+    }
+
+    return g_pPanelCb(ucg, msg, data);
+}
+
+static void
+Test_Canvas(void)
+{
+    Test_Setup(0);
+    g_pPanelCb = g_ucg.device_cb;
+    g_ucg.device_cb = Test_CanvasDevice;
+}
+
+/* Same set of pixels, a pixel may be drawn more than once by ucglib */
+static uint8_t
+Test_SamePixels(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < TEST_PIXELS; i++) {
+        if ((g_pbyCanvas[i] != 0) != (g_pbyGolden[i] != 0)) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+static void
+Test_Disc(
+    ucg_int_t x0,
+    ucg_int_t y0,
+    ucg_int_t rad,
+    uint8_t option,
+    uint32_t *pdwLines,
+    uint32_t *pdwSpanLines
+) {
+    memset(g_pbyCanvas, 0, sizeof(g_pbyCanvas));
+    g_dwLines = 0;
+    ucg_DrawDisc(&g_ucg, x0, y0, rad, option);
+    memcpy(g_pbyGolden, g_pbyCanvas, sizeof(g_pbyGolden));
+    *pdwLines += g_dwLines;
+
+    memset(g_pbyCanvas, 0, sizeof(g_pbyCanvas));
+    g_dwLines = 0;
+    ucg_DrawDiscSpan(&g_ucg, x0, y0, rad, option);
+    *pdwSpanLines += g_dwLines;
+}
+
+static void
+Test_RBox(
+    ucg_int_t x,
+    ucg_int_t y,
+    ucg_int_t w,
+    ucg_int_t h,
+    ucg_int_t r
+) {
+    memset(g_pbyCanvas, 0, sizeof(g_pbyCanvas));
+    ucg_DrawRBox(&g_ucg, x, y, w, h, r);
+    memcpy(g_pbyGolden, g_pbyCanvas, sizeof(g_pbyGolden));
+
+    memset(g_pbyCanvas, 0, sizeof(g_pbyCanvas));
+    ucg_DrawRBoxSpan(&g_ucg, x, y, w, h, r);
+}
+
+static void
+Test_Discs(void)
+{
+    uint32_t dwLines = 0, dwSpanLines = 0;
+    uint32_t dwFailed = 0;
+    ucg_int_t rad;
+    uint8_t option;
+
+    Test_Canvas();
+
+    /* Every radius and quarter, center of screen */
+    for (rad = 0; rad <= TEST_RADIUS_MAX; rad++) {
+        for (option = 1; option <= UCG_DRAW_ALL; option++) {
+            Test_Disc(64, 64, rad, option, &dwLines, &dwSpanLines);
+            dwFailed += !Test_SamePixels();
+        }
+    }
+    HOST_CHECK(dwFailed == 0);
+
+    /* At most one line per row, ucglib one per column and quarter */
+    HOST_CHECK(dwSpanLines < dwLines);
+    printf("  discs r 0-%d x 15 quarters: ucglib %u lines, span %u lines\n",
+           TEST_RADIUS_MAX, dwLines, dwSpanLines);
+
+    /* Clipped at edges, off screen */
+    dwFailed = 0;
+    Test_Disc(0, 0, 20, UCG_DRAW_ALL, &dwLines, &dwSpanLines);
+    dwFailed += !Test_SamePixels();
+    Test_Disc(127, 100, 40, UCG_DRAW_ALL, &dwLines, &dwSpanLines);
+    dwFailed += !Test_SamePixels();
+    Test_Disc(-10, 64, 12, UCG_DRAW_ALL, &dwLines, &dwSpanLines);
+    dwFailed += !Test_SamePixels();
+    Test_Disc(64, 200, 20, UCG_DRAW_ALL, &dwLines, &dwSpanLines);
+    dwFailed += !Test_SamePixels();
+    HOST_CHECK(dwFailed == 0);
+
+    /* Off screen: rejected once, no line */
+    dwSpanLines = 0;
+    Test_Disc(64, 200, 20, UCG_DRAW_ALL, &dwLines, &dwSpanLines);
+    HOST_CHECK(dwSpanLines == 0);
+}
+
+static void
+Test_RBoxes(void)
+{
+    uint32_t dwFailed = 0;
+    ucg_int_t w, h, r;
+
+    Test_Canvas();
+
+    for (w = 1; w <= 40; w++) {
+        for (h = 1; h <= 40; h += 3) {
+            for (r = 0; r <= 12; r++) {
+                Test_RBox(10, 20, w, h, r);
+                dwFailed += !Test_SamePixels();
+            }
+        }
+    }
+    HOST_CHECK(dwFailed == 0);
+
+    /* Clipped at edges */
+    dwFailed = 0;
+    Test_RBox(-5, -5, 30, 20, 6);
+    dwFailed += !Test_SamePixels();
+    Test_RBox(100, 110, 40, 30, 8);
+    dwFailed += !Test_SamePixels();
+    HOST_CHECK(dwFailed == 0);
+}
+
+static void
+Test_Benchmark(void)
+{
+    host_spi_stat_t stat;
+    uint32_t pdwUs[4];
+    uint8_t i, j;
+
+    for (i = 0; i < 4; i++) {
+        Test_Setup(1);
+        Host_SpiResetStat();
+        for (j = 0; j < TEST_BENCH_COUNT; j++) {
+            switch (i) {
+            case 0: ucg_DrawDisc(&g_ucg, 64, 64, 30, UCG_DRAW_ALL); break;
+            case 1: ucg_DrawDiscSpan(&g_ucg, 64, 64, 30, UCG_DRAW_ALL); break;
+            case 2: ucg_DrawRBox(&g_ucg, 10, 40, 108, 40, 8); break;
+            default: ucg_DrawRBoxSpan(&g_ucg, 10, 40, 108, 40, 8); break;
+            }
+        }
+        UcgHwSpi_Wait();
+        Host_SpiGetStat(&stat);
+        pdwUs[i] = (uint32_t)(stat.qwWireNs / 1000u / TEST_BENCH_COUNT);
+    }
+
+    HOST_CHECK(pdwUs[1] < pdwUs[0]);
+    HOST_CHECK(pdwUs[3] < pdwUs[2]);
+    printf("  disc r 30: ucglib %u us (%u/s), span %u us (%u/s)\n",
+           pdwUs[0], 1000000u / pdwUs[0], pdwUs[1], 1000000u / pdwUs[1]);
+    printf("  rbox 108x40 r 8: ucglib %u us (%u/s), span %u us (%u/s)\n",
+           pdwUs[2], 1000000u / pdwUs[2], pdwUs[3], 1000000u / pdwUs[3]);
+}
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+int
+main(void)
+{
+    Test_Discs();
+    Test_RBoxes();
+    Test_Benchmark();
+
+    return Host_Result("ucglib_span");
+}
+
+/* END FILE */
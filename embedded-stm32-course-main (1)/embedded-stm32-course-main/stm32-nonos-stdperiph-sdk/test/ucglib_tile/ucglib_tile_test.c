@@ -0,0 +1,174 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Host test of strip renderer of ucglib (Middle/ucglib/
+ *              Ucglib_tile.c) on the ST7735 model: frame against the golden
+ *              screen drawn straight on the panel, through the reference
+ *              com_cb and through SPI + DMA ping-pong, render and transfer
+ *              time per frame. Built and run by ../run_host_tests.sh
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <string.h>
+#include "host.h"
+#include "host_spi.h"
+#include "host_st7735.h"
+#include "Ucglib.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define TEST_PIXELS                         (HOST_ST7735_GLASS * HOST_ST7735_GLASS)
+#define TEST_STRIPS                         8u      /* 128 rows of 16 */
+#define TEST_FRAME_BYTES                    (TEST_PIXELS * 2u)
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+static ucg_t g_ucg;
+static uint16_t g_pwGolden[TEST_PIXELS];
+static uint16_t g_pwScreen[TEST_PIXELS];
+static uint8_t g_byDrawCount;
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+static void
+Test_Setup(void)
+{
+    Host_Reset();
+    Host_PeriphReset();
+    Host_TimerReset();
+    Host_SpiReset();
+    memset(&g_ucg, 0, sizeof(g_ucg));
+    g_byDrawCount = 0;
+}
+
+/* Frame of ucg_tile_Render, lines across strip borders */
+static void
+Test_Draw(
+    ucg_t *ucg,
+    void *data
+) {
+    (void)data;
+
+    g_byDrawCount++;
+
+    ucg_SetColor(ucg, 0, 10, 20, 30);
+    ucg_DrawBox(ucg, 0, 0, 128, 128);
+    ucg_SetColor(ucg, 0, 255, 0, 0);
+    ucg_DrawBox(ucg, 4, 10, 40, 30);
+    ucg_SetColor(ucg, 0, 0, 0, 255);
+    ucg_DrawFrame(ucg, 2, 30, 124, 40);
+    ucg_SetColor(ucg, 0, 255, 255, 0);
+    ucg_DrawDisc(ucg, 64, 64, 30, UCG_DRAW_ALL);
+    ucg_SetColor(ucg, 0, 0, 255, 255);
+    ucg_DrawRBox(ucg, 70, 90, 50, 30, 6);
+    ucg_SetColor(ucg, 0, 255, 255, 255);
+    ucg_DrawPixel(ucg, 0, 0);
+    ucg_DrawPixel(ucg, 127, 127);
+    /* Panel device wraps lines of dir 2 reaching columns 0 - 1 */
+    ucg_Draw90Line(ucg, 127, 100, 120, 2, 0);
+
+    ucg_SetColor(ucg, 0, 255, 0, 0);
+    ucg_SetColor(ucg, 1, 0, 255, 0);
+    ucg_SetColor(ucg, 2, 0, 0, 255);
+    ucg_SetColor(ucg, 3, 255, 255, 255);
+    ucg_DrawGradientBox(ucg, 4, 76, 60, 48);
+    ucg_DrawGradientLine(ucg, 110, 0, 128, 1);
+}
+
+static void
+Test_Golden(void)
+{
+    Test_Setup();
+    ucg_Init(&g_ucg, ucg_dev_st7735_18x128x128, ucg_ext_st7735_18, Host_St7735Com);
+    Test_Draw(&g_ucg, NULL);
+    Host_St7735Snapshot(g_pwGolden);
+}
+
+static void
+Test_Reference(void)
+{
+    ucg_box_t clip;
+
+    Test_Golden();
+
+    Test_Setup();
+    ucg_Init(&g_ucg, ucg_dev_st7735_18x128x128, ucg_ext_st7735_18, Host_St7735Com);
+    ucg_tile_Attach(&g_ucg);
+    clip = g_ucg.clip_box;
+    ucg_tile_Render(&g_ucg, Test_Draw, NULL);
+    Host_St7735Snapshot(g_pwScreen);
+
+    HOST_CHECK(g_byDrawCount == TEST_STRIPS);
+    HOST_CHECK(Host_St7735Diff(g_pwGolden, g_pwScreen) == 0);
+    HOST_CHECK(memcmp(&clip, &g_ucg.clip_box, sizeof(clip)) == 0);
+
+    /* Outside of ucg_tile_Render nothing is drawn */
+    ucg_SetColor(&g_ucg, 0, 255, 255, 255);
+    ucg_DrawBox(&g_ucg, 0, 0, 8, 8);
+    HOST_CHECK(Host_St7735GetPixel(4, 4) == g_pwGolden[4 * HOST_ST7735_GLASS + 4]);
+
+    /* Panel back to 18-bit after a frame */
+    ucg_tile_Detach(&g_ucg);
+    ucg_DrawPixel(&g_ucg, 4, 4);
+    HOST_CHECK(Host_St7735GetPixel(4, 4) == 0xFFFFu);
+}
+
+static void
+Test_PingPong(void)
+{
+    host_spi_stat_t stat;
+    uint16_t wRenderMs, wFrameMs;
+    uint32_t dwWireMs;
+
+    Test_Golden();
+
+    Test_Setup();
+    Ucglib4WireHWSPI_begin(&g_ucg, UCG_FONT_MODE_TRANSPARENT);
+    ucg_tile_Attach(&g_ucg);
+    Host_SpiResetStat();
+    ucg_tile_Render(&g_ucg, Test_Draw, NULL);
+    UcgHwSpi_Wait();
+    Host_St7735Snapshot(g_pwScreen);
+    Host_SpiGetStat(&stat);
+    ucg_tile_GetFrameTime(&wRenderMs, &wFrameMs);
+    dwWireMs = (uint32_t)(stat.qwWireNs / 1000000u);
+
+    HOST_CHECK(Host_St7735Diff(g_pwGolden, g_pwScreen) == 0);
+    HOST_CHECK(stat.dwDmaTransfers == TEST_STRIPS);
+    HOST_CHECK(stat.dwBytes >= TEST_FRAME_BYTES);
+    HOST_CHECK(stat.dwLineChange == 0);
+    HOST_CHECK(stat.dwOverrun == 0);
+
+    /* Strips rendered while the previous one is on the wire: frame takes
+     * the wire time, render time of the model CPU is not simulated */
+    HOST_CHECK(wFrameMs <= dwWireMs + 1u);
+    printf("  frame: render %u ms, render + transfer %u ms, wire %u ms (%u bytes)\n",
+           wRenderMs, wFrameMs, dwWireMs, stat.dwBytes);
+}
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+int
+main(void)
+{
+    Test_Reference();
+    Test_PingPong();
+
+    return Host_Result("ucglib_tile");
+}
+
+/* END FILE */
@@ -0,0 +1,249 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Host test of the com message recorder of ucglib (Middle/
+ *              ucglib/Ucglib_trace.c) on the ST7735 model: a screen drawn
+ *              in UCG_TRACE sections is dumped, replayed by tools/
+ *              ucg_trace_replay and its PPM and section report compared
+ *              with the model and ucg_trace_GetSection. Built with a trace
+ *              of 64 KB and run by ../run_host_tests.sh, the tool is next
+ *              to the test
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <stdlib.h>
+#include <string.h>
+#include "host.h"
+#include "host_st7735.h"
+#include "Ucglib.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define TEST_SIZE                           HOST_ST7735_GLASS
+#define TEST_PIXELS                         (TEST_SIZE * TEST_SIZE)
+#define TEST_PATH_MAX                       512u
+#define TEST_LINE_MAX                       256u
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+static ucg_t g_ucg;
+static uint16_t g_pwScreen[TEST_PIXELS];
+static uint16_t g_pwReplay[TEST_PIXELS];
+static uint8_t g_pbyPpm[TEST_PIXELS * 3];
+static FILE *g_pFile;
+
+/* Files next to the test: tool, trace, screen and report of the tool */
+static char g_pTool[TEST_PATH_MAX];
+static char g_pTrace[TEST_PATH_MAX];
+static char g_pPpm[TEST_PATH_MAX];
+static char g_pReport[TEST_PATH_MAX];
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+static void
+Test_Setup(void)
+{
+    Host_Reset();
+    Host_PeriphReset();
+    Host_TimerReset();
+    Host_St7735Reset();
+    memset(&g_ucg, 0, sizeof(g_ucg));
+    ucg_Init(&g_ucg, ucg_dev_st7735_18x128x128, ucg_ext_st7735_18, Host_St7735Com);
+    ucg_SetFont(&g_ucg, ucg_font_7x13B_tf);
+    ucg_glyph_Clear();
+}
+
+static void
+Test_Paths(
+    const char *pArgv0
+) {
+    const char *pSlash = strrchr(pArgv0, '/');
+    int iDir = (pSlash != NULL) ? (int)(pSlash - pArgv0) : 1;
+    const char *pDir = (pSlash != NULL) ? pArgv0 : ".";
+
+    snprintf(g_pTool, sizeof(g_pTool), "%.*s/ucg_trace_replay", iDir, pDir);
+    snprintf(g_pTrace, sizeof(g_pTrace), "%.*s/ucglib_trace.txt", iDir, pDir);
+    snprintf(g_pPpm, sizeof(g_pPpm), "%.*s/ucglib_trace.ppm", iDir, pDir);
+    snprintf(g_pReport, sizeof(g_pReport), "%.*s/ucglib_trace.report", iDir, pDir);
+}
+
+static void
+Test_Write(
+    const char *pText
+) {
+    fputs(pText, g_pFile);
+}
+
+/* Status screen in sections, text of the timer task and a rotated part */
+static void
+Test_Draw(
+    ucg_t *ucg
+) {
+    ucg_SetColor(ucg, 0, 20, 40, 60);
+    UCG_TRACE("clear", ucg_DrawBox(ucg, 0, 0, 128, 128));
+
+    ucg_SetColor(ucg, 0, 255, 0, 0);
+    ucg_SetColor(ucg, 1, 0, 255, 0);
+    ucg_SetColor(ucg, 2, 0, 0, 255);
+    ucg_SetColor(ucg, 3, 255, 255, 255);
+    UCG_TRACE("gradient", ucg_DrawGradientBox(ucg, 4, 76, 60, 48));
+
+    ucg_SetColor(ucg, 0, 0, 255, 255);
+    UCG_TRACE("rbox", ucg_DrawRBox(ucg, 70, 80, 50, 28, 6));
+    UCG_TRACE("disc", ucg_DrawDisc(ucg, 96, 60, 10, UCG_DRAW_ALL));
+
+    ucg_SetColor(ucg, 0, 255, 255, 255);
+    ucg_SetColor(ucg, 1, 0, 64, 128);
+    UCG_TRACE("text", ucg_DrawStringCached(ucg, 2, 4, 0, "25.4C"));
+    UCG_TRACE("text", ucg_DrawStringCached(ucg, 2, 20, 0, "61%"));
+
+    /* Drawn later by the text task: messages of section "other" */
+    UCG_TRACE("string", ucg_DrawString(ucg, 60, 4, 0, "Lux"));
+    Host_UcgRunText();
+
+    /* MADCTL changes the mapping of the next windows only */
+    ucg_SetRotateNative(ucg, UCG_ROTATE_90);
+    ucg_SetColor(ucg, 0, 250, 128, 6);
+    UCG_TRACE("rotated", ucg_DrawBox(ucg, 0, 0, 16, 8));
+    ucg_SetRotateNative(ucg, UCG_ROTATE_0);
+    UCG_TRACE("pixel", ucg_DrawPixel(ucg, 127, 127));
+}
+
+/* Binary PPM of the tool as RGB565 snapshot */
+static uint8_t
+Test_ReadPpm(
+    uint16_t *pwScreen
+) {
+    FILE *pFile = fopen(g_pPpm, "rb");
+    int iWidth = 0, iHeight = 0, iMax = 0;
+    uint8_t bOk;
+    uint32_t i;
+
+    if (pFile == NULL) {
+        return 0;
+    }
+
+    bOk = (fscanf(pFile, "P6 %d %d %d", &iWidth, &iHeight, &iMax) == 3) &&
+          (fgetc(pFile) == '\n') && (iWidth == TEST_SIZE) && (iHeight == TEST_SIZE) &&
+          (fread(g_pbyPpm, 1, sizeof(g_pbyPpm), pFile) == sizeof(g_pbyPpm));
+    fclose(pFile);
+
+    for (i = 0; bOk && (i < TEST_PIXELS); i++) {
+        pwScreen[i] = (uint16_t)(((g_pbyPpm[i * 3] & 0xF8u) << 8) |
+                                 ((g_pbyPpm[i * 3 + 1] & 0xFCu) << 3) |
+                                 (g_pbyPpm[i * 3 + 2] >> 3));
+    }
+
+    return bOk;
+}
+
+/* Sections of the report against the recorder, in the same order */
+static uint32_t
+Test_ReadReport(void)
+{
+    FILE *pFile = fopen(g_pReport, "r");
+    char pLine[TEST_LINE_MAX];
+    char pName[TEST_LINE_MAX];
+    ucg_trace_section_t section;
+    unsigned int dwCount, dwCmd, dwData, dwCs, dwUs;
+    uint32_t dwMatched = 0;
+    uint8_t byIndex = 0;
+
+    if (pFile == NULL) {
+        return 0;
+    }
+
+    /* Header line, then one line a section */
+    if (fgets(pLine, sizeof(pLine), pFile) == NULL) {
+        fclose(pFile);
+        return 0;
+    }
+
+    while ((fgets(pLine, sizeof(pLine), pFile) != NULL) &&
+           (sscanf(pLine, "%255s %u %u %u %u %u", pName, &dwCount, &dwCmd, &dwData, &dwCs, &dwUs) == 6)) {
+        if (!ucg_trace_GetSection(byIndex++, &section)) {
+            break;
+        }
+        HOST_CHECK(strcmp(pName, section.pName) == 0);
+        HOST_CHECK((dwCount == section.dwCount) && (dwCmd == section.dwCmdBytes) &&
+                   (dwData == section.dwDataBytes) && (dwCs == section.dwCsToggles) &&
+                   (dwUs == section.dwMicroSec));
+        dwMatched++;
+    }
+    fclose(pFile);
+
+    return dwMatched;
+}
+
+static void
+Test_RoundTrip(void)
+{
+    ucg_trace_section_t section;
+    char pCommand[TEST_PATH_MAX * 4 + 32];
+    char pLine[TEST_LINE_MAX];
+    uint8_t bySections = 0;
+
+    Test_Setup();
+    ucg_trace_Attach(&g_ucg);
+    Test_Draw(&g_ucg);
+    ucg_trace_Detach(&g_ucg);
+    Host_St7735Snapshot(g_pwScreen);
+
+    while (ucg_trace_GetSection(bySections, &section)) {
+        bySections++;
+    }
+    HOST_CHECK(bySections == 9);
+
+    g_pFile = fopen(g_pTrace, "w");
+    HOST_CHECK(g_pFile != NULL);
+    if (g_pFile == NULL) {
+        return;
+    }
+    ucg_trace_Dump(Test_Write);
+    fclose(g_pFile);
+
+    /* Whole screen in trace */
+    g_pFile = fopen(g_pTrace, "r");
+    HOST_CHECK((fgets(pLine, sizeof(pLine), g_pFile) != NULL) && (strcmp(pLine, "# ucg trace\n") == 0));
+    fclose(g_pFile);
+
+    snprintf(pCommand, sizeof(pCommand), "\"%s\" \"%s\" \"%s\" %u > \"%s\"",
+             g_pTool, g_pTrace, g_pPpm, UCG_TRACE_SPI_HZ, g_pReport);
+    HOST_CHECK(system(pCommand) == 0);
+
+    /* Same glass and same counters */
+    HOST_CHECK(Test_ReadPpm(g_pwReplay));
+    HOST_CHECK(Host_St7735Diff(g_pwScreen, g_pwReplay) == 0);
+    HOST_CHECK(Test_ReadReport() == bySections);
+}
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+int
+main(
+    int argc,
+    char **argv
+) {
+    (void)argc;
+
+    Test_Paths(argv[0]);
+    Test_RoundTrip();
+
+    return Host_Result("ucglib_trace");
+}
+
+/* END FILE */
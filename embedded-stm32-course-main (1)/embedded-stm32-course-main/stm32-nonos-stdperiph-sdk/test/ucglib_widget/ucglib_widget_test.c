@@ -0,0 +1,292 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Host test of retained widgets of ucglib (Middle/ucglib/
+ *              Ucglib_widget.c): a minute of sensor updates (600 at 100 ms)
+ *              replayed on label, values, bar, icon and sparkline, each
+ *              incremental frame against a full redraw of the same widgets;
+ *              text of values at the limits of the format; pixels sent
+ *              against naive full redraw. Built and run by
+ *              ../run_host_tests.sh
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <string.h>
+#include "host.h"
+#include "host_st7735.h"
+#include "Ucglib.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define TEST_SIZE                           HOST_ST7735_GLASS
+#define TEST_PIXELS                         (TEST_SIZE * TEST_SIZE)
+#define TEST_UPDATES                        600u    /* One minute, every 100 ms */
+#define TEST_SAMPLE_PERIOD                  5u      /* Updates between sparkline samples */
+#define TEST_LABEL_PERIOD                   150u    /* Updates between label changes */
+
+#define TEST_LABEL                          0
+#define TEST_TEMPERATURE                    1
+#define TEST_HUMIDITY                       2
+#define TEST_BAR                            3
+#define TEST_ICON                           4
+#define TEST_SPARKLINE                      5
+#define TEST_WIDGETS                        6
+
+/* Screen of a ucg: RGB565 of each pixel */
+typedef struct {
+    ucg_t ucg;
+    ucg_widget_t pWidget[TEST_WIDGETS];
+    uint16_t pwCanvas[TEST_PIXELS];
+} test_screen_t, *test_screen_p;
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+/* ucg_image_conv output */
+extern const uint8_t g_pbyThermometer[118];
+extern const uint8_t g_pbySun[725];
+
+static const char *g_ppLabel[] = { "Living room", "Bedroom", "Living room 2", "Kitchen" };
+
+/* Incremental draws, full redraw of the same widgets */
+static test_screen_t g_screen;
+static test_screen_t g_full;
+static ucg_dev_fnptr g_pPanelCb;
+static uint32_t g_dwOther;
+static uint32_t g_dwSeed;
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+/* Lines and pixels painted on canvas of the screen, other messages to panel */
+static ucg_int_t
+Test_CanvasDevice(
+    ucg_t *ucg,
+    ucg_int_t msg,
+    void *data
+) {
+    test_screen_p pScreen = (ucg == &g_screen.ucg) ? &g_screen : &g_full;
+    uint8_t *pbyColor = ucg->arg.pixel.rgb.color;
+    uint16_t wColor;
+    ucg_int_t x, y, i;
+
+    switch (msg) {
+    case UCG_MSG_DRAW_PIXEL:
+        ucg->arg.len = 1;
+        ucg->arg.dir = 0;
+        /* fall through */
+
+    case UCG_MSG_DRAW_L90FX:
+        if (ucg_clip_l90fx(ucg) != 0) {
+            wColor = (uint16_t)(((pbyColor[0] & 0xF8) << 8) | ((pbyColor[1] & 0xFC) << 3) |
+                                (pbyColor[2] >> 3));
+            x = ucg->arg.pixel.pos.x;
+            y = ucg->arg.pixel.pos.y;
+            for (i = 0; i < ucg->arg.len; i++) {
+                pScreen->pwCanvas[y * TEST_SIZE + x] = wColor;
+                switch (ucg->arg.dir) {
+                case 0: x++; break;
+                case 1: y++; break;
+                case 2: x--; break;
+                default: y--; break;
+                }
+            }
+        }
+        return 1;
+
+    case UCG_MSG_DRAW_L90SE:
+        g_dwOther++;
+        return 1;
+
+    default:
+        break;
+    }
+
+    return g_pPanelCb(ucg, msg, data);
+}
+
+static uint32_t
+Test_Random(
+    uint32_t dwRange
+) {
+    g_dwSeed = g_dwSeed * 1103515245u + 12345u;
+
+    return (g_dwSeed >> 16) % dwRange;
+}
+
+static void
+Test_InitScreen(
+    test_screen_p pScreen
+) {
+    ucg_widget_p pWidget = pScreen->pWidget;
+    uint8_t i;
+
+    memset(pScreen, 0, sizeof(test_screen_t));
+    ucg_Init(&pScreen->ucg, ucg_dev_st7735_18x128x128, ucg_ext_st7735_18, Host_St7735Com);
+    g_pPanelCb = pScreen->ucg.device_cb;
+    pScreen->ucg.device_cb = Test_CanvasDevice;
+
+    ucg_widget_Init(&pWidget[TEST_LABEL], UCG_WIDGET_LABEL, 2, 2, 124, 14);
+    ucg_widget_Init(&pWidget[TEST_TEMPERATURE], UCG_WIDGET_VALUE, 2, 20, 60, 14);
+    ucg_widget_Init(&pWidget[TEST_HUMIDITY], UCG_WIDGET_VALUE, 66, 20, 60, 14);
+    ucg_widget_Init(&pWidget[TEST_BAR], UCG_WIDGET_BAR, 2, 38, 124, 10);
+    ucg_widget_Init(&pWidget[TEST_ICON], UCG_WIDGET_ICON, 2, 54, 32, 32);
+    ucg_widget_Init(&pWidget[TEST_SPARKLINE], UCG_WIDGET_SPARKLINE, 40, 54, 86, 32);
+
+    for (i = 0; i < TEST_WIDGETS; i++) {
+        ucg_widget_SetFont(&pWidget[i], ucg_font_7x13B_tf);
+        ucg_widget_SetColor(&pWidget[i], 1, 0, 32, 64);
+    }
+    ucg_widget_SetColor(&pWidget[TEST_BAR], 0, 0, 200, 255);
+    ucg_widget_SetColor(&pWidget[TEST_SPARKLINE], 0, 255, 160, 0);
+    ucg_widget_SetFormat(&pWidget[TEST_TEMPERATURE], 1, "C");
+    ucg_widget_SetFormat(&pWidget[TEST_HUMIDITY], 0, "%");
+    ucg_widget_SetRange(&pWidget[TEST_SPARKLINE], 150, 400);
+    ucg_widget_SetText(&pWidget[TEST_LABEL], g_ppLabel[0]);
+}
+
+/* Same update on both screens */
+static void
+Test_Update(
+    uint32_t dwTick,
+    int32_t iTemperature,
+    int32_t iHumidity
+) {
+    test_screen_p ppScreen[2] = { &g_screen, &g_full };
+    ucg_widget_p pWidget;
+    uint8_t i;
+
+    for (i = 0; i < 2; i++) {
+        pWidget = ppScreen[i]->pWidget;
+        if ((dwTick % TEST_LABEL_PERIOD) == 0) {
+            ucg_widget_SetText(&pWidget[TEST_LABEL],
+                               g_ppLabel[(dwTick / TEST_LABEL_PERIOD) % 4u]);
+        }
+        ucg_widget_SetValue(&pWidget[TEST_TEMPERATURE], iTemperature);
+        ucg_widget_SetValue(&pWidget[TEST_HUMIDITY], iHumidity);
+        ucg_widget_SetValue(&pWidget[TEST_BAR], iHumidity);
+        ucg_widget_SetImage(&pWidget[TEST_ICON],
+                            (iTemperature >= 280) ? g_pbySun : g_pbyThermometer);
+        if ((dwTick % TEST_SAMPLE_PERIOD) == 0) {
+            ucg_widget_AddSample(&pWidget[TEST_SPARKLINE], (int16_t)iTemperature);
+        }
+    }
+}
+
+/* Redraw of every widget from a cleared screen */
+static void
+Test_DrawFull(void)
+{
+    uint8_t i;
+
+    memset(g_full.pwCanvas, 0, sizeof(g_full.pwCanvas));
+    for (i = 0; i < TEST_WIDGETS; i++) {
+        ucg_widget_Invalidate(&g_full.pWidget[i]);
+    }
+    ucg_widget_DrawAll(&g_full.ucg, g_full.pWidget, TEST_WIDGETS);
+}
+
+static void
+Test_Replay(void)
+{
+    ucg_widget_stat_t stat;
+    uint32_t dwSent = 0, dwFull = 0, dwRedraw = 0;
+    int32_t iTemperature = 260;
+    int32_t iHumidity = 55;
+    uint32_t dwFailed = 0;
+    uint32_t dwTick;
+
+    Host_Reset();
+    Host_St7735Reset();
+    ucg_glyph_Clear();
+    g_dwSeed = 1;
+    g_dwOther = 0;
+    Test_InitScreen(&g_screen);
+    Test_InitScreen(&g_full);
+    ucg_widget_DrawAll(&g_screen.ucg, g_screen.pWidget, TEST_WIDGETS);
+
+    for (dwTick = 1; dwTick <= TEST_UPDATES; dwTick++) {
+        /* Random walk of SI7020 readings: 0.1 C and 1 % */
+        iTemperature += (int32_t)Test_Random(5) - 2;
+        iTemperature = (iTemperature < 150) ? 150 : (iTemperature > 400) ? 400 : iTemperature;
+        iHumidity += (int32_t)Test_Random(3) - 1;
+        iHumidity = (iHumidity < 0) ? 0 : (iHumidity > 100) ? 100 : iHumidity;
+        Test_Update(dwTick, iTemperature, iHumidity);
+
+        ucg_widget_ResetStatistic();
+        ucg_widget_DrawAll(&g_screen.ucg, g_screen.pWidget, TEST_WIDGETS);
+        ucg_widget_GetStatistic(&stat);
+        dwSent += stat.dwPixelSent;
+        dwFull += stat.dwPixelFull;
+        dwRedraw += stat.dwRedraw;
+
+        Test_DrawFull();
+        dwFailed += (memcmp(g_screen.pwCanvas, g_full.pwCanvas, sizeof(g_full.pwCanvas)) != 0);
+    }
+
+    HOST_CHECK(dwFailed == 0);
+    HOST_CHECK(g_dwOther == 0);
+    HOST_CHECK(dwSent < dwFull);
+    printf("  %u updates, %u widget redraws: %u pixels sent, naive full redraw %u (%u%%)\n",
+           TEST_UPDATES, dwRedraw, dwSent, dwFull, dwSent * 100u / dwFull);
+}
+
+static void
+Test_Format(void)
+{
+    ucg_widget_t widget;
+    const char *pText = widget.u.text.pText;
+
+    ucg_widget_Init(&widget, UCG_WIDGET_VALUE, 0, 0, 128, 14);
+
+    ucg_widget_SetFormat(&widget, 1, "C");
+    ucg_widget_SetValue(&widget, -5);
+    HOST_CHECK(strcmp(pText, "-0.5C") == 0);
+    ucg_widget_SetValue(&widget, 0);
+    HOST_CHECK(strcmp(pText, "0.0C") == 0);
+
+    /* Decimals are limited to 9: digits of 32 bits and a leading 0 */
+    ucg_widget_SetFormat(&widget, 255, NULL);
+    HOST_CHECK(widget.u.text.byDecimals == UCG_WIDGET_DECIMALS_MAX);
+    ucg_widget_SetValue(&widget, 5);
+    HOST_CHECK(strcmp(pText, "0.000000005") == 0);
+    ucg_widget_SetValue(&widget, INT32_MIN);
+    HOST_CHECK(strcmp(pText, "-2.147483648") == 0);
+
+    ucg_widget_SetFormat(&widget, 0, NULL);
+    ucg_widget_SetValue(&widget, INT32_MIN);
+    HOST_CHECK(strcmp(pText, "-2147483648") == 0);
+
+    /* Unit is cut to the 20 characters of the text */
+    ucg_widget_SetFormat(&widget, 2, "abcdefghijklmnopqrstuvwxyz");
+    ucg_widget_SetValue(&widget, 1234);
+    HOST_CHECK(strcmp(pText, "12.34abcdefghijklmno") == 0);
+    ucg_widget_SetValue(&widget, INT32_MIN);
+    HOST_CHECK(strcmp(pText, "-21474836.48abcdefgh") == 0);
+    HOST_CHECK(strlen(pText) == UCG_WIDGET_TEXT_SIZE - 1);
+}
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+int
+main(void)
+{
+    Test_Format();
+    Test_Replay();
+
+    return Host_Result("ucglib_widget");
+}
+
+/* END FILE */
@@ -0,0 +1,556 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Host tool, compile a RTTTL melody into compact melody played
+ *              by BuzzerPlayer_PlayCompact (Middle/buzzer/buzzerplayer.c)
+ *
+ *                gcc -o buzzer_rtttl buzzer_rtttl.c -lm
+ *                ./buzzer_rtttl elise.txt g_pbyMelodyElise [-w elise.wav]
+ *                    > melody_elise.c
+ *
+ *              -w: render PWM of buzzer as WAV, with timer values and note
+ *                  lengths of the player, to check pitch and timing
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define TEXT_SIZE_MAX                       8192u
+#define NOTE_MAX                            2048u
+
+/* Same as buzzerplayer.h / buzzerplayer.c */
+#define HEADER_SIZE                         8u
+#define DURATION_NEXT                       3u
+#define DURATION_DOTTED                     0x08u
+#define DURATION_CODES                      16u
+#define NOTE_COUNT                          96u     /* C1 - B8 */
+#define NOTE_RANGE                          63u
+#define NOTE_REST                           0xFFu
+#define TIM_HZ                              84000000u
+#define NOTE_TIM_HZ                         10000u
+#define NOTE_TICK_MAX                       0xFFFFu
+
+#define WAV_RATE                            44100u
+
+typedef struct {
+    uint8_t byNote;                         /* Semitones above C1, or NOTE_REST */
+    uint8_t byDuration;                     /* Code of buzzerplayer.h */
+} note_t;
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+static char g_pText[TEXT_SIZE_MAX];
+static note_t g_pNote[NOTE_MAX];
+static uint32_t g_dwNotes;
+static uint32_t g_dwBpm = 63;
+static uint8_t g_pbyOut[HEADER_SIZE + NOTE_MAX * 2];
+static uint8_t g_pbyShort[3];               /* Durations of 1-byte notes */
+static uint8_t g_byShortCount;
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static int ReadText(const char *pPath);
+static int Parse(void);
+static uint8_t DurationCode(uint32_t dwDuration);
+static uint32_t Encode(void);
+static uint32_t NoteTicks(uint8_t byDuration);
+static void NoteTimer(uint8_t byNote, uint32_t *pdwPrescaler, uint32_t *pdwPeriod);
+static int WriteWav(const char *pPath);
+static void PrintArray(const char *pName, const char *pSource, uint32_t dwSize);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func   main
+ * @brief  buzzer_rtttl <melody.txt> <array name> [-w out.wav]
+ *         C source is written to stdout, sizes to stderr
+ * @param  argc, argv: command line
+ * @retval 0 if done
+ */
+int
+main(
+    int argc,
+    char **argv
+) {
+    const char *pWav = NULL;
+    uint32_t dwSize;
+
+    if ((argc == 5) && (strcmp(argv[3], "-w") == 0)) {
+        pWav = argv[4];
+    } else if (argc != 3) {
+        fprintf(stderr, "usage: %s <melody.txt> <array name> [-w out.wav]\n", argv[0]);
+        return 1;
+    }
+
+    if (!ReadText(argv[1]) || !Parse()) {
+        return 1;
+    }
+
+    dwSize = Encode();
+    PrintArray(argv[2], argv[1], dwSize);
+
+    /* tone_t list is 4 bytes a note and 4 bytes of end */
+    fprintf(stderr, "%u notes: %u bytes, %u bytes as tone_t (%u%% saved)\n",
+            g_dwNotes, dwSize, g_dwNotes * 4 + 4,
+            100 - dwSize * 100 / (g_dwNotes * 4 + 4));
+
+    if ((pWav != NULL) && !WriteWav(pWav)) {
+        return 1;
+    }
+
+    return 0;
+}
+
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+/**
+ * @func   ReadText
+ * @brief  Read melody, white space is dropped
+ * @param  pPath: file
+ * @retval 1 if done, 0 on error
+ */
+static int
+ReadText(
+    const char *pPath
+) {
+    FILE *pFile = fopen(pPath, "r");
+    uint32_t dwLength = 0;
+    int iChar;
+
+    if (pFile == NULL) {
+        fprintf(stderr, "cannot open %s\n", pPath);
+        return 0;
+    }
+
+    while (((iChar = fgetc(pFile)) != EOF) && (dwLength + 1 < TEXT_SIZE_MAX)) {
+        if (!isspace(iChar)) {
+            g_pText[dwLength++] = (char)tolower(iChar);
+        }
+    }
+    g_pText[dwLength] = '\0';
+
+    fclose(pFile);
+
+    return 1;
+}
+
+/**
+ * @func   Parse
+ * @brief  RTTTL: name:d=4,o=5,b=63:8e6,8d#6,4p,2a.5,...
+ * @param  None
+ * @retval 1 if done, 0 on error
+ */
+static int
+Parse(void)
+{
+    static const int8_t pSemitone[7] = { 9, 11, 0, 2, 4, 5, 7 };   /* a - g */
+    char *pText = strchr(g_pText, ':');
+    char *pEnd;
+    uint32_t dwDuration = 4;
+    uint32_t dwOctave = 5;
+    uint32_t dwNoteDuration;
+    uint32_t dwNoteOctave;
+    int iNote;
+    int bDotted;
+
+    if (pText == NULL) {
+        fprintf(stderr, "no ':' after name\n");
+        return 0;
+    }
+    pText++;
+
+    /* Defaults */
+    while ((*pText != '\0') && (*pText != ':')) {
+        if ((pText[0] == 'd') && (pText[1] == '=')) {
+            dwDuration = (uint32_t)strtoul(pText + 2, &pEnd, 10);
+        } else if ((pText[0] == 'o') && (pText[1] == '=')) {
+            dwOctave = (uint32_t)strtoul(pText + 2, &pEnd, 10);
+        } else if ((pText[0] == 'b') && (pText[1] == '=')) {
+            g_dwBpm = (uint32_t)strtoul(pText + 2, &pEnd, 10);
+        } else {
+            fprintf(stderr, "bad default at '%.8s'\n", pText);
+            return 0;
+        }
+        pText = (*pEnd == ',') ? pEnd + 1 : pEnd;
+    }
+
+    if ((*pText != ':') || (g_dwBpm == 0) || (g_dwBpm > 0xFFFF)) {
+        fprintf(stderr, "bad defaults\n");
+        return 0;
+    }
+    pText++;
+
+    /* Notes */
+    while (*pText != '\0') {
+        if (g_dwNotes >= NOTE_MAX) {
+            fprintf(stderr, "more than %u notes\n", NOTE_MAX);
+            return 0;
+        }
+
+        dwNoteDuration = (uint32_t)strtoul(pText, &pEnd, 10);
+        if (pEnd == pText) {
+            dwNoteDuration = dwDuration;
+        }
+        pText = pEnd;
+
+        if (*pText == 'p') {
+            iNote = -1;
+        } else if ((*pText >= 'a') && (*pText <= 'h')) {
+            iNote = (*pText == 'h') ? 11 : pSemitone[*pText - 'a'];
+        } else {
+            fprintf(stderr, "bad note at '%.8s'\n", pText);
+            return 0;
+        }
+        pText++;
+
+        if (*pText == '#') {
+            iNote++;
+            pText++;
+        }
+
+        bDotted = 0;
+        if (*pText == '.') {
+            bDotted = 1;
+            pText++;
+        }
+
+        dwNoteOctave = (uint32_t)strtoul(pText, &pEnd, 10);
+        if (pEnd == pText) {
+            dwNoteOctave = dwOctave;
+        }
+        pText = pEnd;
+
+        if (*pText == '.') {
+            bDotted = 1;
+            pText++;
+        }
+
+        if (*pText == ',') {
+            pText++;
+        }
+
+        g_pNote[g_dwNotes].byDuration = DurationCode(dwNoteDuration);
+        if (g_pNote[g_dwNotes].byDuration == 0xFF) {
+            fprintf(stderr, "bad duration %u\n", dwNoteDuration);
+            return 0;
+        }
+        if (bDotted) {
+            g_pNote[g_dwNotes].byDuration |= DURATION_DOTTED;
+        }
+
+        if (iNote < 0) {
+            g_pNote[g_dwNotes].byNote = NOTE_REST;
+        } else {
+            iNote += (int)(dwNoteOctave - 1) * 12;
+            if ((iNote < 0) || (iNote >= (int)NOTE_COUNT)) {
+                fprintf(stderr, "note %u is out of C1 - B8\n", g_dwNotes + 1);
+                return 0;
+            }
+            g_pNote[g_dwNotes].byNote = (uint8_t)iNote;
+        }
+
+        g_dwNotes++;
+    }
+
+    if (g_dwNotes == 0) {
+        fprintf(stderr, "no note\n");
+        return 0;
+    }
+
+    return 1;
+}
+
+/**
+ * @func   DurationCode
+ * @brief  Code of a note duration 1, 2, 4 ... 128
+ * @param  dwDuration: 1 / dwDuration of whole note
+ * @retval Code, 0xFF if not a power of 2
+ */
+static uint8_t
+DurationCode(
+    uint32_t dwDuration
+) {
+    uint8_t byCode;
+
+    for (byCode = 0; byCode < 8; byCode++) {
+        if (dwDuration == (1u << byCode)) {
+            return byCode;
+        }
+    }
+
+    return 0xFF;
+}
+
+/**
+ * @func   Encode
+ * @brief  Header, then notes. The three most used durations take 1 byte
+ * @param  None
+ * @retval Size of compact melody
+ */
+static uint32_t
+Encode(void)
+{
+    uint32_t pdwCount[DURATION_CODES] = { 0 };
+    uint32_t dwSize = HEADER_SIZE;
+    uint32_t i;
+    uint8_t byLowest = NOTE_COUNT;
+    uint8_t byHighest = 0;
+    uint8_t byCode;
+    uint8_t byBest;
+    uint8_t j;
+
+    for (i = 0; i < g_dwNotes; i++) {
+        pdwCount[g_pNote[i].byDuration]++;
+        if (g_pNote[i].byNote != NOTE_REST) {
+            if (g_pNote[i].byNote < byLowest) {
+                byLowest = g_pNote[i].byNote;
+            }
+            if (g_pNote[i].byNote > byHighest) {
+                byHighest = g_pNote[i].byNote;
+            }
+        }
+    }
+
+    if (byLowest == NOTE_COUNT) {
+        byLowest = 0;
+    } else if ((uint32_t)(byHighest - byLowest) >= NOTE_RANGE) {
+        fprintf(stderr, "notes span more than %u semitones\n", NOTE_RANGE);
+        exit(1);
+    }
+
+    memset(g_pbyShort, 0, sizeof(g_pbyShort));
+    for (g_byShortCount = 0; g_byShortCount < 3; g_byShortCount++) {
+        byBest = 0;
+        for (j = 1; j < DURATION_CODES; j++) {
+            if (pdwCount[j] > pdwCount[byBest]) {
+                byBest = j;
+            }
+        }
+        if (pdwCount[byBest] == 0) {
+            break;
+        }
+        g_pbyShort[g_byShortCount] = byBest;
+        pdwCount[byBest] = 0;
+    }
+
+    g_pbyOut[0] = (uint8_t)g_dwNotes;
+    g_pbyOut[1] = (uint8_t)(g_dwNotes >> 8);
+    g_pbyOut[2] = (uint8_t)g_dwBpm;
+    g_pbyOut[3] = (uint8_t)(g_dwBpm >> 8);
+    g_pbyOut[4] = byLowest;
+    memcpy(&g_pbyOut[5], g_pbyShort, sizeof(g_pbyShort));
+
+    for (i = 0; i < g_dwNotes; i++) {
+        byCode = DURATION_NEXT;
+        for (j = 0; j < g_byShortCount; j++) {
+            if (g_pbyShort[j] == g_pNote[i].byDuration) {
+                byCode = j;
+                break;
+            }
+        }
+
+        g_pbyOut[dwSize] = (uint8_t)(byCode << 6);
+        if (g_pNote[i].byNote != NOTE_REST) {
+            g_pbyOut[dwSize] |= (uint8_t)(g_pNote[i].byNote - byLowest + 1);
+        }
+        dwSize++;
+
+        if (byCode == DURATION_NEXT) {
+            g_pbyOut[dwSize++] = g_pNote[i].byDuration;
+        }
+    }
+
+    return dwSize;
+}
+
+/**
+ * @func   NoteTicks
+ * @brief  Length of a note on note timer of the player, at written tempo
+ * @param  byDuration: code
+ * @retval Ticks of 0.1 ms
+ */
+static uint32_t
+NoteTicks(
+    uint8_t byDuration
+) {
+    uint32_t dwTicks = (4u * 60u * NOTE_TIM_HZ / g_dwBpm) >> (byDuration & 0x07);
+
+    if (byDuration & DURATION_DOTTED) {
+        dwTicks += dwTicks >> 1;
+    }
+
+    if (dwTicks == 0) {
+        dwTicks = 1;
+    }
+
+    return (dwTicks > NOTE_TICK_MAX) ? NOTE_TICK_MAX : dwTicks;
+}
+
+/**
+ * @func   NoteTimer
+ * @brief  PSC / ARR of a note, as BUZZER_NOTE of the player
+ * @param  byNote: semitones above C1
+ * @param  pdwPrescaler: PSC
+ * @param  pdwPeriod: ARR
+ * @retval None
+ */
+static void
+NoteTimer(
+    uint8_t byNote,
+    uint32_t *pdwPrescaler,
+    uint32_t *pdwPeriod
+) {
+    uint32_t dwFreq10 = (uint32_t)lround(4400.0 * pow(2.0, ((int)byNote - 45) / 12.0));
+    uint32_t dwCycles = (uint32_t)((TIM_HZ * 10ull) / dwFreq10);
+
+    *pdwPrescaler = dwCycles / 0x10000u;
+    *pdwPeriod = dwCycles / (*pdwPrescaler + 1) - 1;
+}
+
+/**
+ * @func   WriteWav
+ * @brief  Render PWM output at 50% duty as 16-bit mono WAV, report pitch
+ *         error and length of melody
+ * @param  pPath: file
+ * @retval 1 if done, 0 on error
+ */
+static int
+WriteWav(
+    const char *pPath
+) {
+    FILE *pFile = fopen(pPath, "wb");
+    uint8_t pbyHeader[44];
+    uint32_t dwSamples = 0;
+    uint32_t dwTicks = 0;
+    uint32_t dwPrescaler;
+    uint32_t dwPeriod;
+    uint32_t dwEnd;
+    uint32_t dwData;
+    uint32_t i;
+    double fPeriod;
+    double fPhase = 0;
+    double fError;
+    double fErrorMax = 0;
+    int16_t iSample;
+
+    if (pFile == NULL) {
+        fprintf(stderr, "cannot create %s\n", pPath);
+        return 0;
+    }
+
+    /* Header is written when number of samples is known */
+    fwrite(pbyHeader, 1, sizeof(pbyHeader), pFile);
+
+    for (i = 0; i < g_dwNotes; i++) {
+        dwTicks += NoteTicks(g_pNote[i].byDuration);
+        dwEnd = (uint32_t)((uint64_t)dwTicks * WAV_RATE / NOTE_TIM_HZ);
+
+        fPeriod = 0;
+        if (g_pNote[i].byNote != NOTE_REST) {
+            NoteTimer(g_pNote[i].byNote, &dwPrescaler, &dwPeriod);
+            fPeriod = (double)(dwPrescaler + 1) * (dwPeriod + 1) / TIM_HZ;
+            fError = fabs(1.0 / fPeriod / (440.0 * pow(2.0, ((int)g_pNote[i].byNote - 45) / 12.0)) - 1.0);
+            if (fError > fErrorMax) {
+                fErrorMax = fError;
+            }
+        }
+
+        for (; dwSamples < dwEnd; dwSamples++) {
+            iSample = 0;
+            if (fPeriod > 0) {
+                iSample = (fPhase < 0.5) ? 8000 : -8000;
+                fPhase += 1.0 / (fPeriod * WAV_RATE);
+                fPhase -= floor(fPhase);
+            }
+            fputc(iSample & 0xFF, pFile);
+            fputc((iSample >> 8) & 0xFF, pFile);
+        }
+    }
+
+    dwData = dwSamples * 2;
+    memcpy(&pbyHeader[0], "RIFF", 4);
+    pbyHeader[4] = (uint8_t)(dwData + 36);
+    pbyHeader[5] = (uint8_t)((dwData + 36) >> 8);
+    pbyHeader[6] = (uint8_t)((dwData + 36) >> 16);
+    pbyHeader[7] = (uint8_t)((dwData + 36) >> 24);
+    memcpy(&pbyHeader[8], "WAVEfmt ", 8);
+    memcpy(&pbyHeader[16], "\x10\x00\x00\x00\x01\x00\x01\x00", 8);
+    pbyHeader[24] = (uint8_t)WAV_RATE;
+    pbyHeader[25] = (uint8_t)(WAV_RATE >> 8);
+    pbyHeader[26] = 0;
+    pbyHeader[27] = 0;
+    pbyHeader[28] = (uint8_t)(WAV_RATE * 2);
+    pbyHeader[29] = (uint8_t)((WAV_RATE * 2) >> 8);
+    pbyHeader[30] = (uint8_t)((WAV_RATE * 2) >> 16);
+    pbyHeader[31] = 0;
+    memcpy(&pbyHeader[32], "\x02\x00\x10\x00", 4);
+    memcpy(&pbyHeader[36], "data", 4);
+    pbyHeader[40] = (uint8_t)dwData;
+    pbyHeader[41] = (uint8_t)(dwData >> 8);
+    pbyHeader[42] = (uint8_t)(dwData >> 16);
+    pbyHeader[43] = (uint8_t)(dwData >> 24);
+
+    fseek(pFile, 0, SEEK_SET);
+    fwrite(pbyHeader, 1, sizeof(pbyHeader), pFile);
+    fclose(pFile);
+
+    fprintf(stderr, "%s: %u ms, pitch error up to %.3f%%\n",
+            pPath, dwTicks / (NOTE_TIM_HZ / 1000u), fErrorMax * 100);
+
+    return 1;
+}
+
+/**
+ * @func   PrintArray
+ * @brief  Write compact melody as C source
+ * @param  pName: name of array
+ * @param  pSource: name of input
+ * @param  dwSize: number of bytes
+ * @retval None
+ */
+static void
+PrintArray(
+    const char *pName,
+    const char *pSource,
+    uint32_t dwSize
+) {
+    uint32_t i;
+
+    printf("/* Generated by buzzer_rtttl from %s, played by BuzzerPlayer_PlayCompact */\n", pSource);
+    printf("#include <stdint.h>\n\n");
+    printf("const uint8_t %s[%u] = {", pName, dwSize);
+
+    for (i = 0; i < dwSize; i++) {
+        printf(((i % 12) == 0) ? "\n    " : " ");
+        printf("0x%02X%s", g_pbyOut[i], (i + 1 < dwSize) ? "," : "");
+    }
+
+    printf("\n};\n");
+}
+
+/* END FILE */
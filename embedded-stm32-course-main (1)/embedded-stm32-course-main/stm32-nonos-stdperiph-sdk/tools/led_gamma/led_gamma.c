@@ -0,0 +1,117 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Host tool, generate gamma table of led colors used by
+ *              LedColor_* (Middle/led/ledcolor.c)
+ *
+ *                gcc -o led_gamma led_gamma.c -lm
+ *                ./led_gamma [gamma] > ../../shared/Middle/led/ledgamma.c
+ *
+ *              gamma: exponent of eye response, 2.2 if not given
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <math.h>
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define GAMMA_DEFAULT                       2.2
+#define GAMMA_INPUTS                        256u
+#define GAMMA_OUTPUT_MAX                    65535u
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+static uint16_t g_pwTable[GAMMA_INPUTS];
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static void PrintArray(double fGamma);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func   main
+ * @brief  led_gamma [gamma], C source is written to stdout
+ * @param  argc, argv: command line
+ * @retval 0 if done
+ */
+int
+main(
+    int argc,
+    char **argv
+) {
+    double fGamma = GAMMA_DEFAULT;
+    uint32_t i;
+
+    if (argc > 2) {
+        fprintf(stderr, "usage: %s [gamma]\n", argv[0]);
+        return 1;
+    }
+
+    if (argc == 2) {
+        fGamma = atof(argv[1]);
+        if ((fGamma < 1.0) || (fGamma > 4.0)) {
+            fprintf(stderr, "gamma %s is out of 1.0 - 4.0\n", argv[1]);
+            return 1;
+        }
+    }
+
+    /* Light output in 1/65535 of full duty for each 8-bit input */
+    for (i = 0; i < GAMMA_INPUTS; i++) {
+        g_pwTable[i] = (uint16_t)(pow((double)i / (GAMMA_INPUTS - 1), fGamma) *
+                                  GAMMA_OUTPUT_MAX + 0.5);
+    }
+
+    PrintArray(fGamma);
+
+    return 0;
+}
+
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+/**
+ * @func   PrintArray
+ * @brief  Write table as C source
+ * @param  fGamma: exponent of table
+ * @retval None
+ */
+static void
+PrintArray(
+    double fGamma
+) {
+    uint32_t i;
+
+    printf("/* Generated by led_gamma, gamma %.2f, used by LedColor_* */\n", fGamma);
+    printf("#include <stdint.h>\n\n");
+    printf("const uint16_t g_pwLedGamma[%u] = {", GAMMA_INPUTS);
+
+    for (i = 0; i < GAMMA_INPUTS; i++) {
+        printf(((i % 8) == 0) ? "\n    " : " ");
+        printf("%5u%s", g_pwTable[i], (i + 1 < GAMMA_INPUTS) ? "," : "");
+    }
+
+    printf("\n};\n");
+}
+
+/* END FILE */
@@ -0,0 +1,251 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Host tool, keep only some glyphs of a ucglib font. Output is
+ *              a C array in the same font format, usable by ucg_SetFont
+ *
+ *              Fonts of libLibraries.a are in sections .rodata.<font name>:
+ *                arm-none-eabi-objcopy -O binary
+ *                    --only-section=.rodata.ucg_font_7x13B_tf
+ *                    ucg_pixel_font_data.o font.bin
+ *                gcc -o ucg_font_subset ucg_font_subset.c
+ *                ./ucg_font_subset font.bin ucg_font_7x13B_digits "0-9.:%C "
+ *                    > ucg_font_7x13B_digits.c
+ *
+ *              Add the .c file to project and use the new name instead of
+ *              the original font, only the kept glyphs are linked.
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define FONT_SIZE_MAX                       65536u
+#define FONT_HEADER_SIZE                    21u
+#define FONT_OFFSET_GLYPH_CNT               0u
+#define FONT_OFFSET_START_UPPER_A           17u
+#define FONT_OFFSET_START_LOWER_A           19u
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+static uint8_t g_pbyFont[FONT_SIZE_MAX];
+static uint8_t g_pbySubset[FONT_SIZE_MAX];
+static uint8_t g_pbKeep[256];
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static void ParseCharset(const char *pCharset);
+static uint32_t MakeSubset(uint32_t dwFontSize, uint32_t *pdwGlyphCount);
+static void PrintArray(const char *pName, const char *pSource, const char *pCharset,
+                       uint32_t dwSize);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func   main
+ * @brief  ucg_font_subset <font.bin> <array name> <characters>
+ *         Characters are listed as is, "a-z" is a range. C source is
+ *         written to stdout, sizes to stderr
+ * @param  argc, argv: command line
+ * @retval 0 if done
+ */
+int
+main(
+    int argc,
+    char **argv
+) {
+    FILE *pFile;
+    uint32_t dwFontSize;
+    uint32_t dwSubsetSize;
+    uint32_t dwGlyphCount;
+
+    if (argc != 4) {
+        fprintf(stderr, "usage: %s <font.bin> <array name> <characters>\n", argv[0]);
+        return 1;
+    }
+
+    pFile = fopen(argv[1], "rb");
+    if (pFile == NULL) {
+        fprintf(stderr, "cannot open %s\n", argv[1]);
+        return 1;
+    }
+    dwFontSize = (uint32_t)fread(g_pbyFont, 1, sizeof(g_pbyFont), pFile);
+    fclose(pFile);
+
+    if (dwFontSize <= FONT_HEADER_SIZE) {
+        fprintf(stderr, "%s is not a ucglib font\n", argv[1]);
+        return 1;
+    }
+
+    ParseCharset(argv[3]);
+
+    dwSubsetSize = MakeSubset(dwFontSize, &dwGlyphCount);
+    if (dwSubsetSize == 0) {
+        fprintf(stderr, "%s: glyph table is broken\n", argv[1]);
+        return 1;
+    }
+
+    PrintArray(argv[2], argv[1], argv[3], dwSubsetSize);
+
+    fprintf(stderr, "%s: %u glyphs, %u -> %u bytes (%u bytes saved)\n",
+            argv[2], dwGlyphCount, dwFontSize, dwSubsetSize, dwFontSize - dwSubsetSize);
+
+    return 0;
+}
+
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+/**
+ * @func   ParseCharset
+ * @brief  Mark characters to keep
+ * @param  pCharset: characters, "x-y" for a range
+ * @retval None
+ */
+static void
+ParseCharset(
+    const char *pCharset
+) {
+    const uint8_t *pbyChar = (const uint8_t *)pCharset;
+    uint32_t i;
+
+    while (*pbyChar != '\0') {
+        if ((pbyChar[1] == '-') && (pbyChar[2] != '\0')) {
+            for (i = pbyChar[0]; i <= pbyChar[2]; i++) {
+                g_pbKeep[i] = 1;
+            }
+            pbyChar += 3;
+        } else {
+            g_pbKeep[*pbyChar] = 1;
+            pbyChar++;
+        }
+    }
+}
+
+/**
+ * @func   MakeSubset
+ * @brief  Copy header and kept glyphs. Glyphs are sorted by encoding, the
+ *         start of 'A' and 'a' point to first glyph not below them
+ * @param  dwFontSize: size of font data
+ * @param  pdwGlyphCount: number of glyphs kept
+ * @retval Size of subset, 0 on error
+ */
+static uint32_t
+MakeSubset(
+    uint32_t dwFontSize,
+    uint32_t *pdwGlyphCount
+) {
+    uint32_t dwIn = FONT_HEADER_SIZE;
+    uint32_t dwOut = FONT_HEADER_SIZE;
+    uint32_t dwUpper = 0xFFFFFFFFu;
+    uint32_t dwLower = 0xFFFFFFFFu;
+    uint8_t byEncoding;
+    uint8_t bySize;
+
+    memcpy(g_pbySubset, g_pbyFont, FONT_HEADER_SIZE);
+    *pdwGlyphCount = 0;
+
+    /* Glyph: encoding, size of glyph, bit stream. Size 0 ends the table */
+    for (;;) {
+        if (dwIn + 2 > dwFontSize) {
+            return 0;
+        }
+
+        byEncoding = g_pbyFont[dwIn];
+        bySize = g_pbyFont[dwIn + 1];
+        if (bySize == 0) {
+            break;
+        }
+        if (dwIn + bySize > dwFontSize) {
+            return 0;
+        }
+
+        if (g_pbKeep[byEncoding]) {
+            if ((byEncoding >= 'A') && (dwUpper == 0xFFFFFFFFu)) {
+                dwUpper = dwOut - FONT_HEADER_SIZE;
+            }
+            if ((byEncoding >= 'a') && (dwLower == 0xFFFFFFFFu)) {
+                dwLower = dwOut - FONT_HEADER_SIZE;
+            }
+            memcpy(&g_pbySubset[dwOut], &g_pbyFont[dwIn], bySize);
+            dwOut += bySize;
+            (*pdwGlyphCount)++;
+        }
+
+        dwIn += bySize;
+    }
+
+    /* Searches starting at end of table find nothing */
+    if (dwUpper == 0xFFFFFFFFu) {
+        dwUpper = dwOut - FONT_HEADER_SIZE;
+    }
+    if (dwLower == 0xFFFFFFFFu) {
+        dwLower = dwOut - FONT_HEADER_SIZE;
+    }
+
+    g_pbySubset[dwOut++] = 0x00;
+    g_pbySubset[dwOut++] = 0x00;
+
+    g_pbySubset[FONT_OFFSET_GLYPH_CNT] = (uint8_t)*pdwGlyphCount;
+    g_pbySubset[FONT_OFFSET_START_UPPER_A] = (uint8_t)(dwUpper >> 8);
+    g_pbySubset[FONT_OFFSET_START_UPPER_A + 1] = (uint8_t)dwUpper;
+    g_pbySubset[FONT_OFFSET_START_LOWER_A] = (uint8_t)(dwLower >> 8);
+    g_pbySubset[FONT_OFFSET_START_LOWER_A + 1] = (uint8_t)dwLower;
+
+    return dwOut;
+}
+
+/**
+ * @func   PrintArray
+ * @brief  Write subset as C source
+ * @param  pName: array name
+ * @param  pSource: file of original font
+ * @param  pCharset: characters kept
+ * @param  dwSize: size of subset
+ * @retval None
+ */
+static void
+PrintArray(
+    const char *pName,
+    const char *pSource,
+    const char *pCharset,
+    uint32_t dwSize
+) {
+    uint32_t i;
+
+    printf("/* Generated by ucg_font_subset from %s, characters \"%s\" */\n",
+           pSource, pCharset);
+    printf("#include \"ucg.h\"\n\n");
+    printf("const ucg_fntpgm_uint8_t %s[%u] UCG_FONT_SECTION(\"%s\") = {", pName, dwSize, pName);
+
+    for (i = 0; i < dwSize; i++) {
+        if ((i % 12) == 0) {
+            printf("\n    ");
+        }
+        printf("0x%02X%s", g_pbySubset[i], (i + 1 < dwSize) ? ", " : "");
+    }
+
+    printf("\n};\n");
+}
+
+/* END FILE */
@@ -0,0 +1,321 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Host tool, convert a binary PPM (P6) image into palette +
+ *              run-length data drawn by ucg_DrawImage (Ucglib_image.c)
+ *
+ *                convert icon.png icon.ppm
+ *                gcc -o ucg_image_conv ucg_image_conv.c
+ *                ./ucg_image_conv icon.ppm g_pbyIconWifi [-t FF00FF]
+ *                    > icon_wifi.c
+ *
+ *              -t: color drawn as transparent
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define IMAGE_SIZE_MAX                      255u
+#define PALETTE_SIZE_MAX                    256u
+#define SMALL_PALETTE                       16u
+#define RUN_MAX_SMALL                       16u
+#define RUN_MAX_LARGE                       256u
+#define FLAG_TRANSPARENT                    0x01u
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+static uint32_t g_dwWidth;
+static uint32_t g_dwHeight;
+static uint32_t g_pdwPixel[IMAGE_SIZE_MAX * IMAGE_SIZE_MAX];        /* 0xRRGGBB */
+static uint32_t g_pdwPalette[PALETTE_SIZE_MAX];
+static uint32_t g_dwColors;
+static uint8_t g_pbyIndex[IMAGE_SIZE_MAX * IMAGE_SIZE_MAX];
+static uint8_t g_pbyOut[4 + PALETTE_SIZE_MAX * 3 + IMAGE_SIZE_MAX * IMAGE_SIZE_MAX * 2];
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static int ReadNumber(FILE *pFile, uint32_t *pdwValue);
+static int ReadPpm(const char *pPath);
+static int MakePalette(int bTransparent, uint32_t dwTransparent);
+static uint32_t Encode(int bTransparent);
+static void PrintArray(const char *pName, const char *pSource, uint32_t dwSize);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func   main
+ * @brief  ucg_image_conv <image.ppm> <array name> [-t RRGGBB]
+ *         C source is written to stdout, sizes to stderr
+ * @param  argc, argv: command line
+ * @retval 0 if done
+ */
+int
+main(
+    int argc,
+    char **argv
+) {
+    int bTransparent = 0;
+    uint32_t dwTransparent = 0;
+    uint32_t dwSize;
+    uint32_t dwRaw;
+
+    if ((argc == 5) && (strcmp(argv[3], "-t") == 0)) {
+        bTransparent = 1;
+        dwTransparent = (uint32_t)strtoul(argv[4], NULL, 16);
+    } else if (argc != 3) {
+        fprintf(stderr, "usage: %s <image.ppm> <array name> [-t RRGGBB]\n", argv[0]);
+        return 1;
+    }
+
+    if (!ReadPpm(argv[1])) {
+        return 1;
+    }
+
+    if (!MakePalette(bTransparent, dwTransparent)) {
+        fprintf(stderr, "%s: more than %u colors\n", argv[1], PALETTE_SIZE_MAX);
+        return 1;
+    }
+
+    dwSize = Encode(bTransparent);
+    PrintArray(argv[2], argv[1], dwSize);
+
+    dwRaw = g_dwWidth * g_dwHeight * 2;
+    fprintf(stderr, "%s: %ux%u, %u colors, %u bytes (raw RGB565 %u bytes, %u%%)\n",
+            argv[2], g_dwWidth, g_dwHeight, g_dwColors, dwSize, dwRaw,
+            (dwSize * 100) / dwRaw);
+
+    return 0;
+}
+
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+/**
+ * @func   ReadNumber
+ * @brief  Read a decimal number of PPM header, comments are skipped
+ * @param  pFile: file
+ * @param  pdwValue: number
+ * @retval 1 if done, 0 on error
+ */
+static int
+ReadNumber(
+    FILE *pFile,
+    uint32_t *pdwValue
+) {
+    int iChar = fgetc(pFile);
+
+    while ((iChar == ' ') || (iChar == '\t') || (iChar == '\r') ||
+           (iChar == '\n') || (iChar == '#')) {
+        if (iChar == '#') {
+            while ((iChar != '\n') && (iChar != EOF)) {
+                iChar = fgetc(pFile);
+            }
+        }
+        iChar = fgetc(pFile);
+    }
+
+    if ((iChar < '0') || (iChar > '9')) {
+        return 0;
+    }
+
+    *pdwValue = 0;
+    while ((iChar >= '0') && (iChar <= '9')) {
+        *pdwValue = *pdwValue * 10 + (uint32_t)(iChar - '0');
+        iChar = fgetc(pFile);
+    }
+
+    /* One white space ends the header */
+    return 1;
+}
+
+/**
+ * @func   ReadPpm
+ * @brief  Read a binary PPM, 8 bits per channel
+ * @param  pPath: file
+ * @retval 1 if done, 0 on error
+ */
+static int
+ReadPpm(
+    const char *pPath
+) {
+    FILE *pFile = fopen(pPath, "rb");
+    uint8_t pbyRgb[3];
+    uint32_t dwMax;
+    uint32_t i;
+
+    if (pFile == NULL) {
+        fprintf(stderr, "cannot open %s\n", pPath);
+        return 0;
+    }
+
+    if ((fgetc(pFile) != 'P') || (fgetc(pFile) != '6') ||
+        !ReadNumber(pFile, &g_dwWidth) || !ReadNumber(pFile, &g_dwHeight) ||
+        !ReadNumber(pFile, &dwMax) || (dwMax != 255)) {
+        fprintf(stderr, "%s: not a binary PPM with 8 bits per channel\n", pPath);
+        fclose(pFile);
+        return 0;
+    }
+
+    if ((g_dwWidth == 0) || (g_dwHeight == 0) ||
+        (g_dwWidth > IMAGE_SIZE_MAX) || (g_dwHeight > IMAGE_SIZE_MAX)) {
+        fprintf(stderr, "%s: size must be 1 - %u\n", pPath, IMAGE_SIZE_MAX);
+        fclose(pFile);
+        return 0;
+    }
+
+    for (i = 0; i < g_dwWidth * g_dwHeight; i++) {
+        if (fread(pbyRgb, 1, 3, pFile) != 3) {
+            fprintf(stderr, "%s: truncated\n", pPath);
+            fclose(pFile);
+            return 0;
+        }
+        g_pdwPixel[i] = ((uint32_t)pbyRgb[0] << 16) | ((uint32_t)pbyRgb[1] << 8) | pbyRgb[2];
+    }
+
+    fclose(pFile);
+
+    return 1;
+}
+
+/**
+ * @func   MakePalette
+ * @brief  Index pixels by colors in order of appearance, transparent color
+ *         takes index 0
+ * @param  bTransparent: dwTransparent is used
+ * @param  dwTransparent: transparent color 0xRRGGBB
+ * @retval 1 if done, 0 if too many colors
+ */
+static int
+MakePalette(
+    int bTransparent,
+    uint32_t dwTransparent
+) {
+    uint32_t i;
+    uint32_t j;
+
+    g_dwColors = 0;
+    if (bTransparent) {
+        g_pdwPalette[g_dwColors++] = dwTransparent;
+    }
+
+    for (i = 0; i < g_dwWidth * g_dwHeight; i++) {
+        for (j = 0; j < g_dwColors; j++) {
+            if (g_pdwPalette[j] == g_pdwPixel[i]) {
+                break;
+            }
+        }
+
+        if (j == g_dwColors) {
+            if (g_dwColors == PALETTE_SIZE_MAX) {
+                return 0;
+            }
+            g_pdwPalette[g_dwColors++] = g_pdwPixel[i];
+        }
+
+        g_pbyIndex[i] = (uint8_t)j;
+    }
+
+    return 1;
+}
+
+/**
+ * @func   Encode
+ * @brief  Write header, palette and runs
+ * @param  bTransparent: index 0 is transparent
+ * @retval Size of image data
+ */
+static uint32_t
+Encode(
+    int bTransparent
+) {
+    uint32_t dwCount = g_dwWidth * g_dwHeight;
+    uint32_t dwRunMax = (g_dwColors <= SMALL_PALETTE) ? RUN_MAX_SMALL : RUN_MAX_LARGE;
+    uint32_t dwOut = 0;
+    uint32_t dwRun;
+    uint32_t i = 0;
+
+    g_pbyOut[dwOut++] = (uint8_t)g_dwWidth;
+    g_pbyOut[dwOut++] = (uint8_t)g_dwHeight;
+    g_pbyOut[dwOut++] = (uint8_t)g_dwColors;               /* 256 is stored as 0 */
+    g_pbyOut[dwOut++] = bTransparent ? FLAG_TRANSPARENT : 0;
+
+    for (i = 0; i < g_dwColors; i++) {
+        g_pbyOut[dwOut++] = (uint8_t)(g_pdwPalette[i] >> 16);
+        g_pbyOut[dwOut++] = (uint8_t)(g_pdwPalette[i] >> 8);
+        g_pbyOut[dwOut++] = (uint8_t)g_pdwPalette[i];
+    }
+
+    i = 0;
+    while (i < dwCount) {
+        dwRun = 1;
+        while ((i + dwRun < dwCount) && (dwRun < dwRunMax) &&
+               (g_pbyIndex[i + dwRun] == g_pbyIndex[i])) {
+            dwRun++;
+        }
+
+        if (g_dwColors <= SMALL_PALETTE) {
+            g_pbyOut[dwOut++] = (uint8_t)(((dwRun - 1) << 4) | g_pbyIndex[i]);
+        } else {
+            g_pbyOut[dwOut++] = (uint8_t)(dwRun - 1);
+            g_pbyOut[dwOut++] = g_pbyIndex[i];
+        }
+
+        i += dwRun;
+    }
+
+    return dwOut;
+}
+
+/**
+ * @func   PrintArray
+ * @brief  Write image data as C source
+ * @param  pName: array name
+ * @param  pSource: file of image
+ * @param  dwSize: size of image data
+ * @retval None
+ */
+static void
+PrintArray(
+    const char *pName,
+    const char *pSource,
+    uint32_t dwSize
+) {
+    uint32_t i;
+
+    printf("/* Generated by ucg_image_conv from %s, drawn by ucg_DrawImage */\n", pSource);
+    printf("#include <stdint.h>\n\n");
+    printf("const uint8_t %s[%u] = {", pName, dwSize);
+
+    for (i = 0; i < dwSize; i++) {
+        if ((i % 12) == 0) {
+            printf("\n    ");
+        }
+        printf("0x%02X%s", g_pbyOut[i], (i + 1 < dwSize) ? ", " : "");
+    }
+
+    printf("\n};\n");
+}
+
+/* END FILE */
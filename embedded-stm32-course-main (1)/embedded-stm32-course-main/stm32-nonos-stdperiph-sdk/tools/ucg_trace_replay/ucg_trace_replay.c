@@ -0,0 +1,536 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2026
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ *
+ * Description: Host tool, replay a trace of ucg_trace_Dump (Ucglib_trace.c)
+ *              on a model of ST7735 (132 x 162 RAM, glass of 128 x 128 from
+ *              column 2, row 1): the glass is written as binary PPM and
+ *              bytes / SPI time are reported per marked section
+ *
+ *                gcc -o ucg_trace_replay ucg_trace_replay.c
+ *                ./ucg_trace_replay trace.txt screen.ppm [SPI Hz]
+ *
+ *              trace.txt is the UART output of ucg_trace_Dump
+ *
+ * Author: HoangNH
+ *
+ * Last Changed By:  $Author: HoangNH $
+ * Revision:         $Revision: 1.0 $
+ * Last Changed:     $Date: 16/10/2026 $
+ *
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define TRACE_SIZE_MAX                      65536u
+#define TRACE_MARK                          0x80
+
+/* UCG_COM_MSG_xxx of ucg.h */
+#define COM_MSG_CHANGE_CS_LINE              14
+#define COM_MSG_CHANGE_CD_LINE              15
+#define COM_MSG_SEND_BYTE                   16
+#define COM_MSG_REPEAT_1_BYTE               17
+#define COM_MSG_REPEAT_3_BYTES              19
+#define COM_MSG_SEND_STR                    20
+#define COM_MSG_SEND_CD_DATA_SEQUENCE       21
+
+/* ST7735 */
+#define ST7735_CASET                        0x2A
+#define ST7735_RASET                        0x2B
+#define ST7735_RAMWR                        0x2C
+#define ST7735_VSCRDEF                      0x33
+#define ST7735_MADCTL                       0x36
+#define ST7735_VSCRSADD                     0x37
+#define ST7735_COLMOD                       0x3A
+#define ST7735_COLMOD_16BIT                 0x05
+#define ST7735_MADCTL_MY                    0x80
+#define ST7735_MADCTL_MX                    0x40
+#define ST7735_MADCTL_MV                    0x20
+
+#define RAM_COLUMNS                         132
+#define RAM_ROWS                            162
+#define GLASS_SIZE                          128     /* Rows and columns shown */
+#define GLASS_X                             2       /* RAM column of glass column 0 */
+#define GLASS_Y                             1       /* RAM row of glass row 0 */
+
+#define SPI_HZ_DEFAULT                      10500000u
+#define SECTION_MAX                         64u
+#define NAME_MAX_LENGTH                     32u
+
+typedef struct {
+    char pName[NAME_MAX_LENGTH + 1];
+    uint32_t dwCount;
+    uint32_t dwCmdBytes;
+    uint32_t dwDataBytes;
+    uint32_t dwCsToggles;
+} section_t;
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+static uint8_t g_pbyTrace[TRACE_SIZE_MAX];
+static uint32_t g_dwTraceSize;
+
+/* Controller: RAM in RGB, parameters of current command */
+static uint8_t g_pbyRam[RAM_ROWS][RAM_COLUMNS][3];
+static uint8_t g_byCd = 1;
+static uint8_t g_byCommand;
+static uint8_t g_pbyParam[8];
+static uint32_t g_dwParamCount;
+static uint8_t g_byMadctl;
+static uint8_t g_byColmod = 0x06;
+/* Column start, end, row start, end */
+static uint32_t g_pdwWindow[4] = { 0, RAM_COLUMNS - 1, 0, RAM_ROWS - 1 };
+static uint32_t g_dwColumn;
+static uint32_t g_dwRow;
+static uint8_t g_pbyPixel[3];
+static uint32_t g_dwPixelBytes;
+static uint32_t g_pdwScroll[3] = { 0, RAM_ROWS, 0 };
+static uint32_t g_dwScrollStart;
+
+static section_t g_pSection[SECTION_MAX];
+static uint32_t g_dwSectionCount = 1;
+static uint32_t g_dwCurrent;
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static int ReadTrace(const char *pPath);
+static int Replay(void);
+static void SetSection(const uint8_t *pbyName, uint32_t dwLength);
+static void Wire(uint8_t byData);
+static void WritePixel(void);
+static int WritePpm(const char *pPath);
+static void Report(uint32_t dwSpiHz);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+/**
+ * @func   main
+ * @brief  ucg_trace_replay <trace.txt> <screen.ppm> [SPI Hz]
+ * @param  argc, argv: command line
+ * @retval 0 if done
+ */
+int
+main(
+    int argc,
+    char **argv
+) {
+    uint32_t dwSpiHz = SPI_HZ_DEFAULT;
+
+    if ((argc != 3) && (argc != 4)) {
+        fprintf(stderr, "usage: %s <trace.txt> <screen.ppm> [SPI Hz]\n", argv[0]);
+        return 1;
+    }
+
+    if (argc == 4) {
+        dwSpiHz = (uint32_t)strtoul(argv[3], NULL, 10);
+        if (dwSpiHz == 0) {
+            dwSpiHz = SPI_HZ_DEFAULT;
+        }
+    }
+
+    if (!ReadTrace(argv[1])) {
+        return 1;
+    }
+
+    if (!Replay()) {
+        fprintf(stderr, "%s: trace is broken\n", argv[1]);
+        return 1;
+    }
+
+    if (!WritePpm(argv[2])) {
+        return 1;
+    }
+
+    Report(dwSpiHz);
+
+    return 0;
+}
+
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+/**
+ * @func   ReadTrace
+ * @brief  Read hex bytes, lines starting with '#' and other text are skipped
+ * @param  pPath: file
+ * @retval 1 if done, 0 on error
+ */
+static int
+ReadTrace(
+    const char *pPath
+) {
+    FILE *pFile = fopen(pPath, "r");
+    char pLine[256];
+    char *pText;
+    char *pEnd;
+    unsigned long dwValue;
+
+    if (pFile == NULL) {
+        fprintf(stderr, "cannot open %s\n", pPath);
+        return 0;
+    }
+
+    while (fgets(pLine, sizeof(pLine), pFile) != NULL) {
+        if (pLine[0] == '#') {
+            if (strstr(pLine, "overflow") != NULL) {
+                fprintf(stderr, "%s: trace overflowed, replay is partial\n", pPath);
+            }
+            continue;
+        }
+
+        pText = pLine;
+        for (;;) {
+            dwValue = strtoul(pText, &pEnd, 16);
+            if ((pEnd == pText) || (dwValue > 0xFF) || (g_dwTraceSize >= TRACE_SIZE_MAX)) {
+                break;
+            }
+            g_pbyTrace[g_dwTraceSize++] = (uint8_t)dwValue;
+            pText = pEnd;
+        }
+    }
+
+    fclose(pFile);
+
+    return 1;
+}
+
+/**
+ * @func   Replay
+ * @brief  Feed records to the controller model
+ * @param  None
+ * @retval 1 if done, 0 if a record is cut
+ */
+static int
+Replay(void)
+{
+    uint32_t dwPos = 0;
+    uint32_t dwLength;
+    uint32_t i;
+    uint8_t byMsg;
+    uint16_t wArg;
+    const uint8_t *pbyData;
+
+    strcpy(g_pSection[0].pName, "other");
+
+    while (dwPos + 3 <= g_dwTraceSize) {
+        byMsg = g_pbyTrace[dwPos];
+        wArg = (uint16_t)(g_pbyTrace[dwPos + 1] | (g_pbyTrace[dwPos + 2] << 8));
+        pbyData = &g_pbyTrace[dwPos + 3];
+
+        dwLength = 0;
+        if ((byMsg == TRACE_MARK) || (byMsg == COM_MSG_SEND_STR)) {
+            dwLength = wArg;
+        } else if ((byMsg >= COM_MSG_REPEAT_1_BYTE) && (byMsg <= COM_MSG_REPEAT_3_BYTES)) {
+            dwLength = (uint32_t)(byMsg - COM_MSG_REPEAT_1_BYTE + 1);
+        } else if (byMsg == COM_MSG_SEND_CD_DATA_SEQUENCE) {
+            dwLength = (uint32_t)wArg * 2;
+        }
+
+        if (dwPos + 3 + dwLength > g_dwTraceSize) {
+            return 0;
+        }
+
+        switch (byMsg) {
+        case TRACE_MARK:
+            SetSection(pbyData, dwLength);
+            break;
+
+        case COM_MSG_CHANGE_CS_LINE:
+            g_pSection[g_dwCurrent].dwCsToggles++;
+            break;
+
+        case COM_MSG_CHANGE_CD_LINE:
+            g_byCd = (uint8_t)wArg;
+            break;
+
+        case COM_MSG_SEND_BYTE:
+            Wire((uint8_t)wArg);
+            break;
+
+        case COM_MSG_SEND_STR:
+            for (i = 0; i < dwLength; i++) {
+                Wire(pbyData[i]);
+            }
+            break;
+
+        case COM_MSG_SEND_CD_DATA_SEQUENCE:
+            for (i = 0; i < wArg; i++) {
+                if (pbyData[i * 2] != 0) {
+                    g_byCd = (pbyData[i * 2] == 1) ? 0 : 1;
+                }
+                Wire(pbyData[i * 2 + 1]);
+            }
+            break;
+
+        default:
+            if ((byMsg >= COM_MSG_REPEAT_1_BYTE) && (byMsg <= COM_MSG_REPEAT_3_BYTES)) {
+                for (i = 0; i < (uint32_t)wArg * dwLength; i++) {
+                    Wire(pbyData[i % dwLength]);
+                }
+            }
+            break;
+        }
+
+        dwPos += 3 + dwLength;
+    }
+
+    return dwPos == g_dwTraceSize;
+}
+
+/**
+ * @func   SetSection
+ * @brief  Count next bytes in a section, found or added by name
+ * @param  pbyName: name, not terminated. Empty for "other"
+ * @param  dwLength: length of name
+ * @retval None
+ */
+static void
+SetSection(
+    const uint8_t *pbyName,
+    uint32_t dwLength
+) {
+    char pName[NAME_MAX_LENGTH + 1];
+    uint32_t i;
+
+    g_dwCurrent = 0;
+    if (dwLength == 0) {
+        return;
+    }
+
+    if (dwLength > NAME_MAX_LENGTH) {
+        dwLength = NAME_MAX_LENGTH;
+    }
+    memcpy(pName, pbyName, dwLength);
+    pName[dwLength] = '\0';
+
+    for (i = 1; i < g_dwSectionCount; i++) {
+        if (strcmp(g_pSection[i].pName, pName) == 0) {
+            break;
+        }
+    }
+
+    if (i == g_dwSectionCount) {
+        if (g_dwSectionCount >= SECTION_MAX) {
+            return;
+        }
+        strcpy(g_pSection[i].pName, pName);
+        g_dwSectionCount++;
+    }
+
+    g_dwCurrent = i;
+    g_pSection[i].dwCount++;
+}
+
+/**
+ * @func   Wire
+ * @brief  A byte on SPI: command when CD is low, else parameter or pixel
+ * @param  byData: byte
+ * @retval None
+ */
+static void
+Wire(
+    uint8_t byData
+) {
+    uint32_t i;
+
+    if (g_byCd == 0) {
+        g_pSection[g_dwCurrent].dwCmdBytes++;
+        g_byCommand = byData;
+        g_dwParamCount = 0;
+        g_dwPixelBytes = 0;
+        if (byData == ST7735_RAMWR) {
+            g_dwColumn = g_pdwWindow[0];
+            g_dwRow = g_pdwWindow[2];
+        }
+        return;
+    }
+
+    g_pSection[g_dwCurrent].dwDataBytes++;
+
+    if (g_byCommand == ST7735_RAMWR) {
+        g_pbyPixel[g_dwPixelBytes++] = byData;
+        if (g_dwPixelBytes == ((g_byColmod == ST7735_COLMOD_16BIT) ? 2u : 3u)) {
+            WritePixel();
+            g_dwPixelBytes = 0;
+        }
+        return;
+    }
+
+    if (g_dwParamCount < sizeof(g_pbyParam)) {
+        g_pbyParam[g_dwParamCount++] = byData;
+    }
+
+    switch (g_byCommand) {
+    case ST7735_CASET:
+    case ST7735_RASET:
+        if (g_dwParamCount == 4) {
+            i = (g_byCommand == ST7735_CASET) ? 0 : 2;
+            g_pdwWindow[i] = ((uint32_t)g_pbyParam[0] << 8) | g_pbyParam[1];
+            g_pdwWindow[i + 1] = ((uint32_t)g_pbyParam[2] << 8) | g_pbyParam[3];
+        }
+        break;
+
+    case ST7735_MADCTL:
+        g_byMadctl = byData;
+        break;
+
+    case ST7735_COLMOD:
+        g_byColmod = byData & 0x07;
+        break;
+
+    case ST7735_VSCRDEF:
+        if ((g_dwParamCount & 1) == 0) {
+            i = g_dwParamCount / 2 - 1;
+            if (i < 3) {
+                g_pdwScroll[i] = ((uint32_t)g_pbyParam[i * 2] << 8) | g_pbyParam[i * 2 + 1];
+            }
+        }
+        break;
+
+    case ST7735_VSCRSADD:
+        if (g_dwParamCount == 2) {
+            g_dwScrollStart = ((uint32_t)g_pbyParam[0] << 8) | g_pbyParam[1];
+        }
+        break;
+
+    default:
+        break;
+    }
+}
+
+/**
+ * @func   WritePixel
+ * @brief  Store a pixel at address counter mapped by MADCTL, then advance
+ *         counter in address window
+ * @param  None
+ * @retval None
+ */
+static void
+WritePixel(void)
+{
+    uint32_t dwColumn = g_dwColumn;
+    uint32_t dwRow = g_dwRow;
+    uint32_t dwTemp;
+    uint8_t *pbyRgb;
+
+    if (g_byMadctl & ST7735_MADCTL_MV) {
+        dwTemp = dwColumn;
+        dwColumn = dwRow;
+        dwRow = dwTemp;
+    }
+    if (g_byMadctl & ST7735_MADCTL_MX) {
+        dwColumn = RAM_COLUMNS - 1 - dwColumn;
+    }
+    if (g_byMadctl & ST7735_MADCTL_MY) {
+        dwRow = RAM_ROWS - 1 - dwRow;
+    }
+
+    /* Out of RAM when window is past 131 x 161 */
+    if ((dwColumn < RAM_COLUMNS) && (dwRow < RAM_ROWS)) {
+        pbyRgb = g_pbyRam[dwRow][dwColumn];
+        if (g_byColmod == ST7735_COLMOD_16BIT) {
+            pbyRgb[0] = (uint8_t)(g_pbyPixel[0] & 0xF8);
+            pbyRgb[1] = (uint8_t)(((g_pbyPixel[0] << 5) | (g_pbyPixel[1] >> 3)) & 0xFC);
+            pbyRgb[2] = (uint8_t)(g_pbyPixel[1] << 3);
+        } else {
+            pbyRgb[0] = (uint8_t)(g_pbyPixel[0] & 0xFC);
+            pbyRgb[1] = (uint8_t)(g_pbyPixel[1] & 0xFC);
+            pbyRgb[2] = (uint8_t)(g_pbyPixel[2] & 0xFC);
+        }
+    }
+
+    if (g_dwColumn < g_pdwWindow[1]) {
+        g_dwColumn++;
+        return;
+    }
+
+    g_dwColumn = g_pdwWindow[0];
+    g_dwRow = (g_dwRow < g_pdwWindow[3]) ? g_dwRow + 1 : g_pdwWindow[2];
+}
+
+/**
+ * @func   WritePpm
+ * @brief  Write glass as binary PPM, rows of scroll area are taken from
+ *         scroll start address. Areas of VSCRDEF not adding up to the RAM
+ *         rows do not scroll
+ * @param  pPath: file
+ * @retval 1 if done, 0 on error
+ */
+static int
+WritePpm(
+    const char *pPath
+) {
+    FILE *pFile = fopen(pPath, "wb");
+    uint32_t dwTop = g_pdwScroll[0];
+    uint32_t dwHeight = g_pdwScroll[1];
+    uint32_t dwRow;
+    uint32_t i;
+
+    if (pFile == NULL) {
+        fprintf(stderr, "cannot create %s\n", pPath);
+        return 0;
+    }
+
+    fprintf(pFile, "P6\n%d %d\n255\n", GLASS_SIZE, GLASS_SIZE);
+
+    for (i = 0; i < GLASS_SIZE; i++) {
+        dwRow = i + GLASS_Y;
+        if ((g_pdwScroll[0] + g_pdwScroll[1] + g_pdwScroll[2] == RAM_ROWS) && (dwHeight > 0) &&
+            (dwRow >= dwTop) && (dwRow < dwTop + dwHeight) && (g_dwScrollStart >= dwTop)) {
+            dwRow = dwTop + (dwRow - dwTop + g_dwScrollStart - dwTop) % dwHeight;
+        }
+        fwrite(g_pbyRam[dwRow % RAM_ROWS][GLASS_X], 1, GLASS_SIZE * 3, pFile);
+    }
+
+    fclose(pFile);
+
+    return 1;
+}
+
+/**
+ * @func   Report
+ * @brief  Print counters of sections and time of their bytes on SPI
+ * @param  dwSpiHz: SPI clock
+ * @retval None
+ */
+static void
+Report(
+    uint32_t dwSpiHz
+) {
+    uint32_t dwTotal = 0;
+    uint32_t dwBytes;
+    uint32_t i;
+
+    printf("%-20s %8s %10s %10s %8s %10s\n",
+           "section", "count", "cmd", "data", "cs", "us");
+
+    for (i = 0; i < g_dwSectionCount; i++) {
+        dwBytes = g_pSection[i].dwCmdBytes + g_pSection[i].dwDataBytes;
+        dwTotal += dwBytes;
+        printf("%-20s %8u %10u %10u %8u %10u\n",
+               g_pSection[i].pName, g_pSection[i].dwCount,
+               g_pSection[i].dwCmdBytes, g_pSection[i].dwDataBytes,
+               g_pSection[i].dwCsToggles,
+               (uint32_t)(((uint64_t)dwBytes * 8 * 1000000u) / dwSpiHz));
+    }
+
+    printf("total %u bytes, %u us at %u Hz\n", dwTotal,
+           (uint32_t)(((uint64_t)dwTotal * 8 * 1000000u) / dwSpiHz), dwSpiHz);
+}
+
+/* END FILE */